@@ -0,0 +1,188 @@
+//  CBHBenchmark.h
+//  CBHGeometryKitBenchmarks
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** Values written as text, one per line in the format of the `NSStringFrom*()` functions. */
+typedef struct CBHBenchmarkText
+{
+	/** The lines, each ending with a newline. */
+	char *bytes;
+	NSUInteger length;
+
+	/** The start and length of each line, without its newline. */
+	const char * _Nonnull * _Nonnull lines;
+	NSUInteger *lineLengths;
+
+	/** Each line as a string. */
+	__unsafe_unretained NSString * _Nonnull * _Nonnull strings;
+	const void * _Nullable stringOwner;
+} CBHBenchmarkText;
+
+/** The inputs and outputs shared by every benchmark at one input size.
+ *
+ * Each array holds `count` elements, generated deterministically so runs on different machines measure the same work.
+ * `reals` holds four extra elements so a benchmark can read `reals[i + 3]`.
+ */
+typedef struct CBHBenchmarkData
+{
+	NSUInteger count;
+
+	CGFloat *reals;
+	NSUInteger *integers;
+	NSPoint *points;
+	NSPoint *otherPoints;
+	NSSize *sizes;
+	NSSize *otherSizes;
+	NSRect *rects;
+	NSRect *otherRects;
+	NSRange *ranges;
+	NSRange *otherRanges;
+
+	CBHBenchmarkText pointText;
+	CBHBenchmarkText sizeText;
+	CBHBenchmarkText rectText;
+	CBHBenchmarkText rangeText;
+
+	CGFloat *realResults;
+	NSUInteger *integerResults;
+	BOOL *boolResults;
+	NSPoint *pointResults;
+	NSSize *sizeResults;
+	NSRect *rectResults;
+	NSRange *rangeResults;
+} CBHBenchmarkData;
+
+/** Performs one operation on each of the `count` inputs.
+ *
+ * @param data          The inputs and outputs.
+ *
+ * @return              The number of input bytes read.
+ */
+typedef NSUInteger (*CBHBenchmarkFunction)(CBHBenchmarkData *data);
+
+/** A named benchmark. */
+typedef struct CBHBenchmark
+{
+	const char *name;
+	CBHBenchmarkFunction function;
+} CBHBenchmark;
+
+
+#pragma mark - Defining Benchmarks
+
+/** Defines a benchmark running _statement_ once for each index `i` and reading _bytes_ of input per operation. */
+#define CBH_BENCHMARK(name, bytes, statement) \
+	static NSUInteger _CBHBenchmark_##name(CBHBenchmarkData * const data) \
+	{ \
+		const NSUInteger count = data->count; \
+		for (NSUInteger i = 0; i < count; ++i) { statement; } \
+		return count * (bytes); \
+	}
+
+/** Defines a benchmark running _statement_ once for all `count` inputs and reading _bytes_ of input in total. */
+#define CBH_BENCHMARK_BATCH(name, bytes, statement) \
+	static NSUInteger _CBHBenchmark_##name(CBHBenchmarkData * const data) \
+	{ \
+		const NSUInteger count = data->count; \
+		statement; \
+		return (bytes); \
+	}
+
+/** An entry in a table of benchmarks defined with `CBH_BENCHMARK()` or `CBH_BENCHMARK_BATCH()`. */
+#define CBH_BENCHMARK_ENTRY(name) { #name, _CBHBenchmark_##name }
+
+
+#pragma mark - Benchmark Tables
+
+/**
+ * @name Benchmark Tables
+ *
+ * Each table covers the public functions of one header and ends with an entry whose name is `NULL`.
+ */
+
+extern const CBHBenchmark kCBHBenchmarks_NSPoint[];
+extern const CBHBenchmark kCBHBenchmarks_NSSize[];
+extern const CBHBenchmark kCBHBenchmarks_NSRect[];
+extern const CBHBenchmark kCBHBenchmarks_NSRange[];
+
+
+#pragma mark - Input Data
+
+/**
+ * @name Input Data
+ */
+
+/** Creates the inputs and outputs for an input size.
+ *
+ * @param count         The number of elements in each array.
+ *
+ * @return              The data, or `NULL` if the storage could not be allocated. Release it with
+ *                      `CBHBenchmarkData_destroy()`.
+ */
+CBHBenchmarkData * _Nullable CBHBenchmarkData_create(NSUInteger count);
+
+/** Releases the inputs and outputs.
+ *
+ * @param data          The data to release.
+ */
+void CBHBenchmarkData_destroy(CBHBenchmarkData * _Nullable data);
+
+
+#pragma mark - Measuring
+
+/**
+ * @name Measuring
+ */
+
+/** The measurements of one benchmark at one input size. */
+typedef struct CBHBenchmarkResult
+{
+	/** The median time per operation in nanoseconds. */
+	double nanosecondsPerOperation;
+
+	/** The fastest time per operation in nanoseconds. */
+	double minimumNanosecondsPerOperation;
+
+	/** The number of input bytes read per second at the median time. */
+	double bytesPerSecond;
+
+	/** The median number of processor cycles per operation, or a negative number when cycles cannot be counted. */
+	double cyclesPerOperation;
+
+	/** The number of operations in each sample. */
+	NSUInteger operationsPerSample;
+} CBHBenchmarkResult;
+
+/** Measures a benchmark.
+ *
+ * The benchmark runs once to warm up, then is repeated enough times for each sample to take at least _sampleTime_.
+ *
+ * @param benchmark     The benchmark to run.
+ * @param data          The inputs and outputs.
+ * @param samples       The number of samples to take.
+ * @param sampleTime    The minimum duration of a sample in seconds.
+ *
+ * @return              The measurements.
+ */
+CBHBenchmarkResult CBHBenchmark_measure(const CBHBenchmark *benchmark, CBHBenchmarkData *data, NSUInteger samples, double sampleTime);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,354 @@
+//  CBHBenchmark.m
+//  CBHGeometryKitBenchmarks
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHBenchmark.h"
+
+#import <CBHGeometryKit/NSPoint+CBHGeometryKit.h>
+#import <CBHGeometryKit/NSSize+CBHGeometryKit.h>
+#import <CBHGeometryKit/NSRect+CBHGeometryKit.h>
+#import <CBHGeometryKit/NSRange+CBHGeometryKit.h>
+
+#import <math.h>
+#import <stdlib.h>
+#import <string.h>
+#import <time.h>
+#import <unistd.h>
+
+#if defined(__linux__)
+#	import <linux/perf_event.h>
+#	import <sys/syscall.h>
+#endif
+
+
+enum { kCBHBenchmarkLineLength = 128 };
+
+
+#pragma mark - Generating Values
+
+// A 64-bit linear congruential generator, so every platform generates the same inputs.
+static double _CBHBenchmark_random(uint64_t * const state)
+{
+	*state = (*state * 6364136223846793005ULL) + 1442695040888963407ULL;
+	return (double)(*state >> 11) / 9007199254740992.0;
+}
+
+// Layout-like reals: multiples of a quarter between -1000 and 1000.
+static CGFloat _CBHBenchmark_randomReal(uint64_t * const state)
+{
+	return floor(_CBHBenchmark_random(state) * 8000.0) / 4.0 - 1000.0;
+}
+
+// Mostly positive sizes, with one in ten negative so the absolute and empty checks take both paths.
+static NSSize _CBHBenchmark_randomSize(uint64_t * const state)
+{
+	const CGFloat sign = ( _CBHBenchmark_random(state) < 0.1 ) ? -1.0 : 1.0;
+	const CGFloat width = floor(_CBHBenchmark_random(state) * 2000.0) / 4.0;
+	const CGFloat height = floor(_CBHBenchmark_random(state) * 2000.0) / 4.0;
+
+	return NSSize_init(sign * width, height);
+}
+
+static NSRange _CBHBenchmark_randomRange(uint64_t * const state)
+{
+	const NSUInteger location = (NSUInteger)(_CBHBenchmark_random(state) * 1000000.0);
+	const NSUInteger length = (NSUInteger)(_CBHBenchmark_random(state) * 1000.0);
+
+	return NSRange_init(location, length);
+}
+
+
+#pragma mark - Generating Text
+
+typedef NSUInteger (*_CBHBenchmarkDescriber)(const void *value, char *buffer, NSUInteger capacity);
+
+static NSUInteger _CBHBenchmark_describePoint(const void * const value, char * const buffer, const NSUInteger capacity) { return NSPoint_getDescription(*(const NSPoint *)value, buffer, capacity); }
+static NSUInteger _CBHBenchmark_describeSize(const void * const value, char * const buffer, const NSUInteger capacity) { return NSSize_getDescription(*(const NSSize *)value, buffer, capacity); }
+static NSUInteger _CBHBenchmark_describeRect(const void * const value, char * const buffer, const NSUInteger capacity) { return NSRect_getDescription(*(const NSRect *)value, buffer, capacity); }
+static NSUInteger _CBHBenchmark_describeRange(const void * const value, char * const buffer, const NSUInteger capacity) { return NSRange_getDescription(*(const NSRange *)value, buffer, capacity); }
+
+static BOOL _CBHBenchmarkText_init(CBHBenchmarkText * const text, const void * const values, const size_t stride, const NSUInteger count, const _CBHBenchmarkDescriber describe)
+{
+	text->bytes = malloc(count * kCBHBenchmarkLineLength);
+	text->lines = malloc(sizeof(char *) * count);
+	text->lineLengths = malloc(sizeof(NSUInteger) * count);
+	text->strings = (__unsafe_unretained NSString **)calloc(count, sizeof(NSString *));
+
+	if ( text->bytes == NULL || text->lines == NULL || text->lineLengths == NULL || text->strings == NULL ) { return NO; }
+
+	NSMutableArray<NSString *> *strings = [NSMutableArray arrayWithCapacity:count];
+	NSUInteger length = 0;
+
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		char * const line = text->bytes + length;
+		const NSUInteger lineLength = describe((const char *)values + (i * stride), line, kCBHBenchmarkLineLength - 1);
+
+		NSString *string = [[NSString alloc] initWithBytes:line length:lineLength encoding:NSUTF8StringEncoding];
+		[strings addObject:string];
+
+		text->lines[i] = line;
+		text->lineLengths[i] = lineLength;
+		text->strings[i] = string;
+
+		line[lineLength] = '\n';
+		length += lineLength + 1;
+	}
+
+	text->length = length;
+	text->stringOwner = (__bridge_retained const void *)strings;
+
+	return YES;
+}
+
+static void _CBHBenchmarkText_deinit(CBHBenchmarkText * const text)
+{
+	if ( text->stringOwner != NULL ) { (void)(__bridge_transfer NSArray *)text->stringOwner; }
+
+	free((void *)text->strings);
+	free(text->lineLengths);
+	free((void *)text->lines);
+	free(text->bytes);
+}
+
+
+#pragma mark - Input Data
+
+CBHBenchmarkData *CBHBenchmarkData_create(const NSUInteger count)
+{
+	CBHBenchmarkData *data = calloc(1, sizeof(CBHBenchmarkData));
+	if ( data == NULL ) { return NULL; }
+
+	data->count = count;
+
+	data->reals = malloc(sizeof(CGFloat) * (count + 4));
+	data->integers = malloc(sizeof(NSUInteger) * count);
+	data->points = malloc(sizeof(NSPoint) * count);
+	data->otherPoints = malloc(sizeof(NSPoint) * count);
+	data->sizes = malloc(sizeof(NSSize) * count);
+	data->otherSizes = malloc(sizeof(NSSize) * count);
+	data->rects = malloc(sizeof(NSRect) * count);
+	data->otherRects = malloc(sizeof(NSRect) * count);
+	data->ranges = malloc(sizeof(NSRange) * count);
+	data->otherRanges = malloc(sizeof(NSRange) * count);
+
+	data->realResults = malloc(sizeof(CGFloat) * count);
+	data->integerResults = malloc(sizeof(NSUInteger) * count);
+	data->boolResults = malloc(sizeof(BOOL) * count);
+	data->pointResults = malloc(sizeof(NSPoint) * count);
+	data->sizeResults = malloc(sizeof(NSSize) * count);
+	data->rectResults = malloc(sizeof(NSRect) * count);
+	data->rangeResults = malloc(sizeof(NSRange) * count);
+
+	if ( data->reals == NULL || data->integers == NULL || data->points == NULL || data->otherPoints == NULL || data->sizes == NULL
+	  || data->otherSizes == NULL || data->rects == NULL || data->otherRects == NULL || data->ranges == NULL || data->otherRanges == NULL
+	  || data->realResults == NULL || data->integerResults == NULL || data->boolResults == NULL || data->pointResults == NULL
+	  || data->sizeResults == NULL || data->rectResults == NULL || data->rangeResults == NULL )
+	{
+		CBHBenchmarkData_destroy(data);
+		return NULL;
+	}
+
+	uint64_t state = 0x43424847454f4dULL;
+
+	for (NSUInteger i = 0; i < count + 4; ++i) { data->reals[i] = _CBHBenchmark_randomReal(&state); }
+
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		data->integers[i] = (NSUInteger)(_CBHBenchmark_random(&state) * 1000000.0);
+
+		data->points[i] = NSPoint_init(_CBHBenchmark_randomReal(&state), _CBHBenchmark_randomReal(&state));
+		data->otherPoints[i] = NSPoint_init(_CBHBenchmark_randomReal(&state), _CBHBenchmark_randomReal(&state));
+
+		data->sizes[i] = _CBHBenchmark_randomSize(&state);
+		data->otherSizes[i] = _CBHBenchmark_randomSize(&state);
+
+		data->rects[i] = NSRect_initWithStructs(data->points[i], data->sizes[i]);
+		data->otherRects[i] = NSRect_initWithStructs(data->otherPoints[i], data->otherSizes[i]);
+
+		data->ranges[i] = _CBHBenchmark_randomRange(&state);
+		data->otherRanges[i] = _CBHBenchmark_randomRange(&state);
+	}
+
+	if ( !_CBHBenchmarkText_init(&data->pointText, data->points, sizeof(NSPoint), count, _CBHBenchmark_describePoint)
+	  || !_CBHBenchmarkText_init(&data->sizeText, data->sizes, sizeof(NSSize), count, _CBHBenchmark_describeSize)
+	  || !_CBHBenchmarkText_init(&data->rectText, data->rects, sizeof(NSRect), count, _CBHBenchmark_describeRect)
+	  || !_CBHBenchmarkText_init(&data->rangeText, data->ranges, sizeof(NSRange), count, _CBHBenchmark_describeRange) )
+	{
+		CBHBenchmarkData_destroy(data);
+		return NULL;
+	}
+
+	return data;
+}
+
+void CBHBenchmarkData_destroy(CBHBenchmarkData * const data)
+{
+	if ( data == NULL ) { return; }
+
+	_CBHBenchmarkText_deinit(&data->pointText);
+	_CBHBenchmarkText_deinit(&data->sizeText);
+	_CBHBenchmarkText_deinit(&data->rectText);
+	_CBHBenchmarkText_deinit(&data->rangeText);
+
+	free(data->reals);
+	free(data->integers);
+	free(data->points);
+	free(data->otherPoints);
+	free(data->sizes);
+	free(data->otherSizes);
+	free(data->rects);
+	free(data->otherRects);
+	free(data->ranges);
+	free(data->otherRanges);
+
+	free(data->realResults);
+	free(data->integerResults);
+	free(data->boolResults);
+	free(data->pointResults);
+	free(data->sizeResults);
+	free(data->rectResults);
+	free(data->rangeResults);
+
+	free(data);
+}
+
+
+#pragma mark - Counting Cycles
+
+// Cycles are counted with a per-thread hardware counter where the kernel allows it. Elsewhere, and when
+// `perf_event_paranoid` or a container forbids it, the counter is unavailable and no cycles are reported.
+
+static int _CBHBenchmark_cycleCounter(void)
+{
+	static int counter = -2;
+	if ( counter != -2 ) { return counter; }
+
+#if defined(__linux__)
+	struct perf_event_attr attributes;
+	memset(&attributes, 0, sizeof(attributes));
+
+	attributes.type = PERF_TYPE_HARDWARE;
+	attributes.size = sizeof(attributes);
+	attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+	attributes.exclude_kernel = 1;
+	attributes.exclude_hv = 1;
+
+	counter = (int)syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+	if ( counter < 0 ) { counter = -1; }
+#else
+	counter = -1;
+#endif
+
+	return counter;
+}
+
+static BOOL _CBHBenchmark_readCycles(const int counter, uint64_t * const cycles)
+{
+	if ( counter < 0 ) { return NO; }
+	return ( read(counter, cycles, sizeof(*cycles)) == (ssize_t)sizeof(*cycles) );
+}
+
+
+#pragma mark - Measuring
+
+static double _CBHBenchmark_now(void)
+{
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+
+	return (double)time.tv_sec + ((double)time.tv_nsec * 1e-9);
+}
+
+static int _CBHBenchmark_compareDoubles(const void * const a, const void * const b)
+{
+	const double lhs = *(const double *)a;
+	const double rhs = *(const double *)b;
+
+	return ( lhs > rhs ) - ( lhs < rhs );
+}
+
+static double _CBHBenchmark_median(double * const values, const NSUInteger count)
+{
+	qsort(values, count, sizeof(double), _CBHBenchmark_compareDoubles);
+
+	if ( count % 2 == 1 ) { return values[count / 2]; }
+	return (values[(count / 2) - 1] + values[count / 2]) / 2.0;
+}
+
+static NSUInteger _CBHBenchmark_run(const CBHBenchmark * const benchmark, CBHBenchmarkData * const data)
+{
+	@autoreleasepool
+	{
+		return benchmark->function(data);
+	}
+}
+
+CBHBenchmarkResult CBHBenchmark_measure(const CBHBenchmark * const benchmark, CBHBenchmarkData * const data, const NSUInteger samples, const double sampleTime)
+{
+	CBHBenchmarkResult result = { .cyclesPerOperation = -1.0 };
+
+	double * const times = malloc(sizeof(double) * samples);
+	double * const cycles = malloc(sizeof(double) * samples);
+	if ( times == NULL || cycles == NULL || samples == 0 )
+	{
+		free(times);
+		free(cycles);
+		return result;
+	}
+
+	_CBHBenchmark_run(benchmark, data);
+
+	const double start = _CBHBenchmark_now();
+	const NSUInteger bytes = _CBHBenchmark_run(benchmark, data);
+	const double duration = _CBHBenchmark_now() - start;
+
+	const NSUInteger repeats = ( duration >= sampleTime ) ? 1 : (NSUInteger)ceil(sampleTime / fmax(duration, 1e-9));
+	const double operations = (double)repeats * (double)data->count;
+
+	const int counter = _CBHBenchmark_cycleCounter();
+	BOOL hasCycles = ( counter >= 0 );
+
+	for (NSUInteger sample = 0; sample < samples; ++sample)
+	{
+		uint64_t startCycles = 0;
+		uint64_t endCycles = 0;
+
+		hasCycles = _CBHBenchmark_readCycles(counter, &startCycles) && hasCycles;
+		const double sampleStart = _CBHBenchmark_now();
+
+		for (NSUInteger repeat = 0; repeat < repeats; ++repeat) { _CBHBenchmark_run(benchmark, data); }
+
+		const double sampleEnd = _CBHBenchmark_now();
+		hasCycles = _CBHBenchmark_readCycles(counter, &endCycles) && hasCycles;
+
+		times[sample] = ((sampleEnd - sampleStart) * 1e9) / operations;
+		cycles[sample] = (double)(endCycles - startCycles) / operations;
+	}
+
+	result.nanosecondsPerOperation = _CBHBenchmark_median(times, samples);
+	result.minimumNanosecondsPerOperation = times[0];
+	result.bytesPerSecond = ((double)bytes / (double)data->count) * (1e9 / result.nanosecondsPerOperation);
+	result.operationsPerSample = (NSUInteger)operations;
+
+	if ( hasCycles ) { result.cyclesPerOperation = _CBHBenchmark_median(cycles, samples); }
+
+	free(times);
+	free(cycles);
+
+	return result;
+}
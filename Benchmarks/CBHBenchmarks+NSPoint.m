@@ -0,0 +1,118 @@
+//  CBHBenchmarks+NSPoint.m
+//  CBHGeometryKitBenchmarks
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHBenchmark.h"
+
+#import <CBHGeometryKit/NSPoint+CBHGeometryKit.h>
+
+
+#pragma mark - Creating Points
+
+CBH_BENCHMARK(NSPoint_init, 2 * sizeof(CGFloat), data->pointResults[i] = NSPoint_init(data->reals[i], data->reals[i + 1]))
+CBH_BENCHMARK_BATCH(NSPoint_initWithString, data->pointText.length, for (NSUInteger i = 0; i < count; ++i) { data->pointResults[i] = NSPoint_initWithString(data->pointText.strings[i]); })
+CBH_BENCHMARK(NSPoint_initZero, 0, data->pointResults[i] = NSPoint_initZero())
+
+
+#pragma mark - Parsing Points
+
+CBH_BENCHMARK_BATCH(NSPoint_initWithBytes, data->pointText.length, for (NSUInteger i = 0; i < count; ++i) { data->pointResults[i] = NSPoint_initWithBytes(data->pointText.lines[i], data->pointText.lineLengths[i], NULL, NULL); })
+CBH_BENCHMARK_BATCH(NSPoint_parseLines, data->pointText.length, NSPoint_parseLines(data->pointText.bytes, data->pointText.length, data->pointResults, NULL, count))
+
+
+#pragma mark - Checking Points
+
+CBH_BENCHMARK(NSPoint_isEqual, 2 * sizeof(NSPoint), data->boolResults[i] = NSPoint_isEqual(data->points[i], data->otherPoints[i]))
+
+
+#pragma mark - Derived Points
+
+CBH_BENCHMARK(NSPoint_truncate, sizeof(NSPoint), data->pointResults[i] = NSPoint_truncate(data->points[i]))
+CBH_BENCHMARK(NSPoint_round, sizeof(NSPoint), data->pointResults[i] = NSPoint_round(data->points[i]))
+CBH_BENCHMARK(NSPoint_shift, 2 * sizeof(NSPoint), data->pointResults[i] = NSPoint_shift(data->points[i], data->otherPoints[i]))
+CBH_BENCHMARK(NSPoint_shiftParametric, sizeof(NSPoint) + 2 * sizeof(CGFloat), data->pointResults[i] = NSPoint_shiftParametric(data->points[i], data->reals[i], data->reals[i + 1]))
+CBH_BENCHMARK(NSPoint_nearestPixel, sizeof(NSPoint), data->pointResults[i] = NSPoint_nearestPixel(data->points[i]))
+
+
+#pragma mark - Distance
+
+CBH_BENCHMARK(NSPoint_distance, 2 * sizeof(NSPoint), data->realResults[i] = NSPoint_distance(data->points[i], data->otherPoints[i]))
+CBH_BENCHMARK(NSPoint_distanceSquared, 2 * sizeof(NSPoint), data->realResults[i] = NSPoint_distanceSquared(data->points[i], data->otherPoints[i]))
+CBH_BENCHMARK(NSPoint_approximateDistance, 2 * sizeof(NSPoint), data->realResults[i] = NSPoint_approximateDistance(data->points[i], data->otherPoints[i]))
+
+
+#pragma mark - Batched Distance
+
+CBH_BENCHMARK_BATCH(NSPoint_distancesToPoints, count * sizeof(NSPoint), NSPoint_distancesToPoints(data->points[0], data->otherPoints, data->realResults, count))
+CBH_BENCHMARK_BATCH(NSPoint_distancesSquaredToPoints, count * sizeof(NSPoint), NSPoint_distancesSquaredToPoints(data->points[0], data->otherPoints, data->realResults, count))
+CBH_BENCHMARK_BATCH(NSPoint_distancesBetweenPoints, 2 * count * sizeof(NSPoint), NSPoint_distancesBetweenPoints(data->points, data->otherPoints, data->realResults, count))
+CBH_BENCHMARK_BATCH(NSPoint_distancesSquaredBetweenPoints, 2 * count * sizeof(NSPoint), NSPoint_distancesSquaredBetweenPoints(data->points, data->otherPoints, data->realResults, count))
+CBH_BENCHMARK_BATCH(NSPoint_approximateDistancesToPoints, count * sizeof(NSPoint), NSPoint_approximateDistancesToPoints(data->points[0], data->otherPoints, data->realResults, count))
+CBH_BENCHMARK_BATCH(NSPoint_approximateDistancesBetweenPoints, 2 * count * sizeof(NSPoint), NSPoint_approximateDistancesBetweenPoints(data->points, data->otherPoints, data->realResults, count))
+
+
+#pragma mark - Batched Reductions
+
+CBH_BENCHMARK_BATCH(NSPoint_extentsOfPoints, count * sizeof(NSPoint), NSPoint extents[2]; NSPoint_extentsOfPoints(data->points, count, extents, extents + 1); data->pointResults[0] = extents[1])
+CBH_BENCHMARK_BATCH(NSPoint_centroidOfPoints, count * sizeof(NSPoint), data->pointResults[0] = NSPoint_centroidOfPoints(data->points, count))
+
+
+#pragma mark - Batched Pixel Alignment
+
+CBH_BENCHMARK_BATCH(NSPoint_truncatePoints, count * sizeof(NSPoint), NSPoint_truncatePoints(data->points, data->pointResults, count, 2.0))
+CBH_BENCHMARK_BATCH(NSPoint_roundPoints, count * sizeof(NSPoint), NSPoint_roundPoints(data->points, data->pointResults, count, 2.0))
+CBH_BENCHMARK_BATCH(NSPoint_nearestPixels, count * sizeof(NSPoint), NSPoint_nearestPixels(data->points, data->pointResults, count, 2.0))
+
+
+#pragma mark - Description
+
+CBH_BENCHMARK(NSPoint_description, sizeof(NSPoint), data->integerResults[i] = [NSPoint_description(data->points[i]) length])
+CBH_BENCHMARK(NSPoint_getDescription, sizeof(NSPoint), char buffer[64]; data->integerResults[i] = NSPoint_getDescription(data->points[i], buffer, sizeof(buffer)))
+
+
+#pragma mark - Table
+
+const CBHBenchmark kCBHBenchmarks_NSPoint[] = {
+	CBH_BENCHMARK_ENTRY(NSPoint_init),
+	CBH_BENCHMARK_ENTRY(NSPoint_initWithString),
+	CBH_BENCHMARK_ENTRY(NSPoint_initZero),
+	CBH_BENCHMARK_ENTRY(NSPoint_initWithBytes),
+	CBH_BENCHMARK_ENTRY(NSPoint_parseLines),
+	CBH_BENCHMARK_ENTRY(NSPoint_isEqual),
+	CBH_BENCHMARK_ENTRY(NSPoint_truncate),
+	CBH_BENCHMARK_ENTRY(NSPoint_round),
+	CBH_BENCHMARK_ENTRY(NSPoint_shift),
+	CBH_BENCHMARK_ENTRY(NSPoint_shiftParametric),
+	CBH_BENCHMARK_ENTRY(NSPoint_nearestPixel),
+	CBH_BENCHMARK_ENTRY(NSPoint_distance),
+	CBH_BENCHMARK_ENTRY(NSPoint_distanceSquared),
+	CBH_BENCHMARK_ENTRY(NSPoint_approximateDistance),
+	CBH_BENCHMARK_ENTRY(NSPoint_distancesToPoints),
+	CBH_BENCHMARK_ENTRY(NSPoint_distancesSquaredToPoints),
+	CBH_BENCHMARK_ENTRY(NSPoint_distancesBetweenPoints),
+	CBH_BENCHMARK_ENTRY(NSPoint_distancesSquaredBetweenPoints),
+	CBH_BENCHMARK_ENTRY(NSPoint_approximateDistancesToPoints),
+	CBH_BENCHMARK_ENTRY(NSPoint_approximateDistancesBetweenPoints),
+	CBH_BENCHMARK_ENTRY(NSPoint_extentsOfPoints),
+	CBH_BENCHMARK_ENTRY(NSPoint_centroidOfPoints),
+	CBH_BENCHMARK_ENTRY(NSPoint_truncatePoints),
+	CBH_BENCHMARK_ENTRY(NSPoint_roundPoints),
+	CBH_BENCHMARK_ENTRY(NSPoint_nearestPixels),
+	CBH_BENCHMARK_ENTRY(NSPoint_description),
+	CBH_BENCHMARK_ENTRY(NSPoint_getDescription),
+	{ NULL, NULL },
+};
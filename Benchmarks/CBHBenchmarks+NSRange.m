@@ -0,0 +1,82 @@
+//  CBHBenchmarks+NSRange.m
+//  CBHGeometryKitBenchmarks
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHBenchmark.h"
+
+#import <CBHGeometryKit/NSRange+CBHGeometryKit.h>
+
+
+#pragma mark - Creating Ranges
+
+CBH_BENCHMARK(NSRange_init, 2 * sizeof(NSUInteger), data->rangeResults[i] = NSRange_init(data->integers[i], data->ranges[i].length))
+CBH_BENCHMARK(NSRange_initFromTo, 2 * sizeof(NSUInteger), data->rangeResults[i] = NSRange_initFromTo(data->ranges[i].location, data->otherRanges[i].location))
+CBH_BENCHMARK_BATCH(NSRange_initWithString, data->rangeText.length, for (NSUInteger i = 0; i < count; ++i) { data->rangeResults[i] = NSRange_initWithString(data->rangeText.strings[i]); })
+CBH_BENCHMARK(NSRange_initEmpty, 0, data->rangeResults[i] = NSRange_initEmpty())
+
+
+#pragma mark - Parsing Ranges
+
+CBH_BENCHMARK_BATCH(NSRange_initWithBytes, data->rangeText.length, for (NSUInteger i = 0; i < count; ++i) { data->rangeResults[i] = NSRange_initWithBytes(data->rangeText.lines[i], data->rangeText.lineLengths[i], NULL, NULL); })
+CBH_BENCHMARK_BATCH(NSRange_parseLines, data->rangeText.length, NSRange_parseLines(data->rangeText.bytes, data->rangeText.length, data->rangeResults, NULL, count))
+
+
+#pragma mark - Checking Ranges
+
+CBH_BENCHMARK(NSRange_isEmpty, sizeof(NSRange), data->boolResults[i] = NSRange_isEmpty(data->ranges[i]))
+CBH_BENCHMARK(NSRange_isEqual, 2 * sizeof(NSRange), data->boolResults[i] = NSRange_isEqual(data->ranges[i], data->otherRanges[i]))
+CBH_BENCHMARK(NSRange_isLocationInRange, sizeof(NSRange) + sizeof(NSUInteger), data->boolResults[i] = NSRange_isLocationInRange(data->ranges[i], data->integers[i]))
+
+
+#pragma mark - Derived Ranges
+
+CBH_BENCHMARK(NSRange_intersection, 2 * sizeof(NSRange), data->rangeResults[i] = NSRange_intersection(data->ranges[i], data->otherRanges[i]))
+CBH_BENCHMARK(NSRange_union, 2 * sizeof(NSRange), data->rangeResults[i] = NSRange_union(data->ranges[i], data->otherRanges[i]))
+
+
+#pragma mark - Calculated Properties
+
+CBH_BENCHMARK(NSRange_max, sizeof(NSRange), data->integerResults[i] = NSRange_max(data->ranges[i]))
+CBH_BENCHMARK(NSRange_locationAtOffset, sizeof(NSRange) + sizeof(NSUInteger), data->integerResults[i] = NSRange_locationAtOffset(data->ranges[i], data->integers[i] % 1024))
+
+
+#pragma mark - Description
+
+CBH_BENCHMARK(NSRange_description, sizeof(NSRange), data->integerResults[i] = [NSRange_description(data->ranges[i]) length])
+CBH_BENCHMARK(NSRange_getDescription, sizeof(NSRange), char buffer[64]; data->integerResults[i] = NSRange_getDescription(data->ranges[i], buffer, sizeof(buffer)))
+
+
+#pragma mark - Table
+
+const CBHBenchmark kCBHBenchmarks_NSRange[] = {
+	CBH_BENCHMARK_ENTRY(NSRange_init),
+	CBH_BENCHMARK_ENTRY(NSRange_initFromTo),
+	CBH_BENCHMARK_ENTRY(NSRange_initWithString),
+	CBH_BENCHMARK_ENTRY(NSRange_initEmpty),
+	CBH_BENCHMARK_ENTRY(NSRange_initWithBytes),
+	CBH_BENCHMARK_ENTRY(NSRange_parseLines),
+	CBH_BENCHMARK_ENTRY(NSRange_isEmpty),
+	CBH_BENCHMARK_ENTRY(NSRange_isEqual),
+	CBH_BENCHMARK_ENTRY(NSRange_isLocationInRange),
+	CBH_BENCHMARK_ENTRY(NSRange_intersection),
+	CBH_BENCHMARK_ENTRY(NSRange_union),
+	CBH_BENCHMARK_ENTRY(NSRange_max),
+	CBH_BENCHMARK_ENTRY(NSRange_locationAtOffset),
+	CBH_BENCHMARK_ENTRY(NSRange_description),
+	CBH_BENCHMARK_ENTRY(NSRange_getDescription),
+	{ NULL, NULL },
+};
@@ -0,0 +1,146 @@
+//  CBHBenchmarks+NSRect.m
+//  CBHGeometryKitBenchmarks
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHBenchmark.h"
+
+#import <CBHGeometryKit/NSRect+CBHGeometryKit.h>
+
+
+#pragma mark - Creating Rects
+
+CBH_BENCHMARK(NSRect_init, 4 * sizeof(CGFloat), data->rectResults[i] = NSRect_init(data->reals[i], data->reals[i + 1], data->reals[i + 2], data->reals[i + 3]))
+CBH_BENCHMARK(NSRect_initWithStructs, sizeof(NSPoint) + sizeof(NSSize), data->rectResults[i] = NSRect_initWithStructs(data->points[i], data->sizes[i]))
+CBH_BENCHMARK(NSRect_initWithSize, sizeof(NSSize), data->rectResults[i] = NSRect_initWithSize(data->sizes[i]))
+CBH_BENCHMARK_BATCH(NSRect_initWithString, data->rectText.length, for (NSUInteger i = 0; i < count; ++i) { data->rectResults[i] = NSRect_initWithString(data->rectText.strings[i]); })
+CBH_BENCHMARK(NSRect_initEmpty, 0, data->rectResults[i] = NSRect_initEmpty())
+
+
+#pragma mark - Parsing Rects
+
+CBH_BENCHMARK_BATCH(NSRect_initWithBytes, data->rectText.length, for (NSUInteger i = 0; i < count; ++i) { data->rectResults[i] = NSRect_initWithBytes(data->rectText.lines[i], data->rectText.lineLengths[i], NULL, NULL); })
+CBH_BENCHMARK_BATCH(NSRect_parseLines, data->rectText.length, NSRect_parseLines(data->rectText.bytes, data->rectText.length, data->rectResults, NULL, count))
+
+
+#pragma mark - Checking Rects
+
+CBH_BENCHMARK(NSRect_isEmpty, sizeof(NSRect), data->boolResults[i] = NSRect_isEmpty(data->rects[i]))
+CBH_BENCHMARK(NSRect_isNegative, sizeof(NSRect), data->boolResults[i] = NSRect_isNegative(data->rects[i]))
+CBH_BENCHMARK(NSRect_isEqual, 2 * sizeof(NSRect), data->boolResults[i] = NSRect_isEqual(data->rects[i], data->otherRects[i]))
+CBH_BENCHMARK(NSRect_isCovering, 2 * sizeof(NSRect), data->boolResults[i] = NSRect_isCovering(data->rects[i], data->otherRects[i]))
+CBH_BENCHMARK(NSRect_isIntersecting, 2 * sizeof(NSRect), data->boolResults[i] = NSRect_isIntersecting(data->rects[i], data->otherRects[i]))
+CBH_BENCHMARK(NSRect_isPointInRect, sizeof(NSRect) + sizeof(NSPoint), data->boolResults[i] = NSRect_isPointInRect(data->rects[i], data->otherPoints[i]))
+CBH_BENCHMARK(NSRect_isMouseInRect, sizeof(NSRect) + sizeof(NSPoint), data->boolResults[i] = NSRect_isMouseInRect(data->rects[i], data->otherPoints[i], (BOOL)(i & 1)))
+
+
+#pragma mark - Derived Rects
+
+CBH_BENCHMARK(NSRect_inset, sizeof(NSRect) + 2 * sizeof(CGFloat), data->rectResults[i] = NSRect_inset(data->rects[i], data->reals[i], data->reals[i + 1]))
+CBH_BENCHMARK(NSRect_offset, sizeof(NSRect) + 2 * sizeof(CGFloat), data->rectResults[i] = NSRect_offset(data->rects[i], data->reals[i], data->reals[i + 1]))
+CBH_BENCHMARK(NSRect_integral, sizeof(NSRect), data->rectResults[i] = NSRect_integral(data->rects[i]))
+CBH_BENCHMARK(NSRect_truncate, sizeof(NSRect), data->rectResults[i] = NSRect_truncate(data->rects[i]))
+CBH_BENCHMARK(NSRect_round, sizeof(NSRect), data->rectResults[i] = NSRect_round(data->rects[i]))
+CBH_BENCHMARK(NSRect_absolute, sizeof(NSRect), data->rectResults[i] = NSRect_absolute(data->rects[i]))
+CBH_BENCHMARK(NSRect_alignWithPixels, sizeof(NSRect), data->rectResults[i] = NSRect_alignWithPixels(data->rects[i]))
+CBH_BENCHMARK(NSRect_intersection, 2 * sizeof(NSRect), data->rectResults[i] = NSRect_intersection(data->rects[i], data->otherRects[i]))
+CBH_BENCHMARK(NSRect_union, 2 * sizeof(NSRect), data->rectResults[i] = NSRect_union(data->rects[i], data->otherRects[i]))
+CBH_BENCHMARK(NSRect_centeredInRect, 2 * sizeof(NSRect), data->rectResults[i] = NSRect_centeredInRect(data->rects[i], data->otherRects[i]))
+
+
+#pragma mark - Derived Points
+
+CBH_BENCHMARK(NSRect_maxPoint, sizeof(NSRect), data->pointResults[i] = NSRect_maxPoint(data->rects[i]))
+CBH_BENCHMARK(NSRect_midPoint, sizeof(NSRect), data->pointResults[i] = NSRect_midPoint(data->rects[i]))
+CBH_BENCHMARK(NSRect_minPoint, sizeof(NSRect), data->pointResults[i] = NSRect_minPoint(data->rects[i]))
+
+
+#pragma mark - Calculated Properties
+
+CBH_BENCHMARK(NSRect_maxX, sizeof(NSRect), data->realResults[i] = NSRect_maxX(data->rects[i]))
+CBH_BENCHMARK(NSRect_maxY, sizeof(NSRect), data->realResults[i] = NSRect_maxY(data->rects[i]))
+CBH_BENCHMARK(NSRect_midX, sizeof(NSRect), data->realResults[i] = NSRect_midX(data->rects[i]))
+CBH_BENCHMARK(NSRect_midY, sizeof(NSRect), data->realResults[i] = NSRect_midY(data->rects[i]))
+CBH_BENCHMARK(NSRect_minX, sizeof(NSRect), data->realResults[i] = NSRect_minX(data->rects[i]))
+CBH_BENCHMARK(NSRect_minY, sizeof(NSRect), data->realResults[i] = NSRect_minY(data->rects[i]))
+
+
+#pragma mark - Batched Reductions
+
+CBH_BENCHMARK_BATCH(NSRect_boundingRectOfPoints, count * sizeof(NSPoint), data->rectResults[0] = NSRect_boundingRectOfPoints(data->points, count))
+CBH_BENCHMARK_BATCH(NSRect_unionOfRects, count * sizeof(NSRect), data->rectResults[0] = NSRect_unionOfRects(data->rects, count))
+
+
+#pragma mark - Batched Pixel Alignment
+
+CBH_BENCHMARK_BATCH(NSRect_integralRects, count * sizeof(NSRect), NSRect_integralRects(data->rects, data->rectResults, count, 2.0))
+CBH_BENCHMARK_BATCH(NSRect_truncateRects, count * sizeof(NSRect), NSRect_truncateRects(data->rects, data->rectResults, count, 2.0))
+CBH_BENCHMARK_BATCH(NSRect_roundRects, count * sizeof(NSRect), NSRect_roundRects(data->rects, data->rectResults, count, 2.0))
+CBH_BENCHMARK_BATCH(NSRect_alignRectsWithPixels, count * sizeof(NSRect), NSRect_alignRectsWithPixels(data->rects, data->rectResults, count, 2.0))
+
+
+#pragma mark - Description
+
+CBH_BENCHMARK(NSRect_description, sizeof(NSRect), data->integerResults[i] = [NSRect_description(data->rects[i]) length])
+CBH_BENCHMARK(NSRect_getDescription, sizeof(NSRect), char buffer[128]; data->integerResults[i] = NSRect_getDescription(data->rects[i], buffer, sizeof(buffer)))
+
+
+#pragma mark - Table
+
+const CBHBenchmark kCBHBenchmarks_NSRect[] = {
+	CBH_BENCHMARK_ENTRY(NSRect_init),
+	CBH_BENCHMARK_ENTRY(NSRect_initWithStructs),
+	CBH_BENCHMARK_ENTRY(NSRect_initWithSize),
+	CBH_BENCHMARK_ENTRY(NSRect_initWithString),
+	CBH_BENCHMARK_ENTRY(NSRect_initEmpty),
+	CBH_BENCHMARK_ENTRY(NSRect_initWithBytes),
+	CBH_BENCHMARK_ENTRY(NSRect_parseLines),
+	CBH_BENCHMARK_ENTRY(NSRect_isEmpty),
+	CBH_BENCHMARK_ENTRY(NSRect_isNegative),
+	CBH_BENCHMARK_ENTRY(NSRect_isEqual),
+	CBH_BENCHMARK_ENTRY(NSRect_isCovering),
+	CBH_BENCHMARK_ENTRY(NSRect_isIntersecting),
+	CBH_BENCHMARK_ENTRY(NSRect_isPointInRect),
+	CBH_BENCHMARK_ENTRY(NSRect_isMouseInRect),
+	CBH_BENCHMARK_ENTRY(NSRect_inset),
+	CBH_BENCHMARK_ENTRY(NSRect_offset),
+	CBH_BENCHMARK_ENTRY(NSRect_integral),
+	CBH_BENCHMARK_ENTRY(NSRect_truncate),
+	CBH_BENCHMARK_ENTRY(NSRect_round),
+	CBH_BENCHMARK_ENTRY(NSRect_absolute),
+	CBH_BENCHMARK_ENTRY(NSRect_alignWithPixels),
+	CBH_BENCHMARK_ENTRY(NSRect_intersection),
+	CBH_BENCHMARK_ENTRY(NSRect_union),
+	CBH_BENCHMARK_ENTRY(NSRect_centeredInRect),
+	CBH_BENCHMARK_ENTRY(NSRect_maxPoint),
+	CBH_BENCHMARK_ENTRY(NSRect_midPoint),
+	CBH_BENCHMARK_ENTRY(NSRect_minPoint),
+	CBH_BENCHMARK_ENTRY(NSRect_maxX),
+	CBH_BENCHMARK_ENTRY(NSRect_maxY),
+	CBH_BENCHMARK_ENTRY(NSRect_midX),
+	CBH_BENCHMARK_ENTRY(NSRect_midY),
+	CBH_BENCHMARK_ENTRY(NSRect_minX),
+	CBH_BENCHMARK_ENTRY(NSRect_minY),
+	CBH_BENCHMARK_ENTRY(NSRect_boundingRectOfPoints),
+	CBH_BENCHMARK_ENTRY(NSRect_unionOfRects),
+	CBH_BENCHMARK_ENTRY(NSRect_integralRects),
+	CBH_BENCHMARK_ENTRY(NSRect_truncateRects),
+	CBH_BENCHMARK_ENTRY(NSRect_roundRects),
+	CBH_BENCHMARK_ENTRY(NSRect_alignRectsWithPixels),
+	CBH_BENCHMARK_ENTRY(NSRect_description),
+	CBH_BENCHMARK_ENTRY(NSRect_getDescription),
+	{ NULL, NULL },
+};
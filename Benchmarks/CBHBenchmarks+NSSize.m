@@ -0,0 +1,78 @@
+//  CBHBenchmarks+NSSize.m
+//  CBHGeometryKitBenchmarks
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHBenchmark.h"
+
+#import <CBHGeometryKit/NSSize+CBHGeometryKit.h>
+
+
+#pragma mark - Creating Sizes
+
+CBH_BENCHMARK(NSSize_init, 2 * sizeof(CGFloat), data->sizeResults[i] = NSSize_init(data->reals[i], data->reals[i + 1]))
+CBH_BENCHMARK_BATCH(NSSize_initWithString, data->sizeText.length, for (NSUInteger i = 0; i < count; ++i) { data->sizeResults[i] = NSSize_initWithString(data->sizeText.strings[i]); })
+CBH_BENCHMARK(NSSize_initEmpty, 0, data->sizeResults[i] = NSSize_initEmpty())
+
+
+#pragma mark - Parsing Sizes
+
+CBH_BENCHMARK_BATCH(NSSize_initWithBytes, data->sizeText.length, for (NSUInteger i = 0; i < count; ++i) { data->sizeResults[i] = NSSize_initWithBytes(data->sizeText.lines[i], data->sizeText.lineLengths[i], NULL, NULL); })
+CBH_BENCHMARK_BATCH(NSSize_parseLines, data->sizeText.length, NSSize_parseLines(data->sizeText.bytes, data->sizeText.length, data->sizeResults, NULL, count))
+
+
+#pragma mark - Checking Sizes
+
+CBH_BENCHMARK(NSSize_isEmpty, sizeof(NSSize), data->boolResults[i] = NSSize_isEmpty(data->sizes[i]))
+CBH_BENCHMARK(NSSize_isNegative, sizeof(NSSize), data->boolResults[i] = NSSize_isNegative(data->sizes[i]))
+CBH_BENCHMARK(NSSize_isEqual, 2 * sizeof(NSSize), data->boolResults[i] = NSSize_isEqual(data->sizes[i], data->otherSizes[i]))
+
+
+#pragma mark - Derived Sizes
+
+CBH_BENCHMARK(NSSize_truncate, sizeof(NSSize), data->sizeResults[i] = NSSize_truncate(data->sizes[i]))
+CBH_BENCHMARK(NSSize_round, sizeof(NSSize), data->sizeResults[i] = NSSize_round(data->sizes[i]))
+CBH_BENCHMARK(NSSize_absolute, sizeof(NSSize), data->sizeResults[i] = NSSize_absolute(data->sizes[i]))
+CBH_BENCHMARK(NSSize_scale, 2 * sizeof(NSSize), data->sizeResults[i] = NSSize_scale(data->sizes[i], data->otherSizes[i]))
+CBH_BENCHMARK(NSSize_scaleParametric, sizeof(NSSize) + 2 * sizeof(CGFloat), data->sizeResults[i] = NSSize_scaleParametric(data->sizes[i], data->reals[i], data->reals[i + 1]))
+
+
+#pragma mark - Description
+
+CBH_BENCHMARK(NSSize_description, sizeof(NSSize), data->integerResults[i] = [NSSize_description(data->sizes[i]) length])
+CBH_BENCHMARK(NSSize_getDescription, sizeof(NSSize), char buffer[64]; data->integerResults[i] = NSSize_getDescription(data->sizes[i], buffer, sizeof(buffer)))
+
+
+#pragma mark - Table
+
+const CBHBenchmark kCBHBenchmarks_NSSize[] = {
+	CBH_BENCHMARK_ENTRY(NSSize_init),
+	CBH_BENCHMARK_ENTRY(NSSize_initWithString),
+	CBH_BENCHMARK_ENTRY(NSSize_initEmpty),
+	CBH_BENCHMARK_ENTRY(NSSize_initWithBytes),
+	CBH_BENCHMARK_ENTRY(NSSize_parseLines),
+	CBH_BENCHMARK_ENTRY(NSSize_isEmpty),
+	CBH_BENCHMARK_ENTRY(NSSize_isNegative),
+	CBH_BENCHMARK_ENTRY(NSSize_isEqual),
+	CBH_BENCHMARK_ENTRY(NSSize_truncate),
+	CBH_BENCHMARK_ENTRY(NSSize_round),
+	CBH_BENCHMARK_ENTRY(NSSize_absolute),
+	CBH_BENCHMARK_ENTRY(NSSize_scale),
+	CBH_BENCHMARK_ENTRY(NSSize_scaleParametric),
+	CBH_BENCHMARK_ENTRY(NSSize_description),
+	CBH_BENCHMARK_ENTRY(NSSize_getDescription),
+	{ NULL, NULL },
+};
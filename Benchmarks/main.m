@@ -0,0 +1,353 @@
+//  main.m
+//  CBHGeometryKitBenchmarks
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+#import "CBHBenchmark.h"
+
+#import <getopt.h>
+#import <stdio.h>
+#import <stdlib.h>
+#import <string.h>
+#import <sys/utsname.h>
+
+
+enum { kCBHBenchmarksMaximumSizes = 16 };
+
+enum
+{
+	kCBHBenchmarksExitSuccess = 0,
+	kCBHBenchmarksExitRegression = 1,
+	kCBHBenchmarksExitFailure = 2,
+};
+
+typedef struct CBHBenchmarksOptions
+{
+	NSUInteger sizes[kCBHBenchmarksMaximumSizes];
+	NSUInteger sizeCount;
+	NSUInteger samples;
+	double sampleTime;
+	double threshold;
+	const char * _Nullable filter;
+	const char * _Nullable outputPath;
+	const char * _Nullable baselinePath;
+} CBHBenchmarksOptions;
+
+static const CBHBenchmark * const kCBHBenchmarkTables[] = {
+	kCBHBenchmarks_NSPoint,
+	kCBHBenchmarks_NSSize,
+	kCBHBenchmarks_NSRect,
+	kCBHBenchmarks_NSRange,
+};
+
+
+#pragma mark - Options
+
+static void _CBHBenchmarks_printUsage(FILE * const stream)
+{
+	fputs("usage: cbhbench [options]\n"
+		  "\n"
+		  "  -s, --sizes LIST        Comma separated input sizes (default 64,4096,262144).\n"
+		  "  -f, --filter TEXT       Run only benchmarks whose name contains TEXT.\n"
+		  "  -n, --samples COUNT     Samples per measurement; the median is reported (default 7).\n"
+		  "  -t, --time SECONDS      Minimum duration of each sample (default 0.01).\n"
+		  "  -o, --output FILE       Write the results as JSON to FILE, or to standard output for \"-\".\n"
+		  "  -b, --baseline FILE     Compare with results previously written by --output.\n"
+		  "  -r, --threshold RATIO   Slowdown over the baseline which counts as a regression (default 0.10).\n"
+		  "  -h, --help              Show this message.\n"
+		  "\n"
+		  "Exits with 1 if any benchmark regressed against the baseline, and 2 on error.\n", stream);
+}
+
+static BOOL _CBHBenchmarks_parseSizes(const char *text, CBHBenchmarksOptions * const options)
+{
+	options->sizeCount = 0;
+
+	while ( *text != '\0' )
+	{
+		char *end = NULL;
+		const unsigned long long size = strtoull(text, &end, 10);
+
+		if ( end == text || size == 0 || options->sizeCount >= kCBHBenchmarksMaximumSizes ) { return NO; }
+		if ( *end != ',' && *end != '\0' ) { return NO; }
+
+		options->sizes[options->sizeCount++] = (NSUInteger)size;
+		text = ( *end == ',' ) ? end + 1 : end;
+	}
+
+	return ( options->sizeCount > 0 );
+}
+
+static BOOL _CBHBenchmarks_parseOptions(const int argc, char * const argv[], CBHBenchmarksOptions * const options)
+{
+	static const struct option longOptions[] = {
+		{ "sizes", required_argument, NULL, 's' },
+		{ "filter", required_argument, NULL, 'f' },
+		{ "samples", required_argument, NULL, 'n' },
+		{ "time", required_argument, NULL, 't' },
+		{ "output", required_argument, NULL, 'o' },
+		{ "baseline", required_argument, NULL, 'b' },
+		{ "threshold", required_argument, NULL, 'r' },
+		{ "help", no_argument, NULL, 'h' },
+		{ NULL, 0, NULL, 0 },
+	};
+
+	*options = (CBHBenchmarksOptions){
+		.sizes = { 64, 4096, 262144 },
+		.sizeCount = 3,
+		.samples = 7,
+		.sampleTime = 0.01,
+		.threshold = 0.10,
+	};
+
+	int option;
+	while ( (option = getopt_long(argc, argv, "s:f:n:t:o:b:r:h", longOptions, NULL)) != -1 )
+	{
+		switch ( option )
+		{
+			case 's':
+				if ( !_CBHBenchmarks_parseSizes(optarg, options) ) { return NO; }
+				break;
+
+			case 'f': options->filter = optarg; break;
+			case 'o': options->outputPath = optarg; break;
+			case 'b': options->baselinePath = optarg; break;
+
+			case 'n':
+				options->samples = (NSUInteger)strtoul(optarg, NULL, 10);
+				if ( options->samples == 0 ) { return NO; }
+				break;
+
+			case 't':
+				options->sampleTime = strtod(optarg, NULL);
+				if ( !(options->sampleTime > 0.0) ) { return NO; }
+				break;
+
+			case 'r':
+				options->threshold = strtod(optarg, NULL);
+				if ( !(options->threshold >= 0.0) ) { return NO; }
+				break;
+
+			case 'h':
+				_CBHBenchmarks_printUsage(stdout);
+				exit(kCBHBenchmarksExitSuccess);
+
+			default:
+				return NO;
+		}
+	}
+
+	return ( optind == argc );
+}
+
+
+#pragma mark - Baselines
+
+static NSString *_CBHBenchmarks_key(NSString * const name, const NSUInteger size)
+{
+	return [NSString stringWithFormat:@"%@@%lu", name, (unsigned long)size];
+}
+
+// Maps each "name@size" in a file written by `--output` to its time per operation.
+static NSDictionary<NSString *, NSNumber *> * _Nullable _CBHBenchmarks_loadBaseline(const char * const path)
+{
+	NSData *data = [NSData dataWithContentsOfFile:@(path)];
+	if ( data == nil ) { return nil; }
+
+	NSDictionary *report = [NSJSONSerialization JSONObjectWithData:data options:0 error:NULL];
+	if ( ![report isKindOfClass:[NSDictionary class]] ) { return nil; }
+
+	NSArray *results = report[@"results"];
+	if ( ![results isKindOfClass:[NSArray class]] ) { return nil; }
+
+	NSMutableDictionary<NSString *, NSNumber *> *baseline = [NSMutableDictionary dictionaryWithCapacity:[results count]];
+	for (NSDictionary *result in results)
+	{
+		if ( ![result isKindOfClass:[NSDictionary class]] ) { continue; }
+
+		NSString *name = result[@"name"];
+		NSNumber *size = result[@"size"];
+		NSNumber *time = result[@"nanosecondsPerOperation"];
+
+		if ( ![name isKindOfClass:[NSString class]] || ![size isKindOfClass:[NSNumber class]] || ![time isKindOfClass:[NSNumber class]] ) { continue; }
+
+		baseline[_CBHBenchmarks_key(name, [size unsignedIntegerValue])] = time;
+	}
+
+	return baseline;
+}
+
+
+#pragma mark - Reports
+
+static NSDictionary *_CBHBenchmarks_host(void)
+{
+	struct utsname name;
+	if ( uname(&name) != 0 ) { return @{}; }
+
+	return @{
+		@"system": @(name.sysname),
+		@"release": @(name.release),
+		@"machine": @(name.machine),
+		@"node": @(name.nodename),
+	};
+}
+
+static NSDictionary *_CBHBenchmarks_resultObject(NSString * const name, const NSUInteger size, const CBHBenchmarkResult result)
+{
+	return @{
+		@"name": name,
+		@"size": @(size),
+		@"nanosecondsPerOperation": @(result.nanosecondsPerOperation),
+		@"minimumNanosecondsPerOperation": @(result.minimumNanosecondsPerOperation),
+		@"operationsPerSecond": @(1e9 / result.nanosecondsPerOperation),
+		@"bytesPerSecond": @(result.bytesPerSecond),
+		@"cyclesPerOperation": ( result.cyclesPerOperation >= 0.0 ) ? @(result.cyclesPerOperation) : [NSNull null],
+		@"operationsPerSample": @(result.operationsPerSample),
+	};
+}
+
+static BOOL _CBHBenchmarks_writeReport(const char * const path, NSDictionary * const report)
+{
+	NSData *data = [NSJSONSerialization dataWithJSONObject:report options:NSJSONWritingPrettyPrinted error:NULL];
+	if ( data == nil ) { return NO; }
+
+	if ( strcmp(path, "-") == 0 )
+	{
+		fwrite([data bytes], 1, [data length], stdout);
+		fputc('\n', stdout);
+		return ( fflush(stdout) == 0 );
+	}
+
+	return [data writeToFile:@(path) atomically:YES];
+}
+
+
+#pragma mark - Running
+
+int main(const int argc, char * const argv[])
+{
+	@autoreleasepool
+	{
+		CBHBenchmarksOptions options;
+		if ( !_CBHBenchmarks_parseOptions(argc, argv, &options) )
+		{
+			_CBHBenchmarks_printUsage(stderr);
+			return kCBHBenchmarksExitFailure;
+		}
+
+		NSDictionary<NSString *, NSNumber *> *baseline = nil;
+		if ( options.baselinePath != NULL )
+		{
+			baseline = _CBHBenchmarks_loadBaseline(options.baselinePath);
+			if ( baseline == nil )
+			{
+				fprintf(stderr, "cbhbench: could not read the baseline %s\n", options.baselinePath);
+				return kCBHBenchmarksExitFailure;
+			}
+		}
+
+		// The table goes to standard error when the JSON report is written to standard output.
+		FILE * const table = ( options.outputPath != NULL && strcmp(options.outputPath, "-") == 0 ) ? stderr : stdout;
+
+		fprintf(table, "%-44s %8s %11s %11s %11s %9s", "benchmark", "size", "ns/op", "Mop/s", "MB/s", "cycles/op");
+		if ( baseline != nil ) { fprintf(table, " %11s %8s", "baseline", "change"); }
+		fputc('\n', table);
+
+		NSMutableArray<NSDictionary *> *results = [NSMutableArray array];
+		NSUInteger regressions = 0;
+
+		for (NSUInteger sizeIndex = 0; sizeIndex < options.sizeCount; ++sizeIndex)
+		{
+			const NSUInteger size = options.sizes[sizeIndex];
+
+			CBHBenchmarkData *data = CBHBenchmarkData_create(size);
+			if ( data == NULL )
+			{
+				fprintf(stderr, "cbhbench: could not allocate inputs of size %lu\n", (unsigned long)size);
+				return kCBHBenchmarksExitFailure;
+			}
+
+			for (NSUInteger tableIndex = 0; tableIndex < sizeof(kCBHBenchmarkTables) / sizeof(*kCBHBenchmarkTables); ++tableIndex)
+			{
+				for (const CBHBenchmark *benchmark = kCBHBenchmarkTables[tableIndex]; benchmark->name != NULL; ++benchmark)
+				{
+					if ( options.filter != NULL && strstr(benchmark->name, options.filter) == NULL ) { continue; }
+
+					const CBHBenchmarkResult result = CBHBenchmark_measure(benchmark, data, options.samples, options.sampleTime);
+					NSString *name = @(benchmark->name);
+
+					[results addObject:_CBHBenchmarks_resultObject(name, size, result)];
+
+					fprintf(table, "%-44s %8lu %11.3f %11.2f %11.1f", benchmark->name, (unsigned long)size, result.nanosecondsPerOperation, 1e3 / result.nanosecondsPerOperation, result.bytesPerSecond / 1e6);
+					if ( result.cyclesPerOperation >= 0.0 ) { fprintf(table, " %9.2f", result.cyclesPerOperation); }
+					else { fprintf(table, " %9s", "-"); }
+
+					NSNumber *previous = baseline[_CBHBenchmarks_key(name, size)];
+					if ( previous != nil )
+					{
+						const double change = (result.nanosecondsPerOperation / [previous doubleValue]) - 1.0;
+						const BOOL isRegression = ( change > options.threshold );
+						if ( isRegression ) { ++regressions; }
+
+						fprintf(table, " %11.3f %+7.1f%%%s", [previous doubleValue], change * 100.0, ( isRegression ) ? "  REGRESSION" : "");
+					}
+					else if ( baseline != nil )
+					{
+						fprintf(table, " %11s %8s", "-", "new");
+					}
+
+					fputc('\n', table);
+					fflush(table);
+				}
+			}
+
+			CBHBenchmarkData_destroy(data);
+		}
+
+		if ( options.outputPath != NULL )
+		{
+			NSMutableArray<NSNumber *> *sizes = [NSMutableArray array];
+			for (NSUInteger i = 0; i < options.sizeCount; ++i) { [sizes addObject:@(options.sizes[i])]; }
+
+			NSDictionary *report = @{
+				@"version": @1,
+				@"host": _CBHBenchmarks_host(),
+				@"compiler": @(__VERSION__),
+				@"sizes": sizes,
+				@"samples": @(options.samples),
+				@"sampleTime": @(options.sampleTime),
+				@"results": results,
+			};
+
+			if ( !_CBHBenchmarks_writeReport(options.outputPath, report) )
+			{
+				fprintf(stderr, "cbhbench: could not write the results to %s\n", options.outputPath);
+				return kCBHBenchmarksExitFailure;
+			}
+		}
+
+		if ( baseline != nil )
+		{
+			fprintf(table, "%lu of %lu benchmarks slower than the baseline by more than %.0f%%\n", (unsigned long)regressions, (unsigned long)[results count], options.threshold * 100.0);
+			if ( regressions > 0 ) { return kCBHBenchmarksExitRegression; }
+		}
+	}
+
+	return kCBHBenchmarksExitSuccess;
+}
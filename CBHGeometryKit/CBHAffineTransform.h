@@ -0,0 +1,284 @@
+//  CBHAffineTransform.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** A 2D affine transform held as a plain struct.
+ *
+ * The components follow `NSAffineTransformStruct`. A point is mapped to
+ * `{ x * m11 + y * m21 + tX, x * m12 + y * m22 + tY }`.
+ *
+ * Transforms with no rotation or shear, where `m12` and `m21` are both 0, take a faster path which skips the zero terms.
+ */
+typedef struct CBHAffineTransform
+{
+	CGFloat m11;
+	CGFloat m12;
+	CGFloat m21;
+	CGFloat m22;
+	CGFloat tX;
+	CGFloat tY;
+} CBHAffineTransform;
+
+
+#pragma mark - Creating Transforms
+
+/**
+ * @name Creating Transforms
+ */
+
+/** Creates a transform from its components.
+ *
+ * @param m11           The x scale component.
+ * @param m12           The y shear component.
+ * @param m21           The x shear component.
+ * @param m22           The y scale component.
+ * @param tX            The x translation.
+ * @param tY            The y translation.
+ *
+ * @return              A `CBHAffineTransform` with the given components.
+ */
+CBHAffineTransform CBHAffineTransform_init(CGFloat m11, CGFloat m12, CGFloat m21, CGFloat m22, CGFloat tX, CGFloat tY);
+
+/** Creates a transform from an `NSAffineTransformStruct`.
+ *
+ * @param components    The components of the transform.
+ *
+ * @return              A `CBHAffineTransform` with the same components.
+ */
+CBHAffineTransform CBHAffineTransform_initWithTransformStruct(NSAffineTransformStruct components);
+
+/** Creates the identity transform.
+ *
+ * @return              A `CBHAffineTransform` which maps every point to itself.
+ */
+CBHAffineTransform CBHAffineTransform_initIdentity(void);
+
+/** Creates a translation.
+ *
+ * @param tX            The x translation.
+ * @param tY            The y translation.
+ *
+ * @return              A `CBHAffineTransform` which moves points by _tX_ and _tY_.
+ */
+CBHAffineTransform CBHAffineTransform_initTranslation(CGFloat tX, CGFloat tY);
+
+/** Creates a scale about the origin.
+ *
+ * @param sX            The x scale.
+ * @param sY            The y scale.
+ *
+ * @return              A `CBHAffineTransform` which scales points by _sX_ and _sY_.
+ */
+CBHAffineTransform CBHAffineTransform_initScale(CGFloat sX, CGFloat sY);
+
+/** Creates a rotation about the origin.
+ *
+ * @param radians       The angle of rotation, counterclockwise in a coordinate system where y increases upwards.
+ *
+ * @return              A `CBHAffineTransform` which rotates points by _radians_.
+ */
+CBHAffineTransform CBHAffineTransform_initRotation(CGFloat radians);
+
+/** Creates a transform mapping one rect onto another without rotation.
+ *
+ * @param rect          The source rect.
+ * @param other         The destination rect.
+ *
+ * @return              A `CBHAffineTransform` which maps the corners of _rect_ onto the corresponding corners of _other_.
+ *
+ * @warning             If _rect_ has a width or height of 0 the corresponding scale is infinite or `NaN`.
+ */
+CBHAffineTransform CBHAffineTransform_initMappingRect(NSRect rect, NSRect other);
+
+
+#pragma mark - Checking Transforms
+
+/**
+ * @name Checking Transforms
+ */
+
+/** Checks if a transform is the identity.
+ *
+ * @param transform     The transform to check.
+ *
+ * @return              `YES` if _transform_ maps every point to itself, otherwise `NO`.
+ */
+BOOL CBHAffineTransform_isIdentity(CBHAffineTransform transform);
+
+/** Checks if two transforms are equal.
+ *
+ * @param transform     The first transform to compare.
+ * @param other         The second transform to compare.
+ *
+ * @return              `YES` if every component is equal, otherwise `NO`.
+ */
+BOOL CBHAffineTransform_isEqual(CBHAffineTransform transform, CBHAffineTransform other);
+
+/** Checks if a transform only scales and translates.
+ *
+ * @param transform     The transform to check.
+ *
+ * @return              `YES` if `m12` and `m21` are both 0, otherwise `NO`.
+ */
+BOOL CBHAffineTransform_isScaleTranslate(CBHAffineTransform transform);
+
+/** Checks if a transform can be inverted.
+ *
+ * @param transform     The transform to check.
+ *
+ * @return              `YES` if the determinant of _transform_ is finite and not 0, otherwise `NO`.
+ */
+BOOL CBHAffineTransform_isInvertible(CBHAffineTransform transform);
+
+
+#pragma mark - Combining Transforms
+
+/**
+ * @name Combining Transforms
+ */
+
+/** Composes two transforms.
+ *
+ * @param transform     The transform to apply first.
+ * @param other         The transform to apply second.
+ *
+ * @return              A `CBHAffineTransform` equivalent to applying _transform_ and then _other_.
+ */
+CBHAffineTransform CBHAffineTransform_compose(CBHAffineTransform transform, CBHAffineTransform other);
+
+/** Inverts a transform.
+ *
+ * @param transform     The transform to invert.
+ * @param inverse       On success, the transform which undoes _transform_.
+ *
+ * @return              `YES` if _transform_ was inverted, or `NO` if it is not invertible, in which case _inverse_ is unchanged.
+ */
+BOOL CBHAffineTransform_invert(CBHAffineTransform transform, CBHAffineTransform *inverse);
+
+/** Appends a translation to a transform.
+ *
+ * @param transform     The transform to extend.
+ * @param tX            The x translation.
+ * @param tY            The y translation.
+ *
+ * @return              A `CBHAffineTransform` equivalent to applying _transform_ and then translating.
+ */
+CBHAffineTransform CBHAffineTransform_translate(CBHAffineTransform transform, CGFloat tX, CGFloat tY);
+
+/** Appends a scale about the origin to a transform.
+ *
+ * @param transform     The transform to extend.
+ * @param sX            The x scale.
+ * @param sY            The y scale.
+ *
+ * @return              A `CBHAffineTransform` equivalent to applying _transform_ and then scaling.
+ */
+CBHAffineTransform CBHAffineTransform_scale(CBHAffineTransform transform, CGFloat sX, CGFloat sY);
+
+/** Appends a rotation about the origin to a transform.
+ *
+ * @param transform     The transform to extend.
+ * @param radians       The angle of rotation.
+ *
+ * @return              A `CBHAffineTransform` equivalent to applying _transform_ and then rotating.
+ */
+CBHAffineTransform CBHAffineTransform_rotate(CBHAffineTransform transform, CGFloat radians);
+
+
+#pragma mark - Applying Transforms
+
+/**
+ * @name Applying Transforms
+ */
+
+/** Transforms a point.
+ *
+ * @param transform     The transform to apply.
+ * @param point         The point to transform.
+ *
+ * @return              The transformed point.
+ */
+NSPoint CBHAffineTransform_applyToPoint(CBHAffineTransform transform, NSPoint point);
+
+/** Transforms a size, ignoring the translation.
+ *
+ * @param transform     The transform to apply.
+ * @param size          The size to transform.
+ *
+ * @return              The transformed size, which may have negative components, as `-[NSAffineTransform transformSize:]` returns.
+ */
+NSSize CBHAffineTransform_applyToSize(CBHAffineTransform transform, NSSize size);
+
+/** Transforms a rect into the bounding rect of its transformed corners.
+ *
+ * @param transform     The transform to apply.
+ * @param rect          The rect to transform. Its size may be negative.
+ *
+ * @return              The smallest rect with a non-negative size which contains the four transformed corners of _rect_.
+ */
+NSRect CBHAffineTransform_applyToRect(CBHAffineTransform transform, NSRect rect);
+
+
+#pragma mark - Batched Transforms
+
+/**
+ * @name Batched Transforms
+ */
+
+/** Transforms each point in an array.
+ *
+ * @param transform     The transform to apply.
+ * @param points        The points to transform.
+ * @param results       A buffer of at least _count_ elements to receive the transformed points. It may be _points_.
+ * @param count         The number of points in _points_.
+ *
+ * @warning             The results are identical to calling `CBHAffineTransform_applyToPoint()` for each point.
+ */
+void CBHAffineTransform_applyToPoints(CBHAffineTransform transform, const NSPoint *points, NSPoint *results, NSUInteger count);
+
+/** Transforms each rect in an array into the bounding rect of its transformed corners.
+ *
+ * @param transform     The transform to apply.
+ * @param rects         The rects to transform.
+ * @param results       A buffer of at least _count_ elements to receive the bounding rects. It may be _rects_.
+ * @param count         The number of rects in _rects_.
+ *
+ * @warning             The results are identical to calling `CBHAffineTransform_applyToRect()` for each rect.
+ */
+void CBHAffineTransform_applyToRects(CBHAffineTransform transform, const NSRect *rects, NSRect *results, NSUInteger count);
+
+
+#pragma mark - Conversion
+
+/**
+ * @name Conversion
+ */
+
+/** Converts a transform to an `NSAffineTransformStruct`.
+ *
+ * @param transform     The transform to convert.
+ *
+ * @return              An `NSAffineTransformStruct` with the same components, for use with `NSAffineTransform`.
+ */
+NSAffineTransformStruct CBHAffineTransform_transformStruct(CBHAffineTransform transform);
+
+NS_ASSUME_NONNULL_END
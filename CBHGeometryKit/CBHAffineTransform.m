@@ -0,0 +1,515 @@
+//  CBHAffineTransform.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHAffineTransform.h"
+
+#import "_CBHGeometryKit+Utilities.h"
+#import "_CBHGeometryKit+Parallel.h"
+
+#import <math.h>
+
+
+#pragma mark - Creating Transforms
+
+CBH_CONST CBHAffineTransform CBHAffineTransform_init(const CGFloat m11, const CGFloat m12, const CGFloat m21, const CGFloat m22, const CGFloat tX, const CGFloat tY)
+{
+	return (CBHAffineTransform){ .m11 = m11, .m12 = m12, .m21 = m21, .m22 = m22, .tX = tX, .tY = tY };
+}
+
+CBH_CONST CBHAffineTransform CBHAffineTransform_initWithTransformStruct(const NSAffineTransformStruct components)
+{
+	return CBHAffineTransform_init(components.m11, components.m12, components.m21, components.m22, components.tX, components.tY);
+}
+
+CBH_CONST CBHAffineTransform CBHAffineTransform_initIdentity(void)
+{
+	return CBHAffineTransform_init(1.0, 0.0, 0.0, 1.0, 0.0, 0.0);
+}
+
+CBH_CONST CBHAffineTransform CBHAffineTransform_initTranslation(const CGFloat tX, const CGFloat tY)
+{
+	return CBHAffineTransform_init(1.0, 0.0, 0.0, 1.0, tX, tY);
+}
+
+CBH_CONST CBHAffineTransform CBHAffineTransform_initScale(const CGFloat sX, const CGFloat sY)
+{
+	return CBHAffineTransform_init(sX, 0.0, 0.0, sY, 0.0, 0.0);
+}
+
+CBH_CONST CBHAffineTransform CBHAffineTransform_initRotation(const CGFloat radians)
+{
+	const CGFloat cosine = cos(radians);
+	const CGFloat sine = sin(radians);
+
+	return CBHAffineTransform_init(cosine, sine, -sine, cosine, 0.0, 0.0);
+}
+
+CBH_CONST CBHAffineTransform CBHAffineTransform_initMappingRect(const NSRect rect, const NSRect other)
+{
+	const CGFloat sX = other.size.width / rect.size.width;
+	const CGFloat sY = other.size.height / rect.size.height;
+
+	return CBHAffineTransform_init(sX, 0.0, 0.0, sY, other.origin.x - (rect.origin.x * sX), other.origin.y - (rect.origin.y * sY));
+}
+
+
+#pragma mark - Checking Transforms
+
+CBH_CONST BOOL CBHAffineTransform_isIdentity(const CBHAffineTransform transform)
+{
+	return CBHAffineTransform_isEqual(transform, CBHAffineTransform_initIdentity());
+}
+
+CBH_CONST BOOL CBHAffineTransform_isEqual(const CBHAffineTransform transform, const CBHAffineTransform other)
+{
+	return ( (transform.m11 == other.m11) && (transform.m12 == other.m12) && (transform.m21 == other.m21)
+		  && (transform.m22 == other.m22) && (transform.tX == other.tX) && (transform.tY == other.tY) );
+}
+
+CBH_CONST BOOL CBHAffineTransform_isScaleTranslate(const CBHAffineTransform transform)
+{
+	return ( (transform.m12 == 0.0) && (transform.m21 == 0.0) );
+}
+
+CBH_CONST BOOL CBHAffineTransform_isInvertible(const CBHAffineTransform transform)
+{
+	const CGFloat determinant = (transform.m11 * transform.m22) - (transform.m12 * transform.m21);
+	return ( determinant != 0.0 ) && isfinite(determinant);
+}
+
+
+#pragma mark - Combining Transforms
+
+CBH_CONST CBHAffineTransform CBHAffineTransform_compose(const CBHAffineTransform transform, const CBHAffineTransform other)
+{
+	CBHAffineTransform newTransform;
+
+	newTransform.m11 = (transform.m11 * other.m11) + (transform.m12 * other.m21);
+	newTransform.m12 = (transform.m11 * other.m12) + (transform.m12 * other.m22);
+	newTransform.m21 = (transform.m21 * other.m11) + (transform.m22 * other.m21);
+	newTransform.m22 = (transform.m21 * other.m12) + (transform.m22 * other.m22);
+	newTransform.tX = (transform.tX * other.m11) + (transform.tY * other.m21) + other.tX;
+	newTransform.tY = (transform.tX * other.m12) + (transform.tY * other.m22) + other.tY;
+
+	return newTransform;
+}
+
+BOOL CBHAffineTransform_invert(const CBHAffineTransform transform, CBHAffineTransform * const inverse)
+{
+	if ( !CBHAffineTransform_isInvertible(transform) ) { return NO; }
+
+	if ( CBHAffineTransform_isScaleTranslate(transform) )
+	{
+		const CGFloat sX = 1.0 / transform.m11;
+		const CGFloat sY = 1.0 / transform.m22;
+
+		*inverse = CBHAffineTransform_init(sX, 0.0, 0.0, sY, -transform.tX * sX, -transform.tY * sY);
+		return YES;
+	}
+
+	const CGFloat determinant = (transform.m11 * transform.m22) - (transform.m12 * transform.m21);
+
+	CBHAffineTransform newTransform;
+
+	newTransform.m11 = transform.m22 / determinant;
+	newTransform.m12 = -transform.m12 / determinant;
+	newTransform.m21 = -transform.m21 / determinant;
+	newTransform.m22 = transform.m11 / determinant;
+	newTransform.tX = ((transform.m21 * transform.tY) - (transform.m22 * transform.tX)) / determinant;
+	newTransform.tY = ((transform.m12 * transform.tX) - (transform.m11 * transform.tY)) / determinant;
+
+	*inverse = newTransform;
+	return YES;
+}
+
+CBH_CONST CBHAffineTransform CBHAffineTransform_translate(const CBHAffineTransform transform, const CGFloat tX, const CGFloat tY)
+{
+	CBHAffineTransform newTransform = transform;
+
+	newTransform.tX += tX;
+	newTransform.tY += tY;
+
+	return newTransform;
+}
+
+CBH_CONST CBHAffineTransform CBHAffineTransform_scale(const CBHAffineTransform transform, const CGFloat sX, const CGFloat sY)
+{
+	return CBHAffineTransform_compose(transform, CBHAffineTransform_initScale(sX, sY));
+}
+
+CBH_CONST CBHAffineTransform CBHAffineTransform_rotate(const CBHAffineTransform transform, const CGFloat radians)
+{
+	return CBHAffineTransform_compose(transform, CBHAffineTransform_initRotation(radians));
+}
+
+
+#pragma mark - Applying Transforms
+
+// Every path, scalar or vector, computes each component with the same operations in the same order, and the products
+// are kept in separate statements so they cannot be contracted into fused multiply-adds. Batched results are therefore
+// bit-identical to the scalar functions.
+
+// The negative part of a value, matching the `min(value, 0)` of the vector paths when _value_ is -0 or NaN.
+NS_INLINE CGFloat _CBHAffineTransform_lower(const CGFloat value)
+{
+	return ( value < 0.0 ) ? value : 0.0;
+}
+
+NS_INLINE NSPoint _CBHAffineTransform_applyScaleTranslateToPoint(const CBHAffineTransform transform, const NSPoint point)
+{
+	const CGFloat x = point.x * transform.m11;
+	const CGFloat y = point.y * transform.m22;
+
+	return (NSPoint){ .x = x + transform.tX, .y = y + transform.tY };
+}
+
+NS_INLINE NSPoint _CBHAffineTransform_applyGeneralToPoint(const CBHAffineTransform transform, const NSPoint point)
+{
+	const CGFloat xX = point.x * transform.m11;
+	const CGFloat xY = point.x * transform.m12;
+	const CGFloat yX = point.y * transform.m21;
+	const CGFloat yY = point.y * transform.m22;
+
+	return (NSPoint){ .x = (xX + yX) + transform.tX, .y = (xY + yY) + transform.tY };
+}
+
+NS_INLINE NSRect _CBHAffineTransform_applyScaleTranslateToRect(const CBHAffineTransform transform, const NSRect rect)
+{
+	const NSPoint origin = _CBHAffineTransform_applyScaleTranslateToPoint(transform, rect.origin);
+	const CGFloat width = rect.size.width * transform.m11;
+	const CGFloat height = rect.size.height * transform.m22;
+
+	NSRect newRect;
+
+	newRect.origin.x = origin.x + _CBHAffineTransform_lower(width);
+	newRect.origin.y = origin.y + _CBHAffineTransform_lower(height);
+	newRect.size.width = fabs(width);
+	newRect.size.height = fabs(height);
+
+	return newRect;
+}
+
+NS_INLINE NSRect _CBHAffineTransform_applyGeneralToRect(const CBHAffineTransform transform, const NSRect rect)
+{
+	const NSPoint origin = _CBHAffineTransform_applyGeneralToPoint(transform, rect.origin);
+
+	// The transformed edges along which the corners are spread.
+	const CGFloat widthX = rect.size.width * transform.m11;
+	const CGFloat widthY = rect.size.width * transform.m12;
+	const CGFloat heightX = rect.size.height * transform.m21;
+	const CGFloat heightY = rect.size.height * transform.m22;
+
+	NSRect newRect;
+
+	newRect.origin.x = (origin.x + _CBHAffineTransform_lower(widthX)) + _CBHAffineTransform_lower(heightX);
+	newRect.origin.y = (origin.y + _CBHAffineTransform_lower(widthY)) + _CBHAffineTransform_lower(heightY);
+	newRect.size.width = fabs(widthX) + fabs(heightX);
+	newRect.size.height = fabs(widthY) + fabs(heightY);
+
+	return newRect;
+}
+
+
+CBH_CONST NSPoint CBHAffineTransform_applyToPoint(const CBHAffineTransform transform, const NSPoint point)
+{
+	if ( CBHAffineTransform_isScaleTranslate(transform) ) { return _CBHAffineTransform_applyScaleTranslateToPoint(transform, point); }
+	return _CBHAffineTransform_applyGeneralToPoint(transform, point);
+}
+
+CBH_CONST NSSize CBHAffineTransform_applyToSize(const CBHAffineTransform transform, const NSSize size)
+{
+	const CGFloat widthX = size.width * transform.m11;
+	const CGFloat widthY = size.width * transform.m12;
+	const CGFloat heightX = size.height * transform.m21;
+	const CGFloat heightY = size.height * transform.m22;
+
+	return (NSSize){ .width = widthX + heightX, .height = widthY + heightY };
+}
+
+CBH_CONST NSRect CBHAffineTransform_applyToRect(const CBHAffineTransform transform, const NSRect rect)
+{
+	if ( CBHAffineTransform_isScaleTranslate(transform) ) { return _CBHAffineTransform_applyScaleTranslateToRect(transform, rect); }
+	return _CBHAffineTransform_applyGeneralToRect(transform, rect);
+}
+
+
+#pragma mark - Batched Transforms
+
+static void _CBHAffineTransform_applyToPoints(const CBHAffineTransform transform, const NSPoint * const points, NSPoint * const results, const NSUInteger count)
+{
+	const BOOL isScaleTranslate = CBHAffineTransform_isScaleTranslate(transform);
+	NSUInteger i = 0;
+
+#if CBH_VECTOR_AVX2
+	const __m256d scale = _mm256_setr_pd(transform.m11, transform.m22, transform.m11, transform.m22);
+	const __m256d columnX = _mm256_setr_pd(transform.m11, transform.m12, transform.m11, transform.m12);
+	const __m256d columnY = _mm256_setr_pd(transform.m21, transform.m22, transform.m21, transform.m22);
+	const __m256d translation = _mm256_setr_pd(transform.tX, transform.tY, transform.tX, transform.tY);
+
+	for ( ; i + 2 <= count; i += 2 )
+	{
+		const __m256d point = _mm256_loadu_pd((const double *)(points + i));
+		__m256d result;
+
+		if ( isScaleTranslate )
+		{
+			result = _mm256_add_pd(_mm256_mul_pd(point, scale), translation);
+		}
+		else
+		{
+			const __m256d x = _mm256_mul_pd(_mm256_movedup_pd(point), columnX);
+			const __m256d y = _mm256_mul_pd(_mm256_permute_pd(point, 0xF), columnY);
+			result = _mm256_add_pd(_mm256_add_pd(x, y), translation);
+		}
+
+		_mm256_storeu_pd((double *)(results + i), result);
+	}
+#elif CBH_VECTOR_SSE2
+	const __m128d scale = _mm_setr_pd(transform.m11, transform.m22);
+	const __m128d columnX = _mm_setr_pd(transform.m11, transform.m12);
+	const __m128d columnY = _mm_setr_pd(transform.m21, transform.m22);
+	const __m128d translation = _mm_setr_pd(transform.tX, transform.tY);
+
+	for ( ; i < count; ++i )
+	{
+		const __m128d point = _mm_loadu_pd((const double *)(points + i));
+		__m128d result;
+
+		if ( isScaleTranslate )
+		{
+			result = _mm_add_pd(_mm_mul_pd(point, scale), translation);
+		}
+		else
+		{
+			const __m128d x = _mm_mul_pd(_mm_unpacklo_pd(point, point), columnX);
+			const __m128d y = _mm_mul_pd(_mm_unpackhi_pd(point, point), columnY);
+			result = _mm_add_pd(_mm_add_pd(x, y), translation);
+		}
+
+		_mm_storeu_pd((double *)(results + i), result);
+	}
+#elif CBH_VECTOR_NEON
+	const float64x2_t scale = { transform.m11, transform.m22 };
+	const float64x2_t columnX = { transform.m11, transform.m12 };
+	const float64x2_t columnY = { transform.m21, transform.m22 };
+	const float64x2_t translation = { transform.tX, transform.tY };
+
+	for ( ; i < count; ++i )
+	{
+		const float64x2_t point = vld1q_f64((const double *)(points + i));
+		float64x2_t result;
+
+		if ( isScaleTranslate )
+		{
+			result = vaddq_f64(vmulq_f64(point, scale), translation);
+		}
+		else
+		{
+			const float64x2_t x = vmulq_f64(vdupq_laneq_f64(point, 0), columnX);
+			const float64x2_t y = vmulq_f64(vdupq_laneq_f64(point, 1), columnY);
+			result = vaddq_f64(vaddq_f64(x, y), translation);
+		}
+
+		vst1q_f64((double *)(results + i), result);
+	}
+#endif
+
+	for ( ; i < count; ++i )
+	{
+		results[i] = ( isScaleTranslate ) ? _CBHAffineTransform_applyScaleTranslateToPoint(transform, points[i]) : _CBHAffineTransform_applyGeneralToPoint(transform, points[i]);
+	}
+}
+
+static void _CBHAffineTransform_applyToRects(const CBHAffineTransform transform, const NSRect * const rects, NSRect * const results, const NSUInteger count)
+{
+	const BOOL isScaleTranslate = CBHAffineTransform_isScaleTranslate(transform);
+	NSUInteger i = 0;
+
+#if CBH_VECTOR_AVX2
+	const __m256d zero = _mm256_setzero_pd();
+	const __m256d sign = _mm256_set1_pd(-0.0);
+	const __m256d scale = _mm256_setr_pd(transform.m11, transform.m22, transform.m11, transform.m22);
+	const __m256d columnX = _mm256_setr_pd(transform.m11, transform.m12, transform.m11, transform.m12);
+	const __m256d columnY = _mm256_setr_pd(transform.m21, transform.m22, transform.m21, transform.m22);
+	const __m256d translation = _mm256_setr_pd(transform.tX, transform.tY, transform.tX, transform.tY);
+
+	for ( ; i + 2 <= count; i += 2 )
+	{
+		const __m256d first = _mm256_loadu_pd((const double *)(rects + i));
+		const __m256d second = _mm256_loadu_pd((const double *)(rects + i + 1));
+
+		// { x0, y0, x1, y1 } and { w0, h0, w1, h1 }.
+		const __m256d origins = _mm256_permute2f128_pd(first, second, 0x20);
+		const __m256d sizes = _mm256_permute2f128_pd(first, second, 0x31);
+
+		__m256d minimum;
+		__m256d extent;
+
+		if ( isScaleTranslate )
+		{
+			const __m256d edges = _mm256_mul_pd(sizes, scale);
+
+			minimum = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(origins, scale), translation), _mm256_min_pd(edges, zero));
+			extent = _mm256_andnot_pd(sign, edges);
+		}
+		else
+		{
+			const __m256d x = _mm256_mul_pd(_mm256_movedup_pd(origins), columnX);
+			const __m256d y = _mm256_mul_pd(_mm256_permute_pd(origins, 0xF), columnY);
+			const __m256d origin = _mm256_add_pd(_mm256_add_pd(x, y), translation);
+
+			const __m256d widths = _mm256_mul_pd(_mm256_movedup_pd(sizes), columnX);
+			const __m256d heights = _mm256_mul_pd(_mm256_permute_pd(sizes, 0xF), columnY);
+
+			minimum = _mm256_add_pd(_mm256_add_pd(origin, _mm256_min_pd(widths, zero)), _mm256_min_pd(heights, zero));
+			extent = _mm256_add_pd(_mm256_andnot_pd(sign, widths), _mm256_andnot_pd(sign, heights));
+		}
+
+		_mm256_storeu_pd((double *)(results + i), _mm256_permute2f128_pd(minimum, extent, 0x20));
+		_mm256_storeu_pd((double *)(results + i + 1), _mm256_permute2f128_pd(minimum, extent, 0x31));
+	}
+#elif CBH_VECTOR_SSE2
+	const __m128d zero = _mm_setzero_pd();
+	const __m128d sign = _mm_set1_pd(-0.0);
+	const __m128d scale = _mm_setr_pd(transform.m11, transform.m22);
+	const __m128d columnX = _mm_setr_pd(transform.m11, transform.m12);
+	const __m128d columnY = _mm_setr_pd(transform.m21, transform.m22);
+	const __m128d translation = _mm_setr_pd(transform.tX, transform.tY);
+
+	for ( ; i < count; ++i )
+	{
+		const __m128d origins = _mm_loadu_pd((const double *)(rects + i));
+		const __m128d sizes = _mm_loadu_pd((const double *)(rects + i) + 2);
+
+		__m128d minimum;
+		__m128d extent;
+
+		if ( isScaleTranslate )
+		{
+			const __m128d edges = _mm_mul_pd(sizes, scale);
+
+			minimum = _mm_add_pd(_mm_add_pd(_mm_mul_pd(origins, scale), translation), _mm_min_pd(edges, zero));
+			extent = _mm_andnot_pd(sign, edges);
+		}
+		else
+		{
+			const __m128d x = _mm_mul_pd(_mm_unpacklo_pd(origins, origins), columnX);
+			const __m128d y = _mm_mul_pd(_mm_unpackhi_pd(origins, origins), columnY);
+			const __m128d origin = _mm_add_pd(_mm_add_pd(x, y), translation);
+
+			const __m128d widths = _mm_mul_pd(_mm_unpacklo_pd(sizes, sizes), columnX);
+			const __m128d heights = _mm_mul_pd(_mm_unpackhi_pd(sizes, sizes), columnY);
+
+			minimum = _mm_add_pd(_mm_add_pd(origin, _mm_min_pd(widths, zero)), _mm_min_pd(heights, zero));
+			extent = _mm_add_pd(_mm_andnot_pd(sign, widths), _mm_andnot_pd(sign, heights));
+		}
+
+		_mm_storeu_pd((double *)(results + i), minimum);
+		_mm_storeu_pd((double *)(results + i) + 2, extent);
+	}
+#elif CBH_VECTOR_NEON
+	const float64x2_t zero = vdupq_n_f64(0.0);
+	const float64x2_t scale = { transform.m11, transform.m22 };
+	const float64x2_t columnX = { transform.m11, transform.m12 };
+	const float64x2_t columnY = { transform.m21, transform.m22 };
+	const float64x2_t translation = { transform.tX, transform.tY };
+
+	for ( ; i < count; ++i )
+	{
+		const float64x2_t origins = vld1q_f64((const double *)(rects + i));
+		const float64x2_t sizes = vld1q_f64((const double *)(rects + i) + 2);
+
+		float64x2_t minimum;
+		float64x2_t extent;
+
+		// `vminq_f64()` propagates NaN and orders -0 below 0, so the negative parts are selected explicitly.
+		if ( isScaleTranslate )
+		{
+			const float64x2_t edges = vmulq_f64(sizes, scale);
+			const float64x2_t lower = vbslq_f64(vcltq_f64(edges, zero), edges, zero);
+
+			minimum = vaddq_f64(vaddq_f64(vmulq_f64(origins, scale), translation), lower);
+			extent = vabsq_f64(edges);
+		}
+		else
+		{
+			const float64x2_t x = vmulq_f64(vdupq_laneq_f64(origins, 0), columnX);
+			const float64x2_t y = vmulq_f64(vdupq_laneq_f64(origins, 1), columnY);
+			const float64x2_t origin = vaddq_f64(vaddq_f64(x, y), translation);
+
+			const float64x2_t widths = vmulq_f64(vdupq_laneq_f64(sizes, 0), columnX);
+			const float64x2_t heights = vmulq_f64(vdupq_laneq_f64(sizes, 1), columnY);
+			const float64x2_t lowerWidths = vbslq_f64(vcltq_f64(widths, zero), widths, zero);
+			const float64x2_t lowerHeights = vbslq_f64(vcltq_f64(heights, zero), heights, zero);
+
+			minimum = vaddq_f64(vaddq_f64(origin, lowerWidths), lowerHeights);
+			extent = vaddq_f64(vabsq_f64(widths), vabsq_f64(heights));
+		}
+
+		vst1q_f64((double *)(results + i), minimum);
+		vst1q_f64((double *)(results + i) + 2, extent);
+	}
+#endif
+
+	for ( ; i < count; ++i )
+	{
+		results[i] = ( isScaleTranslate ) ? _CBHAffineTransform_applyScaleTranslateToRect(transform, rects[i]) : _CBHAffineTransform_applyGeneralToRect(transform, rects[i]);
+	}
+}
+
+
+// Large batches are split between threads with `CBHParallel_apply()`. Each range reads and writes only its own
+// elements, so transforming in place is safe.
+typedef struct CBHAffineTransformBatch
+{
+	CBHAffineTransform transform;
+	const void *elements;
+	void *results;
+} CBHAffineTransformBatch;
+
+static void _CBHAffineTransform_pointsWorker(void * const context, const NSRange range)
+{
+	const CBHAffineTransformBatch * const batch = context;
+	_CBHAffineTransform_applyToPoints(batch->transform, (const NSPoint *)batch->elements + range.location, (NSPoint *)batch->results + range.location, range.length);
+}
+
+static void _CBHAffineTransform_rectsWorker(void * const context, const NSRange range)
+{
+	const CBHAffineTransformBatch * const batch = context;
+	_CBHAffineTransform_applyToRects(batch->transform, (const NSRect *)batch->elements + range.location, (NSRect *)batch->results + range.location, range.length);
+}
+
+
+void CBHAffineTransform_applyToPoints(const CBHAffineTransform transform, const NSPoint * const points, NSPoint * const results, const NSUInteger count)
+{
+	CBHAffineTransformBatch batch = { .transform = transform, .elements = points, .results = results };
+	CBHParallel_apply(count, &batch, _CBHAffineTransform_pointsWorker);
+}
+
+void CBHAffineTransform_applyToRects(const CBHAffineTransform transform, const NSRect * const rects, NSRect * const results, const NSUInteger count)
+{
+	CBHAffineTransformBatch batch = { .transform = transform, .elements = rects, .results = results };
+	CBHParallel_apply(count, &batch, _CBHAffineTransform_rectsWorker);
+}
+
+#pragma mark - Conversion
+
+CBH_CONST NSAffineTransformStruct CBHAffineTransform_transformStruct(const CBHAffineTransform transform)
+{
+	return (NSAffineTransformStruct){ .m11 = transform.m11, .m12 = transform.m12, .m21 = transform.m21, .m22 = transform.m22, .tX = transform.tX, .tY = transform.tY };
+}
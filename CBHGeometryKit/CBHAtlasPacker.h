@@ -0,0 +1,151 @@
+//  CBHAtlasPacker.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** Places rects of given sizes into a fixed area without overlap, for building texture atlases.
+ *
+ * Placed rects lie within the area, never intersect one another in the sense of `NSRect_isIntersecting()`, and are
+ * separated by at least the packer's padding. The area's own edges are not padded.
+ *
+ * Sizes with a dimension which is not positive and finite are never placed.
+ */
+typedef struct CBHAtlasPacker CBHAtlasPacker;
+
+/** The rule used to choose where each rect is placed. */
+typedef NS_ENUM(NSInteger, CBHAtlasHeuristic)
+{
+	/** MaxRects, choosing the free rect which leaves the shortest side the least room. Usually the densest. */
+	CBHAtlasHeuristicMaxRectsBestShortSideFit = 0,
+
+	/** MaxRects, choosing the smallest free rect the size fits in. */
+	CBHAtlasHeuristicMaxRectsBestAreaFit,
+
+	/** MaxRects, choosing the position whose top edge is lowest. */
+	CBHAtlasHeuristicMaxRectsBottomLeft,
+
+	/** Skyline, choosing the position whose top edge is lowest. Much faster than MaxRects but less dense. */
+	CBHAtlasHeuristicSkylineBottomLeft,
+
+	/** Skyline, choosing the position which leaves the least area trapped beneath the rect. */
+	CBHAtlasHeuristicSkylineMinWaste,
+};
+
+
+#pragma mark - Creating Atlas Packers
+
+/**
+ * @name Creating Atlas Packers
+ */
+
+/** Creates an empty atlas packer.
+ *
+ * @param size          The size of the area to fill. Both dimensions must be positive and finite.
+ * @param heuristic     The rule used to choose where each rect is placed.
+ * @param padding       The space to leave between placed rects. Must be finite and not negative.
+ * @param allowsRotation Whether a size may be placed turned a quarter turn, swapping its width and height.
+ *
+ * @return              A new packer, or `NULL` if the arguments are invalid or the storage could not be allocated.
+ *                      Release it with `CBHAtlasPacker_destroy()`.
+ */
+CBHAtlasPacker * _Nullable CBHAtlasPacker_create(NSSize size, CBHAtlasHeuristic heuristic, CGFloat padding, BOOL allowsRotation);
+
+/** Releases an atlas packer.
+ *
+ * @param packer        The packer to release.
+ */
+void CBHAtlasPacker_destroy(CBHAtlasPacker * _Nullable packer);
+
+/** Removes every placed rect, leaving the whole area free.
+ *
+ * @param packer        The packer to reset.
+ */
+void CBHAtlasPacker_reset(CBHAtlasPacker *packer);
+
+
+#pragma mark - Properties
+
+/**
+ * @name Properties
+ */
+
+/** The size of the area being filled.
+ *
+ * @param packer        The packer.
+ *
+ * @return              The size given when the packer was created.
+ */
+NSSize CBHAtlasPacker_size(const CBHAtlasPacker *packer);
+
+/** The number of rects placed since the packer was created or last reset.
+ *
+ * @param packer        The packer.
+ *
+ * @return              The number of placed rects.
+ */
+NSUInteger CBHAtlasPacker_count(const CBHAtlasPacker *packer);
+
+/** The fraction of the area covered by placed rects, not counting padding.
+ *
+ * @param packer        The packer.
+ *
+ * @return              A value from 0 to 1.
+ */
+CGFloat CBHAtlasPacker_occupancy(const CBHAtlasPacker *packer);
+
+
+#pragma mark - Placing Rects
+
+/**
+ * @name Placing Rects
+ */
+
+/** Places a single rect.
+ *
+ * Rects are placed in the order they are inserted, so earlier placements are never moved.
+ *
+ * @param packer        The packer to place into.
+ * @param size          The size of the rect to place.
+ * @param rect          Set to the placed rect. When rotated its width and height are those of _size_ swapped.
+ * @param rotated       Set to whether the rect was rotated.
+ *
+ * @return              `YES` if the rect was placed, or `NO` if it does not fit or the storage could not be allocated.
+ */
+BOOL CBHAtlasPacker_insert(CBHAtlasPacker *packer, NSSize size, NSRect * _Nullable rect, BOOL * _Nullable rotated);
+
+/** Places a C array of rects, largest first.
+ *
+ * Sorting by longest side before placing packs considerably tighter than inserting the same sizes in an arbitrary
+ * order. The results are still reported in the order of _sizes_.
+ *
+ * @param packer        The packer to place into.
+ * @param sizes         The sizes of the rects to place.
+ * @param rects         A buffer of _count_ rects to receive the placed rects. Sizes which could not be placed receive
+ *                      an empty rect.
+ * @param rotated       A buffer of _count_ values to receive whether each rect was rotated.
+ * @param count         The number of sizes in _sizes_.
+ *
+ * @return              The number of rects placed, or `NSNotFound` if the storage could not be allocated, in which case
+ *                      nothing was placed.
+ */
+NSUInteger CBHAtlasPacker_insertSizes(CBHAtlasPacker *packer, const NSSize *sizes, NSRect *rects, BOOL * _Nullable rotated, NSUInteger count);
+
+NS_ASSUME_NONNULL_END
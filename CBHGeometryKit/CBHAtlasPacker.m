@@ -0,0 +1,512 @@
+//  CBHAtlasPacker.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHAtlasPacker.h"
+
+#import "NSSize+CBHGeometryKit.h"
+#import "NSRect+CBHGeometryKit.h"
+
+#import "_CBHGeometryKit+Utilities.h"
+
+#import <math.h>
+#import <stdlib.h>
+#import <string.h>
+
+
+// A run of the skyline: the top of everything placed between `x` and `x + width`.
+typedef struct CBHAtlasSegment
+{
+	CGFloat x;
+	CGFloat y;
+	CGFloat width;
+} CBHAtlasSegment;
+
+// A candidate position. Lower scores are better, compared by `primary` and then `secondary`.
+typedef struct CBHAtlasPlacement
+{
+	NSRect rect;
+	NSUInteger index;
+	CGFloat primary;
+	CGFloat secondary;
+	BOOL rotated;
+} CBHAtlasPlacement;
+
+typedef struct CBHAtlasItem
+{
+	NSSize size;
+	NSUInteger index;
+} CBHAtlasItem;
+
+// All positions are in padded space, where every rect is grown by the padding on its maximum sides and the area is
+// grown by the same amount. This keeps rects apart without padding the edges of the area.
+struct CBHAtlasPacker
+{
+	NSSize size;
+	NSSize paddedSize;
+	CGFloat padding;
+	CBHAtlasHeuristic heuristic;
+	BOOL allowsRotation;
+
+	NSUInteger count;
+	CGFloat usedArea;
+
+	// MaxRects keeps the maximal free rects, none of which covers another.
+	NSRect * _Nullable freeRects;
+	NSUInteger freeCount;
+	NSUInteger freeCapacity;
+
+	// Skyline keeps segments in order of x, spanning the width of the area.
+	CBHAtlasSegment * _Nullable segments;
+	NSUInteger segmentCount;
+	NSUInteger segmentCapacity;
+};
+
+
+#pragma mark - Utilities
+
+NS_INLINE BOOL _CBHAtlasPacker_isPlaceable(const NSSize size)
+{
+	return ( size.width > 0.0 ) && ( size.height > 0.0 ) && isfinite(size.width) && isfinite(size.height);
+}
+
+NS_INLINE BOOL _CBHAtlasPacker_isMaxRects(const CBHAtlasHeuristic heuristic)
+{
+	return ( heuristic <= CBHAtlasHeuristicMaxRectsBottomLeft );
+}
+
+NS_INLINE BOOL _CBHAtlasPlacement_isBetter(const CBHAtlasPlacement placement, const CGFloat primary, const CGFloat secondary)
+{
+	return ( primary < placement.primary ) || ( primary == placement.primary && secondary < placement.secondary );
+}
+
+static BOOL _CBHAtlasPacker_reserve(void * _Nullable * const storage, NSUInteger * const capacity, const NSUInteger needed, const size_t elementSize)
+{
+	if ( needed <= *capacity ) { return YES; }
+
+	const NSUInteger newCapacity = MAX(needed, MAX(*capacity * 2, 16UL));
+	if ( newCapacity > NSUIntegerMax / elementSize ) { return NO; }
+
+	void * const elements = realloc(*storage, elementSize * newCapacity);
+	if ( elements == NULL ) { return NO; }
+
+	*storage = elements;
+	*capacity = newCapacity;
+
+	return YES;
+}
+
+
+#pragma mark - MaxRects
+
+static void _CBHAtlasPacker_scoreFreeRects(const CBHAtlasPacker * const packer, const NSSize size, const BOOL rotated, CBHAtlasPlacement * const best)
+{
+	for (NSUInteger i = 0; i < packer->freeCount; ++i)
+	{
+		const NSRect freeRect = packer->freeRects[i];
+		if ( size.width > freeRect.size.width || size.height > freeRect.size.height ) { continue; }
+
+		const CGFloat leftoverWidth = freeRect.size.width - size.width;
+		const CGFloat leftoverHeight = freeRect.size.height - size.height;
+
+		CGFloat primary;
+		CGFloat secondary;
+
+		switch ( packer->heuristic )
+		{
+			case CBHAtlasHeuristicMaxRectsBestAreaFit:
+				primary = (freeRect.size.width * freeRect.size.height) - (size.width * size.height);
+				secondary = MIN(leftoverWidth, leftoverHeight);
+				break;
+
+			case CBHAtlasHeuristicMaxRectsBottomLeft:
+				primary = freeRect.origin.y + size.height;
+				secondary = freeRect.origin.x;
+				break;
+
+			default:
+				primary = MIN(leftoverWidth, leftoverHeight);
+				secondary = MAX(leftoverWidth, leftoverHeight);
+				break;
+		}
+
+		if ( !_CBHAtlasPlacement_isBetter(*best, primary, secondary) ) { continue; }
+
+		*best = (CBHAtlasPlacement){
+			.rect = { freeRect.origin, size },
+			.index = i,
+			.primary = primary,
+			.secondary = secondary,
+			.rotated = rotated,
+		};
+	}
+}
+
+// Writes the parts of `freeRect` outside `used` to `pieces` and returns how many there are.
+static NSUInteger _CBHAtlasPacker_split(const NSRect freeRect, const NSRect used, NSRect * const pieces)
+{
+	const CGFloat freeMaxX = NSRect_maxX(freeRect);
+	const CGFloat freeMaxY = NSRect_maxY(freeRect);
+	const CGFloat usedMaxX = NSRect_maxX(used);
+	const CGFloat usedMaxY = NSRect_maxY(used);
+
+	NSUInteger count = 0;
+
+	if ( used.origin.x > freeRect.origin.x )
+	{
+		pieces[count++] = NSRect_init(freeRect.origin.x, freeRect.origin.y, used.origin.x - freeRect.origin.x, freeRect.size.height);
+	}
+
+	if ( usedMaxX < freeMaxX )
+	{
+		pieces[count++] = NSRect_init(usedMaxX, freeRect.origin.y, freeMaxX - usedMaxX, freeRect.size.height);
+	}
+
+	if ( used.origin.y > freeRect.origin.y )
+	{
+		pieces[count++] = NSRect_init(freeRect.origin.x, freeRect.origin.y, freeRect.size.width, used.origin.y - freeRect.origin.y);
+	}
+
+	if ( usedMaxY < freeMaxY )
+	{
+		pieces[count++] = NSRect_init(freeRect.origin.x, usedMaxY, freeRect.size.width, freeMaxY - usedMaxY);
+	}
+
+	return count;
+}
+
+static BOOL _CBHAtlasPacker_placeInFreeRects(CBHAtlasPacker * const packer, const NSRect used)
+{
+	const NSUInteger oldCount = packer->freeCount;
+
+	// Every free rect the placement intersects is replaced by up to four pieces, so make room first.
+	NSUInteger intersectingCount = 0;
+	for (NSUInteger i = 0; i < oldCount; ++i)
+	{
+		if ( NSRect_isIntersecting(packer->freeRects[i], used) ) { ++intersectingCount; }
+	}
+
+	if ( !_CBHAtlasPacker_reserve((void **)&packer->freeRects, &packer->freeCapacity, oldCount + intersectingCount * 4, sizeof(NSRect)) ) { return NO; }
+
+	NSRect * const freeRects = packer->freeRects;
+
+	// Keep the untouched rects at the front and gather the pieces after the old rects, where compaction can't reach.
+	NSUInteger keptCount = 0;
+	NSUInteger end = oldCount;
+
+	for (NSUInteger i = 0; i < oldCount; ++i)
+	{
+		const NSRect freeRect = freeRects[i];
+
+		if ( NSRect_isIntersecting(freeRect, used) ) { end += _CBHAtlasPacker_split(freeRect, used, freeRects + end); }
+		else { freeRects[keptCount++] = freeRect; }
+	}
+
+	const NSUInteger pieceCount = end - oldCount;
+	memmove(freeRects + keptCount, freeRects + oldCount, sizeof(NSRect) * pieceCount);
+	end = keptCount + pieceCount;
+
+	// The kept rects already don't cover one another, so only pairs involving a piece need checking. Covered rects are
+	// emptied and skipped so duplicates keep exactly one copy.
+	for (NSUInteger i = keptCount; i < end; ++i)
+	{
+		for (NSUInteger j = 0; j < end; ++j)
+		{
+			if ( i == j || NSRect_isEmpty(freeRects[j]) ) { continue; }
+			if ( NSRect_isCovering(freeRects[j], freeRects[i]) ) { freeRects[i] = NSRect_initEmpty(); break; }
+		}
+	}
+
+	for (NSUInteger i = 0; i < keptCount; ++i)
+	{
+		for (NSUInteger j = keptCount; j < end; ++j)
+		{
+			if ( NSRect_isEmpty(freeRects[j]) ) { continue; }
+			if ( NSRect_isCovering(freeRects[j], freeRects[i]) ) { freeRects[i] = NSRect_initEmpty(); break; }
+		}
+	}
+
+	NSUInteger count = 0;
+	for (NSUInteger i = 0; i < end; ++i)
+	{
+		if ( !NSRect_isEmpty(freeRects[i]) ) { freeRects[count++] = freeRects[i]; }
+	}
+
+	packer->freeCount = count;
+
+	return YES;
+}
+
+
+#pragma mark - Skyline
+
+// Finds the height at which a rect of `size` would rest if its left edge were at segment `index`, along with the area
+// it would leave trapped beneath it, or returns `NO` if it would leave the area.
+static BOOL _CBHAtlasPacker_fitSegment(const CBHAtlasPacker * const packer, const NSUInteger index, const NSSize size, CGFloat * const y, CGFloat * const waste)
+{
+	const CBHAtlasSegment * const segments = packer->segments;
+	const CGFloat minX = segments[index].x;
+	const CGFloat maxX = minX + size.width;
+
+	if ( maxX > packer->paddedSize.width ) { return NO; }
+
+	CGFloat top = 0.0;
+	for (NSUInteger i = index; i < packer->segmentCount && segments[i].x < maxX; ++i)
+	{
+		top = MAX(top, segments[i].y);
+	}
+
+	if ( top + size.height > packer->paddedSize.height ) { return NO; }
+
+	CGFloat area = 0.0;
+	for (NSUInteger i = index; i < packer->segmentCount && segments[i].x < maxX; ++i)
+	{
+		const CGFloat width = MIN(maxX, segments[i].x + segments[i].width) - segments[i].x;
+		area += (top - segments[i].y) * width;
+	}
+
+	*y = top;
+	*waste = area;
+
+	return YES;
+}
+
+static void _CBHAtlasPacker_scoreSegments(const CBHAtlasPacker * const packer, const NSSize size, const BOOL rotated, CBHAtlasPlacement * const best)
+{
+	for (NSUInteger i = 0; i < packer->segmentCount; ++i)
+	{
+		CGFloat y;
+		CGFloat waste;
+		if ( !_CBHAtlasPacker_fitSegment(packer, i, size, &y, &waste) ) { continue; }
+
+		const BOOL isMinWaste = ( packer->heuristic == CBHAtlasHeuristicSkylineMinWaste );
+		const CGFloat primary = ( isMinWaste ) ? waste : y + size.height;
+		const CGFloat secondary = ( isMinWaste ) ? y + size.height : packer->segments[i].width;
+
+		if ( !_CBHAtlasPlacement_isBetter(*best, primary, secondary) ) { continue; }
+
+		*best = (CBHAtlasPlacement){
+			.rect = NSRect_init(packer->segments[i].x, y, size.width, size.height),
+			.index = i,
+			.primary = primary,
+			.secondary = secondary,
+			.rotated = rotated,
+		};
+	}
+}
+
+static BOOL _CBHAtlasPacker_placeInSkyline(CBHAtlasPacker * const packer, const NSRect used, const NSUInteger index)
+{
+	if ( !_CBHAtlasPacker_reserve((void **)&packer->segments, &packer->segmentCapacity, packer->segmentCount + 1, sizeof(CBHAtlasSegment)) ) { return NO; }
+
+	CBHAtlasSegment * const segments = packer->segments;
+	const CGFloat maxX = NSRect_maxX(used);
+
+	memmove(segments + index + 1, segments + index, sizeof(CBHAtlasSegment) * (packer->segmentCount - index));
+	segments[index] = (CBHAtlasSegment){ .x = used.origin.x, .y = NSRect_maxY(used), .width = used.size.width };
+	++packer->segmentCount;
+
+	// Drop or shorten the segments now beneath the new one.
+	NSUInteger next = index + 1;
+	while ( next < packer->segmentCount && segments[next].x < maxX )
+	{
+		const CGFloat segmentMaxX = segments[next].x + segments[next].width;
+
+		if ( segmentMaxX <= maxX )
+		{
+			memmove(segments + next, segments + next + 1, sizeof(CBHAtlasSegment) * (packer->segmentCount - next - 1));
+			--packer->segmentCount;
+			continue;
+		}
+
+		segments[next].width = segmentMaxX - maxX;
+		segments[next].x = maxX;
+		break;
+	}
+
+	// Merge neighbours at the same height.
+	NSUInteger count = 0;
+	for (NSUInteger i = 0; i < packer->segmentCount; ++i)
+	{
+		if ( count > 0 && segments[count - 1].y == segments[i].y ) { segments[count - 1].width = (segments[i].x + segments[i].width) - segments[count - 1].x; }
+		else { segments[count++] = segments[i]; }
+	}
+
+	packer->segmentCount = count;
+
+	return YES;
+}
+
+
+#pragma mark - Creating Atlas Packers
+
+CBHAtlasPacker *CBHAtlasPacker_create(const NSSize size, const CBHAtlasHeuristic heuristic, const CGFloat padding, const BOOL allowsRotation)
+{
+	if ( !_CBHAtlasPacker_isPlaceable(size) || !isfinite(padding) || padding < 0.0 ) { return NULL; }
+	if ( heuristic < CBHAtlasHeuristicMaxRectsBestShortSideFit || heuristic > CBHAtlasHeuristicSkylineMinWaste ) { return NULL; }
+
+	CBHAtlasPacker * const packer = calloc(1, sizeof(CBHAtlasPacker));
+	if ( packer == NULL ) { return NULL; }
+
+	packer->size = size;
+	packer->paddedSize = NSSize_init(size.width + padding, size.height + padding);
+	packer->padding = padding;
+	packer->heuristic = heuristic;
+	packer->allowsRotation = allowsRotation;
+
+	BOOL isReserved;
+	if ( _CBHAtlasPacker_isMaxRects(heuristic) ) { isReserved = _CBHAtlasPacker_reserve((void **)&packer->freeRects, &packer->freeCapacity, 1, sizeof(NSRect)); }
+	else { isReserved = _CBHAtlasPacker_reserve((void **)&packer->segments, &packer->segmentCapacity, 1, sizeof(CBHAtlasSegment)); }
+
+	if ( !isReserved )
+	{
+		CBHAtlasPacker_destroy(packer);
+		return NULL;
+	}
+
+	CBHAtlasPacker_reset(packer);
+
+	return packer;
+}
+
+void CBHAtlasPacker_destroy(CBHAtlasPacker * const packer)
+{
+	if ( packer == NULL ) { return; }
+
+	free(packer->freeRects);
+	free(packer->segments);
+	free(packer);
+}
+
+void CBHAtlasPacker_reset(CBHAtlasPacker * const packer)
+{
+	packer->count = 0;
+	packer->usedArea = 0.0;
+
+	if ( _CBHAtlasPacker_isMaxRects(packer->heuristic) )
+	{
+		packer->freeRects[0] = NSRect_init(0.0, 0.0, packer->paddedSize.width, packer->paddedSize.height);
+		packer->freeCount = 1;
+	}
+	else
+	{
+		packer->segments[0] = (CBHAtlasSegment){ .x = 0.0, .y = 0.0, .width = packer->paddedSize.width };
+		packer->segmentCount = 1;
+	}
+}
+
+
+#pragma mark - Properties
+
+NSSize CBHAtlasPacker_size(const CBHAtlasPacker * const packer)
+{
+	return packer->size;
+}
+
+NSUInteger CBHAtlasPacker_count(const CBHAtlasPacker * const packer)
+{
+	return packer->count;
+}
+
+CGFloat CBHAtlasPacker_occupancy(const CBHAtlasPacker * const packer)
+{
+	return packer->usedArea / (packer->size.width * packer->size.height);
+}
+
+
+#pragma mark - Placing Rects
+
+BOOL CBHAtlasPacker_insert(CBHAtlasPacker * const packer, const NSSize size, NSRect * const rect, BOOL * const rotated)
+{
+	if ( !_CBHAtlasPacker_isPlaceable(size) ) { return NO; }
+
+	const NSSize padded = NSSize_init(size.width + packer->padding, size.height + packer->padding);
+	const NSSize turned = NSSize_init(padded.height, padded.width);
+	const BOOL isMaxRects = _CBHAtlasPacker_isMaxRects(packer->heuristic);
+	const BOOL tryTurned = packer->allowsRotation && ( size.width != size.height );
+
+	CBHAtlasPlacement best = { .index = NSNotFound, .primary = INFINITY, .secondary = INFINITY };
+
+	if ( isMaxRects )
+	{
+		_CBHAtlasPacker_scoreFreeRects(packer, padded, NO, &best);
+		if ( tryTurned ) { _CBHAtlasPacker_scoreFreeRects(packer, turned, YES, &best); }
+	}
+	else
+	{
+		_CBHAtlasPacker_scoreSegments(packer, padded, NO, &best);
+		if ( tryTurned ) { _CBHAtlasPacker_scoreSegments(packer, turned, YES, &best); }
+	}
+
+	if ( best.index == NSNotFound ) { return NO; }
+
+	const BOOL isPlaced = ( isMaxRects ) ? _CBHAtlasPacker_placeInFreeRects(packer, best.rect) : _CBHAtlasPacker_placeInSkyline(packer, best.rect, best.index);
+	if ( !isPlaced ) { return NO; }
+
+	++packer->count;
+	packer->usedArea += size.width * size.height;
+
+	if ( rect != NULL ) { *rect = NSRect_init(best.rect.origin.x, best.rect.origin.y, best.rect.size.width - packer->padding, best.rect.size.height - packer->padding); }
+	if ( rotated != NULL ) { *rotated = best.rotated; }
+
+	return YES;
+}
+
+// Longest side first, then the other side, then the original order so equal sizes pack the same way every time.
+static int _CBHAtlasItem_compare(const void * const lhs, const void * const rhs)
+{
+	const CBHAtlasItem * const item = lhs;
+	const CBHAtlasItem * const other = rhs;
+
+	const CGFloat longest = MAX(item->size.width, item->size.height);
+	const CGFloat otherLongest = MAX(other->size.width, other->size.height);
+	if ( longest != otherLongest ) { return ( longest > otherLongest ) ? -1 : 1; }
+
+	const CGFloat shortest = MIN(item->size.width, item->size.height);
+	const CGFloat otherShortest = MIN(other->size.width, other->size.height);
+	if ( shortest != otherShortest ) { return ( shortest > otherShortest ) ? -1 : 1; }
+
+	return ( item->index > other->index ) - ( item->index < other->index );
+}
+
+NSUInteger CBHAtlasPacker_insertSizes(CBHAtlasPacker * const packer, const NSSize * const sizes, NSRect * const rects, BOOL * const rotated, const NSUInteger count)
+{
+	CBHAtlasItem * const items = malloc(sizeof(CBHAtlasItem) * MAX(count, 1UL));
+	if ( items == NULL ) { return NSNotFound; }
+
+	NSUInteger itemCount = 0;
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		rects[i] = NSRect_initEmpty();
+		if ( rotated != NULL ) { rotated[i] = NO; }
+
+		if ( _CBHAtlasPacker_isPlaceable(sizes[i]) ) { items[itemCount++] = (CBHAtlasItem){ .size = sizes[i], .index = i }; }
+	}
+
+	qsort(items, itemCount, sizeof(CBHAtlasItem), _CBHAtlasItem_compare);
+
+	NSUInteger placedCount = 0;
+	for (NSUInteger i = 0; i < itemCount; ++i)
+	{
+		const NSUInteger index = items[i].index;
+		if ( CBHAtlasPacker_insert(packer, items[i].size, rects + index, ( rotated != NULL ) ? rotated + index : NULL) ) { ++placedCount; }
+	}
+
+	free(items);
+
+	return placedCount;
+}
@@ -0,0 +1,254 @@
+//  CBHGeometryArchive.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** A read-only binary archive of geometry arrays, read in place without parsing or copying.
+ *
+ * An archive holds a list of sections, each an array of points, sizes, rects or ranges. Reals are stored as 64 or 32 bit
+ * floats and ranges as 64 bit integers, in the byte order of the machine which wrote them. Archives are written with
+ * `CBHGeometryArchiveWriter`.
+ *
+ * Opening a file maps it into memory, so only the pages actually read are loaded. Every offset and length is validated
+ * when the archive is opened, after which sections stored in the native layout are available as plain C arrays.
+ *
+ * The layout, with every integer in the writer's byte order:
+ *
+ * - A 32 byte header: the magic "CBHGEOM", a 32 bit version and the 32 bit byte order mark 0x01020304.
+ * - The values of each section, starting on a 16 byte boundary.
+ * - The section table: for each section a 32 bit kind, a 32 bit storage, a 64 bit count, and a 64 bit offset from
+ *   the start of the archive, padded to 32 bytes.
+ * - A 32 byte trailer: the 64 bit offset of the section table, the 64 bit number of sections, and the magic again.
+ */
+typedef struct CBHGeometryArchive CBHGeometryArchive;
+
+/** The kind of values held by a section. */
+typedef NS_ENUM(uint32_t, CBHGeometryArchiveKind)
+{
+	CBHGeometryArchiveKindPoints = 1,
+	CBHGeometryArchiveKindSizes = 2,
+	CBHGeometryArchiveKindRects = 3,
+	CBHGeometryArchiveKindRanges = 4,
+};
+
+/** How each component of a section's values is stored. */
+typedef NS_ENUM(uint32_t, CBHGeometryArchiveStorage)
+{
+	/** 64 bit floats, used for points, sizes and rects. */
+	CBHGeometryArchiveStorageFloat64 = 1,
+
+	/** 32 bit floats, used for points, sizes and rects which tolerate the lost precision. */
+	CBHGeometryArchiveStorageFloat32 = 2,
+
+	/** 64 bit unsigned integers, used for ranges. */
+	CBHGeometryArchiveStorageUInt64 = 3,
+};
+
+/** The outcome of opening an archive. */
+typedef NS_ENUM(NSInteger, CBHGeometryArchiveStatus)
+{
+	CBHGeometryArchiveStatusSuccess = 0,
+
+	/** The file could not be opened or mapped, or the storage could not be allocated. */
+	CBHGeometryArchiveStatusUnreadable,
+
+	/** The bytes are not an archive, are truncated, or describe sections outside of the archive. */
+	CBHGeometryArchiveStatusInvalid,
+
+	/** The archive was written by a newer version of the format. */
+	CBHGeometryArchiveStatusUnsupportedVersion,
+
+	/** The archive was written on a machine with the other byte order. */
+	CBHGeometryArchiveStatusWrongByteOrder,
+};
+
+/** A description of one section of an archive. */
+typedef struct CBHGeometryArchiveSection
+{
+	CBHGeometryArchiveKind kind;
+	CBHGeometryArchiveStorage storage;
+	NSUInteger count;
+
+	/** The stored values, which live as long as the archive. */
+	const void *values;
+} CBHGeometryArchiveSection;
+
+
+#pragma mark - Opening Archives
+
+/**
+ * @name Opening Archives
+ */
+
+/** Opens an archive by mapping a file into memory.
+ *
+ * @param path          The path of the file to open.
+ * @param status        Receives the outcome.
+ *
+ * @return              A new archive, or `NULL` if the file is not a valid archive. Release it with `CBHGeometryArchive_destroy()`.
+ */
+CBHGeometryArchive * _Nullable CBHGeometryArchive_createWithContentsOfFile(const char *path, CBHGeometryArchiveStatus * _Nullable status);
+
+/** Opens an archive held in memory, without copying it.
+ *
+ * @param bytes         The archive, aligned to 16 bytes. It must outlive the archive and remain unchanged.
+ * @param length        The number of bytes in _bytes_.
+ * @param status        Receives the outcome.
+ *
+ * @return              A new archive, or `NULL` if the bytes are not a valid archive. Release it with `CBHGeometryArchive_destroy()`.
+ */
+CBHGeometryArchive * _Nullable CBHGeometryArchive_createWithBytes(const void *bytes, NSUInteger length, CBHGeometryArchiveStatus * _Nullable status);
+
+/** Releases an archive, unmapping its file.
+ *
+ * @param archive       The archive to release.
+ */
+void CBHGeometryArchive_destroy(CBHGeometryArchive * _Nullable archive);
+
+
+#pragma mark - Sections
+
+/**
+ * @name Sections
+ */
+
+/** The number of sections in an archive.
+ *
+ * @param archive       The archive.
+ *
+ * @return              The number of sections.
+ */
+NSUInteger CBHGeometryArchive_sectionCount(const CBHGeometryArchive *archive);
+
+/** Describes a section of an archive.
+ *
+ * @param archive       The archive.
+ * @param index         The index of the section, which must be less than the section count.
+ *
+ * @return              The section's kind, storage, count and values.
+ */
+CBHGeometryArchiveSection CBHGeometryArchive_sectionAtIndex(const CBHGeometryArchive *archive, NSUInteger index);
+
+
+#pragma mark - Reading Values in Place
+
+/**
+ * @name Reading Values in Place
+ *
+ * These functions return a section's values without copying them when the section holds the right kind of value in
+ * the native layout, which is 64 bit floats for reals. Otherwise they return `NULL`.
+ */
+
+/** The points of a section.
+ *
+ * @param archive       The archive.
+ * @param index         The index of the section.
+ * @param count         Receives the number of points.
+ *
+ * @return              The points, which live as long as the archive, or `NULL`.
+ */
+const NSPoint * _Nullable CBHGeometryArchive_points(const CBHGeometryArchive *archive, NSUInteger index, NSUInteger * _Nullable count);
+
+/** The sizes of a section.
+ *
+ * @param archive       The archive.
+ * @param index         The index of the section.
+ * @param count         Receives the number of sizes.
+ *
+ * @return              The sizes, which live as long as the archive, or `NULL`.
+ */
+const NSSize * _Nullable CBHGeometryArchive_sizes(const CBHGeometryArchive *archive, NSUInteger index, NSUInteger * _Nullable count);
+
+/** The rects of a section.
+ *
+ * @param archive       The archive.
+ * @param index         The index of the section.
+ * @param count         Receives the number of rects.
+ *
+ * @return              The rects, which live as long as the archive, or `NULL`.
+ */
+const NSRect * _Nullable CBHGeometryArchive_rects(const CBHGeometryArchive *archive, NSUInteger index, NSUInteger * _Nullable count);
+
+/** The ranges of a section.
+ *
+ * @param archive       The archive.
+ * @param index         The index of the section.
+ * @param count         Receives the number of ranges.
+ *
+ * @return              The ranges, which live as long as the archive, or `NULL`.
+ */
+const NSRange * _Nullable CBHGeometryArchive_ranges(const CBHGeometryArchive *archive, NSUInteger index, NSUInteger * _Nullable count);
+
+
+#pragma mark - Copying Values
+
+/**
+ * @name Copying Values
+ *
+ * These functions copy a span of a section's values into a buffer, converting from any storage. They return the number
+ * of values copied, which is 0 if the section holds a different kind of value.
+ */
+
+/** Copies points from a section.
+ *
+ * @param archive       The archive.
+ * @param index         The index of the section.
+ * @param range         The span of points to copy, which is clamped to the section.
+ * @param points        A buffer to receive the points, large enough for _range_.
+ *
+ * @return              The number of points copied.
+ */
+NSUInteger CBHGeometryArchive_getPoints(const CBHGeometryArchive *archive, NSUInteger index, NSRange range, NSPoint *points);
+
+/** Copies sizes from a section.
+ *
+ * @param archive       The archive.
+ * @param index         The index of the section.
+ * @param range         The span of sizes to copy, which is clamped to the section.
+ * @param sizes         A buffer to receive the sizes, large enough for _range_.
+ *
+ * @return              The number of sizes copied.
+ */
+NSUInteger CBHGeometryArchive_getSizes(const CBHGeometryArchive *archive, NSUInteger index, NSRange range, NSSize *sizes);
+
+/** Copies rects from a section.
+ *
+ * @param archive       The archive.
+ * @param index         The index of the section.
+ * @param range         The span of rects to copy, which is clamped to the section.
+ * @param rects         A buffer to receive the rects, large enough for _range_.
+ *
+ * @return              The number of rects copied.
+ */
+NSUInteger CBHGeometryArchive_getRects(const CBHGeometryArchive *archive, NSUInteger index, NSRange range, NSRect *rects);
+
+/** Copies ranges from a section.
+ *
+ * @param archive       The archive.
+ * @param index         The index of the section.
+ * @param range         The span of ranges to copy, which is clamped to the section.
+ * @param ranges        A buffer to receive the ranges, large enough for _range_.
+ *
+ * @return              The number of ranges copied.
+ */
+NSUInteger CBHGeometryArchive_getRanges(const CBHGeometryArchive *archive, NSUInteger index, NSRange range, NSRange *ranges);
+
+NS_ASSUME_NONNULL_END
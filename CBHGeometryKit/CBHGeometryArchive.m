@@ -0,0 +1,290 @@
+//  CBHGeometryArchive.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHGeometryArchive.h"
+
+#import "_CBHGeometryKit+Utilities.h"
+#import "_CBHGeometryKit+Archive.h"
+
+#import <fcntl.h>
+#import <string.h>
+#import <sys/mman.h>
+#import <sys/stat.h>
+#import <unistd.h>
+
+
+struct CBHGeometryArchive
+{
+	const uint8_t *bytes;
+	NSUInteger length;
+
+	const CBHArchiveEntry *entries;
+	NSUInteger sectionCount;
+
+	BOOL isMapped;
+};
+
+
+#pragma mark - Validation
+
+static CBHGeometryArchiveStatus _CBHGeometryArchive_validateEntry(const CBHArchiveEntry * const entry, const uint64_t tableOffset)
+{
+	if ( !CBHArchive_isValidLayout(entry->kind, entry->storage) ) { return CBHGeometryArchiveStatusInvalid; }
+	if ( entry->offset < sizeof(CBHArchiveHeader) || entry->offset > tableOffset ) { return CBHGeometryArchiveStatusInvalid; }
+	if ( entry->offset % kCBHArchiveAlignment != 0 ) { return CBHGeometryArchiveStatusInvalid; }
+
+	const uint64_t stride = CBHArchive_componentCount(entry->kind) * CBHArchive_componentSize(entry->storage);
+	if ( entry->count > (tableOffset - entry->offset) / stride ) { return CBHGeometryArchiveStatusInvalid; }
+	if ( entry->count > NSUIntegerMax ) { return CBHGeometryArchiveStatusInvalid; }
+
+	return CBHGeometryArchiveStatusSuccess;
+}
+
+static CBHGeometryArchiveStatus _CBHGeometryArchive_validate(CBHGeometryArchive * const archive)
+{
+	const NSUInteger length = archive->length;
+	if ( length < sizeof(CBHArchiveHeader) + sizeof(CBHArchiveTrailer) ) { return CBHGeometryArchiveStatusInvalid; }
+	if ( (uintptr_t)archive->bytes % kCBHArchiveAlignment != 0 ) { return CBHGeometryArchiveStatusInvalid; }
+
+	CBHArchiveHeader header;
+	memcpy(&header, archive->bytes, sizeof(CBHArchiveHeader));
+
+	if ( memcmp(header.magic, kCBHArchiveMagic, sizeof(kCBHArchiveMagic)) != 0 ) { return CBHGeometryArchiveStatusInvalid; }
+	if ( header.byteOrderMark == kCBHArchiveSwappedByteOrderMark ) { return CBHGeometryArchiveStatusWrongByteOrder; }
+	if ( header.byteOrderMark != kCBHArchiveByteOrderMark ) { return CBHGeometryArchiveStatusInvalid; }
+	if ( header.version == 0 ) { return CBHGeometryArchiveStatusInvalid; }
+	if ( header.version > kCBHArchiveVersion ) { return CBHGeometryArchiveStatusUnsupportedVersion; }
+
+	CBHArchiveTrailer trailer;
+	memcpy(&trailer, archive->bytes + length - sizeof(CBHArchiveTrailer), sizeof(CBHArchiveTrailer));
+
+	if ( memcmp(trailer.magic, kCBHArchiveMagic, sizeof(kCBHArchiveMagic)) != 0 ) { return CBHGeometryArchiveStatusInvalid; }
+
+	// The table must sit exactly between the last section and the trailer.
+	const uint64_t tableEnd = length - sizeof(CBHArchiveTrailer);
+	if ( trailer.tableOffset < sizeof(CBHArchiveHeader) || trailer.tableOffset > tableEnd ) { return CBHGeometryArchiveStatusInvalid; }
+	if ( trailer.tableOffset % kCBHArchiveAlignment != 0 ) { return CBHGeometryArchiveStatusInvalid; }
+	if ( trailer.sectionCount != (tableEnd - trailer.tableOffset) / sizeof(CBHArchiveEntry) ) { return CBHGeometryArchiveStatusInvalid; }
+	if ( (tableEnd - trailer.tableOffset) % sizeof(CBHArchiveEntry) != 0 ) { return CBHGeometryArchiveStatusInvalid; }
+
+	archive->entries = (const CBHArchiveEntry *)(const void *)(archive->bytes + trailer.tableOffset);
+	archive->sectionCount = (NSUInteger)trailer.sectionCount;
+
+	for (NSUInteger i = 0; i < archive->sectionCount; ++i)
+	{
+		const CBHGeometryArchiveStatus status = _CBHGeometryArchive_validateEntry(&archive->entries[i], trailer.tableOffset);
+		if ( status != CBHGeometryArchiveStatusSuccess ) { return status; }
+	}
+
+	return CBHGeometryArchiveStatusSuccess;
+}
+
+static CBHGeometryArchive *_CBHGeometryArchive_open(CBHGeometryArchive * const archive, CBHGeometryArchiveStatus * const status)
+{
+	const CBHGeometryArchiveStatus result = _CBHGeometryArchive_validate(archive);
+	if ( status != NULL ) { *status = result; }
+
+	if ( result == CBHGeometryArchiveStatusSuccess ) { return archive; }
+
+	CBHGeometryArchive_destroy(archive);
+	return NULL;
+}
+
+
+#pragma mark - Opening Archives
+
+CBHGeometryArchive *CBHGeometryArchive_createWithContentsOfFile(const char * const path, CBHGeometryArchiveStatus * const status)
+{
+	if ( status != NULL ) { *status = CBHGeometryArchiveStatusUnreadable; }
+
+	const int fileDescriptor = open(path, O_RDONLY);
+	if ( fileDescriptor < 0 ) { return NULL; }
+
+	struct stat info;
+	if ( fstat(fileDescriptor, &info) != 0 || (unsigned long long)info.st_size > NSUIntegerMax )
+	{
+		close(fileDescriptor);
+		return NULL;
+	}
+
+	// Empty files cannot be mapped, and are not archives anyway.
+	if ( info.st_size < (off_t)(sizeof(CBHArchiveHeader) + sizeof(CBHArchiveTrailer)) )
+	{
+		close(fileDescriptor);
+		if ( status != NULL ) { *status = CBHGeometryArchiveStatusInvalid; }
+		return NULL;
+	}
+
+	const NSUInteger length = (NSUInteger)info.st_size;
+	void * const bytes = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+	close(fileDescriptor);
+
+	if ( bytes == MAP_FAILED ) { return NULL; }
+
+	CBHGeometryArchive * const archive = calloc(1, sizeof(CBHGeometryArchive));
+	if ( archive == NULL )
+	{
+		munmap(bytes, length);
+		return NULL;
+	}
+
+	archive->bytes = bytes;
+	archive->length = length;
+	archive->isMapped = YES;
+
+	return _CBHGeometryArchive_open(archive, status);
+}
+
+CBHGeometryArchive *CBHGeometryArchive_createWithBytes(const void * const bytes, const NSUInteger length, CBHGeometryArchiveStatus * const status)
+{
+	CBHGeometryArchive * const archive = calloc(1, sizeof(CBHGeometryArchive));
+	if ( archive == NULL )
+	{
+		if ( status != NULL ) { *status = CBHGeometryArchiveStatusUnreadable; }
+		return NULL;
+	}
+
+	archive->bytes = bytes;
+	archive->length = length;
+
+	return _CBHGeometryArchive_open(archive, status);
+}
+
+void CBHGeometryArchive_destroy(CBHGeometryArchive * const archive)
+{
+	if ( archive == NULL ) { return; }
+
+	if ( archive->isMapped ) { munmap((void *)archive->bytes, archive->length); }
+	free(archive);
+}
+
+
+#pragma mark - Sections
+
+CBH_PURE NSUInteger CBHGeometryArchive_sectionCount(const CBHGeometryArchive * const archive)
+{
+	return archive->sectionCount;
+}
+
+CBH_PURE CBHGeometryArchiveSection CBHGeometryArchive_sectionAtIndex(const CBHGeometryArchive * const archive, const NSUInteger index)
+{
+	NSCParameterAssert(index < archive->sectionCount);
+
+	const CBHArchiveEntry * const entry = &archive->entries[index];
+	return (CBHGeometryArchiveSection){
+		.kind = entry->kind,
+		.storage = entry->storage,
+		.count = (NSUInteger)entry->count,
+		.values = archive->bytes + entry->offset,
+	};
+}
+
+
+#pragma mark - Reading Values in Place
+
+static const void *_CBHGeometryArchive_nativeValues(const CBHGeometryArchive * const archive, const NSUInteger index, const CBHGeometryArchiveKind kind, NSUInteger * const count)
+{
+	const CBHGeometryArchiveSection section = CBHGeometryArchive_sectionAtIndex(archive, index);
+	const BOOL isReadable = ( section.kind == kind ) && CBHArchive_isNativeStorage(section.storage);
+
+	if ( count != NULL ) { *count = ( isReadable ) ? section.count : 0; }
+	return ( isReadable ) ? section.values : NULL;
+}
+
+const NSPoint *CBHGeometryArchive_points(const CBHGeometryArchive * const archive, const NSUInteger index, NSUInteger * const count)
+{
+	return _CBHGeometryArchive_nativeValues(archive, index, CBHGeometryArchiveKindPoints, count);
+}
+
+const NSSize *CBHGeometryArchive_sizes(const CBHGeometryArchive * const archive, const NSUInteger index, NSUInteger * const count)
+{
+	return _CBHGeometryArchive_nativeValues(archive, index, CBHGeometryArchiveKindSizes, count);
+}
+
+const NSRect *CBHGeometryArchive_rects(const CBHGeometryArchive * const archive, const NSUInteger index, NSUInteger * const count)
+{
+	return _CBHGeometryArchive_nativeValues(archive, index, CBHGeometryArchiveKindRects, count);
+}
+
+const NSRange *CBHGeometryArchive_ranges(const CBHGeometryArchive * const archive, const NSUInteger index, NSUInteger * const count)
+{
+	return _CBHGeometryArchive_nativeValues(archive, index, CBHGeometryArchiveKindRanges, count);
+}
+
+
+#pragma mark - Copying Values
+
+static NSUInteger _CBHGeometryArchive_copy(const CBHGeometryArchive * const archive, const NSUInteger index, const CBHGeometryArchiveKind kind, const NSRange range, void * const values)
+{
+	const CBHGeometryArchiveSection section = CBHGeometryArchive_sectionAtIndex(archive, index);
+	if ( section.kind != kind || range.location >= section.count ) { return 0; }
+
+	const NSUInteger count = MIN(range.length, section.count - range.location);
+	const NSUInteger components = CBHArchive_componentCount(kind);
+	const NSUInteger first = range.location * components;
+	const NSUInteger total = count * components;
+
+	switch ( section.storage )
+	{
+		case CBHGeometryArchiveStorageFloat64:
+		{
+			const double * const source = (const double *)section.values + first;
+			CGFloat * const destination = values;
+			for (NSUInteger i = 0; i < total; ++i) { destination[i] = (CGFloat)source[i]; }
+			break;
+		}
+
+		case CBHGeometryArchiveStorageFloat32:
+		{
+			const float * const source = (const float *)section.values + first;
+			CGFloat * const destination = values;
+			for (NSUInteger i = 0; i < total; ++i) { destination[i] = (CGFloat)source[i]; }
+			break;
+		}
+
+		case CBHGeometryArchiveStorageUInt64:
+		{
+			const uint64_t * const source = (const uint64_t *)section.values + first;
+			NSUInteger * const destination = values;
+			for (NSUInteger i = 0; i < total; ++i) { destination[i] = (NSUInteger)source[i]; }
+			break;
+		}
+	}
+
+	return count;
+}
+
+NSUInteger CBHGeometryArchive_getPoints(const CBHGeometryArchive * const archive, const NSUInteger index, const NSRange range, NSPoint * const points)
+{
+	return _CBHGeometryArchive_copy(archive, index, CBHGeometryArchiveKindPoints, range, points);
+}
+
+NSUInteger CBHGeometryArchive_getSizes(const CBHGeometryArchive * const archive, const NSUInteger index, const NSRange range, NSSize * const sizes)
+{
+	return _CBHGeometryArchive_copy(archive, index, CBHGeometryArchiveKindSizes, range, sizes);
+}
+
+NSUInteger CBHGeometryArchive_getRects(const CBHGeometryArchive * const archive, const NSUInteger index, const NSRange range, NSRect * const rects)
+{
+	return _CBHGeometryArchive_copy(archive, index, CBHGeometryArchiveKindRects, range, rects);
+}
+
+NSUInteger CBHGeometryArchive_getRanges(const CBHGeometryArchive * const archive, const NSUInteger index, const NSRange range, NSRange * const ranges)
+{
+	return _CBHGeometryArchive_copy(archive, index, CBHGeometryArchiveKindRanges, range, ranges);
+}
@@ -0,0 +1,159 @@
+//  CBHGeometryArchiveWriter.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+#import <CBHGeometryKit/CBHGeometryArchive.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** A writer which streams geometry arrays into a `CBHGeometryArchive`.
+ *
+ * Values are appended to the current section, which is started with `CBHGeometryArchiveWriter_beginSection()`, and
+ * are converted to the section's storage as they are written. A section can be appended to any number of times, so
+ * collections too large to hold in memory can be written a piece at a time. The section table is written by
+ * `CBHGeometryArchiveWriter_finish()`; until then the output is not a valid archive.
+ *
+ * A writer either collects its output in a growable buffer of bytes or passes it to a file descriptor in large blocks.
+ * Once a write fails the writer stops writing, and every later call returns `NO`.
+ */
+typedef struct CBHGeometryArchiveWriter CBHGeometryArchiveWriter;
+
+
+#pragma mark - Creating Writers
+
+/**
+ * @name Creating Writers
+ */
+
+/** Creates an archive writer which collects its output in memory.
+ *
+ * @return              A new writer, or `NULL` if the storage could not be allocated. Release it with `CBHGeometryArchiveWriter_destroy()`.
+ */
+CBHGeometryArchiveWriter * _Nullable CBHGeometryArchiveWriter_create(void);
+
+/** Creates an archive writer which passes its output to a file descriptor.
+ *
+ * @param fileDescriptor    The open file descriptor to write to. The writer does not close it.
+ *
+ * @return                  A new writer, or `NULL` if the storage could not be allocated. Release it with `CBHGeometryArchiveWriter_destroy()`.
+ */
+CBHGeometryArchiveWriter * _Nullable CBHGeometryArchiveWriter_createWithFileDescriptor(int fileDescriptor);
+
+/** Releases an archive writer without finishing the archive.
+ *
+ * @param writer        The writer to release.
+ */
+void CBHGeometryArchiveWriter_destroy(CBHGeometryArchiveWriter * _Nullable writer);
+
+
+#pragma mark - Output
+
+/**
+ * @name Output
+ */
+
+/** The bytes collected by a writer created with `CBHGeometryArchiveWriter_create()`.
+ *
+ * Once the writer is finished these bytes can be opened with `CBHGeometryArchive_createWithBytes()`.
+ *
+ * @param writer        The writer.
+ *
+ * @return              The output, which remains valid until the next write, or `NULL` if the writer passes its
+ *                      output to a file descriptor.
+ */
+const void * _Nullable CBHGeometryArchiveWriter_bytes(const CBHGeometryArchiveWriter *writer);
+
+/** The number of bytes written so far.
+ *
+ * @param writer        The writer.
+ *
+ * @return              The number of bytes written, including any not yet passed to the file descriptor.
+ */
+NSUInteger CBHGeometryArchiveWriter_length(const CBHGeometryArchiveWriter *writer);
+
+
+#pragma mark - Writing Archives
+
+/**
+ * @name Writing Archives
+ *
+ * These functions return `NO` if the output could not be grown or written, or if the writer is already finished.
+ */
+
+/** Starts a new section, ending the current one.
+ *
+ * @param writer        The writer.
+ * @param kind          The kind of values the section holds.
+ * @param storage       How the values are stored. Points, sizes and rects may use either float storage and ranges
+ *                      must use `CBHGeometryArchiveStorageUInt64`.
+ *
+ * @return              `YES` if the section was started, or `NO` if the storage does not suit the kind.
+ */
+BOOL CBHGeometryArchiveWriter_beginSection(CBHGeometryArchiveWriter *writer, CBHGeometryArchiveKind kind, CBHGeometryArchiveStorage storage);
+
+/** Appends points to the current section, which must hold points.
+ *
+ * @param writer        The writer.
+ * @param points        The points to write.
+ * @param count         The number of points in _points_.
+ *
+ * @return              `YES` if the points were written, otherwise `NO`.
+ */
+BOOL CBHGeometryArchiveWriter_appendPoints(CBHGeometryArchiveWriter *writer, const NSPoint *points, NSUInteger count);
+
+/** Appends sizes to the current section, which must hold sizes.
+ *
+ * @param writer        The writer.
+ * @param sizes         The sizes to write.
+ * @param count         The number of sizes in _sizes_.
+ *
+ * @return              `YES` if the sizes were written, otherwise `NO`.
+ */
+BOOL CBHGeometryArchiveWriter_appendSizes(CBHGeometryArchiveWriter *writer, const NSSize *sizes, NSUInteger count);
+
+/** Appends rects to the current section, which must hold rects.
+ *
+ * @param writer        The writer.
+ * @param rects         The rects to write.
+ * @param count         The number of rects in _rects_.
+ *
+ * @return              `YES` if the rects were written, otherwise `NO`.
+ */
+BOOL CBHGeometryArchiveWriter_appendRects(CBHGeometryArchiveWriter *writer, const NSRect *rects, NSUInteger count);
+
+/** Appends ranges to the current section, which must hold ranges.
+ *
+ * @param writer        The writer.
+ * @param ranges        The ranges to write.
+ * @param count         The number of ranges in _ranges_.
+ *
+ * @return              `YES` if the ranges were written, otherwise `NO`.
+ */
+BOOL CBHGeometryArchiveWriter_appendRanges(CBHGeometryArchiveWriter *writer, const NSRange *ranges, NSUInteger count);
+
+/** Writes the section table and passes any buffered output to the file descriptor, completing the archive.
+ *
+ * @param writer        The writer.
+ *
+ * @return              `YES` if the archive was completed, otherwise `NO`.
+ */
+BOOL CBHGeometryArchiveWriter_finish(CBHGeometryArchiveWriter *writer);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,322 @@
+//  CBHGeometryArchiveWriter.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHGeometryArchiveWriter.h"
+
+#import "_CBHGeometryKit+Utilities.h"
+#import "_CBHGeometryKit+Archive.h"
+
+#import <errno.h>
+#import <string.h>
+#import <unistd.h>
+
+
+// Memory writers double their buffer as it fills. File descriptor writers keep one block, flushing it whenever it
+// cannot take the next piece.
+enum
+{
+	kCBHArchiveWriterInitialCapacity = 4096,
+	kCBHArchiveWriterBlockLength = 1 << 16,
+	kCBHArchiveWriterMinimumSpace = 64,
+};
+
+struct CBHGeometryArchiveWriter
+{
+	uint8_t *bytes;
+	NSUInteger length;
+	NSUInteger capacity;
+	NSUInteger flushedLength;
+	int fileDescriptor;
+
+	CBHArchiveEntry *entries;
+	NSUInteger sectionCount;
+	NSUInteger sectionCapacity;
+
+	BOOL isFinished;
+	BOOL hasFailed;
+};
+
+
+#pragma mark - Utilities
+
+static BOOL _CBHGeometryArchiveWriter_flush(CBHGeometryArchiveWriter * const writer)
+{
+	if ( writer->fileDescriptor < 0 ) { return YES; }
+
+	for (NSUInteger offset = 0; offset < writer->length;)
+	{
+		const ssize_t written = write(writer->fileDescriptor, writer->bytes + offset, writer->length - offset);
+		if ( written < 0 )
+		{
+			if ( errno == EINTR ) { continue; }
+
+			writer->hasFailed = YES;
+			return NO;
+		}
+
+		offset += (NSUInteger)written;
+	}
+
+	writer->flushedLength += writer->length;
+	writer->length = 0;
+	return YES;
+}
+
+/// Makes room for up to `wanted` bytes, returning the room available. File descriptor writers may offer less than
+/// asked for, but always at least `kCBHArchiveWriterMinimumSpace` bytes. Returns 0 on failure.
+static NSUInteger _CBHGeometryArchiveWriter_reserve(CBHGeometryArchiveWriter * const writer, const NSUInteger wanted)
+{
+	if ( writer->hasFailed ) { return 0; }
+
+	const NSUInteger available = writer->capacity - writer->length;
+	if ( available >= wanted ) { return available; }
+
+	if ( writer->fileDescriptor >= 0 )
+	{
+		if ( available >= kCBHArchiveWriterMinimumSpace ) { return available; }
+		return ( _CBHGeometryArchiveWriter_flush(writer) ) ? writer->capacity : 0;
+	}
+
+	if ( wanted > NSUIntegerMax / 2 - writer->length )
+	{
+		writer->hasFailed = YES;
+		return 0;
+	}
+
+	const NSUInteger capacity = MAX(MAX(writer->capacity * 2, writer->length + wanted), (NSUInteger)kCBHArchiveWriterInitialCapacity);
+	uint8_t * const bytes = realloc(writer->bytes, capacity);
+	if ( bytes == NULL )
+	{
+		writer->hasFailed = YES;
+		return 0;
+	}
+
+	writer->bytes = bytes;
+	writer->capacity = capacity;
+	return capacity - writer->length;
+}
+
+static BOOL _CBHGeometryArchiveWriter_appendBytes(CBHGeometryArchiveWriter * const writer, const void * const bytes, const NSUInteger length)
+{
+	if ( _CBHGeometryArchiveWriter_reserve(writer, length) < length ) { return NO; }
+
+	memcpy(writer->bytes + writer->length, bytes, length);
+	writer->length += length;
+	return YES;
+}
+
+static BOOL _CBHGeometryArchiveWriter_align(CBHGeometryArchiveWriter * const writer)
+{
+	static const uint8_t padding[kCBHArchiveAlignment] = { 0 };
+
+	const NSUInteger remainder = CBHGeometryArchiveWriter_length(writer) % kCBHArchiveAlignment;
+	if ( remainder == 0 ) { return YES; }
+
+	return _CBHGeometryArchiveWriter_appendBytes(writer, padding, kCBHArchiveAlignment - remainder);
+}
+
+static CBHGeometryArchiveWriter *_CBHGeometryArchiveWriter_create(const int fileDescriptor, const NSUInteger capacity)
+{
+	CBHGeometryArchiveWriter * const writer = calloc(1, sizeof(CBHGeometryArchiveWriter));
+	if ( writer == NULL ) { return NULL; }
+
+	writer->bytes = malloc(capacity);
+	if ( writer->bytes == NULL )
+	{
+		free(writer);
+		return NULL;
+	}
+
+	writer->capacity = capacity;
+	writer->fileDescriptor = fileDescriptor;
+
+	CBHArchiveHeader header = { .version = kCBHArchiveVersion, .byteOrderMark = kCBHArchiveByteOrderMark };
+	memcpy(header.magic, kCBHArchiveMagic, sizeof(kCBHArchiveMagic));
+	_CBHGeometryArchiveWriter_appendBytes(writer, &header, sizeof(CBHArchiveHeader));
+
+	return writer;
+}
+
+/// Appends `count` values of `kind` to the current section, converting their `CGFloat` or `NSUInteger` components to
+/// the section's storage a block at a time.
+static BOOL _CBHGeometryArchiveWriter_append(CBHGeometryArchiveWriter * const writer, const CBHGeometryArchiveKind kind, const void * const values, const NSUInteger count)
+{
+	if ( writer->isFinished || writer->hasFailed || writer->sectionCount == 0 ) { return NO; }
+
+	CBHArchiveEntry * const entry = &writer->entries[writer->sectionCount - 1];
+	if ( entry->kind != kind ) { return NO; }
+
+	const NSUInteger size = CBHArchive_componentSize(entry->storage);
+	const NSUInteger total = count * CBHArchive_componentCount(kind);
+
+	for (NSUInteger done = 0; done < total;)
+	{
+		const NSUInteger available = _CBHGeometryArchiveWriter_reserve(writer, (total - done) * size);
+		if ( available < size ) { return NO; }
+
+		const NSUInteger length = MIN(total - done, available / size);
+		uint8_t * const output = writer->bytes + writer->length;
+
+		switch ( entry->storage )
+		{
+			case CBHGeometryArchiveStorageFloat64:
+			{
+				const CGFloat * const source = (const CGFloat *)values + done;
+				for (NSUInteger i = 0; i < length; ++i)
+				{
+					const double value = (double)source[i];
+					memcpy(output + i * sizeof(double), &value, sizeof(double));
+				}
+				break;
+			}
+
+			case CBHGeometryArchiveStorageFloat32:
+			{
+				const CGFloat * const source = (const CGFloat *)values + done;
+				for (NSUInteger i = 0; i < length; ++i)
+				{
+					const float value = (float)source[i];
+					memcpy(output + i * sizeof(float), &value, sizeof(float));
+				}
+				break;
+			}
+
+			case CBHGeometryArchiveStorageUInt64:
+			{
+				const NSUInteger * const source = (const NSUInteger *)values + done;
+				for (NSUInteger i = 0; i < length; ++i)
+				{
+					const uint64_t value = (uint64_t)source[i];
+					memcpy(output + i * sizeof(uint64_t), &value, sizeof(uint64_t));
+				}
+				break;
+			}
+		}
+
+		writer->length += length * size;
+		done += length;
+	}
+
+	entry->count += count;
+	return YES;
+}
+
+
+#pragma mark - Creating Writers
+
+CBHGeometryArchiveWriter *CBHGeometryArchiveWriter_create(void)
+{
+	return _CBHGeometryArchiveWriter_create(-1, kCBHArchiveWriterInitialCapacity);
+}
+
+CBHGeometryArchiveWriter *CBHGeometryArchiveWriter_createWithFileDescriptor(const int fileDescriptor)
+{
+	return _CBHGeometryArchiveWriter_create(fileDescriptor, kCBHArchiveWriterBlockLength);
+}
+
+void CBHGeometryArchiveWriter_destroy(CBHGeometryArchiveWriter * const writer)
+{
+	if ( writer == NULL ) { return; }
+
+	free(writer->entries);
+	free(writer->bytes);
+	free(writer);
+}
+
+
+#pragma mark - Output
+
+CBH_PURE const void *CBHGeometryArchiveWriter_bytes(const CBHGeometryArchiveWriter * const writer)
+{
+	return ( writer->fileDescriptor < 0 ) ? writer->bytes : NULL;
+}
+
+CBH_PURE NSUInteger CBHGeometryArchiveWriter_length(const CBHGeometryArchiveWriter * const writer)
+{
+	return writer->flushedLength + writer->length;
+}
+
+
+#pragma mark - Writing Archives
+
+BOOL CBHGeometryArchiveWriter_beginSection(CBHGeometryArchiveWriter * const writer, const CBHGeometryArchiveKind kind, const CBHGeometryArchiveStorage storage)
+{
+	if ( writer->isFinished || writer->hasFailed || !CBHArchive_isValidLayout(kind, storage) ) { return NO; }
+
+	if ( writer->sectionCount == writer->sectionCapacity )
+	{
+		const NSUInteger capacity = MAX(writer->sectionCapacity * 2, (NSUInteger)8);
+		CBHArchiveEntry * const entries = realloc(writer->entries, sizeof(CBHArchiveEntry) * capacity);
+		if ( entries == NULL ) { return NO; }
+
+		writer->entries = entries;
+		writer->sectionCapacity = capacity;
+	}
+
+	if ( !_CBHGeometryArchiveWriter_align(writer) ) { return NO; }
+
+	writer->entries[writer->sectionCount++] = (CBHArchiveEntry){
+		.kind = kind,
+		.storage = storage,
+		.count = 0,
+		.offset = CBHGeometryArchiveWriter_length(writer),
+		.reserved = 0,
+	};
+
+	return YES;
+}
+
+BOOL CBHGeometryArchiveWriter_appendPoints(CBHGeometryArchiveWriter * const writer, const NSPoint * const points, const NSUInteger count)
+{
+	return _CBHGeometryArchiveWriter_append(writer, CBHGeometryArchiveKindPoints, points, count);
+}
+
+BOOL CBHGeometryArchiveWriter_appendSizes(CBHGeometryArchiveWriter * const writer, const NSSize * const sizes, const NSUInteger count)
+{
+	return _CBHGeometryArchiveWriter_append(writer, CBHGeometryArchiveKindSizes, sizes, count);
+}
+
+BOOL CBHGeometryArchiveWriter_appendRects(CBHGeometryArchiveWriter * const writer, const NSRect * const rects, const NSUInteger count)
+{
+	return _CBHGeometryArchiveWriter_append(writer, CBHGeometryArchiveKindRects, rects, count);
+}
+
+BOOL CBHGeometryArchiveWriter_appendRanges(CBHGeometryArchiveWriter * const writer, const NSRange * const ranges, const NSUInteger count)
+{
+	return _CBHGeometryArchiveWriter_append(writer, CBHGeometryArchiveKindRanges, ranges, count);
+}
+
+BOOL CBHGeometryArchiveWriter_finish(CBHGeometryArchiveWriter * const writer)
+{
+	if ( writer->isFinished || writer->hasFailed ) { return NO; }
+	if ( !_CBHGeometryArchiveWriter_align(writer) ) { return NO; }
+
+	CBHArchiveTrailer trailer = { .tableOffset = CBHGeometryArchiveWriter_length(writer), .sectionCount = writer->sectionCount };
+	memcpy(trailer.magic, kCBHArchiveMagic, sizeof(kCBHArchiveMagic));
+
+	for (NSUInteger i = 0; i < writer->sectionCount; ++i)
+	{
+		if ( !_CBHGeometryArchiveWriter_appendBytes(writer, &writer->entries[i], sizeof(CBHArchiveEntry)) ) { return NO; }
+	}
+
+	if ( !_CBHGeometryArchiveWriter_appendBytes(writer, &trailer, sizeof(CBHArchiveTrailer)) ) { return NO; }
+	if ( !_CBHGeometryArchiveWriter_flush(writer) ) { return NO; }
+
+	writer->isFinished = YES;
+	return YES;
+}
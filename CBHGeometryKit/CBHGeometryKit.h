@@ -23,8 +23,41 @@ FOUNDATION_EXPORT double CBHGeometryKitVersionNumber;
 FOUNDATION_EXPORT const unsigned char CBHGeometryKitVersionString[];
 
 
+#import <CBHGeometryKit/CBHParseStatus.h>
+#import <CBHGeometryKit/CBHParallel.h>
+
 #import <CBHGeometryKit/NSPoint+CBHGeometryKit.h>
 #import <CBHGeometryKit/NSSize+CBHGeometryKit.h>
 #import <CBHGeometryKit/NSRect+CBHGeometryKit.h>
 
 #import <CBHGeometryKit/NSRange+CBHGeometryKit.h>
+#import <CBHGeometryKit/CBHPixelRect.h>
+
+#import <CBHGeometryKit/CBHAffineTransform.h>
+#import <CBHGeometryKit/CBHAtlasPacker.h>
+#import <CBHGeometryKit/CBHPolygon.h>
+#import <CBHGeometryKit/CBHPolyline.h>
+#import <CBHGeometryKit/CBHPointAccumulator.h>
+
+#import <CBHGeometryKit/CBHInlining.h>
+#import <CBHGeometryKit/NSPoint+CBHGeometryKitInline.h>
+#import <CBHGeometryKit/NSSize+CBHGeometryKitInline.h>
+#import <CBHGeometryKit/NSRect+CBHGeometryKitInline.h>
+#import <CBHGeometryKit/NSRange+CBHGeometryKitInline.h>
+#import <CBHGeometryKit/CBHPixelRectInline.h>
+
+#import <CBHGeometryKit/CBHGeometryTemplates.h>
+
+#import <CBHGeometryKit/CBHRectArray.h>
+#import <CBHGeometryKit/CBHPackedGeometry.h>
+#import <CBHGeometryKit/CBHRectTree.h>
+#import <CBHGeometryKit/CBHSweepAndPrune.h>
+#import <CBHGeometryKit/CBHPointTree.h>
+#import <CBHGeometryKit/CBHRegion.h>
+#import <CBHGeometryKit/CBHRangeSet.h>
+#import <CBHGeometryKit/CBHRangeTree.h>
+#import <CBHGeometryKit/CBHHitGrid.h>
+
+#import <CBHGeometryKit/CBHGeometryWriter.h>
+#import <CBHGeometryKit/CBHGeometryArchive.h>
+#import <CBHGeometryKit/CBHGeometryArchiveWriter.h>
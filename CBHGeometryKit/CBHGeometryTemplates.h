@@ -0,0 +1,673 @@
+//  CBHGeometryTemplates.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+// The templates need C++17. Objective-C and older C++ clients see an empty header.
+#if defined(__cplusplus) && __cplusplus >= 201703L
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+
+/** Compile-time counterparts of the scalar `NSPoint`, `NSSize`, `NSRect` and `NSRange` functions.
+ *
+ * `Point<T>`, `Size<T>` and `Rect<T>` hold any arithmetic type and `Range<T>` any unsigned integer type. Every
+ * operation is `constexpr` and `noexcept`, so layout constants fold at compile time, and for `CGFloat` and `NSUInteger`
+ * each gives exactly the result of the C function it is named after, including for negative sizes, signed zeros and
+ * NaN. The exceptions are `Rect::intersection()` and `Rect::unionWith()` with NaN components, as their C counterparts
+ * defer to Foundation, which does not define the result. Integer coordinates divide with truncation where the C
+ * functions halve.
+ *
+ * The templates with `CGFloat` and `NSUInteger` components have the layout of their Foundation counterparts and convert
+ * to and from them component by component.
+ */
+namespace CBH
+{
+
+#pragma mark - Exact Arithmetic
+
+// These match `trunc()`, `floor()`, `ceil()`, `round()`, `fabs()`, `fmin()`, `fmax()` and `sqrt()` exactly, but also
+// evaluate at compile time. At run time they call the C functions, which agree with them except in NaN payloads.
+// Integers pass through unchanged.
+
+template <typename T>
+constexpr T _trunc(const T value) noexcept
+{
+	if constexpr ( std::is_integral_v<T> ) { return value; }
+	else
+	{
+		if ( !__builtin_is_constant_evaluated() ) { return std::trunc(value); }
+
+		// Values this large are already integral, and NaN and infinities fail the comparison.
+		constexpr T limit = static_cast<T>(std::uint64_t(1) << (std::numeric_limits<T>::digits - 1));
+		if ( !(value < limit && value > -limit) || value == 0 ) { return value; }
+
+		const T result = static_cast<T>(static_cast<std::int64_t>(value));
+		if ( result == 0 && value < 0 ) { return -T(0); }
+
+		return result;
+	}
+}
+
+template <typename T>
+constexpr T _floor(const T value) noexcept
+{
+	if constexpr ( std::is_floating_point_v<T> )
+	{
+		if ( !__builtin_is_constant_evaluated() ) { return std::floor(value); }
+	}
+
+	const T result = _trunc(value);
+	return ( value < result ) ? result - T(1) : result;
+}
+
+template <typename T>
+constexpr T _ceil(const T value) noexcept
+{
+	if constexpr ( std::is_floating_point_v<T> )
+	{
+		if ( !__builtin_is_constant_evaluated() ) { return std::ceil(value); }
+	}
+
+	const T result = _trunc(value);
+	return ( value > result ) ? result + T(1) : result;
+}
+
+template <typename T>
+constexpr T _round(const T value) noexcept
+{
+	if constexpr ( std::is_floating_point_v<T> )
+	{
+		if ( !__builtin_is_constant_evaluated() ) { return std::round(value); }
+	}
+
+	const T result = _trunc(value);
+	const T fraction = ( value < result ) ? result - value : value - result;
+
+	// Halfway cases round away from zero. The fraction is exact, so no sum can carry across the halfway point.
+	if ( fraction >= T(0.5) ) { return ( value < 0 ) ? result - T(1) : result + T(1); }
+
+	return result;
+}
+
+template <typename T>
+constexpr T _fabs(const T value) noexcept
+{
+	if constexpr ( std::is_floating_point_v<T> )
+	{
+		if ( !__builtin_is_constant_evaluated() ) { return std::fabs(value); }
+	}
+
+	// Adding zero turns a negative zero positive.
+	return ( value < 0 ) ? -value : value + T(0);
+}
+
+template <typename T>
+constexpr T _fmin(const T value, const T other) noexcept
+{
+	if constexpr ( std::is_floating_point_v<T> )
+	{
+		if ( !__builtin_is_constant_evaluated() ) { return std::fmin(value, other); }
+	}
+
+	if ( value != value ) { return other; }
+	if ( other != other ) { return value; }
+
+	// Zeros are ordered by sign, as Apple's `fmin()` orders them. The sum of their negations is positive unless both are.
+	if ( value == 0 && other == 0 ) { return -((-value) + (-other)); }
+
+	return ( other < value ) ? other : value;
+}
+
+template <typename T>
+constexpr T _fmax(const T value, const T other) noexcept
+{
+	if constexpr ( std::is_floating_point_v<T> )
+	{
+		if ( !__builtin_is_constant_evaluated() ) { return std::fmax(value, other); }
+	}
+
+	if ( value != value ) { return other; }
+	if ( other != other ) { return value; }
+
+	// Zeros are ordered by sign, as Apple's `fmax()` orders them. Their sum is negative only if both are.
+	if ( value == 0 && other == 0 ) { return value + other; }
+
+	return ( other > value ) ? other : value;
+}
+
+// The correctly rounded square root of a positive, finite double, found with integer arithmetic.
+constexpr double _sqrtExact(double value) noexcept
+{
+	// Scale by powers of four into [1, 4), which is exact and halves exactly under the root.
+	int exponent = 0;
+	while ( value >= 4.0 ) { value *= 0.25; ++exponent; }
+	while ( value < 1.0 ) { value *= 4.0; --exponent; }
+
+	// The root of the 106 bit square has the 53 bits of the result.
+	const unsigned __int128 square = static_cast<unsigned __int128>(static_cast<std::uint64_t>(value * 0x1p52)) << 52;
+
+	unsigned __int128 remainder = square;
+	unsigned __int128 root = 0;
+	unsigned __int128 bit = static_cast<unsigned __int128>(1) << 106;
+
+	while ( bit > square ) { bit >>= 2; }
+	while ( bit != 0 )
+	{
+		if ( remainder >= root + bit )
+		{
+			remainder -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	// The root is never halfway between two integers, so a remainder beyond the root means rounding up.
+	if ( remainder > root ) { ++root; }
+
+	double result = static_cast<double>(static_cast<std::uint64_t>(root)) * 0x1p-52;
+	for (; exponent > 0; --exponent) { result *= 2.0; }
+	for (; exponent < 0; ++exponent) { result *= 0.5; }
+
+	return result;
+}
+
+template <typename T>
+constexpr T _sqrt(const T value) noexcept
+{
+	static_assert(std::is_floating_point_v<T>, "Square roots need a floating point type.");
+
+	if ( !__builtin_is_constant_evaluated() ) { return std::sqrt(value); }
+
+	if ( value < 0 ) { return std::numeric_limits<T>::quiet_NaN(); }
+	if ( !(value < std::numeric_limits<T>::infinity()) || value == 0 ) { return value; }
+
+	// A double has more than twice the precision of a float, so rounding twice gives the correctly rounded float.
+	return static_cast<T>(_sqrtExact(static_cast<double>(value)));
+}
+
+
+#pragma mark - Point
+
+/** A point with components of type `T`, mirroring `NSPoint`.
+ */
+template <typename T>
+struct Point
+{
+	static_assert(std::is_arithmetic_v<T>, "Points need an arithmetic component type.");
+
+	T x;
+	T y;
+
+
+	#pragma mark Creating Points
+
+	/** Creates a point at {0, 0}, as `NSPoint_initZero()` does. */
+	constexpr Point() noexcept : x(0), y(0) {}
+
+	/** Creates a point from its components, as `NSPoint_init()` does. */
+	constexpr Point(const T x, const T y) noexcept : x(x), y(y) {}
+
+	/** Creates a point from a `NSPoint`, converting each component to `T`. */
+	constexpr explicit Point(const NSPoint point) noexcept : x(static_cast<T>(point.x)), y(static_cast<T>(point.y)) {}
+
+	/** Converts the point to a `NSPoint`. */
+	constexpr operator NSPoint() const noexcept { return NSPoint{ static_cast<CGFloat>(x), static_cast<CGFloat>(y) }; }
+
+
+	#pragma mark Checking Points
+
+	/** Checks equality as `NSPoint_isEqual()` does. */
+	constexpr bool isEqual(const Point other) const noexcept { return ( (x == other.x) && (y == other.y) ); }
+
+	constexpr bool operator==(const Point other) const noexcept { return isEqual(other); }
+	constexpr bool operator!=(const Point other) const noexcept { return !isEqual(other); }
+
+
+	#pragma mark Derived Points
+
+	/** Truncates each component, as `NSPoint_truncate()` does. */
+	constexpr Point truncate() const noexcept { return Point(_trunc(x), _trunc(y)); }
+
+	/** Rounds each component half away from zero, as `NSPoint_round()` does. */
+	constexpr Point round() const noexcept { return Point(_round(x), _round(y)); }
+
+	/** Shifts the point by another, as `NSPoint_shift()` does. */
+	constexpr Point shift(const Point delta) const noexcept { return shiftParametric(delta.x, delta.y); }
+
+	/** Shifts the point by a distance on each axis, as `NSPoint_shiftParametric()` does. */
+	constexpr Point shiftParametric(const T dX, const T dY) const noexcept { return Point(x + dX, y + dY); }
+
+	/** Moves the point to the center of its pixel, as `NSPoint_nearestPixel()` does. */
+	constexpr Point nearestPixel() const noexcept
+	{
+		static_assert(std::is_floating_point_v<T>, "Pixel centers need a floating point type.");
+		return Point(_trunc(x) + T(0.5), _trunc(y) + T(0.5));
+	}
+
+
+	#pragma mark Distance
+
+	/** The distance to another point, as `NSPoint_distance()` finds it. */
+	constexpr T distance(const Point end) const noexcept { return _sqrt(distanceSquared(end)); }
+
+	/** The square of the distance to another point, as `NSPoint_distanceSquared()` finds it. */
+	constexpr T distanceSquared(const Point end) const noexcept
+	{
+		const T dX = x - end.x;
+		const T dY = y - end.y;
+
+		const T squareX = dX * dX;
+		const T squareY = dY * dY;
+
+		return squareX + squareY;
+	}
+
+	/** An estimate of the distance to another point, as `NSPoint_approximateDistance()` finds it. */
+	constexpr T approximateDistance(const Point end) const noexcept
+	{
+		static_assert(std::is_floating_point_v<T>, "Approximate distances need a floating point type.");
+
+		const T dX = _fabs(x - end.x);
+		const T dY = _fabs(y - end.y);
+
+		const T high = _fmax(dX, dY);
+		const T low = _fmin(dX, dY);
+
+		// The products are separate statements, as in `NSPoint_approximateDistance()`, so neither is ever fused.
+		const T scaledHigh = T(0.898204193266868) * high;
+		const T scaledLow = T(0.485968200201465) * low;
+
+		return _fmax(high, scaledHigh + scaledLow);
+	}
+};
+
+
+#pragma mark - Size
+
+/** A size with components of type `T`, mirroring `NSSize`.
+ */
+template <typename T>
+struct Size
+{
+	static_assert(std::is_arithmetic_v<T>, "Sizes need an arithmetic component type.");
+
+	T width;
+	T height;
+
+
+	#pragma mark Creating Sizes
+
+	/** Creates a size of {0, 0}, as `NSSize_initEmpty()` does. */
+	constexpr Size() noexcept : width(0), height(0) {}
+
+	/** Creates a size from its components, as `NSSize_init()` does. */
+	constexpr Size(const T width, const T height) noexcept : width(width), height(height) {}
+
+	/** Creates a size from a `NSSize`, converting each component to `T`. */
+	constexpr explicit Size(const NSSize size) noexcept : width(static_cast<T>(size.width)), height(static_cast<T>(size.height)) {}
+
+	/** Converts the size to a `NSSize`. */
+	constexpr operator NSSize() const noexcept { return NSSize{ static_cast<CGFloat>(width), static_cast<CGFloat>(height) }; }
+
+
+	#pragma mark Checking Sizes
+
+	/** Checks emptiness as `NSSize_isEmpty()` does. */
+	constexpr bool isEmpty() const noexcept { return ( (width <= 0) || (height <= 0) ); }
+
+	/** Checks for negative components as `NSSize_isNegative()` does. */
+	constexpr bool isNegative() const noexcept { return ( (width < 0) || (height < 0) ); }
+
+	/** Checks equality as `NSSize_isEqual()` does. */
+	constexpr bool isEqual(const Size other) const noexcept { return ( (width == other.width) && (height == other.height) ); }
+
+	constexpr bool operator==(const Size other) const noexcept { return isEqual(other); }
+	constexpr bool operator!=(const Size other) const noexcept { return !isEqual(other); }
+
+
+	#pragma mark Derived Sizes
+
+	/** Truncates each component, as `NSSize_truncate()` does. */
+	constexpr Size truncate() const noexcept { return Size(_trunc(width), _trunc(height)); }
+
+	/** Rounds each component half away from zero, as `NSSize_round()` does. */
+	constexpr Size round() const noexcept { return Size(_round(width), _round(height)); }
+
+	/** Takes the magnitude of each component, as `NSSize_absolute()` does. */
+	constexpr Size absolute() const noexcept { return Size(_fabs(width), _fabs(height)); }
+
+	/** Grows the size by another, as `NSSize_scale()` does. */
+	constexpr Size scale(const Size delta) const noexcept { return scaleParametric(delta.width, delta.height); }
+
+	/** Grows the size by an amount on each axis, as `NSSize_scaleParametric()` does. */
+	constexpr Size scaleParametric(const T dWidth, const T dHeight) const noexcept { return Size(width + dWidth, height + dHeight); }
+};
+
+
+#pragma mark - Rect
+
+/** A rect with components of type `T`, mirroring `NSRect`.
+ */
+template <typename T>
+struct Rect
+{
+	static_assert(std::is_arithmetic_v<T>, "Rects need an arithmetic component type.");
+
+	Point<T> origin;
+	Size<T> size;
+
+
+	#pragma mark Creating Rects
+
+	/** Creates a rect of {{0, 0}, {0, 0}}, as `NSRect_initEmpty()` does. */
+	constexpr Rect() noexcept : origin(), size() {}
+
+	/** Creates a rect from its components, as `NSRect_init()` does. */
+	constexpr Rect(const T x, const T y, const T width, const T height) noexcept : origin(x, y), size(width, height) {}
+
+	/** Creates a rect from its origin and size, as `NSRect_initWithStructs()` does. */
+	constexpr Rect(const Point<T> origin, const Size<T> size) noexcept : origin(origin), size(size) {}
+
+	/** Creates a rect at {0, 0}, as `NSRect_initWithSize()` does. */
+	constexpr explicit Rect(const Size<T> size) noexcept : origin(), size(size) {}
+
+	/** Creates a rect from a `NSRect`, converting each component to `T`. */
+	constexpr explicit Rect(const NSRect rect) noexcept : origin(rect.origin), size(rect.size) {}
+
+	/** Converts the rect to a `NSRect`. */
+	constexpr operator NSRect() const noexcept { return NSRect{ origin, size }; }
+
+
+	#pragma mark Checking Rects
+
+	/** Checks emptiness as `NSRect_isEmpty()` does. */
+	constexpr bool isEmpty() const noexcept { return size.isEmpty(); }
+
+	/** Checks for a negative size as `NSRect_isNegative()` does. */
+	constexpr bool isNegative() const noexcept { return size.isNegative(); }
+
+	/** Checks equality as `NSRect_isEqual()` does. */
+	constexpr bool isEqual(const Rect other) const noexcept { return ( origin.isEqual(other.origin) && size.isEqual(other.size) ); }
+
+	constexpr bool operator==(const Rect other) const noexcept { return isEqual(other); }
+	constexpr bool operator!=(const Rect other) const noexcept { return !isEqual(other); }
+
+	/** Checks whether the rect covers another, as `NSRect_isCovering()` does. */
+	constexpr bool isCovering(const Rect other) const noexcept
+	{
+		if ( other._isFoundationEmpty() ) { return false; }
+
+		return ( (origin.x <= other.origin.x) && (origin.y <= other.origin.y) && (_maxX() >= other._maxX()) && (_maxY() >= other._maxY()) );
+	}
+
+	/** Checks whether the rect overlaps another, as `NSRect_isIntersecting()` does. */
+	constexpr bool isIntersecting(const Rect other) const noexcept
+	{
+		if ( _isFoundationEmpty() || other._isFoundationEmpty() ) { return false; }
+
+		return !_isApart(other);
+	}
+
+	/** Checks whether a point is in the rect, as `NSRect_isPointInRect()` does. */
+	constexpr bool isPointInRect(const Point<T> point) const noexcept { return isMouseInRect(point, true); }
+
+	/** Checks whether a point is in the rect, as `NSRect_isMouseInRect()` does. */
+	constexpr bool isMouseInRect(const Point<T> point, const bool flipped) const noexcept
+	{
+		if ( flipped )
+		{
+			return ( (point.x >= origin.x) && (point.y >= origin.y) && (point.x < _maxX()) && (point.y < _maxY()) );
+		}
+
+		return ( (point.x >= origin.x) && (point.y > origin.y) && (point.x < _maxX()) && (point.y <= _maxY()) );
+	}
+
+
+	#pragma mark Derived Rects
+
+	/** Insets the rect on each axis, as `NSRect_inset()` does. */
+	constexpr Rect inset(const T dX, const T dY) const noexcept
+	{
+		return Rect(origin.x + dX, origin.y + dY, size.width - (T(2) * dX), size.height - (T(2) * dY));
+	}
+
+	/** Moves the rect on each axis, as `NSRect_offset()` does. */
+	constexpr Rect offset(const T dX, const T dY) const noexcept { return Rect(origin.x + dX, origin.y + dY, size.width, size.height); }
+
+	/** Expands the rect outward to whole units, as `NSRect_integral()` does. */
+	constexpr Rect integral() const noexcept
+	{
+		if ( _isFoundationEmpty() ) { return Rect(); }
+
+		const T x = _floor(origin.x);
+		const T y = _floor(origin.y);
+
+		return Rect(x, y, _ceil(_maxX()) - x, _ceil(_maxY()) - y);
+	}
+
+	/** Truncates each component, as `NSRect_truncate()` does. */
+	constexpr Rect truncate() const noexcept { return Rect(origin.truncate(), size.truncate()); }
+
+	/** Rounds each component half away from zero, as `NSRect_round()` does. */
+	constexpr Rect round() const noexcept { return Rect(origin.round(), size.round()); }
+
+	/** Normalizes a negative size, as `NSRect_absolute()` does. */
+	constexpr Rect absolute() const noexcept
+	{
+		if ( !isNegative() ) { return *this; }
+		return Rect(minPoint(), size.absolute());
+	}
+
+	/** Aligns the rect with the pixel grid, as `NSRect_alignWithPixels()` does. */
+	constexpr Rect alignWithPixels() const noexcept { return Rect(origin.nearestPixel(), size.truncate()); }
+
+	/** The overlap of the rect and another, as `NSRect_intersection()` finds it for rects without NaN components. */
+	constexpr Rect intersection(const Rect other) const noexcept
+	{
+		if ( _isApart(other) ) { return Rect(); }
+
+		const T x = _fmax(origin.x, other.origin.x);
+		const T y = _fmax(origin.y, other.origin.y);
+
+		return Rect(x, y, _fmin(_maxX(), other._maxX()) - x, _fmin(_maxY(), other._maxY()) - y);
+	}
+
+	/** The smallest rect holding the rect and another, as `NSRect_union()` finds it for rects without NaN components. */
+	constexpr Rect unionWith(const Rect other) const noexcept
+	{
+		if ( _isFoundationEmpty() && other._isFoundationEmpty() ) { return Rect(); }
+		if ( _isFoundationEmpty() ) { return other; }
+		if ( other._isFoundationEmpty() ) { return *this; }
+
+		const T x = _fmin(origin.x, other.origin.x);
+		const T y = _fmin(origin.y, other.origin.y);
+
+		return Rect(x, y, _fmax(_maxX(), other._maxX()) - x, _fmax(_maxY(), other._maxY()) - y);
+	}
+
+	/** Centers the rect in another, as `NSRect_centeredInRect()` does. */
+	constexpr Rect centeredInRect(const Rect inRect) const noexcept
+	{
+		const T x = inRect.origin.x + ((inRect.size.width - size.width) / T(2));
+		const T y = inRect.origin.y + ((inRect.size.height - size.height) / T(2));
+
+		return Rect(x, y, size.width, size.height);
+	}
+
+
+	#pragma mark Derived Points
+
+	/** The maximum corner, as `NSRect_maxPoint()` finds it. */
+	constexpr Point<T> maxPoint() const noexcept { return Point<T>(maxX(), maxY()); }
+
+	/** The center, as `NSRect_midPoint()` finds it. */
+	constexpr Point<T> midPoint() const noexcept { return Point<T>(midX(), midY()); }
+
+	/** The minimum corner, as `NSRect_minPoint()` finds it. */
+	constexpr Point<T> minPoint() const noexcept { return Point<T>(minX(), minY()); }
+
+
+	#pragma mark Calculated Properties
+
+	/** The greatest x value, as `NSRect_maxX()` finds it. */
+	constexpr T maxX() const noexcept { return ( size.width <= 0 ) ? origin.x : origin.x + size.width; }
+
+	/** The greatest y value, as `NSRect_maxY()` finds it. */
+	constexpr T maxY() const noexcept { return ( size.height <= 0 ) ? origin.y : origin.y + size.height; }
+
+	/** The middle x value, as `NSRect_midX()` finds it. */
+	constexpr T midX() const noexcept { return origin.x + (size.width / T(2)); }
+
+	/** The middle y value, as `NSRect_midY()` finds it. */
+	constexpr T midY() const noexcept { return origin.y + (size.height / T(2)); }
+
+	/** The least x value, as `NSRect_minX()` finds it. */
+	constexpr T minX() const noexcept { return ( size.width >= 0 ) ? origin.x : origin.x + size.width; }
+
+	/** The least y value, as `NSRect_minY()` finds it. */
+	constexpr T minY() const noexcept { return ( size.height >= 0 ) ? origin.y : origin.y + size.height; }
+
+
+	private:
+
+	// Foundation's own rules, which the wrapped `NSRect` functions follow: a NaN size is empty and the far edges are not
+	// adjusted for negative sizes.
+	constexpr bool _isFoundationEmpty() const noexcept { return !( (size.width > 0) && (size.height > 0) ); }
+	constexpr T _maxX() const noexcept { return origin.x + size.width; }
+	constexpr T _maxY() const noexcept { return origin.y + size.height; }
+
+	constexpr bool _isApart(const Rect other) const noexcept
+	{
+		return ( (_maxX() <= other.origin.x) || (other._maxX() <= origin.x) || (_maxY() <= other.origin.y) || (other._maxY() <= origin.y) );
+	}
+};
+
+
+#pragma mark - Range
+
+/** A range with components of type `T`, mirroring `NSRange`.
+ */
+template <typename T>
+struct Range
+{
+	static_assert(std::is_integral_v<T> && std::is_unsigned_v<T>, "Ranges need an unsigned integer component type.");
+
+	/** The location `Range<NSUInteger>` reports as `NSNotFound`. */
+	static constexpr T notFound = static_cast<T>(std::numeric_limits<std::make_signed_t<T>>::max());
+
+	T location;
+	T length;
+
+
+	#pragma mark Creating Ranges
+
+	/** Creates a range of {0, 0}, as `NSRange_initEmpty()` does. */
+	constexpr Range() noexcept : location(0), length(0) {}
+
+	/** Creates a range from its components, as `NSRange_init()` does. */
+	constexpr Range(const T location, const T length) noexcept : location(location), length(length) {}
+
+	/** Creates a range from a `NSRange`, converting each component to `T`. */
+	constexpr explicit Range(const NSRange range) noexcept : location(static_cast<T>(range.location)), length(static_cast<T>(range.length)) {}
+
+	/** Converts the range to a `NSRange`. */
+	constexpr operator NSRange() const noexcept { return NSRange{ static_cast<NSUInteger>(location), static_cast<NSUInteger>(length) }; }
+
+	/** Creates a range between two locations, as `NSRange_initFromTo()` does. */
+	static constexpr Range fromTo(const T from, const T to) noexcept { return Range(from, static_cast<T>(to - from)); }
+
+
+	#pragma mark Checking Ranges
+
+	/** Checks emptiness as `NSRange_isEmpty()` does. */
+	constexpr bool isEmpty() const noexcept { return ( length == 0 ); }
+
+	/** Checks equality as `NSRange_isEqual()` does. */
+	constexpr bool isEqual(const Range other) const noexcept { return ( (location == other.location) && (length == other.length) ); }
+
+	constexpr bool operator==(const Range other) const noexcept { return isEqual(other); }
+	constexpr bool operator!=(const Range other) const noexcept { return !isEqual(other); }
+
+	/** Checks whether a location is in the range, as `NSRange_isLocationInRange()` does. */
+	constexpr bool isLocationInRange(const T value) const noexcept
+	{
+		return ( (value >= location) && (static_cast<T>(value - location) < length) );
+	}
+
+
+	#pragma mark Derived Ranges
+
+	/** The overlap of the range and another, as `NSRange_intersection()` finds it. */
+	constexpr Range intersection(const Range other) const noexcept
+	{
+		if ( (max() < other.location) || (other.max() < location) ) { return Range(); }
+
+		const T from = ( location > other.location ) ? location : other.location;
+		const T to = ( max() < other.max() ) ? max() : other.max();
+
+		return fromTo(from, to);
+	}
+
+	/** The smallest range holding the range and another, as `NSRange_union()` finds it. */
+	constexpr Range unionWith(const Range other) const noexcept
+	{
+		const T from = ( location < other.location ) ? location : other.location;
+		const T to = ( max() > other.max() ) ? max() : other.max();
+
+		return fromTo(from, to);
+	}
+
+
+	#pragma mark Calculated Properties
+
+	/** The location past the end, as `NSRange_max()` finds it. */
+	constexpr T max() const noexcept { return static_cast<T>(location + length); }
+
+	/** The location at an offset into the range, as `NSRange_locationAtOffset()` finds it. */
+	constexpr T locationAtOffset(const T offset) const noexcept
+	{
+		if ( offset >= length ) { return notFound; }
+		return static_cast<T>(location + offset);
+	}
+};
+
+
+#pragma mark - Foundation Types
+
+using PointF = Point<CGFloat>;
+using SizeF = Size<CGFloat>;
+using RectF = Rect<CGFloat>;
+using RangeU = Range<NSUInteger>;
+
+static_assert(sizeof(PointF) == sizeof(NSPoint) && std::is_trivially_copyable_v<PointF>, "Points must match NSPoint.");
+static_assert(sizeof(SizeF) == sizeof(NSSize) && std::is_trivially_copyable_v<SizeF>, "Sizes must match NSSize.");
+static_assert(sizeof(RectF) == sizeof(NSRect) && std::is_trivially_copyable_v<RectF>, "Rects must match NSRect.");
+static_assert(sizeof(RangeU) == sizeof(NSRange) && std::is_trivially_copyable_v<RangeU>, "Ranges must match NSRange.");
+
+}
+
+#endif
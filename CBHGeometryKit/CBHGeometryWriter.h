@@ -0,0 +1,142 @@
+//  CBHGeometryWriter.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** A writer which serializes arrays of geometry values as text, one value per line.
+ *
+ * Each line has the layout of the matching `*_getDescription()` function, so the output round-trips through the
+ * `*_parseLines()` functions. A writer either collects its output in a growable buffer of bytes or passes it to a file
+ * descriptor in large blocks. Writing does not create any objects.
+ *
+ * Once a write fails the writer stops writing, and every later write and flush returns `NO`.
+ */
+typedef struct CBHGeometryWriter CBHGeometryWriter;
+
+
+#pragma mark - Creating Writers
+
+/**
+ * @name Creating Writers
+ */
+
+/** Creates a writer which collects its output in memory.
+ *
+ * @return              A new writer, or `NULL` if the storage could not be allocated. Release it with `CBHGeometryWriter_destroy()`.
+ */
+CBHGeometryWriter * _Nullable CBHGeometryWriter_create(void);
+
+/** Creates a writer which passes its output to a file descriptor.
+ *
+ * @param fileDescriptor    The open file descriptor to write to. The writer does not close it.
+ *
+ * @return                  A new writer, or `NULL` if the storage could not be allocated. Release it with `CBHGeometryWriter_destroy()`.
+ */
+CBHGeometryWriter * _Nullable CBHGeometryWriter_createWithFileDescriptor(int fileDescriptor);
+
+/** Flushes and releases a writer.
+ *
+ * @param writer        The writer to release.
+ */
+void CBHGeometryWriter_destroy(CBHGeometryWriter * _Nullable writer);
+
+
+#pragma mark - Output
+
+/**
+ * @name Output
+ */
+
+/** The bytes collected by a writer created with `CBHGeometryWriter_create()`.
+ *
+ * @param writer        The writer.
+ *
+ * @return              The output, which is not terminated and remains valid until the next write, or `NULL` if the
+ *                      writer has no output or passes it to a file descriptor.
+ */
+const char * _Nullable CBHGeometryWriter_bytes(const CBHGeometryWriter *writer);
+
+/** The number of bytes written so far.
+ *
+ * @param writer        The writer.
+ *
+ * @return              The number of bytes written, including any not yet flushed.
+ */
+NSUInteger CBHGeometryWriter_length(const CBHGeometryWriter *writer);
+
+/** Passes any buffered output to the file descriptor.
+ *
+ * @param writer        The writer.
+ *
+ * @return              `YES` if all of the output has been written, otherwise `NO`.
+ */
+BOOL CBHGeometryWriter_flush(CBHGeometryWriter *writer);
+
+
+#pragma mark - Writing Values
+
+/**
+ * @name Writing Values
+ *
+ * These functions write one line for each value. They return `NO` if the output could not be grown or written.
+ */
+
+/** Writes an array of points.
+ *
+ * @param writer        The writer.
+ * @param points        The points to write.
+ * @param count         The number of points in _points_.
+ *
+ * @return              `YES` if the points were written, otherwise `NO`.
+ */
+BOOL CBHGeometryWriter_writePoints(CBHGeometryWriter *writer, const NSPoint *points, NSUInteger count);
+
+/** Writes an array of sizes.
+ *
+ * @param writer        The writer.
+ * @param sizes         The sizes to write.
+ * @param count         The number of sizes in _sizes_.
+ *
+ * @return              `YES` if the sizes were written, otherwise `NO`.
+ */
+BOOL CBHGeometryWriter_writeSizes(CBHGeometryWriter *writer, const NSSize *sizes, NSUInteger count);
+
+/** Writes an array of rects.
+ *
+ * @param writer        The writer.
+ * @param rects         The rects to write.
+ * @param count         The number of rects in _rects_.
+ *
+ * @return              `YES` if the rects were written, otherwise `NO`.
+ */
+BOOL CBHGeometryWriter_writeRects(CBHGeometryWriter *writer, const NSRect *rects, NSUInteger count);
+
+/** Writes an array of ranges.
+ *
+ * @param writer        The writer.
+ * @param ranges        The ranges to write.
+ * @param count         The number of ranges in _ranges_.
+ *
+ * @return              `YES` if the ranges were written, otherwise `NO`.
+ */
+BOOL CBHGeometryWriter_writeRanges(CBHGeometryWriter *writer, const NSRange *ranges, NSUInteger count);
+
+NS_ASSUME_NONNULL_END
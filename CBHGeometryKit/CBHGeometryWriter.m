@@ -0,0 +1,197 @@
+//  CBHGeometryWriter.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHGeometryWriter.h"
+
+#import "_CBHGeometryKit+Utilities.h"
+#import "_CBHGeometryKit+Formatter.h"
+
+#import <errno.h>
+#import <unistd.h>
+
+
+// Memory writers double their buffer as it fills. File descriptor writers keep one block and flush it whenever the
+// next line might not fit.
+enum
+{
+	kCBHGeometryWriterLineLength = kCBHFormatterValueLength + 1,
+	kCBHGeometryWriterInitialCapacity = 4096,
+	kCBHGeometryWriterBlockLength = 1 << 16,
+};
+
+struct CBHGeometryWriter
+{
+	char *bytes;
+	NSUInteger length;
+	NSUInteger capacity;
+	NSUInteger flushedLength;
+	int fileDescriptor;
+	BOOL hasFailed;
+};
+
+
+#pragma mark - Utilities
+
+static BOOL _CBHGeometryWriter_reserveLine(CBHGeometryWriter * const writer)
+{
+	if ( writer->hasFailed ) { return NO; }
+	if ( writer->capacity - writer->length >= kCBHGeometryWriterLineLength ) { return YES; }
+
+	if ( writer->fileDescriptor >= 0 ) { return CBHGeometryWriter_flush(writer); }
+
+	const NSUInteger capacity = MAX(writer->capacity * 2, (NSUInteger)kCBHGeometryWriterInitialCapacity);
+	char * const bytes = realloc(writer->bytes, capacity);
+	if ( bytes == NULL )
+	{
+		writer->hasFailed = YES;
+		return NO;
+	}
+
+	writer->bytes = bytes;
+	writer->capacity = capacity;
+	return YES;
+}
+
+NS_INLINE void _CBHGeometryWriter_endLine(CBHGeometryWriter * const writer, char *cursor)
+{
+	*cursor++ = '\n';
+	writer->length = (NSUInteger)(cursor - writer->bytes);
+}
+
+
+#pragma mark - Creating Writers
+
+CBHGeometryWriter *CBHGeometryWriter_create(void)
+{
+	CBHGeometryWriter * const writer = calloc(1, sizeof(CBHGeometryWriter));
+	if ( writer == NULL ) { return NULL; }
+
+	writer->fileDescriptor = -1;
+	return writer;
+}
+
+CBHGeometryWriter *CBHGeometryWriter_createWithFileDescriptor(const int fileDescriptor)
+{
+	CBHGeometryWriter * const writer = calloc(1, sizeof(CBHGeometryWriter));
+	if ( writer == NULL ) { return NULL; }
+
+	writer->bytes = malloc(kCBHGeometryWriterBlockLength);
+	if ( writer->bytes == NULL )
+	{
+		free(writer);
+		return NULL;
+	}
+
+	writer->capacity = kCBHGeometryWriterBlockLength;
+	writer->fileDescriptor = fileDescriptor;
+	return writer;
+}
+
+void CBHGeometryWriter_destroy(CBHGeometryWriter * const writer)
+{
+	if ( writer == NULL ) { return; }
+
+	CBHGeometryWriter_flush(writer);
+
+	free(writer->bytes);
+	free(writer);
+}
+
+
+#pragma mark - Output
+
+CBH_PURE const char *CBHGeometryWriter_bytes(const CBHGeometryWriter * const writer)
+{
+	return ( writer->fileDescriptor < 0 ) ? writer->bytes : NULL;
+}
+
+CBH_PURE NSUInteger CBHGeometryWriter_length(const CBHGeometryWriter * const writer)
+{
+	return writer->flushedLength + writer->length;
+}
+
+BOOL CBHGeometryWriter_flush(CBHGeometryWriter * const writer)
+{
+	if ( writer->hasFailed ) { return NO; }
+	if ( writer->fileDescriptor < 0 ) { return YES; }
+
+	for (NSUInteger offset = 0; offset < writer->length;)
+	{
+		const ssize_t written = write(writer->fileDescriptor, writer->bytes + offset, writer->length - offset);
+		if ( written < 0 )
+		{
+			if ( errno == EINTR ) { continue; }
+
+			writer->hasFailed = YES;
+			return NO;
+		}
+
+		offset += (NSUInteger)written;
+	}
+
+	writer->flushedLength += writer->length;
+	writer->length = 0;
+	return YES;
+}
+
+
+#pragma mark - Writing Values
+
+BOOL CBHGeometryWriter_writePoints(CBHGeometryWriter * const writer, const NSPoint * const points, const NSUInteger count)
+{
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		if ( !_CBHGeometryWriter_reserveLine(writer) ) { return NO; }
+		_CBHGeometryWriter_endLine(writer, CBHFormatter_writePoint(writer->bytes + writer->length, points[i]));
+	}
+
+	return !writer->hasFailed;
+}
+
+BOOL CBHGeometryWriter_writeSizes(CBHGeometryWriter * const writer, const NSSize * const sizes, const NSUInteger count)
+{
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		if ( !_CBHGeometryWriter_reserveLine(writer) ) { return NO; }
+		_CBHGeometryWriter_endLine(writer, CBHFormatter_writeSize(writer->bytes + writer->length, sizes[i]));
+	}
+
+	return !writer->hasFailed;
+}
+
+BOOL CBHGeometryWriter_writeRects(CBHGeometryWriter * const writer, const NSRect * const rects, const NSUInteger count)
+{
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		if ( !_CBHGeometryWriter_reserveLine(writer) ) { return NO; }
+		_CBHGeometryWriter_endLine(writer, CBHFormatter_writeRect(writer->bytes + writer->length, rects[i]));
+	}
+
+	return !writer->hasFailed;
+}
+
+BOOL CBHGeometryWriter_writeRanges(CBHGeometryWriter * const writer, const NSRange * const ranges, const NSUInteger count)
+{
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		if ( !_CBHGeometryWriter_reserveLine(writer) ) { return NO; }
+		_CBHGeometryWriter_endLine(writer, CBHFormatter_writeRange(writer->bytes + writer->length, ranges[i]));
+	}
+
+	return !writer->hasFailed;
+}
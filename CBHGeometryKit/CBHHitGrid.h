@@ -0,0 +1,212 @@
+//  CBHHitGrid.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** A mutable index over a collection of stacked rects which finds the topmost rect under a point.
+ *
+ * The grid is a hierarchy of hashed grids whose cell sizes are powers of two. Each rect is held in the cell of the
+ * finest grid no smaller than the rect which contains its origin, so a point only needs to check four cells in each
+ * grid holding rects. Adding, removing and moving a rect costs amortized constant time, and moving a rect within its
+ * cell only replaces it. Queries do not allocate.
+ *
+ * Each rect is identified by an index which stays the same until the rect is removed, after which it may be reused.
+ * A grid created from a C array uses the array's indexes.
+ *
+ * Rects are stacked by a z-index. Those with a greater z-index are above those with a lesser one, and among rects with
+ * the same z-index those with a greater index are above those with a lesser one.
+ *
+ * Hits agree exactly with `NSRect_isMouseInRect()`, including its treatment of flipped coordinates. In particular
+ * empty rects and rects with a non-finite origin are held but never hit.
+ */
+typedef struct CBHHitGrid CBHHitGrid;
+
+/** A function called for each hit during an enumeration.
+ *
+ * @param index         The index of the rect which was hit.
+ * @param context       The context given to the enumeration.
+ * @param stop          Set to `YES` to stop the enumeration.
+ */
+typedef void (*CBHHitGridCallback)(NSUInteger index, void * _Nullable context, BOOL *stop);
+
+
+#pragma mark - Creating Hit Grids
+
+/**
+ * @name Creating Hit Grids
+ */
+
+/** Creates an empty hit grid.
+ *
+ * @return              A new grid, or `NULL` if the storage could not be allocated. Release it with `CBHHitGrid_destroy()`.
+ */
+CBHHitGrid * _Nullable CBHHitGrid_create(void);
+
+/** Creates a hit grid from a C array of rects stacked in order.
+ *
+ * Every rect has a z-index of 0, so each rect is above those before it in the array.
+ *
+ * @param rects         The rects to index. The grid does not keep a reference to them.
+ * @param count         The number of rects in _rects_.
+ *
+ * @return              A new grid, or `NULL` if the storage could not be allocated. Release it with `CBHHitGrid_destroy()`.
+ */
+CBHHitGrid * _Nullable CBHHitGrid_createWithRects(const NSRect *rects, NSUInteger count);
+
+/** Releases a hit grid.
+ *
+ * @param grid          The grid to release.
+ */
+void CBHHitGrid_destroy(CBHHitGrid * _Nullable grid);
+
+
+#pragma mark - Properties
+
+/**
+ * @name Properties
+ */
+
+/** The number of rects in the grid, including any which are never hit.
+ *
+ * @param grid          The grid.
+ *
+ * @return              The number of rects.
+ */
+NSUInteger CBHHitGrid_count(const CBHHitGrid *grid);
+
+/** The rect with an index.
+ *
+ * @param grid          The grid.
+ * @param index         The index of the rect.
+ *
+ * @return              The rect, or `NSZeroRect` if _index_ is not in use.
+ */
+NSRect CBHHitGrid_rectAtIndex(const CBHHitGrid *grid, NSUInteger index);
+
+/** The z-index of the rect with an index.
+ *
+ * @param grid          The grid.
+ * @param index         The index of the rect.
+ *
+ * @return              The z-index, or 0 if _index_ is not in use.
+ */
+NSInteger CBHHitGrid_zIndexAtIndex(const CBHHitGrid *grid, NSUInteger index);
+
+
+#pragma mark - Modifying Hit Grids
+
+/**
+ * @name Modifying Hit Grids
+ */
+
+/** Adds a rect to the grid.
+ *
+ * @param grid          The grid to modify.
+ * @param rect          The rect to add.
+ * @param zIndex        The z-index of the rect.
+ *
+ * @return              The index of the rect, or `NSNotFound` if the storage could not be allocated.
+ */
+NSUInteger CBHHitGrid_insertRect(CBHHitGrid *grid, NSRect rect, NSInteger zIndex);
+
+/** Removes a rect from the grid.
+ *
+ * @param grid          The grid to modify.
+ * @param index         The index of the rect to remove.
+ *
+ * @return              `YES` if the rect was removed, or `NO` if _index_ is not in use.
+ */
+BOOL CBHHitGrid_removeIndex(CBHHitGrid *grid, NSUInteger index);
+
+/** Moves or resizes a rect.
+ *
+ * @param grid          The grid to modify.
+ * @param index         The index of the rect.
+ * @param rect          The new rect.
+ *
+ * @return              `YES` if the rect was replaced, or `NO` if _index_ is not in use or the storage could not be
+ *                      allocated, in which case the grid is unchanged.
+ */
+BOOL CBHHitGrid_setRect(CBHHitGrid *grid, NSUInteger index, NSRect rect);
+
+/** Restacks a rect.
+ *
+ * @param grid          The grid to modify.
+ * @param index         The index of the rect.
+ * @param zIndex        The new z-index.
+ *
+ * @return              `YES` if the z-index was replaced, or `NO` if _index_ is not in use.
+ */
+BOOL CBHHitGrid_setZIndex(CBHHitGrid *grid, NSUInteger index, NSInteger zIndex);
+
+
+#pragma mark - Finding Hits
+
+/**
+ * @name Finding Hits
+ */
+
+/** Finds the topmost rect under a point.
+ *
+ * @param grid          The grid.
+ * @param point         The point to test.
+ * @param flipped       Whether the coordinates are flipped, as for `NSRect_isMouseInRect()`.
+ *
+ * @return              The index of the topmost rect for which `NSRect_isMouseInRect()` is `YES`, or `NSNotFound` if
+ *                      there is none.
+ */
+NSUInteger CBHHitGrid_topmostIndexAtPoint(const CBHHitGrid *grid, NSPoint point, BOOL flipped);
+
+/** Finds every rect under a point.
+ *
+ * Writes up to _capacity_ of the indexes, topmost first, and returns the total number of hits, which may exceed
+ * _capacity_. The first _capacity_ indexes are always the topmost.
+ *
+ * @param grid          The grid.
+ * @param point         The point to test.
+ * @param flipped       Whether the coordinates are flipped, as for `NSRect_isMouseInRect()`.
+ * @param indexes       A buffer to receive the indexes.
+ * @param capacity      The number of elements _indexes_ can hold.
+ *
+ * @return              The number of rects for which `NSRect_isMouseInRect()` is `YES`.
+ */
+NSUInteger CBHHitGrid_hitIndexes(const CBHHitGrid *grid, NSPoint point, BOOL flipped, NSUInteger * _Nullable indexes, NSUInteger capacity);
+
+
+#pragma mark - Enumerating Hits
+
+/**
+ * @name Enumerating Hits
+ */
+
+/** Calls a function for each rect under a point, topmost first.
+ *
+ * Hits are sorted in batches, each costing a pass over the rects near the point, so stopping early is cheap.
+ *
+ * @param grid          The grid.
+ * @param point         The point to test.
+ * @param flipped       Whether the coordinates are flipped, as for `NSRect_isMouseInRect()`.
+ * @param callback      The function to call for each hit.
+ * @param context       A value passed to _callback_.
+ */
+void CBHHitGrid_enumerateHits(const CBHHitGrid *grid, NSPoint point, BOOL flipped, CBHHitGridCallback callback, void * _Nullable context);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,605 @@
+//  CBHHitGrid.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHHitGrid.h"
+
+#import "_CBHGeometryKit+Predicates.h"
+#import "_CBHGeometryKit+IndexSink.h"
+
+#import <stdlib.h>
+#import <math.h>
+
+
+// Cells of level `k` are `2^k` wide. Rects smaller than the finest cell are held in it, and rects larger than the
+// coarsest cell are held in a single list which every query checks.
+enum { kCBHHitGridMinLevel = -32 };
+enum { kCBHHitGridLevelCount = 128 };
+
+// A point checks its cell and the three below and to the left of it in each occupied level.
+enum { kCBHHitGridMaxLists = kCBHHitGridLevelCount * 4 + 1 };
+
+// The number of hits an enumeration sorts at a time.
+enum { kCBHHitGridBatchSize = 64 };
+
+// Cell coordinates are clamped so they stay exact as `CGFloat`s. Rects beyond the limit share the outermost cells.
+static const CGFloat kCBHHitGridCellLimit = 4503599627370496.0;
+
+static const NSUInteger kCBHHitGridNil = NSNotFound;
+
+// Levels of items which are not held in a cell.
+static const NSInteger kCBHHitGridUnlinked = NSIntegerMin;
+static const NSInteger kCBHHitGridFree = NSIntegerMin + 1;
+static const NSInteger kCBHHitGridUnbounded = NSIntegerMax;
+
+
+// An item is its rect's index. Items in the same cell are chained through `next` and `previous`, and free items are
+// chained through `next`.
+typedef struct CBHHitGridItem
+{
+	NSRect rect;
+	NSInteger zIndex;
+
+	NSUInteger next;
+	NSUInteger previous;
+
+	NSInteger level;
+	int64_t x;
+	int64_t y;
+} CBHHitGridItem;
+
+// A slot in the cell table, which is empty when `head` is nil.
+typedef struct CBHHitGridCell
+{
+	NSInteger level;
+	int64_t x;
+	int64_t y;
+	NSUInteger head;
+} CBHHitGridCell;
+
+struct CBHHitGrid
+{
+	CBHHitGridItem * _Nullable items;
+	NSUInteger length;
+	NSUInteger capacity;
+
+	NSUInteger free;
+	NSUInteger count;
+
+	CBHHitGridCell * _Nullable cells;
+	NSUInteger cellCount;
+	NSUInteger cellCapacity;
+
+	NSUInteger unbounded;
+	NSUInteger levelCounts[kCBHHitGridLevelCount];
+	uint64_t levels[kCBHHitGridLevelCount / 64];
+};
+
+
+#pragma mark - Cells
+
+// The cell containing a coordinate.
+NS_INLINE int64_t _CBHHitGrid_floorCell(const CGFloat value, const NSInteger level)
+{
+	CGFloat cell = floor(ldexp(value, (int)-level));
+
+	// Scaling a tiny negative coordinate can round it to zero, which would floor into the wrong cell.
+	if ( cell == 0.0 && value < 0.0 ) { cell = -1.0; }
+
+	return (int64_t)fmin(fmax(cell, -kCBHHitGridCellLimit), kCBHHitGridCellLimit);
+}
+
+// The cell containing a coordinate when cells hold their upper edge rather than their lower one, as rects do along the
+// unflipped y axis. Clamping before stepping down keeps it within one cell of `_CBHHitGrid_floorCell()` at the limits.
+NS_INLINE int64_t _CBHHitGrid_ceilCell(const CGFloat value, const NSInteger level)
+{
+	CGFloat cell = ceil(ldexp(value, (int)-level));
+
+	if ( cell == 0.0 && value > 0.0 ) { cell = 1.0; }
+
+	return (int64_t)fmin(fmax(cell, 1.0 - kCBHHitGridCellLimit), 1.0 + kCBHHitGridCellLimit) - 1;
+}
+
+// Finds where a rect belongs. Rects which can never be hit are not held in a cell, nor are those too large for the
+// coarsest level. Otherwise the level is the finest whose cells are at least as large as the rect, so any point in
+// the rect lies in its cell or in the next cell along either axis.
+static NSInteger _CBHHitGrid_place(const NSRect rect, int64_t * const x, int64_t * const y)
+{
+	*x = 0;
+	*y = 0;
+
+	const BOOL isEmpty = !( rect.size.width > 0.0 && rect.size.height > 0.0 );
+	if ( isEmpty || !isfinite(rect.origin.x) || !isfinite(rect.origin.y) ) { return kCBHHitGridUnlinked; }
+
+	const CGFloat size = MAX(rect.size.width, rect.size.height);
+	if ( !(size <= ldexp(1.0, kCBHHitGridMinLevel + kCBHHitGridLevelCount - 1)) ) { return kCBHHitGridUnbounded; }
+
+	int exponent;
+	const NSInteger level = MAX(( frexp(size, &exponent) == 0.5 ) ? exponent - 1 : exponent, kCBHHitGridMinLevel);
+
+	*x = _CBHHitGrid_floorCell(rect.origin.x, level);
+	*y = _CBHHitGrid_floorCell(rect.origin.y, level);
+
+	return level;
+}
+
+NS_INLINE NSUInteger _CBHHitGrid_hash(const NSInteger level, const int64_t x, const int64_t y)
+{
+	uint64_t hash = (uint64_t)x * 0x9E3779B97F4A7C15ULL;
+	hash ^= (uint64_t)y * 0xC2B2AE3D27D4EB4FULL;
+	hash ^= (uint64_t)level * 0x165667B19E3779F9ULL;
+
+	return (NSUInteger)(hash ^ (hash >> 29));
+}
+
+// Finds the slot holding a cell, or the empty slot where it would go.
+static NSUInteger _CBHHitGrid_slot(const CBHHitGrid * const grid, const NSInteger level, const int64_t x, const int64_t y)
+{
+	const NSUInteger mask = grid->cellCapacity - 1;
+	NSUInteger slot = _CBHHitGrid_hash(level, x, y) & mask;
+
+	while ( grid->cells[slot].head != kCBHHitGridNil )
+	{
+		const CBHHitGridCell * const cell = grid->cells + slot;
+		if ( cell->x == x && cell->y == y && cell->level == level ) { break; }
+
+		slot = (slot + 1) & mask;
+	}
+
+	return slot;
+}
+
+NS_INLINE NSUInteger _CBHHitGrid_head(const CBHHitGrid * const grid, const NSInteger level, const int64_t x, const int64_t y)
+{
+	return grid->cells[_CBHHitGrid_slot(grid, level, x, y)].head;
+}
+
+// Empties a slot, shifting back any cells which probed past it so every cell stays reachable.
+static void _CBHHitGrid_removeSlot(CBHHitGrid * const grid, NSUInteger hole)
+{
+	const NSUInteger mask = grid->cellCapacity - 1;
+
+	for (NSUInteger slot = (hole + 1) & mask; grid->cells[slot].head != kCBHHitGridNil; slot = (slot + 1) & mask)
+	{
+		const CBHHitGridCell * const cell = grid->cells + slot;
+		const NSUInteger home = _CBHHitGrid_hash(cell->level, cell->x, cell->y) & mask;
+
+		if ( ((slot - home) & mask) >= ((slot - hole) & mask) )
+		{
+			grid->cells[hole] = *cell;
+			hole = slot;
+		}
+	}
+
+	grid->cells[hole].head = kCBHHitGridNil;
+	grid->cellCount -= 1;
+}
+
+
+#pragma mark - Storage
+
+static BOOL _CBHHitGrid_reserve(CBHHitGrid * const grid, const NSUInteger capacity)
+{
+	if ( capacity <= grid->capacity ) { return YES; }
+
+	const NSUInteger newCapacity = MAX(capacity, MAX(grid->capacity * 2, 16UL));
+	if ( newCapacity > NSUIntegerMax / sizeof(CBHHitGridItem) ) { return NO; }
+
+	CBHHitGridItem * const items = realloc(grid->items, sizeof(CBHHitGridItem) * newCapacity);
+	if ( items == NULL ) { return NO; }
+
+	grid->items = items;
+	grid->capacity = newCapacity;
+
+	return YES;
+}
+
+// Keeps the cell table at most half full, rehashing into a larger table when it would not be.
+static BOOL _CBHHitGrid_reserveCells(CBHHitGrid * const grid, const NSUInteger count)
+{
+	if ( count <= grid->cellCapacity / 2 ) { return YES; }
+
+	NSUInteger newCapacity = MAX(grid->cellCapacity, 16UL);
+	while ( count > newCapacity / 2 )
+	{
+		if ( newCapacity > NSUIntegerMax / 2 / sizeof(CBHHitGridCell) ) { return NO; }
+		newCapacity *= 2;
+	}
+
+	CBHHitGridCell * const cells = malloc(sizeof(CBHHitGridCell) * newCapacity);
+	if ( cells == NULL ) { return NO; }
+
+	for (NSUInteger i = 0; i < newCapacity; ++i) { cells[i].head = kCBHHitGridNil; }
+
+	CBHHitGridCell * const oldCells = grid->cells;
+	const NSUInteger oldCapacity = grid->cellCapacity;
+
+	grid->cells = cells;
+	grid->cellCapacity = newCapacity;
+
+	for (NSUInteger i = 0; i < oldCapacity; ++i)
+	{
+		if ( oldCells[i].head == kCBHHitGridNil ) { continue; }
+		grid->cells[_CBHHitGrid_slot(grid, oldCells[i].level, oldCells[i].x, oldCells[i].y)] = oldCells[i];
+	}
+
+	free(oldCells);
+
+	return YES;
+}
+
+
+#pragma mark - Linking
+
+// Adds an item to the front of the list for its cell. The cell table must have room for a new cell.
+static void _CBHHitGrid_link(CBHHitGrid * const grid, const NSUInteger index)
+{
+	CBHHitGridItem * const item = grid->items + index;
+	item->previous = kCBHHitGridNil;
+
+	if ( item->level == kCBHHitGridUnlinked )
+	{
+		item->next = kCBHHitGridNil;
+		return;
+	}
+
+	NSUInteger *head = &grid->unbounded;
+	if ( item->level != kCBHHitGridUnbounded )
+	{
+		const NSUInteger slot = _CBHHitGrid_slot(grid, item->level, item->x, item->y);
+		CBHHitGridCell * const cell = grid->cells + slot;
+
+		if ( cell->head == kCBHHitGridNil )
+		{
+			*cell = (CBHHitGridCell){ .level = item->level, .x = item->x, .y = item->y, .head = kCBHHitGridNil };
+			grid->cellCount += 1;
+		}
+
+		const NSUInteger level = (NSUInteger)(item->level - kCBHHitGridMinLevel);
+		grid->levelCounts[level] += 1;
+		grid->levels[level / 64] |= 1ULL << (level % 64);
+
+		head = &cell->head;
+	}
+
+	item->next = *head;
+	if ( *head != kCBHHitGridNil ) { grid->items[*head].previous = index; }
+	*head = index;
+}
+
+static void _CBHHitGrid_unlink(CBHHitGrid * const grid, const NSUInteger index)
+{
+	const CBHHitGridItem * const item = grid->items + index;
+	if ( item->level == kCBHHitGridUnlinked ) { return; }
+
+	if ( item->next != kCBHHitGridNil ) { grid->items[item->next].previous = item->previous; }
+
+	if ( item->previous != kCBHHitGridNil ) { grid->items[item->previous].next = item->next; }
+	else if ( item->level == kCBHHitGridUnbounded ) { grid->unbounded = item->next; }
+	else
+	{
+		const NSUInteger slot = _CBHHitGrid_slot(grid, item->level, item->x, item->y);
+		grid->cells[slot].head = item->next;
+
+		if ( item->next == kCBHHitGridNil ) { _CBHHitGrid_removeSlot(grid, slot); }
+	}
+
+	if ( item->level == kCBHHitGridUnbounded ) { return; }
+
+	const NSUInteger level = (NSUInteger)(item->level - kCBHHitGridMinLevel);
+	grid->levelCounts[level] -= 1;
+	if ( grid->levelCounts[level] == 0 ) { grid->levels[level / 64] &= ~(1ULL << (level % 64)); }
+}
+
+
+#pragma mark - Creating Hit Grids
+
+CBHHitGrid *CBHHitGrid_create(void)
+{
+	CBHHitGrid * const grid = calloc(1, sizeof(CBHHitGrid));
+	if ( grid == NULL ) { return NULL; }
+
+	grid->free = kCBHHitGridNil;
+	grid->unbounded = kCBHHitGridNil;
+
+	return grid;
+}
+
+CBHHitGrid *CBHHitGrid_createWithRects(const NSRect * const rects, const NSUInteger count)
+{
+	CBHHitGrid * const grid = CBHHitGrid_create();
+	if ( grid == NULL ) { return NULL; }
+
+	if ( count >= NSNotFound || !_CBHHitGrid_reserve(grid, count) )
+	{
+		CBHHitGrid_destroy(grid);
+		return NULL;
+	}
+
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		if ( !_CBHHitGrid_reserveCells(grid, grid->cellCount + 1) )
+		{
+			CBHHitGrid_destroy(grid);
+			return NULL;
+		}
+
+		CBHHitGridItem * const item = grid->items + i;
+		item->rect = rects[i];
+		item->zIndex = 0;
+		item->level = _CBHHitGrid_place(rects[i], &item->x, &item->y);
+
+		_CBHHitGrid_link(grid, i);
+	}
+
+	grid->length = count;
+	grid->count = count;
+
+	return grid;
+}
+
+void CBHHitGrid_destroy(CBHHitGrid * const grid)
+{
+	if ( grid == NULL ) { return; }
+
+	free(grid->items);
+	free(grid->cells);
+	free(grid);
+}
+
+
+#pragma mark - Properties
+
+NS_INLINE BOOL _CBHHitGrid_isInUse(const CBHHitGrid * const grid, const NSUInteger index)
+{
+	return ( index < grid->length ) && ( grid->items[index].level != kCBHHitGridFree );
+}
+
+NSUInteger CBHHitGrid_count(const CBHHitGrid * const grid)
+{
+	return grid->count;
+}
+
+NSRect CBHHitGrid_rectAtIndex(const CBHHitGrid * const grid, const NSUInteger index)
+{
+	if ( !_CBHHitGrid_isInUse(grid, index) ) { return NSZeroRect; }
+
+	return grid->items[index].rect;
+}
+
+NSInteger CBHHitGrid_zIndexAtIndex(const CBHHitGrid * const grid, const NSUInteger index)
+{
+	if ( !_CBHHitGrid_isInUse(grid, index) ) { return 0; }
+
+	return grid->items[index].zIndex;
+}
+
+
+#pragma mark - Modifying Hit Grids
+
+NSUInteger CBHHitGrid_insertRect(CBHHitGrid * const grid, const NSRect rect, const NSInteger zIndex)
+{
+	if ( !_CBHHitGrid_reserveCells(grid, grid->cellCount + 1) ) { return NSNotFound; }
+
+	NSUInteger index = grid->free;
+
+	if ( index != kCBHHitGridNil ) { grid->free = grid->items[index].next; }
+	else
+	{
+		if ( grid->length >= NSNotFound - 1 || !_CBHHitGrid_reserve(grid, grid->length + 1) ) { return NSNotFound; }
+		index = grid->length++;
+	}
+
+	CBHHitGridItem * const item = grid->items + index;
+	item->rect = rect;
+	item->zIndex = zIndex;
+	item->level = _CBHHitGrid_place(rect, &item->x, &item->y);
+
+	_CBHHitGrid_link(grid, index);
+	grid->count += 1;
+
+	return index;
+}
+
+BOOL CBHHitGrid_removeIndex(CBHHitGrid * const grid, const NSUInteger index)
+{
+	if ( !_CBHHitGrid_isInUse(grid, index) ) { return NO; }
+
+	_CBHHitGrid_unlink(grid, index);
+
+	grid->items[index].level = kCBHHitGridFree;
+	grid->items[index].next = grid->free;
+	grid->free = index;
+	grid->count -= 1;
+
+	return YES;
+}
+
+BOOL CBHHitGrid_setRect(CBHHitGrid * const grid, const NSUInteger index, const NSRect rect)
+{
+	if ( !_CBHHitGrid_isInUse(grid, index) ) { return NO; }
+
+	CBHHitGridItem * const item = grid->items + index;
+
+	int64_t x;
+	int64_t y;
+	const NSInteger level = _CBHHitGrid_place(rect, &x, &y);
+
+	// Most moves stay within a cell.
+	if ( level == item->level && x == item->x && y == item->y )
+	{
+		item->rect = rect;
+		return YES;
+	}
+
+	if ( !_CBHHitGrid_reserveCells(grid, grid->cellCount + 1) ) { return NO; }
+
+	_CBHHitGrid_unlink(grid, index);
+
+	item->rect = rect;
+	item->level = level;
+	item->x = x;
+	item->y = y;
+
+	_CBHHitGrid_link(grid, index);
+
+	return YES;
+}
+
+BOOL CBHHitGrid_setZIndex(CBHHitGrid * const grid, const NSUInteger index, const NSInteger zIndex)
+{
+	if ( !_CBHHitGrid_isInUse(grid, index) ) { return NO; }
+
+	grid->items[index].zIndex = zIndex;
+
+	return YES;
+}
+
+
+#pragma mark - Searching
+
+// Items are stacked by z-index and then by index so every item has a distinct place.
+NS_INLINE BOOL _CBHHitGrid_isAbove(const CBHHitGrid * const grid, const NSUInteger index, const NSUInteger other)
+{
+	const NSInteger zIndex = grid->items[index].zIndex;
+	const NSInteger otherZIndex = grid->items[other].zIndex;
+
+	return ( zIndex > otherZIndex ) || ( zIndex == otherZIndex && index > other );
+}
+
+// Gathers the lists which may hold rects under a point. A rect's cell holds its origin, so a point in the rect lies in
+// that cell or in the next one along either axis.
+static NSUInteger _CBHHitGrid_lists(const CBHHitGrid * const grid, const NSPoint point, const BOOL flipped, NSUInteger * const heads)
+{
+	if ( isnan(point.x) || isnan(point.y) ) { return 0; }
+
+	NSUInteger count = 0;
+	if ( grid->unbounded != kCBHHitGridNil ) { heads[count++] = grid->unbounded; }
+
+	for (NSUInteger word = 0; word < kCBHHitGridLevelCount / 64; ++word)
+	{
+		for (uint64_t bits = grid->levels[word]; bits != 0; bits &= bits - 1)
+		{
+			const NSInteger level = (NSInteger)(word * 64 + (NSUInteger)__builtin_ctzll(bits)) + kCBHHitGridMinLevel;
+			const int64_t x = _CBHHitGrid_floorCell(point.x, level);
+			const int64_t y = ( flipped ) ? _CBHHitGrid_floorCell(point.y, level) : _CBHHitGrid_ceilCell(point.y, level);
+
+			const NSUInteger cells[4] = {
+				_CBHHitGrid_head(grid, level, x, y),
+				_CBHHitGrid_head(grid, level, x - 1, y),
+				_CBHHitGrid_head(grid, level, x, y - 1),
+				_CBHHitGrid_head(grid, level, x - 1, y - 1),
+			};
+
+			for (NSUInteger i = 0; i < 4; ++i)
+			{
+				if ( cells[i] != kCBHHitGridNil ) { heads[count++] = cells[i]; }
+			}
+		}
+	}
+
+	return count;
+}
+
+// Writes the topmost hits below `bound`, or all hits when it is nil, into `indexes` in order and returns the number of
+// hits below `bound`, which may exceed `capacity`.
+static NSUInteger _CBHHitGrid_collect(const CBHHitGrid * const grid, const NSUInteger * const heads, const NSUInteger headCount, const NSPoint point, const BOOL flipped, const NSUInteger bound, NSUInteger * const indexes, const NSUInteger capacity)
+{
+	NSUInteger count = 0;
+
+	for (NSUInteger i = 0; i < headCount; ++i)
+	{
+		for (NSUInteger index = heads[i]; index != kCBHHitGridNil; index = grid->items[index].next)
+		{
+			if ( !CBHRect_isMouseInRect(grid->items[index].rect, point, flipped) ) { continue; }
+			if ( bound != kCBHHitGridNil && !_CBHHitGrid_isAbove(grid, bound, index) ) { continue; }
+
+			count += 1;
+
+			// Insert into the sorted buffer, dropping its bottom hit when full.
+			NSUInteger position = MIN(count - 1, capacity);
+			if ( position == capacity )
+			{
+				if ( capacity == 0 || !_CBHHitGrid_isAbove(grid, index, indexes[capacity - 1]) ) { continue; }
+				position -= 1;
+			}
+
+			for (; position > 0 && _CBHHitGrid_isAbove(grid, index, indexes[position - 1]); --position)
+			{
+				indexes[position] = indexes[position - 1];
+			}
+
+			indexes[position] = index;
+		}
+	}
+
+	return count;
+}
+
+
+#pragma mark - Finding Hits
+
+NSUInteger CBHHitGrid_topmostIndexAtPoint(const CBHHitGrid * const grid, const NSPoint point, const BOOL flipped)
+{
+	NSUInteger heads[kCBHHitGridMaxLists];
+	const NSUInteger headCount = _CBHHitGrid_lists(grid, point, flipped, heads);
+
+	NSUInteger topmost = kCBHHitGridNil;
+	for (NSUInteger i = 0; i < headCount; ++i)
+	{
+		for (NSUInteger index = heads[i]; index != kCBHHitGridNil; index = grid->items[index].next)
+		{
+			if ( topmost != kCBHHitGridNil && !_CBHHitGrid_isAbove(grid, index, topmost) ) { continue; }
+			if ( CBHRect_isMouseInRect(grid->items[index].rect, point, flipped) ) { topmost = index; }
+		}
+	}
+
+	return topmost;
+}
+
+NSUInteger CBHHitGrid_hitIndexes(const CBHHitGrid * const grid, const NSPoint point, const BOOL flipped, NSUInteger * const indexes, const NSUInteger capacity)
+{
+	NSUInteger heads[kCBHHitGridMaxLists];
+	const NSUInteger headCount = _CBHHitGrid_lists(grid, point, flipped, heads);
+
+	return _CBHHitGrid_collect(grid, heads, headCount, point, flipped, kCBHHitGridNil, indexes, ( indexes != NULL ) ? capacity : 0);
+}
+
+
+#pragma mark - Enumerating Hits
+
+void CBHHitGrid_enumerateHits(const CBHHitGrid * const grid, const NSPoint point, const BOOL flipped, const CBHHitGridCallback callback, void * const context)
+{
+	NSUInteger heads[kCBHHitGridMaxLists];
+	const NSUInteger headCount = _CBHHitGrid_lists(grid, point, flipped, heads);
+
+	NSUInteger batch[kCBHHitGridBatchSize];
+	NSUInteger bound = kCBHHitGridNil;
+	CBHIndexSink sink = CBHIndexSink_initWithCallback(callback, context);
+
+	// Each pass reports the topmost hits below the last one reported.
+	while ( !sink.stop )
+	{
+		const NSUInteger count = _CBHHitGrid_collect(grid, heads, headCount, point, flipped, bound, batch, kCBHHitGridBatchSize);
+		const NSUInteger length = MIN(count, (NSUInteger)kCBHHitGridBatchSize);
+
+		CBHIndexSink_emitRange(&sink, batch, length);
+
+		if ( count <= kCBHHitGridBatchSize ) { return; }
+		bound = batch[length - 1];
+	}
+}
@@ -0,0 +1,43 @@
+//  CBHInlining.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/** Selects how the scalar functions of `NSPoint`, `NSSize`, `NSRect`, `NSRange` and `CBHPixelRect` reach their callers.
+ *
+ * By default each function is an exported symbol of the framework, so calls cannot be inlined or vectorized across the
+ * framework boundary. Defining `CBH_GEOMETRY_INLINE` as 1 for a target makes the headers declare those functions
+ * `static inline` and include their definitions. The exported symbols are built either way, so both kinds of client
+ * link against the same framework.
+ *
+ * Define the macro for the whole target, with `GCC_PREPROCESSOR_DEFINITIONS` or `-DCBH_GEOMETRY_INLINE=1`. When modules
+ * are enabled a `#define` before `@import CBHGeometryKit;` does not reach the headers.
+ *
+ * The parsing, description buffer and batched distance functions are always out of line.
+ */
+#ifndef CBH_GEOMETRY_INLINE
+#define CBH_GEOMETRY_INLINE 0
+#endif
+
+#if CBH_GEOMETRY_INLINE
+#define CBH_INLINABLE static inline
+#else
+#define CBH_INLINABLE
+#endif
+
+#ifndef CBH_CONST
+#define CBH_CONST __attribute__((const))
+#endif
@@ -0,0 +1,315 @@
+//  CBHPackedGeometry.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Read-only point and rect arrays stored in fewer bytes than `NSPoint` and `NSRect`.
+ *
+ * Elements are packed in blocks of 1024. Each block stores every coordinate as an offset from an origin chosen for that
+ * block, so the precision follows the spread of the block rather than its distance from the origin. Queries run on
+ * the packed form, skipping blocks whose bounds rule them out and decoding the others a block at a time, and give the
+ * same results as the `NSPoint` and `NSRect` functions applied to the decoded elements.
+ *
+ * Every coordinate must be finite, and the spread of each block must be finite too. Other values are packed to
+ * unspecified values.
+ */
+
+/** The storage of each packed coordinate.
+ *
+ * The error bounds are for a block spanning _spread_ in that coordinate, and leave out the rounding of the decoded
+ * double. The error actually incurred is measured when an array is packed.
+ */
+typedef NS_ENUM(NSInteger, CBHPackedFormat)
+{
+	/** A 32 bit float offset from the middle of the block, for 4 bytes per coordinate. The error is at most
+	 * _spread_ / 2^25, and less for coordinates near the middle of the block. */
+	CBHPackedFormatFloat32 = 0,
+
+	/** A 16 bit unsigned step count from the minimum of the block, for 2 bytes per coordinate. The steps are evenly
+	 * spaced across the block and the error is at most _spread_ / 131070, half a step. */
+	CBHPackedFormatUInt16,
+
+	/** A 32 bit unsigned step count from the minimum of the block, for 4 bytes per coordinate. The error is at most
+	 * _spread_ / 8589934590, half a step. */
+	CBHPackedFormatUInt32,
+};
+
+/** A packed array of points. */
+typedef struct CBHPackedPoints CBHPackedPoints;
+
+/** A packed array of rects. The origin and size of each rect are packed as 4 coordinates. */
+typedef struct CBHPackedRects CBHPackedRects;
+
+
+#pragma mark - Creating Packed Points
+
+/**
+ * @name Creating Packed Points
+ */
+
+/** Packs a C array of points.
+ *
+ * @param points        The points to pack. The array does not keep a reference to them.
+ * @param count         The number of points in _points_.
+ * @param format        The storage of each coordinate.
+ *
+ * @return              A new packed array, or `NULL` if the storage could not be allocated or _format_ is not valid.
+ *                      Release it with `CBHPackedPoints_destroy()`.
+ */
+CBHPackedPoints * _Nullable CBHPackedPoints_create(const NSPoint *points, NSUInteger count, CBHPackedFormat format);
+
+/** Releases a packed point array.
+ *
+ * @param packed        The array to release.
+ */
+void CBHPackedPoints_destroy(CBHPackedPoints * _Nullable packed);
+
+
+#pragma mark - Packed Point Properties
+
+/**
+ * @name Packed Point Properties
+ */
+
+/** The number of points in a packed array.
+ *
+ * @param packed        The array.
+ *
+ * @return              The number of points.
+ */
+NSUInteger CBHPackedPoints_count(const CBHPackedPoints *packed);
+
+/** The storage of each coordinate in a packed array.
+ *
+ * @param packed        The array.
+ *
+ * @return              The format the array was created with.
+ */
+CBHPackedFormat CBHPackedPoints_format(const CBHPackedPoints *packed);
+
+/** The memory held by a packed array.
+ *
+ * @param packed        The array.
+ *
+ * @return              The number of bytes, including the block headers.
+ */
+NSUInteger CBHPackedPoints_byteCount(const CBHPackedPoints *packed);
+
+/** The greatest quantization error of a packed array, measured when it was packed.
+ *
+ * @param packed        The array.
+ *
+ * @return              A point whose coordinates are the greatest absolute difference between a decoded and an
+ *                      original x and y coordinate.
+ */
+NSPoint CBHPackedPoints_maximumError(const CBHPackedPoints *packed);
+
+/** The bounds of the decoded points.
+ *
+ * @param packed        The array.
+ *
+ * @return              The same rect as `NSRect_boundingRectOfPoints()` gives for the decoded points.
+ */
+NSRect CBHPackedPoints_bounds(const CBHPackedPoints *packed);
+
+
+#pragma mark - Decoding Packed Points
+
+/**
+ * @name Decoding Packed Points
+ */
+
+/** Decodes a point.
+ *
+ * @param packed        The array.
+ * @param index         The index of the point, which must be less than the count.
+ *
+ * @return              The decoded point.
+ */
+NSPoint CBHPackedPoints_pointAtIndex(const CBHPackedPoints *packed, NSUInteger index);
+
+/** Decodes a range of points into a C array. Large ranges are vectorized and split across cores.
+ *
+ * @param packed        The array.
+ * @param range         The range of points to decode, which must lie within the count.
+ * @param points        A buffer of at least _range.length_ points to receive the decoded points.
+ */
+void CBHPackedPoints_unpack(const CBHPackedPoints *packed, NSRange range, NSPoint *points);
+
+
+#pragma mark - Querying Packed Points
+
+/**
+ * @name Querying Packed Points
+ */
+
+/** Calculates the squared distance from a point to every packed point. Large arrays are split across cores.
+ *
+ * @param packed        The array.
+ * @param point         The point to measure from.
+ * @param distances     A buffer with room for every point in _packed_ to receive the distances.
+ */
+void CBHPackedPoints_distancesSquaredToPoint(const CBHPackedPoints *packed, NSPoint point, CGFloat *distances);
+
+/** Finds the points in a rect.
+ *
+ * Matches are written in order of index, up to _capacity_.
+ *
+ * @param packed        The array.
+ * @param rect          The rect to search.
+ * @param indexes       A buffer to receive the indexes.
+ * @param capacity      The number of elements _indexes_ can hold.
+ *
+ * @return              The number of decoded points for which `NSRect_isPointInRect()` is `YES`, which may exceed
+ *                      _capacity_.
+ */
+NSUInteger CBHPackedPoints_inRectIndexes(const CBHPackedPoints *packed, NSRect rect, NSUInteger * _Nullable indexes, NSUInteger capacity);
+
+
+#pragma mark - Creating Packed Rects
+
+/**
+ * @name Creating Packed Rects
+ */
+
+/** Packs a C array of rects.
+ *
+ * @param rects         The rects to pack. The array does not keep a reference to them.
+ * @param count         The number of rects in _rects_.
+ * @param format        The storage of each coordinate.
+ *
+ * @return              A new packed array, or `NULL` if the storage could not be allocated or _format_ is not valid.
+ *                      Release it with `CBHPackedRects_destroy()`.
+ */
+CBHPackedRects * _Nullable CBHPackedRects_create(const NSRect *rects, NSUInteger count, CBHPackedFormat format);
+
+/** Releases a packed rect array.
+ *
+ * @param packed        The array to release.
+ */
+void CBHPackedRects_destroy(CBHPackedRects * _Nullable packed);
+
+
+#pragma mark - Packed Rect Properties
+
+/**
+ * @name Packed Rect Properties
+ */
+
+/** The number of rects in a packed array.
+ *
+ * @param packed        The array.
+ *
+ * @return              The number of rects.
+ */
+NSUInteger CBHPackedRects_count(const CBHPackedRects *packed);
+
+/** The storage of each coordinate in a packed array.
+ *
+ * @param packed        The array.
+ *
+ * @return              The format the array was created with.
+ */
+CBHPackedFormat CBHPackedRects_format(const CBHPackedRects *packed);
+
+/** The memory held by a packed array.
+ *
+ * @param packed        The array.
+ *
+ * @return              The number of bytes, including the block headers.
+ */
+NSUInteger CBHPackedRects_byteCount(const CBHPackedRects *packed);
+
+/** The greatest quantization error of a packed array, measured when it was packed.
+ *
+ * @param packed        The array.
+ *
+ * @return              A rect whose components are the greatest absolute difference between a decoded and an original
+ *                      x, y, width, and height.
+ */
+NSRect CBHPackedRects_maximumError(const CBHPackedRects *packed);
+
+/** The union of the decoded rects.
+ *
+ * @param packed        The array.
+ *
+ * @return              The same rect as `NSRect_unionOfRects()` gives for the decoded rects.
+ */
+NSRect CBHPackedRects_bounds(const CBHPackedRects *packed);
+
+
+#pragma mark - Decoding Packed Rects
+
+/**
+ * @name Decoding Packed Rects
+ */
+
+/** Decodes a rect.
+ *
+ * @param packed        The array.
+ * @param index         The index of the rect, which must be less than the count.
+ *
+ * @return              The decoded rect.
+ */
+NSRect CBHPackedRects_rectAtIndex(const CBHPackedRects *packed, NSUInteger index);
+
+/** Decodes a range of rects into a C array. Large ranges are vectorized and split across cores.
+ *
+ * @param packed        The array.
+ * @param range         The range of rects to decode, which must lie within the count.
+ * @param rects         A buffer of at least _range.length_ rects to receive the decoded rects.
+ */
+void CBHPackedRects_unpack(const CBHPackedRects *packed, NSRange range, NSRect *rects);
+
+
+#pragma mark - Querying Packed Rects
+
+/**
+ * @name Querying Packed Rects
+ *
+ * These functions write up to _capacity_ matching indexes in order of index and return the total number of matches,
+ * which may exceed _capacity_.
+ */
+
+/** Finds the rects intersecting a rect.
+ *
+ * @param packed        The array.
+ * @param rect          The rect to search.
+ * @param indexes       A buffer to receive the indexes.
+ * @param capacity      The number of elements _indexes_ can hold.
+ *
+ * @return              The number of decoded rects for which `NSRect_isIntersecting()` with _rect_ is `YES`.
+ */
+NSUInteger CBHPackedRects_intersectingIndexes(const CBHPackedRects *packed, NSRect rect, NSUInteger * _Nullable indexes, NSUInteger capacity);
+
+/** Finds the rects containing a point.
+ *
+ * @param packed        The array.
+ * @param point         The point to search.
+ * @param indexes       A buffer to receive the indexes.
+ * @param capacity      The number of elements _indexes_ can hold.
+ *
+ * @return              The number of decoded rects for which `NSRect_isPointInRect()` is `YES`.
+ */
+NSUInteger CBHPackedRects_containingPointIndexes(const CBHPackedRects *packed, NSPoint point, NSUInteger * _Nullable indexes, NSUInteger capacity);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,698 @@
+//  CBHPackedGeometry.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHPackedGeometry.h"
+
+#import "NSPoint+CBHGeometryKit.h"
+#import "NSRect+CBHGeometryKit.h"
+
+#import "_CBHGeometryKit+Utilities.h"
+#import "_CBHGeometryKit+Vector.h"
+#import "_CBHGeometryKit+Predicates.h"
+#import "_CBHGeometryKit+IndexSink.h"
+#import "_CBHGeometryKit+Parallel.h"
+
+#import <math.h>
+#import <stdlib.h>
+
+
+// Blocks are the unit of encoding, culling, and sharing work. A block of rects decodes into 32 KB, which fits on the
+// stack and in the first level cache.
+enum { kCBHPackedBlockLength = 1024 };
+
+
+// Points and rects are both stored as a flat sequence of coordinates, `components` to an element, so one set of
+// kernels serves both. A coordinate is stored as `(value - origin) / step`, rounded and clamped to a whole number of
+// steps for the integer formats, and decoded as `origin + stored * step`. The float format has a step of 1, which
+// leaves its offsets unscaled.
+//
+// Every path, scalar or vector, computes each coordinate with the same operations in the same order, and the products
+// are kept in separate statements so they cannot be contracted into fused multiply-adds. A coordinate therefore
+// decodes to the same value however it is read.
+//
+// A block's edges are the least and greatest decoded x and y of its points, or of the edges of its non-empty rects, so
+// a block whose edges rule out a query holds no match.
+typedef struct CBHPackedBlock
+{
+	CGFloat origin[4];
+	CGFloat step[4];
+	CGFloat error[4];
+
+	NSPoint minimum;
+	NSPoint maximum;
+} CBHPackedBlock;
+
+typedef struct CBHPackedStorage
+{
+	CBHPackedFormat format;
+	NSUInteger count;
+	NSUInteger components;
+	NSUInteger blockCount;
+
+	CBHPackedBlock * _Nullable blocks;
+	void * _Nullable values;
+
+	CGFloat error[4];
+	NSPoint minimum;
+	NSPoint maximum;
+} CBHPackedStorage;
+
+struct CBHPackedPoints
+{
+	CBHPackedStorage storage;
+};
+
+struct CBHPackedRects
+{
+	CBHPackedStorage storage;
+};
+
+
+#pragma mark - Coordinates
+
+NS_INLINE BOOL _CBHPacked_isFormatValid(const CBHPackedFormat format)
+{
+	return ( format == CBHPackedFormatFloat32 || format == CBHPackedFormatUInt16 || format == CBHPackedFormatUInt32 );
+}
+
+NS_INLINE size_t _CBHPacked_valueSize(const CBHPackedFormat format)
+{
+	return ( format == CBHPackedFormatUInt16 ) ? sizeof(uint16_t) : sizeof(uint32_t);
+}
+
+// The greatest number of steps the integer formats can hold.
+NS_INLINE CGFloat _CBHPacked_stepLimit(const CBHPackedFormat format)
+{
+	return ( format == CBHPackedFormatUInt16 ) ? (CGFloat)UINT16_MAX : (CGFloat)UINT32_MAX;
+}
+
+// The coordinates of an element in a block run from `location` to `location + length` in the flat sequence.
+NS_INLINE NSRange _CBHPacked_blockValues(const CBHPackedStorage * const storage, const NSUInteger index)
+{
+	const NSUInteger first = index * kCBHPackedBlockLength;
+	return NSMakeRange(first * storage->components, MIN((NSUInteger)kCBHPackedBlockLength, storage->count - first) * storage->components);
+}
+
+NS_INLINE CGFloat _CBHPacked_load(const CBHPackedFormat format, const void * const values, const NSUInteger index)
+{
+	if ( format == CBHPackedFormatFloat32 ) { return (CGFloat)((const float *)values)[index]; }
+	if ( format == CBHPackedFormatUInt16 ) { return (CGFloat)((const uint16_t *)values)[index]; }
+	return (CGFloat)((const uint32_t *)values)[index];
+}
+
+NS_INLINE void _CBHPacked_store(const CBHPackedFormat format, void * const values, const NSUInteger index, const CGFloat value)
+{
+	if ( format == CBHPackedFormatFloat32 ) { ((float *)values)[index] = (float)value; }
+	else if ( format == CBHPackedFormatUInt16 ) { ((uint16_t *)values)[index] = (uint16_t)value; }
+	else { ((uint32_t *)values)[index] = (uint32_t)value; }
+}
+
+NS_INLINE CGFloat _CBHPacked_quantize(const CBHPackedFormat format, const CGFloat value, const CGFloat origin, const CGFloat step, const CGFloat limit)
+{
+	const CGFloat offset = (value - origin) / step;
+
+	if ( format == CBHPackedFormatFloat32 ) { return offset; }
+	return MIN(MAX(round(offset), 0.0), limit);
+}
+
+NS_INLINE CGFloat _CBHPacked_dequantize(const CGFloat stored, const CGFloat origin, const CGFloat step)
+{
+	const CGFloat scaled = stored * step;
+	return origin + scaled;
+}
+
+#if CBH_VECTOR
+
+NS_INLINE CBHVector _CBHPacked_loadVector(const CBHPackedFormat format, const void * const values, const NSUInteger index)
+{
+	if ( format == CBHPackedFormatFloat32 ) { return CBHVector_loadFloats((const float *)values + index); }
+	if ( format == CBHPackedFormatUInt16 ) { return CBHVector_loadUInt16s((const uint16_t *)values + index); }
+	return CBHVector_loadUInt32s((const uint32_t *)values + index);
+}
+
+NS_INLINE void _CBHPacked_storeVector(const CBHPackedFormat format, void * const values, const NSUInteger index, const CBHVector vector)
+{
+	if ( format == CBHPackedFormatFloat32 ) { CBHVector_storeFloats((float *)values + index, vector); }
+	else if ( format == CBHPackedFormatUInt16 ) { CBHVector_storeUInt16s((uint16_t *)values + index, vector); }
+	else { CBHVector_storeUInt32s((uint32_t *)values + index, vector); }
+}
+
+// Successive vector steps cycle through the components of an element. With at most 4 components a cycle is at most
+// `kCBHPackedLaneCycle` steps long, and each step's origins and steps are loaded once per block.
+enum { kCBHPackedLaneCycle = 4 / CBH_VECTOR_WIDTH };
+
+typedef struct CBHPackedLanes
+{
+	CBHVector origin[kCBHPackedLaneCycle];
+	CBHVector step[kCBHPackedLaneCycle];
+} CBHPackedLanes;
+
+static CBHPackedLanes _CBHPacked_lanes(const CBHPackedStorage * const storage, const CBHPackedBlock * const block, const NSUInteger location)
+{
+	double origins[4];
+	double steps[4];
+
+	for (NSUInteger i = 0; i < 4; ++i)
+	{
+		const NSUInteger component = (location + i) % storage->components;
+		origins[i] = block->origin[component];
+		steps[i] = block->step[component];
+	}
+
+	CBHPackedLanes lanes;
+
+	for (NSUInteger i = 0; i < kCBHPackedLaneCycle; ++i)
+	{
+		lanes.origin[i] = CBHVector_load(origins + i * CBH_VECTOR_WIDTH);
+		lanes.step[i] = CBHVector_load(steps + i * CBH_VECTOR_WIDTH);
+	}
+
+	return lanes;
+}
+
+#endif
+
+
+#pragma mark - Encoding Blocks
+
+// Chooses the origin and step of each component from the extents of a block's coordinates. The float format is
+// centred on the block to halve its greatest offset. The integer formats spread their steps from the least coordinate
+// to the greatest, or use a step of 1 when every coordinate is the same.
+static void _CBHPacked_prepareBlock(const CBHPackedStorage * const storage, CBHPackedBlock * const block, const CGFloat * const values, const NSUInteger length)
+{
+	const NSUInteger components = storage->components;
+
+	for (NSUInteger c = 0; c < components; ++c)
+	{
+		CGFloat minimum = values[c];
+		CGFloat maximum = values[c];
+
+		for (NSUInteger i = c + components; i < length; i += components)
+		{
+			minimum = MIN(minimum, values[i]);
+			maximum = MAX(maximum, values[i]);
+		}
+
+		if ( storage->format == CBHPackedFormatFloat32 )
+		{
+			block->origin[c] = minimum * 0.5 + maximum * 0.5;
+			block->step[c] = 1.0;
+		}
+		else
+		{
+			const CGFloat step = (maximum - minimum) / _CBHPacked_stepLimit(storage->format);
+
+			block->origin[c] = minimum;
+			block->step[c] = ( step > 0.0 ) ? step : 1.0;
+		}
+	}
+}
+
+static void _CBHPacked_encodeBlock(CBHPackedStorage * const storage, const CBHPackedBlock * const block, const CGFloat * const values, const NSRange range)
+{
+	const CBHPackedFormat format = storage->format;
+	const CGFloat limit = _CBHPacked_stepLimit(format);
+	NSUInteger i = 0;
+
+#if CBH_VECTOR
+	const CBHPackedLanes lanes = _CBHPacked_lanes(storage, block, range.location);
+	const CBHVector zero = CBHVector_set(0.0);
+	const CBHVector limits = CBHVector_set(limit);
+
+	for ( ; i + CBH_VECTOR_WIDTH <= range.length; i += CBH_VECTOR_WIDTH )
+	{
+		const NSUInteger cycle = (i / CBH_VECTOR_WIDTH) % kCBHPackedLaneCycle;
+
+		CBHVector offset = CBHVector_div(CBHVector_sub(CBHVector_load(values + i), lanes.origin[cycle]), lanes.step[cycle]);
+		if ( format != CBHPackedFormatFloat32 ) { offset = CBHVector_min(CBHVector_max(CBHVector_round(offset), zero), limits); }
+
+		_CBHPacked_storeVector(format, storage->values, range.location + i, offset);
+	}
+#endif
+
+	for ( ; i < range.length; ++i )
+	{
+		const NSUInteger component = (range.location + i) % storage->components;
+		const CGFloat stored = _CBHPacked_quantize(format, values[i], block->origin[component], block->step[component], limit);
+
+		_CBHPacked_store(format, storage->values, range.location + i, stored);
+	}
+}
+
+// Decodes coordinates which lie within one block.
+static void _CBHPacked_decodeBlock(const CBHPackedStorage * const storage, const CBHPackedBlock * const block, const NSRange range, CGFloat * const values)
+{
+	const CBHPackedFormat format = storage->format;
+	NSUInteger i = 0;
+
+#if CBH_VECTOR
+	const CBHPackedLanes lanes = _CBHPacked_lanes(storage, block, range.location);
+
+	for ( ; i + CBH_VECTOR_WIDTH <= range.length; i += CBH_VECTOR_WIDTH )
+	{
+		const NSUInteger cycle = (i / CBH_VECTOR_WIDTH) % kCBHPackedLaneCycle;
+
+		const CBHVector scaled = CBHVector_mul(_CBHPacked_loadVector(format, storage->values, range.location + i), lanes.step[cycle]);
+		CBHVector_store(values + i, CBHVector_add(lanes.origin[cycle], scaled));
+	}
+#endif
+
+	for ( ; i < range.length; ++i )
+	{
+		const NSUInteger component = (range.location + i) % storage->components;
+		values[i] = _CBHPacked_dequantize(_CBHPacked_load(format, storage->values, range.location + i), block->origin[component], block->step[component]);
+	}
+}
+
+// Decodes any run of coordinates, a block at a time.
+static void _CBHPacked_decode(const CBHPackedStorage * const storage, const NSRange range, CGFloat * const values)
+{
+	const NSUInteger blockValues = kCBHPackedBlockLength * storage->components;
+	NSUInteger location = range.location;
+
+	while ( location < NSMaxRange(range) )
+	{
+		const NSUInteger block = location / blockValues;
+		const NSUInteger length = MIN((block + 1) * blockValues, NSMaxRange(range)) - location;
+
+		_CBHPacked_decodeBlock(storage, storage->blocks + block, NSMakeRange(location, length), values + (location - range.location));
+		location += length;
+	}
+}
+
+static void _CBHPacked_measureError(const CBHPackedStorage * const storage, CBHPackedBlock * const block, const CGFloat * const values, const CGFloat * const decoded, const NSUInteger length)
+{
+	for (NSUInteger c = 0; c < 4; ++c) { block->error[c] = 0.0; }
+
+	for (NSUInteger i = 0; i < length; ++i)
+	{
+		const NSUInteger component = i % storage->components;
+		block->error[component] = MAX(block->error[component], fabs(decoded[i] - values[i]));
+	}
+}
+
+static void _CBHPackedPoints_finishBlock(const CBHPackedStorage * const storage, CBHPackedBlock * const block, const CGFloat * const values, const NSRange range)
+{
+	NSPoint decoded[kCBHPackedBlockLength];
+	_CBHPacked_decodeBlock(storage, block, range, (CGFloat *)decoded);
+
+	_CBHPacked_measureError(storage, block, values, (const CGFloat *)decoded, range.length);
+	NSPoint_extentsOfPoints(decoded, range.length / 2, &block->minimum, &block->maximum);
+}
+
+static void _CBHPackedRects_finishBlock(const CBHPackedStorage * const storage, CBHPackedBlock * const block, const CGFloat * const values, const NSRange range)
+{
+	NSRect decoded[kCBHPackedBlockLength];
+	_CBHPacked_decodeBlock(storage, block, range, (CGFloat *)decoded);
+
+	_CBHPacked_measureError(storage, block, values, (const CGFloat *)decoded, range.length);
+
+	// The edges are found as `NSRect_unionOfRects()` finds them, and stay inverted if every rect is empty.
+	block->minimum = NSPoint_init(INFINITY, INFINITY);
+	block->maximum = NSPoint_init(-INFINITY, -INFINITY);
+
+	for (NSUInteger i = 0; i < range.length / 4; ++i)
+	{
+		const NSRect rect = decoded[i];
+		if ( CBHRect_isEmpty(rect) ) { continue; }
+
+		block->minimum.x = MIN(block->minimum.x, rect.origin.x);
+		block->minimum.y = MIN(block->minimum.y, rect.origin.y);
+		block->maximum.x = MAX(block->maximum.x, rect.origin.x + rect.size.width);
+		block->maximum.y = MAX(block->maximum.y, rect.origin.y + rect.size.height);
+	}
+}
+
+typedef struct CBHPackedPacking
+{
+	CBHPackedStorage *storage;
+	const CGFloat *values;
+} CBHPackedPacking;
+
+static void _CBHPacked_packWorker(void * const context, const NSRange blocks)
+{
+	const CBHPackedPacking * const packing = context;
+	CBHPackedStorage * const storage = packing->storage;
+
+	for (NSUInteger i = blocks.location; i < NSMaxRange(blocks); ++i)
+	{
+		CBHPackedBlock * const block = storage->blocks + i;
+		const NSRange range = _CBHPacked_blockValues(storage, i);
+		const CGFloat * const values = packing->values + range.location;
+
+		_CBHPacked_prepareBlock(storage, block, values, range.length);
+		_CBHPacked_encodeBlock(storage, block, values, range);
+
+		if ( storage->components == 2 ) { _CBHPackedPoints_finishBlock(storage, block, values, range); }
+		else { _CBHPackedRects_finishBlock(storage, block, values, range); }
+	}
+}
+
+static BOOL _CBHPacked_init(CBHPackedStorage * const storage, const CGFloat * const values, const NSUInteger count, const NSUInteger components, const CBHPackedFormat format)
+{
+	storage->format = format;
+	storage->count = count;
+	storage->components = components;
+	storage->blockCount = ( count / kCBHPackedBlockLength ) + ( ( count % kCBHPackedBlockLength ) ? 1 : 0 );
+
+	storage->blocks = malloc(sizeof(CBHPackedBlock) * MAX(storage->blockCount, 1UL));
+	storage->values = malloc(_CBHPacked_valueSize(format) * MAX(count * components, 1UL));
+	if ( storage->blocks == NULL || storage->values == NULL ) { return NO; }
+
+	CBHPackedPacking packing = { .storage = storage, .values = values };
+	CBHParallel_applyWithGrainSize(storage->blockCount, CBHParallel_grainSizeForUnit(kCBHPackedBlockLength), &packing, _CBHPacked_packWorker);
+
+	for (NSUInteger c = 0; c < 4; ++c) { storage->error[c] = 0.0; }
+	storage->minimum = NSPoint_init(INFINITY, INFINITY);
+	storage->maximum = NSPoint_init(-INFINITY, -INFINITY);
+
+	for (NSUInteger i = 0; i < storage->blockCount; ++i)
+	{
+		const CBHPackedBlock * const block = storage->blocks + i;
+
+		for (NSUInteger c = 0; c < components; ++c) { storage->error[c] = MAX(storage->error[c], block->error[c]); }
+
+		storage->minimum.x = MIN(storage->minimum.x, block->minimum.x);
+		storage->minimum.y = MIN(storage->minimum.y, block->minimum.y);
+		storage->maximum.x = MAX(storage->maximum.x, block->maximum.x);
+		storage->maximum.y = MAX(storage->maximum.y, block->maximum.y);
+	}
+
+	return YES;
+}
+
+static void _CBHPacked_deinit(CBHPackedStorage * const storage)
+{
+	free(storage->blocks);
+	free(storage->values);
+}
+
+NS_INLINE NSUInteger _CBHPacked_byteCount(const CBHPackedStorage * const storage)
+{
+	return sizeof(CBHPackedBlock) * storage->blockCount + _CBHPacked_valueSize(storage->format) * storage->count * storage->components;
+}
+
+
+#pragma mark - Decoding in Parallel
+
+typedef struct CBHPackedDecoding
+{
+	const CBHPackedStorage *storage;
+	NSUInteger location;
+	CGFloat *values;
+} CBHPackedDecoding;
+
+static void _CBHPacked_decodeWorker(void * const context, const NSRange range)
+{
+	const CBHPackedDecoding * const decoding = context;
+	const NSUInteger components = decoding->storage->components;
+
+	const NSRange values = NSMakeRange((decoding->location + range.location) * components, range.length * components);
+	_CBHPacked_decode(decoding->storage, values, decoding->values + range.location * components);
+}
+
+static void _CBHPacked_decodeElements(const CBHPackedStorage * const storage, const NSRange range, CGFloat * const values)
+{
+	CBHPackedDecoding decoding = { .storage = storage, .location = range.location, .values = values };
+	CBHParallel_apply(range.length, &decoding, _CBHPacked_decodeWorker);
+}
+
+
+#pragma mark - Creating Packed Points
+
+CBHPackedPoints *CBHPackedPoints_create(const NSPoint * const points, const NSUInteger count, const CBHPackedFormat format)
+{
+	if ( !_CBHPacked_isFormatValid(format) ) { return NULL; }
+
+	CBHPackedPoints * const packed = calloc(1, sizeof(CBHPackedPoints));
+	if ( packed == NULL ) { return NULL; }
+
+	if ( !_CBHPacked_init(&packed->storage, (const CGFloat *)points, count, 2, format) )
+	{
+		CBHPackedPoints_destroy(packed);
+		return NULL;
+	}
+
+	return packed;
+}
+
+void CBHPackedPoints_destroy(CBHPackedPoints * const packed)
+{
+	if ( packed == NULL ) { return; }
+
+	_CBHPacked_deinit(&packed->storage);
+	free(packed);
+}
+
+
+#pragma mark - Packed Point Properties
+
+NSUInteger CBHPackedPoints_count(const CBHPackedPoints * const packed)
+{
+	return packed->storage.count;
+}
+
+CBHPackedFormat CBHPackedPoints_format(const CBHPackedPoints * const packed)
+{
+	return packed->storage.format;
+}
+
+NSUInteger CBHPackedPoints_byteCount(const CBHPackedPoints * const packed)
+{
+	return sizeof(CBHPackedPoints) + _CBHPacked_byteCount(&packed->storage);
+}
+
+NSPoint CBHPackedPoints_maximumError(const CBHPackedPoints * const packed)
+{
+	return NSPoint_init(packed->storage.error[0], packed->storage.error[1]);
+}
+
+NSRect CBHPackedPoints_bounds(const CBHPackedPoints * const packed)
+{
+	const CBHPackedStorage * const storage = &packed->storage;
+
+	if ( storage->count == 0 ) { return NSRect_initEmpty(); }
+	return NSRect_init(storage->minimum.x, storage->minimum.y, storage->maximum.x - storage->minimum.x, storage->maximum.y - storage->minimum.y);
+}
+
+
+#pragma mark - Decoding Packed Points
+
+NSPoint CBHPackedPoints_pointAtIndex(const CBHPackedPoints * const packed, const NSUInteger index)
+{
+	NSPoint point;
+	_CBHPacked_decode(&packed->storage, NSMakeRange(index * 2, 2), (CGFloat *)&point);
+
+	return point;
+}
+
+void CBHPackedPoints_unpack(const CBHPackedPoints * const packed, const NSRange range, NSPoint * const points)
+{
+	_CBHPacked_decodeElements(&packed->storage, range, (CGFloat *)points);
+}
+
+
+#pragma mark - Querying Packed Points
+
+typedef struct CBHPackedMeasuring
+{
+	const CBHPackedStorage *storage;
+	NSPoint point;
+	CGFloat *distances;
+} CBHPackedMeasuring;
+
+static void _CBHPackedPoints_distancesWorker(void * const context, const NSRange range)
+{
+	const CBHPackedMeasuring * const measuring = context;
+	NSPoint decoded[kCBHPackedBlockLength];
+
+	for (NSUInteger i = range.location; i < NSMaxRange(range); i += kCBHPackedBlockLength)
+	{
+		const NSUInteger length = MIN((NSUInteger)kCBHPackedBlockLength, NSMaxRange(range) - i);
+
+		_CBHPacked_decode(measuring->storage, NSMakeRange(i * 2, length * 2), (CGFloat *)decoded);
+		NSPoint_distancesSquaredToPoints(measuring->point, decoded, measuring->distances + i, length);
+	}
+}
+
+void CBHPackedPoints_distancesSquaredToPoint(const CBHPackedPoints * const packed, const NSPoint point, CGFloat * const distances)
+{
+	CBHPackedMeasuring measuring = { .storage = &packed->storage, .point = point, .distances = distances };
+	CBHParallel_apply(packed->storage.count, &measuring, _CBHPackedPoints_distancesWorker);
+}
+
+NSUInteger CBHPackedPoints_inRectIndexes(const CBHPackedPoints * const packed, const NSRect rect, NSUInteger * const indexes, const NSUInteger capacity)
+{
+	const CBHPackedStorage * const storage = &packed->storage;
+	CBHIndexSink sink = CBHIndexSink_initWithBuffer(indexes, capacity);
+
+	const CGFloat maxX = rect.origin.x + rect.size.width;
+	const CGFloat maxY = rect.origin.y + rect.size.height;
+
+	NSPoint decoded[kCBHPackedBlockLength];
+
+	for (NSUInteger i = 0; i < storage->blockCount; ++i)
+	{
+		const CBHPackedBlock * const block = storage->blocks + i;
+
+		const BOOL isOverlapping = ( rect.origin.x <= block->maximum.x && block->minimum.x < maxX && rect.origin.y <= block->maximum.y && block->minimum.y < maxY );
+		if ( !isOverlapping ) { continue; }
+
+		const NSRange range = _CBHPacked_blockValues(storage, i);
+		const NSUInteger first = range.location / 2;
+		const NSUInteger length = range.length / 2;
+
+		const BOOL isInside = ( rect.origin.x <= block->minimum.x && block->maximum.x < maxX && rect.origin.y <= block->minimum.y && block->maximum.y < maxY );
+		if ( isInside )
+		{
+			for (NSUInteger j = 0; j < length; ++j) { CBHIndexSink_emit(&sink, first + j); }
+			continue;
+		}
+
+		_CBHPacked_decodeBlock(storage, block, range, (CGFloat *)decoded);
+
+		for (NSUInteger j = 0; j < length; ++j)
+		{
+			if ( CBHRect_isPointInRect(rect, decoded[j]) ) { CBHIndexSink_emit(&sink, first + j); }
+		}
+	}
+
+	return sink.count;
+}
+
+
+#pragma mark - Creating Packed Rects
+
+CBHPackedRects *CBHPackedRects_create(const NSRect * const rects, const NSUInteger count, const CBHPackedFormat format)
+{
+	if ( !_CBHPacked_isFormatValid(format) ) { return NULL; }
+
+	CBHPackedRects * const packed = calloc(1, sizeof(CBHPackedRects));
+	if ( packed == NULL ) { return NULL; }
+
+	if ( !_CBHPacked_init(&packed->storage, (const CGFloat *)rects, count, 4, format) )
+	{
+		CBHPackedRects_destroy(packed);
+		return NULL;
+	}
+
+	return packed;
+}
+
+void CBHPackedRects_destroy(CBHPackedRects * const packed)
+{
+	if ( packed == NULL ) { return; }
+
+	_CBHPacked_deinit(&packed->storage);
+	free(packed);
+}
+
+
+#pragma mark - Packed Rect Properties
+
+NSUInteger CBHPackedRects_count(const CBHPackedRects * const packed)
+{
+	return packed->storage.count;
+}
+
+CBHPackedFormat CBHPackedRects_format(const CBHPackedRects * const packed)
+{
+	return packed->storage.format;
+}
+
+NSUInteger CBHPackedRects_byteCount(const CBHPackedRects * const packed)
+{
+	return sizeof(CBHPackedRects) + _CBHPacked_byteCount(&packed->storage);
+}
+
+NSRect CBHPackedRects_maximumError(const CBHPackedRects * const packed)
+{
+	const CGFloat * const error = packed->storage.error;
+	return NSRect_init(error[0], error[1], error[2], error[3]);
+}
+
+NSRect CBHPackedRects_bounds(const CBHPackedRects * const packed)
+{
+	const CBHPackedStorage * const storage = &packed->storage;
+
+	if ( !(storage->minimum.x < storage->maximum.x) ) { return NSRect_initEmpty(); }
+	return NSRect_init(storage->minimum.x, storage->minimum.y, storage->maximum.x - storage->minimum.x, storage->maximum.y - storage->minimum.y);
+}
+
+
+#pragma mark - Decoding Packed Rects
+
+NSRect CBHPackedRects_rectAtIndex(const CBHPackedRects * const packed, const NSUInteger index)
+{
+	NSRect rect;
+	_CBHPacked_decode(&packed->storage, NSMakeRange(index * 4, 4), (CGFloat *)&rect);
+
+	return rect;
+}
+
+void CBHPackedRects_unpack(const CBHPackedRects * const packed, const NSRange range, NSRect * const rects)
+{
+	_CBHPacked_decodeElements(&packed->storage, range, (CGFloat *)rects);
+}
+
+
+#pragma mark - Querying Packed Rects
+
+// Rects which intersect a rect or contain a point raise their block's edges past it, so blocks whose edges fall short
+// are skipped without decoding.
+static NSUInteger _CBHPackedRects_search(const CBHPackedStorage * const storage, const NSRect rect, const NSPoint point, const BOOL isPointSearch, CBHIndexSink * const sink)
+{
+	NSRect decoded[kCBHPackedBlockLength];
+
+	for (NSUInteger i = 0; i < storage->blockCount; ++i)
+	{
+		const CBHPackedBlock * const block = storage->blocks + i;
+
+		const BOOL isReachable = ( isPointSearch )
+			? ( block->minimum.x <= point.x && point.x < block->maximum.x && block->minimum.y <= point.y && point.y < block->maximum.y )
+			: ( rect.origin.x < block->maximum.x && block->minimum.x < rect.origin.x + rect.size.width
+			 && rect.origin.y < block->maximum.y && block->minimum.y < rect.origin.y + rect.size.height );
+		if ( !isReachable ) { continue; }
+
+		const NSRange range = _CBHPacked_blockValues(storage, i);
+		const NSUInteger first = range.location / 4;
+		const NSUInteger length = range.length / 4;
+
+		_CBHPacked_decodeBlock(storage, block, range, (CGFloat *)decoded);
+
+		for (NSUInteger j = 0; j < length; ++j)
+		{
+			const BOOL isMatch = ( isPointSearch ) ? CBHRect_isPointInRect(decoded[j], point) : CBHRect_isIntersecting(decoded[j], rect);
+			if ( isMatch ) { CBHIndexSink_emit(sink, first + j); }
+		}
+	}
+
+	return sink->count;
+}
+
+NSUInteger CBHPackedRects_intersectingIndexes(const CBHPackedRects * const packed, const NSRect rect, NSUInteger * const indexes, const NSUInteger capacity)
+{
+	CBHIndexSink sink = CBHIndexSink_initWithBuffer(indexes, capacity);
+	return _CBHPackedRects_search(&packed->storage, rect, NSPoint_init(0.0, 0.0), NO, &sink);
+}
+
+NSUInteger CBHPackedRects_containingPointIndexes(const CBHPackedRects * const packed, const NSPoint point, NSUInteger * const indexes, const NSUInteger capacity)
+{
+	CBHIndexSink sink = CBHIndexSink_initWithBuffer(indexes, capacity);
+	return _CBHPackedRects_search(&packed->storage, NSRect_initEmpty(), point, YES, &sink);
+}
@@ -0,0 +1,97 @@
+//  CBHParallel.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** A function which performs part of a bulk operation.
+ *
+ * Calls for different ranges may run at the same time on different threads, so a function must only write results for
+ * the indexes in its own range.
+ *
+ * @param context       The context given to `CBHParallel_apply()`.
+ * @param range         The indexes to process.
+ */
+typedef void (*CBHParallelFunction)(void * _Nullable context, NSRange range);
+
+
+#pragma mark - Configuration
+
+/**
+ * @name Configuration
+ *
+ * The batched functions of the kit split large arrays into chunks of at least the grain size and share the chunks
+ * between up to the thread count of threads. Each chunk writes only its own results and partial results are combined
+ * in chunk order, so the output never depends on the configuration or on scheduling.
+ *
+ * On Apple platforms the chunks are run with `dispatch_apply_f()`. Elsewhere a pool of POSIX threads is started the
+ * first time it is needed and reused. In both cases each thread works through its own run of chunks before helping
+ * with the runs of the others.
+ *
+ * These settings are global and may be changed from any thread.
+ */
+
+/** Sets the greatest number of threads, including the calling thread, that a bulk operation may use.
+ *
+ * @param threadCount   The number of threads. 0 uses one per active processor, which is the default, and 1 runs every
+ *                      operation on the calling thread.
+ */
+void CBHParallel_setThreadCount(NSUInteger threadCount);
+
+/** The greatest number of threads a bulk operation may use.
+ *
+ * @return              The thread count, with 0 resolved to the number of active processors.
+ */
+NSUInteger CBHParallel_threadCount(void);
+
+/** Sets the least number of elements handed to a thread at a time.
+ *
+ * Operations over fewer than twice this many elements run on the calling thread.
+ *
+ * @param grainSize     The number of elements. 0 restores the default of 32768.
+ */
+void CBHParallel_setGrainSize(NSUInteger grainSize);
+
+/** The least number of elements handed to a thread at a time.
+ *
+ * @return              The grain size.
+ */
+NSUInteger CBHParallel_grainSize(void);
+
+
+#pragma mark - Running Operations
+
+/**
+ * @name Running Operations
+ */
+
+/** Calls a function over every index below a count, sharing the work between threads.
+ *
+ * The indexes are split into consecutive ranges of the grain size, each passed to _function_ exactly once. When the
+ * work is not worth splitting _function_ is called once with the whole range on the calling thread, as it is when
+ * called from within another operation.
+ *
+ * @param count         The number of indexes.
+ * @param context       A value passed to _function_.
+ * @param function      The function to call for each range.
+ */
+void CBHParallel_apply(NSUInteger count, void * _Nullable context, CBHParallelFunction function);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,375 @@
+//  CBHParallel.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHParallel.h"
+
+#import "_CBHGeometryKit+Parallel.h"
+
+#import <stdatomic.h>
+#import <stdlib.h>
+#import <unistd.h>
+
+#if defined(__APPLE__)
+#	define CBH_PARALLEL_DISPATCH 1
+#	import <dispatch/dispatch.h>
+#else
+#	import <pthread.h>
+#endif
+
+
+static const NSUInteger kCBHParallelDefaultGrainSize = 1 << 15;
+static const NSUInteger kCBHParallelMaximumThreadCount = 256;
+
+// Runs are aligned to cache lines so claiming chunks from one does not slow claims from another.
+enum { kCBHParallelCacheLine = 64 };
+
+static _Atomic(NSUInteger) gThreadCount = 0;
+static _Atomic(NSUInteger) gGrainSize = 0;
+static _Atomic(NSUInteger) gProcessorCount = 0;
+
+// Set while a thread is running part of an operation, so operations started from within one run inline.
+static _Thread_local BOOL gIsParticipating = NO;
+
+
+#pragma mark - Jobs
+
+// Each participant owns a run of chunks and claims them from the front through its cursor. Once its own run is
+// finished it claims chunks through the cursors of the other participants in turn. Every claim is a single atomic
+// increment, so each chunk is run exactly once.
+typedef struct CBHParallelRun
+{
+	_Alignas(kCBHParallelCacheLine) _Atomic(NSUInteger) cursor;
+	NSUInteger end;
+} CBHParallelRun;
+
+typedef struct CBHParallelJob
+{
+	CBHParallelFunction function;
+	void * _Nullable context;
+
+	NSUInteger count;
+	NSUInteger chunkLength;
+	NSUInteger participantCount;
+	CBHParallelRun *runs;
+} CBHParallelJob;
+
+static BOOL _CBHParallelJob_init(CBHParallelJob * const job, const NSUInteger count, const NSUInteger grainSize, const NSUInteger threadCount, void * const context, const CBHParallelFunction function)
+{
+	const NSUInteger chunkCount = ( count / grainSize ) + ( ( count % grainSize ) ? 1 : 0 );
+	const NSUInteger participantCount = MIN(threadCount, chunkCount);
+
+	void *runs = NULL;
+	if ( posix_memalign(&runs, kCBHParallelCacheLine, sizeof(CBHParallelRun) * participantCount) != 0 ) { return NO; }
+
+	*job = (CBHParallelJob){
+		.function = function,
+		.context = context,
+		.count = count,
+		.chunkLength = grainSize,
+		.participantCount = participantCount,
+		.runs = runs,
+	};
+
+	for (NSUInteger i = 0; i < participantCount; ++i)
+	{
+		atomic_init(&job->runs[i].cursor, (chunkCount * i) / participantCount);
+		job->runs[i].end = (chunkCount * (i + 1)) / participantCount;
+	}
+
+	return YES;
+}
+
+static void _CBHParallelJob_participate(CBHParallelJob * const job, const NSUInteger participant)
+{
+	const BOOL wasParticipating = gIsParticipating;
+	gIsParticipating = YES;
+
+	for (NSUInteger i = 0; i < job->participantCount; ++i)
+	{
+		CBHParallelRun * const run = job->runs + ((participant + i) % job->participantCount);
+
+		for (;;)
+		{
+			const NSUInteger chunk = atomic_fetch_add_explicit(&run->cursor, 1, memory_order_relaxed);
+			if ( chunk >= run->end ) { break; }
+
+			const NSUInteger location = chunk * job->chunkLength;
+			job->function(job->context, NSMakeRange(location, MIN(job->chunkLength, job->count - location)));
+		}
+	}
+
+	gIsParticipating = wasParticipating;
+}
+
+
+#pragma mark - Threads
+
+#if CBH_PARALLEL_DISPATCH
+
+static void _CBHParallel_dispatchParticipant(void * const context, const size_t participant)
+{
+	_CBHParallelJob_participate(context, participant);
+}
+
+static void _CBHParallel_run(CBHParallelJob * const job)
+{
+	dispatch_apply_f(job->participantCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), job, _CBHParallel_dispatchParticipant);
+}
+
+#else
+
+// The calling thread is participant 0 and the workers are the rest. Every worker wakes for each job and those beyond
+// the job's participant count have nothing to do.
+typedef struct CBHParallelPool
+{
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	pthread_cond_t finished;
+
+	pthread_t *threads;
+	NSUInteger threadCount;
+
+	CBHParallelJob * _Nullable job;
+	NSUInteger generation;
+	NSUInteger pending;
+	BOOL isStopping;
+} CBHParallelPool;
+
+typedef struct CBHParallelWorker
+{
+	CBHParallelPool *pool;
+	NSUInteger participant;
+} CBHParallelWorker;
+
+// Serializes operations and changes to the pool.
+static pthread_mutex_t gPoolLock = PTHREAD_MUTEX_INITIALIZER;
+static CBHParallelPool *gPool = NULL;
+
+// The thread count the pool was created for, which may be more than it started if threads could not be created.
+static NSUInteger gPoolThreadCount = 0;
+
+static void *_CBHParallelPool_work(void * const argument)
+{
+	CBHParallelWorker worker = *(CBHParallelWorker *)argument;
+	CBHParallelPool * const pool = worker.pool;
+	free(argument);
+
+	// Pools start at generation 0, so a job posted before this thread first takes the lock is still seen.
+	NSUInteger generation = 0;
+	pthread_mutex_lock(&pool->lock);
+
+	for (;;)
+	{
+		while ( pool->generation == generation && !pool->isStopping ) { pthread_cond_wait(&pool->wake, &pool->lock); }
+		if ( pool->isStopping ) { break; }
+
+		generation = pool->generation;
+		CBHParallelJob * const job = pool->job;
+		pthread_mutex_unlock(&pool->lock);
+
+		if ( worker.participant < job->participantCount ) { _CBHParallelJob_participate(job, worker.participant); }
+
+		pthread_mutex_lock(&pool->lock);
+		if ( --pool->pending == 0 ) { pthread_cond_signal(&pool->finished); }
+	}
+
+	pthread_mutex_unlock(&pool->lock);
+	return NULL;
+}
+
+static void _CBHParallelPool_destroy(CBHParallelPool * const pool)
+{
+	if ( pool == NULL ) { return; }
+
+	pthread_mutex_lock(&pool->lock);
+	pool->isStopping = YES;
+	pthread_cond_broadcast(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+
+	for (NSUInteger i = 0; i < pool->threadCount; ++i)
+	{
+		pthread_join(pool->threads[i], NULL);
+	}
+
+	pthread_cond_destroy(&pool->finished);
+	pthread_cond_destroy(&pool->wake);
+	pthread_mutex_destroy(&pool->lock);
+
+	free(pool->threads);
+	free(pool);
+}
+
+// Creates a pool of up to `workerCount` workers, or returns `NULL` if none could be started.
+static CBHParallelPool *_CBHParallelPool_create(const NSUInteger workerCount)
+{
+	CBHParallelPool * const pool = calloc(1, sizeof(CBHParallelPool));
+	pthread_t * const threads = calloc(workerCount, sizeof(pthread_t));
+
+	if ( pool == NULL || threads == NULL )
+	{
+		free(threads);
+		free(pool);
+		return NULL;
+	}
+
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->wake, NULL);
+	pthread_cond_init(&pool->finished, NULL);
+	pool->threads = threads;
+
+	for (NSUInteger i = 0; i < workerCount; ++i)
+	{
+		CBHParallelWorker * const worker = malloc(sizeof(CBHParallelWorker));
+		if ( worker == NULL ) { break; }
+
+		*worker = (CBHParallelWorker){ .pool = pool, .participant = i + 1 };
+
+		if ( pthread_create(threads + i, NULL, _CBHParallelPool_work, worker) != 0 )
+		{
+			free(worker);
+			break;
+		}
+
+		++pool->threadCount;
+	}
+
+	if ( pool->threadCount == 0 )
+	{
+		_CBHParallelPool_destroy(pool);
+		return NULL;
+	}
+
+	return pool;
+}
+
+// Must be called with `gPoolLock` held. Returns the number of threads available, including the caller. A pool which
+// started fewer threads than asked for is kept until the thread count changes rather than rebuilt on every call.
+static NSUInteger _CBHParallelPool_prepare(const NSUInteger threadCount)
+{
+	if ( gPoolThreadCount != threadCount )
+	{
+		_CBHParallelPool_destroy(gPool);
+		gPool = _CBHParallelPool_create(threadCount - 1);
+		gPoolThreadCount = threadCount;
+	}
+
+	return ( gPool != NULL ) ? gPool->threadCount + 1 : 1;
+}
+
+static void _CBHParallel_run(CBHParallelJob * const job)
+{
+	CBHParallelPool * const pool = gPool;
+
+	pthread_mutex_lock(&pool->lock);
+	pool->job = job;
+	pool->pending = pool->threadCount;
+	++pool->generation;
+	pthread_cond_broadcast(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+
+	_CBHParallelJob_participate(job, 0);
+
+	pthread_mutex_lock(&pool->lock);
+	while ( pool->pending > 0 ) { pthread_cond_wait(&pool->finished, &pool->lock); }
+	pool->job = NULL;
+	pthread_mutex_unlock(&pool->lock);
+}
+
+#endif
+
+
+#pragma mark - Configuration
+
+void CBHParallel_setThreadCount(const NSUInteger threadCount)
+{
+	atomic_store_explicit(&gThreadCount, MIN(threadCount, kCBHParallelMaximumThreadCount), memory_order_relaxed);
+}
+
+NSUInteger CBHParallel_threadCount(void)
+{
+	const NSUInteger threadCount = atomic_load_explicit(&gThreadCount, memory_order_relaxed);
+	if ( threadCount != 0 ) { return threadCount; }
+
+	NSUInteger processorCount = atomic_load_explicit(&gProcessorCount, memory_order_relaxed);
+
+	if ( processorCount == 0 )
+	{
+		const long online = sysconf(_SC_NPROCESSORS_ONLN);
+		processorCount = ( online > 0 ) ? MIN((NSUInteger)online, kCBHParallelMaximumThreadCount) : 1;
+		atomic_store_explicit(&gProcessorCount, processorCount, memory_order_relaxed);
+	}
+
+	return processorCount;
+}
+
+void CBHParallel_setGrainSize(const NSUInteger grainSize)
+{
+	atomic_store_explicit(&gGrainSize, grainSize, memory_order_relaxed);
+}
+
+NSUInteger CBHParallel_grainSize(void)
+{
+	const NSUInteger grainSize = atomic_load_explicit(&gGrainSize, memory_order_relaxed);
+	return ( grainSize != 0 ) ? grainSize : kCBHParallelDefaultGrainSize;
+}
+
+
+#pragma mark - Running Operations
+
+BOOL CBHParallel_isSplit(const NSUInteger count, const NSUInteger grainSize)
+{
+	return ( count / 2 >= grainSize ) && !gIsParticipating && ( CBHParallel_threadCount() > 1 );
+}
+
+void CBHParallel_applyWithGrainSize(const NSUInteger count, const NSUInteger grainSize, void * const context, const CBHParallelFunction function)
+{
+	if ( count == 0 ) { return; }
+
+	if ( !CBHParallel_isSplit(count, MAX(grainSize, 1UL)) )
+	{
+		function(context, NSMakeRange(0, count));
+		return;
+	}
+
+	NSUInteger threadCount = CBHParallel_threadCount();
+
+#if !CBH_PARALLEL_DISPATCH
+	pthread_mutex_lock(&gPoolLock);
+	threadCount = _CBHParallelPool_prepare(threadCount);
+#endif
+
+	CBHParallelJob job;
+	const BOOL isSplit = ( threadCount > 1 ) && _CBHParallelJob_init(&job, count, MAX(grainSize, 1UL), threadCount, context, function);
+
+	if ( isSplit )
+	{
+		_CBHParallel_run(&job);
+		free(job.runs);
+	}
+
+#if !CBH_PARALLEL_DISPATCH
+	pthread_mutex_unlock(&gPoolLock);
+#endif
+
+	if ( !isSplit ) { function(context, NSMakeRange(0, count)); }
+}
+
+void CBHParallel_apply(const NSUInteger count, void * const context, const CBHParallelFunction function)
+{
+	CBHParallel_applyWithGrainSize(count, CBHParallel_grainSize(), context, function);
+}
@@ -0,0 +1,41 @@
+//  CBHParseStatus.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** The outcome of parsing a geometry value from bytes.
+ *
+ * Parsing is lenient in the same way as `NSPointFromString()` and its relatives: anything which is not part of a number
+ * is skipped, and missing components are set to 0. The status reports what that leniency hid.
+ */
+typedef NS_ENUM(NSInteger, CBHParseStatus)
+{
+	/** Every component was found. */
+	CBHParseStatusSuccess = 0,
+
+	/** Fewer numbers were found than the value has components. The missing components are 0. */
+	CBHParseStatusMissingComponents,
+
+	/** A number could not be represented. Reals overflow to infinity and integers saturate at `NSIntegerMax`. */
+	CBHParseStatusOutOfRange,
+};
+
+NS_ASSUME_NONNULL_END
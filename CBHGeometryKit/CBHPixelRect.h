@@ -0,0 +1,373 @@
+//  CBHPixelRect.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+#import <CBHGeometryKit/CBHInlining.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Points, sizes, and rects in whole device pixels.
+ *
+ * They follow the rules of their `NSPoint`, `NSSize`, and `NSRect` counterparts: a rect with a 0 or negative width or
+ * height is empty, empty rects never intersect or are covered by anything, and rects are half open, containing their
+ * minimum edges but not their maximum ones.
+ *
+ * The functions are written with selects rather than branches so loops over them can be vectorized. Like C integer
+ * arithmetic, they must not overflow: every edge and every size a result would have must fit in an `int32_t`. The
+ * conversions from `NSRect` saturate instead.
+ */
+
+/** A point in whole pixels. */
+typedef struct CBHPixelPoint
+{
+	int32_t x;
+	int32_t y;
+} CBHPixelPoint;
+
+/** A size in whole pixels. */
+typedef struct CBHPixelSize
+{
+	int32_t width;
+	int32_t height;
+} CBHPixelSize;
+
+/** A rect in whole pixels. */
+typedef struct CBHPixelRect
+{
+	CBHPixelPoint origin;
+	CBHPixelSize size;
+} CBHPixelRect;
+
+
+#pragma mark - Creating Pixel Geometry
+
+/**
+ * @name Creating Pixel Geometry
+ */
+
+/** Creates a new `CBHPixelPoint` from the specified components.
+ *
+ * @param x             The x component.
+ * @param y             The y component.
+ *
+ * @return              A `CBHPixelPoint` with its components provided by _x_ and _y_.
+ */
+CBH_INLINABLE CBHPixelPoint CBHPixelPoint_init(int32_t x, int32_t y);
+
+/** Creates a new `CBHPixelSize` from the specified components.
+ *
+ * @param width         The width component.
+ * @param height        The height component.
+ *
+ * @return              A `CBHPixelSize` with its components provided by _width_ and _height_.
+ */
+CBH_INLINABLE CBHPixelSize CBHPixelSize_init(int32_t width, int32_t height);
+
+/** Creates a new `CBHPixelRect` from the specified components.
+ *
+ * @param x             The x component of the origin.
+ * @param y             The y component of the origin.
+ * @param width         The width component of the size.
+ * @param height        The height component of the size.
+ *
+ * @return              A `CBHPixelRect` with its components provided by _x_, _y_, _width_, and _height_.
+ */
+CBH_INLINABLE CBHPixelRect CBHPixelRect_init(int32_t x, int32_t y, int32_t width, int32_t height);
+
+/** Creates a new `CBHPixelRect` from an origin and a size.
+ *
+ * @param origin        The origin of the rect.
+ * @param size          The size of the rect.
+ *
+ * @return              A `CBHPixelRect` with the provided _origin_ and _size_.
+ */
+CBH_INLINABLE CBHPixelRect CBHPixelRect_initWithStructs(CBHPixelPoint origin, CBHPixelSize size);
+
+/** Creates a new `CBHPixelRect` with the x, y, width, and height components set to 0.
+ *
+ * @return              A `CBHPixelRect` with its components set to 0.
+ */
+CBH_INLINABLE CBHPixelRect CBHPixelRect_initEmpty(void);
+
+
+#pragma mark - Converting Pixel Geometry
+
+/**
+ * @name Converting Pixel Geometry
+ */
+
+/** Creates a new `CBHPixelRect` covering the pixels a `NSRect` touches.
+ *
+ * @param rect          The rect to convert.
+ *
+ * @return              The rect `NSRect_integral()` derives from _rect_, in whole pixels. Empty rects become
+ *                      `CBHPixelRect_initEmpty()`.
+ *
+ * @warning             Components beyond the range of `int32_t` saturate, as do NaN components, which become the
+ *                      least value.
+ */
+CBH_INLINABLE CBHPixelRect CBHPixelRect_initWithRect(NSRect rect);
+
+/** Derives the `NSRect` with the same components as a `CBHPixelRect`.
+ *
+ * @param rect          The rect to convert.
+ *
+ * @return              A `NSRect` with the components of _rect_, which are represented exactly.
+ */
+CBH_INLINABLE NSRect CBHPixelRect_rect(CBHPixelRect rect);
+
+/** Derives the `NSPoint` with the same components as a `CBHPixelPoint`.
+ *
+ * @param point         The point to convert.
+ *
+ * @return              A `NSPoint` with the components of _point_, which are represented exactly.
+ */
+CBH_INLINABLE NSPoint CBHPixelPoint_point(CBHPixelPoint point);
+
+/** Derives the `NSSize` with the same components as a `CBHPixelSize`.
+ *
+ * @param size          The size to convert.
+ *
+ * @return              A `NSSize` with the components of _size_, which are represented exactly.
+ */
+CBH_INLINABLE NSSize CBHPixelSize_size(CBHPixelSize size);
+
+
+#pragma mark - Checking Pixel Geometry
+
+/**
+ * @name Checking Pixel Geometry
+ */
+
+/** Indicates whether the two points are equal.
+ *
+ * @param point         A point to compare.
+ * @param other         A point to compare against.
+ *
+ * @return              `YES` if the components of _point_ and _other_ are equal, otherwise `NO`.
+ */
+CBH_INLINABLE BOOL CBHPixelPoint_isEqual(CBHPixelPoint point, CBHPixelPoint other);
+
+/** Indicates whether the two sizes are equal.
+ *
+ * @param size          A size to compare.
+ * @param other         A size to compare against.
+ *
+ * @return              `YES` if the components of _size_ and _other_ are equal, otherwise `NO`.
+ */
+CBH_INLINABLE BOOL CBHPixelSize_isEqual(CBHPixelSize size, CBHPixelSize other);
+
+/** Indicates whether the rect is empty.
+ *
+ * @param rect          A rect to check.
+ *
+ * @return              `YES` if the width or height of _rect_ is 0 or negative, otherwise `NO`.
+ */
+CBH_INLINABLE BOOL CBHPixelRect_isEmpty(CBHPixelRect rect);
+
+/** Indicates whether the two rects are equal.
+ *
+ * @param rect          A rect to compare.
+ * @param other         A rect to compare against.
+ *
+ * @return              `YES` if the components of _rect_ and _other_ are equal, otherwise `NO`.
+ */
+CBH_INLINABLE BOOL CBHPixelRect_isEqual(CBHPixelRect rect, CBHPixelRect other);
+
+/** Indicates whether one rect completely encloses another.
+ *
+ * @param rect          The rect which may cover _other_.
+ * @param other         The rect which may be covered.
+ *
+ * @return              `YES` if _other_ is not empty and does not extend beyond _rect_, otherwise `NO`.
+ */
+CBH_INLINABLE BOOL CBHPixelRect_isCovering(CBHPixelRect rect, CBHPixelRect other);
+
+/** Indicates whether two rects share any pixels.
+ *
+ * @param rect          A rect to check.
+ * @param other         A rect to check against.
+ *
+ * @return              `YES` if neither rect is empty and they overlap, otherwise `NO`.
+ */
+CBH_INLINABLE BOOL CBHPixelRect_isIntersecting(CBHPixelRect rect, CBHPixelRect other);
+
+/** Indicates whether a pixel lies within a rect.
+ *
+ * @param rect          The rect to check.
+ * @param point         The point to check.
+ *
+ * @return              `YES` if _point_ lies on or past the minimum edges of _rect_ and before its maximum edges,
+ *                      otherwise `NO`.
+ */
+CBH_INLINABLE BOOL CBHPixelRect_isPointInRect(CBHPixelRect rect, CBHPixelPoint point);
+
+
+#pragma mark - Derived Pixel Rects
+
+/**
+ * @name Derived Pixel Rects
+ */
+
+/** Derives a new `CBHPixelRect` by moving each edge of a rect inward.
+ *
+ * @param rect          The rect to inset.
+ * @param dX            The number of pixels to move the left and right edges inward. Negative values move them outward.
+ * @param dY            The number of pixels to move the bottom and top edges inward. Negative values move them outward.
+ *
+ * @return              A `CBHPixelRect` derived from _rect_, as `NSRect_inset()` derives one.
+ */
+CBH_INLINABLE CBHPixelRect CBHPixelRect_inset(CBHPixelRect rect, int32_t dX, int32_t dY);
+
+/** Derives a new `CBHPixelRect` by moving a rect.
+ *
+ * @param rect          The rect to move.
+ * @param dX            The number of pixels to move _rect_ along the x axis.
+ * @param dY            The number of pixels to move _rect_ along the y axis.
+ *
+ * @return              A `CBHPixelRect` with the size of _rect_ and its origin moved by _dX_ and _dY_.
+ */
+CBH_INLINABLE CBHPixelRect CBHPixelRect_offset(CBHPixelRect rect, int32_t dX, int32_t dY);
+
+/** Derives the pixels two rects share.
+ *
+ * @param rect          A rect to intersect.
+ * @param other         A rect to intersect with.
+ *
+ * @return              The overlap of _rect_ and _other_, or `CBHPixelRect_initEmpty()` if
+ *                      `CBHPixelRect_isIntersecting()` is `NO`.
+ */
+CBH_INLINABLE CBHPixelRect CBHPixelRect_intersection(CBHPixelRect rect, CBHPixelRect other);
+
+/** Derives the smallest rect covering two rects.
+ *
+ * @param rect          A rect to combine.
+ * @param other         A rect to combine with.
+ *
+ * @return              The smallest rect covering both, or the other rect if one is empty, or
+ *                      `CBHPixelRect_initEmpty()` if both are empty.
+ */
+CBH_INLINABLE CBHPixelRect CBHPixelRect_union(CBHPixelRect rect, CBHPixelRect other);
+
+/** Derives a new `CBHPixelRect` by centering a rect in another.
+ *
+ * @param rect          The rect to center.
+ * @param inRect        The rect to center _rect_ in.
+ *
+ * @return              A `CBHPixelRect` with the size of _rect_ centered in _inRect_. When the sizes differ by an odd
+ *                      number of pixels it sits half a pixel toward the minimum edges.
+ */
+CBH_INLINABLE CBHPixelRect CBHPixelRect_centeredInRect(CBHPixelRect rect, CBHPixelRect inRect);
+
+
+#pragma mark - Derived Pixel Points
+
+/**
+ * @name Derived Pixel Points
+ */
+
+/** Derives the minimum corner of a rect.
+ *
+ * @param rect          The rect.
+ *
+ * @return              A `CBHPixelPoint` at `CBHPixelRect_minX()` and `CBHPixelRect_minY()`.
+ */
+CBH_INLINABLE CBHPixelPoint CBHPixelRect_minPoint(CBHPixelRect rect);
+
+/** Derives the maximum corner of a rect.
+ *
+ * @param rect          The rect.
+ *
+ * @return              A `CBHPixelPoint` at `CBHPixelRect_maxX()` and `CBHPixelRect_maxY()`.
+ */
+CBH_INLINABLE CBHPixelPoint CBHPixelRect_maxPoint(CBHPixelRect rect);
+
+
+#pragma mark - Calculated Properties
+
+/**
+ * @name Calculated Properties
+ *
+ * These functions treat negative sizes as `NSRect_minX()` and its relatives do.
+ */
+
+/** The least x of a rect.
+ *
+ * @param rect          The rect.
+ *
+ * @return              The x of the origin, or of the origin plus the width when the width is negative.
+ */
+CBH_INLINABLE int32_t CBHPixelRect_minX(CBHPixelRect rect);
+
+/** The least y of a rect.
+ *
+ * @param rect          The rect.
+ *
+ * @return              The y of the origin, or of the origin plus the height when the height is negative.
+ */
+CBH_INLINABLE int32_t CBHPixelRect_minY(CBHPixelRect rect);
+
+/** The greatest x of a rect.
+ *
+ * @param rect          The rect.
+ *
+ * @return              The x of the origin plus the width, or of the origin when the width is 0 or negative.
+ */
+CBH_INLINABLE int32_t CBHPixelRect_maxX(CBHPixelRect rect);
+
+/** The greatest y of a rect.
+ *
+ * @param rect          The rect.
+ *
+ * @return              The y of the origin plus the height, or of the origin when the height is 0 or negative.
+ */
+CBH_INLINABLE int32_t CBHPixelRect_maxY(CBHPixelRect rect);
+
+
+#pragma mark - Batched Conversions
+
+/**
+ * @name Batched Conversions
+ *
+ * These functions apply the single conversions to every element of an array, in loops the compiler vectorizes.
+ */
+
+/** Converts each rect in an array with `CBHPixelRect_initWithRect()`.
+ *
+ * @param rects         The rects to convert.
+ * @param results       A buffer of _count_ pixel rects to receive the results.
+ * @param count         The number of rects in _rects_.
+ */
+void CBHPixelRect_initWithRects(const NSRect *rects, CBHPixelRect *results, NSUInteger count);
+
+/** Converts each pixel rect in an array with `CBHPixelRect_rect()`.
+ *
+ * @param rects         The pixel rects to convert.
+ * @param results       A buffer of _count_ rects to receive the results.
+ * @param count         The number of rects in _rects_.
+ */
+void CBHPixelRect_getRects(const CBHPixelRect *rects, NSRect *results, NSUInteger count);
+
+NS_ASSUME_NONNULL_END
+
+#if CBH_GEOMETRY_INLINE
+#import <CBHGeometryKit/CBHPixelRectInline.h>
+#endif
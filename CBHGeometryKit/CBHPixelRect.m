@@ -0,0 +1,44 @@
+//  CBHPixelRect.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+// The framework always exports the out of line definitions, whichever mode its clients use.
+#undef CBH_GEOMETRY_INLINE
+#define CBH_GEOMETRY_INLINE 0
+#define _CBH_GEOMETRY_EXPORTING 1
+
+#import "CBHPixelRect.h"
+#import "CBHPixelRectInline.h"
+
+
+#pragma mark - Batched Conversions
+
+void CBHPixelRect_initWithRects(const NSRect * const rects, CBHPixelRect * const results, const NSUInteger count)
+{
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		results[i] = CBHPixelRect_initWithRect(rects[i]);
+	}
+}
+
+void CBHPixelRect_getRects(const CBHPixelRect * const rects, NSRect * const results, const NSUInteger count)
+{
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		results[i] = CBHPixelRect_rect(rects[i]);
+	}
+}
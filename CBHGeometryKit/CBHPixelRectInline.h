@@ -0,0 +1,255 @@
+//  CBHPixelRectInline.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+#import <CBHGeometryKit/CBHInlining.h>
+#import <CBHGeometryKit/CBHPixelRect.h>
+
+#import <math.h>
+
+
+// The definitions of the functions declared in `CBHPixelRect.h`. The framework compiles them as exported symbols, and
+// when `CBH_GEOMETRY_INLINE` is set clients compile them as `static inline` definitions.
+//
+// Conditions are combined with `&` and `|` rather than `&&` and `||`, and results are chosen with selects, so no
+// function branches on its arguments.
+#if CBH_GEOMETRY_INLINE || defined(_CBH_GEOMETRY_EXPORTING)
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Selects with a mask, which compilers keep as bitwise operations where a conditional expression might become a jump.
+static inline CBHPixelRect _CBHPixelRect_select(const int condition, const CBHPixelRect rect, const CBHPixelRect other)
+{
+	const int32_t mask = -(int32_t)( condition != 0 );
+	CBHPixelRect newRect;
+
+	newRect.origin.x = (rect.origin.x & mask) | (other.origin.x & ~mask);
+	newRect.origin.y = (rect.origin.y & mask) | (other.origin.y & ~mask);
+	newRect.size.width = (rect.size.width & mask) | (other.size.width & ~mask);
+	newRect.size.height = (rect.size.height & mask) | (other.size.height & ~mask);
+
+	return newRect;
+}
+
+// NaN fails the first comparison and saturates to the least value. The comparisons are explicit as `MIN()` and `MAX()`
+// treat NaN differently depending on which definitions are in scope.
+static inline int32_t _CBHPixelRect_saturate(const CGFloat value)
+{
+	if ( !(value > (CGFloat)INT32_MIN) ) { return INT32_MIN; }
+	if ( value >= (CGFloat)INT32_MAX ) { return INT32_MAX; }
+
+	return (int32_t)value;
+}
+
+
+#pragma mark - Creating Pixel Geometry
+
+CBH_INLINABLE CBH_CONST CBHPixelPoint CBHPixelPoint_init(const int32_t x, const int32_t y)
+{
+	return (CBHPixelPoint){ .x = x, .y = y };
+}
+
+CBH_INLINABLE CBH_CONST CBHPixelSize CBHPixelSize_init(const int32_t width, const int32_t height)
+{
+	return (CBHPixelSize){ .width = width, .height = height };
+}
+
+CBH_INLINABLE CBH_CONST CBHPixelRect CBHPixelRect_init(const int32_t x, const int32_t y, const int32_t width, const int32_t height)
+{
+	return (CBHPixelRect){ (CBHPixelPoint){ .x = x, .y = y }, (CBHPixelSize){ .width = width, .height = height } };
+}
+
+CBH_INLINABLE CBH_CONST CBHPixelRect CBHPixelRect_initWithStructs(const CBHPixelPoint origin, const CBHPixelSize size)
+{
+	return (CBHPixelRect){origin, size};
+}
+
+CBH_INLINABLE CBH_CONST CBHPixelRect CBHPixelRect_initEmpty(void)
+{
+	return (CBHPixelRect){ { .x = 0, .y = 0 }, { .width = 0, .height = 0 } };
+}
+
+
+#pragma mark - Converting Pixel Geometry
+
+// The edges are rounded outward as `NSIntegralRect()` rounds them. Whole numbers of this size are exact in a double,
+// so the size is the exact difference of the rounded edges.
+CBH_INLINABLE CBH_CONST CBHPixelRect CBHPixelRect_initWithRect(const NSRect rect)
+{
+	const int isEmpty = ( (rect.size.width <= 0.0) | (rect.size.height <= 0.0) );
+
+	const CGFloat minX = floor(rect.origin.x);
+	const CGFloat minY = floor(rect.origin.y);
+	const CGFloat maxX = ceil(rect.origin.x + rect.size.width);
+	const CGFloat maxY = ceil(rect.origin.y + rect.size.height);
+
+	const CBHPixelRect newRect = CBHPixelRect_init(_CBHPixelRect_saturate(minX), _CBHPixelRect_saturate(minY), _CBHPixelRect_saturate(maxX - minX), _CBHPixelRect_saturate(maxY - minY));
+	return _CBHPixelRect_select(isEmpty, CBHPixelRect_initEmpty(), newRect);
+}
+
+CBH_INLINABLE CBH_CONST NSRect CBHPixelRect_rect(const CBHPixelRect rect)
+{
+	return (NSRect){ { .x = (CGFloat)rect.origin.x, .y = (CGFloat)rect.origin.y }, { .width = (CGFloat)rect.size.width, .height = (CGFloat)rect.size.height } };
+}
+
+CBH_INLINABLE CBH_CONST NSPoint CBHPixelPoint_point(const CBHPixelPoint point)
+{
+	return (NSPoint){ .x = (CGFloat)point.x, .y = (CGFloat)point.y };
+}
+
+CBH_INLINABLE CBH_CONST NSSize CBHPixelSize_size(const CBHPixelSize size)
+{
+	return (NSSize){ .width = (CGFloat)size.width, .height = (CGFloat)size.height };
+}
+
+
+#pragma mark - Checking Pixel Geometry
+
+CBH_INLINABLE CBH_CONST BOOL CBHPixelPoint_isEqual(const CBHPixelPoint point, const CBHPixelPoint other)
+{
+	return (BOOL)( (point.x == other.x) & (point.y == other.y) );
+}
+
+CBH_INLINABLE CBH_CONST BOOL CBHPixelSize_isEqual(const CBHPixelSize size, const CBHPixelSize other)
+{
+	return (BOOL)( (size.width == other.width) & (size.height == other.height) );
+}
+
+CBH_INLINABLE CBH_CONST BOOL CBHPixelRect_isEmpty(const CBHPixelRect rect)
+{
+	return (BOOL)( (rect.size.width <= 0) | (rect.size.height <= 0) );
+}
+
+CBH_INLINABLE CBH_CONST BOOL CBHPixelRect_isEqual(const CBHPixelRect rect, const CBHPixelRect other)
+{
+	return (BOOL)( (rect.origin.x == other.origin.x) & (rect.origin.y == other.origin.y)
+				 & (rect.size.width == other.size.width) & (rect.size.height == other.size.height) );
+}
+
+CBH_INLINABLE CBH_CONST BOOL CBHPixelRect_isCovering(const CBHPixelRect rect, const CBHPixelRect other)
+{
+	const int isEmpty = ( (other.size.width <= 0) | (other.size.height <= 0) );
+
+	return (BOOL)( !isEmpty & (rect.origin.x <= other.origin.x) & (rect.origin.y <= other.origin.y)
+				 & (other.origin.x + other.size.width <= rect.origin.x + rect.size.width)
+				 & (other.origin.y + other.size.height <= rect.origin.y + rect.size.height) );
+}
+
+CBH_INLINABLE CBH_CONST BOOL CBHPixelRect_isIntersecting(const CBHPixelRect rect, const CBHPixelRect other)
+{
+	const int isEmpty = ( (rect.size.width <= 0) | (rect.size.height <= 0) | (other.size.width <= 0) | (other.size.height <= 0) );
+
+	return (BOOL)( !isEmpty & (rect.origin.x < other.origin.x + other.size.width) & (other.origin.x < rect.origin.x + rect.size.width)
+				 & (rect.origin.y < other.origin.y + other.size.height) & (other.origin.y < rect.origin.y + rect.size.height) );
+}
+
+CBH_INLINABLE CBH_CONST BOOL CBHPixelRect_isPointInRect(const CBHPixelRect rect, const CBHPixelPoint point)
+{
+	return (BOOL)( (rect.origin.x <= point.x) & (point.x < rect.origin.x + rect.size.width)
+				 & (rect.origin.y <= point.y) & (point.y < rect.origin.y + rect.size.height) );
+}
+
+
+#pragma mark - Derived Pixel Rects
+
+CBH_INLINABLE CBH_CONST CBHPixelRect CBHPixelRect_inset(const CBHPixelRect rect, const int32_t dX, const int32_t dY)
+{
+	return CBHPixelRect_init(rect.origin.x + dX, rect.origin.y + dY, rect.size.width - dX * 2, rect.size.height - dY * 2);
+}
+
+CBH_INLINABLE CBH_CONST CBHPixelRect CBHPixelRect_offset(const CBHPixelRect rect, const int32_t dX, const int32_t dY)
+{
+	return CBHPixelRect_init(rect.origin.x + dX, rect.origin.y + dY, rect.size.width, rect.size.height);
+}
+
+CBH_INLINABLE CBH_CONST CBHPixelRect CBHPixelRect_intersection(const CBHPixelRect rect, const CBHPixelRect other)
+{
+	const int32_t minX = MAX(rect.origin.x, other.origin.x);
+	const int32_t minY = MAX(rect.origin.y, other.origin.y);
+	const int32_t maxX = MIN(rect.origin.x + rect.size.width, other.origin.x + other.size.width);
+	const int32_t maxY = MIN(rect.origin.y + rect.size.height, other.origin.y + other.size.height);
+
+	const CBHPixelRect newRect = CBHPixelRect_init(minX, minY, maxX - minX, maxY - minY);
+	return _CBHPixelRect_select(CBHPixelRect_isIntersecting(rect, other), newRect, CBHPixelRect_initEmpty());
+}
+
+CBH_INLINABLE CBH_CONST CBHPixelRect CBHPixelRect_union(const CBHPixelRect rect, const CBHPixelRect other)
+{
+	const int32_t minX = MIN(rect.origin.x, other.origin.x);
+	const int32_t minY = MIN(rect.origin.y, other.origin.y);
+	const int32_t maxX = MAX(rect.origin.x + rect.size.width, other.origin.x + other.size.width);
+	const int32_t maxY = MAX(rect.origin.y + rect.size.height, other.origin.y + other.size.height);
+
+	const CBHPixelRect newRect = CBHPixelRect_init(minX, minY, maxX - minX, maxY - minY);
+	const CBHPixelRect otherOrEmpty = _CBHPixelRect_select(CBHPixelRect_isEmpty(other), CBHPixelRect_initEmpty(), other);
+	const CBHPixelRect rectOrUnion = _CBHPixelRect_select(CBHPixelRect_isEmpty(other), rect, newRect);
+
+	return _CBHPixelRect_select(CBHPixelRect_isEmpty(rect), otherOrEmpty, rectOrUnion);
+}
+
+// An arithmetic shift halves the difference in size, rounding toward the minimum edges.
+CBH_INLINABLE CBH_CONST CBHPixelRect CBHPixelRect_centeredInRect(const CBHPixelRect rect, const CBHPixelRect inRect)
+{
+	CBHPixelRect newRect = rect;
+
+	newRect.origin.x = inRect.origin.x + ((inRect.size.width - rect.size.width) >> 1);
+	newRect.origin.y = inRect.origin.y + ((inRect.size.height - rect.size.height) >> 1);
+
+	return newRect;
+}
+
+
+#pragma mark - Derived Pixel Points
+
+CBH_INLINABLE CBH_CONST CBHPixelPoint CBHPixelRect_minPoint(const CBHPixelRect rect)
+{
+	return CBHPixelPoint_init(CBHPixelRect_minX(rect), CBHPixelRect_minY(rect));
+}
+
+CBH_INLINABLE CBH_CONST CBHPixelPoint CBHPixelRect_maxPoint(const CBHPixelRect rect)
+{
+	return CBHPixelPoint_init(CBHPixelRect_maxX(rect), CBHPixelRect_maxY(rect));
+}
+
+
+#pragma mark - Calculated Properties
+
+CBH_INLINABLE CBH_CONST int32_t CBHPixelRect_minX(const CBHPixelRect rect)
+{
+	return ( rect.size.width >= 0 ) ? rect.origin.x : rect.origin.x + rect.size.width;
+}
+
+CBH_INLINABLE CBH_CONST int32_t CBHPixelRect_minY(const CBHPixelRect rect)
+{
+	return ( rect.size.height >= 0 ) ? rect.origin.y : rect.origin.y + rect.size.height;
+}
+
+CBH_INLINABLE CBH_CONST int32_t CBHPixelRect_maxX(const CBHPixelRect rect)
+{
+	return ( rect.size.width <= 0 ) ? rect.origin.x : rect.origin.x + rect.size.width;
+}
+
+CBH_INLINABLE CBH_CONST int32_t CBHPixelRect_maxY(const CBHPixelRect rect)
+{
+	return ( rect.size.height <= 0 ) ? rect.origin.y : rect.origin.y + rect.size.height;
+}
+
+NS_ASSUME_NONNULL_END
+
+#endif
@@ -0,0 +1,165 @@
+//  CBHPointAccumulator.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** Running statistics over a stream of points, held in a fixed-size struct which never stores the points.
+ *
+ * The mean and variance are updated with Welford's method and partial results are combined with Chan's formula, so
+ * they stay accurate for long streams and for streams far from the origin. The path length is a compensated sum of
+ * `NSPoint_distance()` between consecutive points.
+ *
+ * The fields may be read directly but should only be modified through the functions below.
+ */
+typedef struct CBHPointAccumulator
+{
+	/** The number of points pushed. */
+	NSUInteger count;
+
+	/** The least x and least y coordinates pushed. */
+	NSPoint minimum;
+
+	/** The greatest x and greatest y coordinates pushed. */
+	NSPoint maximum;
+
+	/** The mean of the points pushed. */
+	NSPoint mean;
+
+	/** The sums of squared deviations from the mean in x and in y. */
+	NSPoint deviations;
+
+	/** The first point pushed. */
+	NSPoint first;
+
+	/** The last point pushed. */
+	NSPoint last;
+
+	/** The running sum of the path length. */
+	CGFloat length;
+
+	/** The rounding error lost from `length`, which is added back when the length is read. */
+	CGFloat lengthCompensation;
+} CBHPointAccumulator;
+
+
+#pragma mark - Creating Accumulators
+
+/**
+ * @name Creating Accumulators
+ */
+
+/** Creates an accumulator with no points.
+ *
+ * @return              An empty `CBHPointAccumulator`.
+ */
+CBHPointAccumulator CBHPointAccumulator_init(void);
+
+
+#pragma mark - Adding Points
+
+/**
+ * @name Adding Points
+ *
+ * Points are taken to follow those already pushed, so the path length grows by the distance from the last point to
+ * the first new one.
+ */
+
+/** Adds a point.
+ *
+ * @param accumulator   The accumulator to update.
+ * @param point         The next point in the stream.
+ */
+void CBHPointAccumulator_push(CBHPointAccumulator *accumulator, NSPoint point);
+
+/** Adds the points in an array.
+ *
+ * The points are examined several at a time and large arrays are split across cores, with the partial results merged
+ * in order. The results are the same for any number of threads but may differ from pushing the points one at a time
+ * in the last bits.
+ *
+ * @param accumulator   The accumulator to update.
+ * @param points        The next points in the stream.
+ * @param count         The number of points in _points_.
+ */
+void CBHPointAccumulator_pushPoints(CBHPointAccumulator *accumulator, const NSPoint *points, NSUInteger count);
+
+/** Adds the points gathered by another accumulator.
+ *
+ * This combines partial results, such as those gathered by separate threads. The other accumulator's points are taken
+ * to follow this one's, so the path length includes the distance from this one's last point to the other's first.
+ *
+ * @param accumulator   The accumulator to update.
+ * @param other         The accumulator whose points follow.
+ */
+void CBHPointAccumulator_merge(CBHPointAccumulator *accumulator, const CBHPointAccumulator *other);
+
+
+#pragma mark - Reading Statistics
+
+/**
+ * @name Reading Statistics
+ *
+ * Points with a NaN component give unspecified results.
+ */
+
+/** The smallest rect containing every point pushed.
+ *
+ * @param accumulator   The accumulator.
+ *
+ * @return              A `NSRect` spanning the least and greatest coordinates, or an empty rect at {0, 0} if no points
+ *                      have been pushed.
+ */
+NSRect CBHPointAccumulator_bounds(const CBHPointAccumulator *accumulator);
+
+/** The mean of the points pushed.
+ *
+ * @param accumulator   The accumulator.
+ *
+ * @return              The centroid of the points, or the origin if no points have been pushed.
+ */
+NSPoint CBHPointAccumulator_centroid(const CBHPointAccumulator *accumulator);
+
+/** The population variance of the points pushed.
+ *
+ * @param accumulator   The accumulator.
+ *
+ * @return              A point holding the variance of the x coordinates and of the y coordinates, or the origin if no
+ *                      points have been pushed.
+ */
+NSPoint CBHPointAccumulator_variance(const CBHPointAccumulator *accumulator);
+
+/** The population standard deviation of the points pushed.
+ *
+ * @param accumulator   The accumulator.
+ *
+ * @return              A point holding the square roots of the components of `CBHPointAccumulator_variance()`.
+ */
+NSPoint CBHPointAccumulator_standardDeviation(const CBHPointAccumulator *accumulator);
+
+/** The length of the path through the points pushed, in order.
+ *
+ * @param accumulator   The accumulator.
+ *
+ * @return              The sum of `NSPoint_distance()` between consecutive points, or 0 for fewer than 2 points.
+ */
+CGFloat CBHPointAccumulator_length(const CBHPointAccumulator *accumulator);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,361 @@
+//  CBHPointAccumulator.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHPointAccumulator.h"
+
+#import "NSPoint+CBHGeometryKit.h"
+#import "NSRect+CBHGeometryKit.h"
+
+#import "_CBHGeometryKit+Utilities.h"
+#import "_CBHGeometryKit+Vector.h"
+#import "_CBHGeometryKit+Parallel.h"
+
+#import <math.h>
+#import <stdlib.h>
+
+
+// Batches are summarized in chunks small enough to stay in the L1 cache for the second pass over their deviations.
+enum { kCBHPointAccumulatorChunkLength = 1024 };
+
+
+#pragma mark - Creating Accumulators
+
+CBHPointAccumulator CBHPointAccumulator_init(void)
+{
+	return (CBHPointAccumulator){ .count = 0 };
+}
+
+
+#pragma mark - Adding Points
+
+// Neumaier's variant of Kahan summation, which also holds up when the value added is larger than the sum.
+NS_INLINE void _CBHPointAccumulator_addLength(CBHPointAccumulator * const accumulator, const CGFloat value)
+{
+	const CGFloat sum = accumulator->length + value;
+
+	if ( fabs(accumulator->length) >= fabs(value) ) { accumulator->lengthCompensation += (accumulator->length - sum) + value; }
+	else { accumulator->lengthCompensation += (value - sum) + accumulator->length; }
+
+	accumulator->length = sum;
+}
+
+void CBHPointAccumulator_push(CBHPointAccumulator * const accumulator, const NSPoint point)
+{
+	if ( accumulator->count == 0 )
+	{
+		*accumulator = (CBHPointAccumulator){ .count = 1, .minimum = point, .maximum = point, .mean = point, .first = point, .last = point };
+		return;
+	}
+
+	_CBHPointAccumulator_addLength(accumulator, NSPoint_distance(accumulator->last, point));
+
+	accumulator->minimum = NSPoint_init(MIN(accumulator->minimum.x, point.x), MIN(accumulator->minimum.y, point.y));
+	accumulator->maximum = NSPoint_init(MAX(accumulator->maximum.x, point.x), MAX(accumulator->maximum.y, point.y));
+
+	accumulator->count += 1;
+	const CGFloat count = (CGFloat)accumulator->count;
+
+	const CGFloat dx = point.x - accumulator->mean.x;
+	const CGFloat dy = point.y - accumulator->mean.y;
+	accumulator->mean.x += dx / count;
+	accumulator->mean.y += dy / count;
+	accumulator->deviations.x += dx * (point.x - accumulator->mean.x);
+	accumulator->deviations.y += dy * (point.y - accumulator->mean.y);
+
+	accumulator->last = point;
+}
+
+void CBHPointAccumulator_merge(CBHPointAccumulator * const accumulator, const CBHPointAccumulator * const other)
+{
+	if ( other->count == 0 ) { return; }
+	if ( accumulator->count == 0 )
+	{
+		*accumulator = *other;
+		return;
+	}
+
+	_CBHPointAccumulator_addLength(accumulator, NSPoint_distance(accumulator->last, other->first));
+	_CBHPointAccumulator_addLength(accumulator, other->length);
+	accumulator->lengthCompensation += other->lengthCompensation;
+
+	accumulator->minimum = NSPoint_init(MIN(accumulator->minimum.x, other->minimum.x), MIN(accumulator->minimum.y, other->minimum.y));
+	accumulator->maximum = NSPoint_init(MAX(accumulator->maximum.x, other->maximum.x), MAX(accumulator->maximum.y, other->maximum.y));
+
+	// Chan's formula for combining the means and squared deviations of two sets.
+	const CGFloat count = (CGFloat)accumulator->count;
+	const CGFloat otherCount = (CGFloat)other->count;
+	const CGFloat total = count + otherCount;
+
+	const CGFloat dx = other->mean.x - accumulator->mean.x;
+	const CGFloat dy = other->mean.y - accumulator->mean.y;
+	accumulator->mean.x += dx * (otherCount / total);
+	accumulator->mean.y += dy * (otherCount / total);
+	accumulator->deviations.x += other->deviations.x + dx * dx * (count * otherCount / total);
+	accumulator->deviations.y += other->deviations.y + dy * dy * (count * otherCount / total);
+
+	accumulator->count += other->count;
+	accumulator->last = other->last;
+}
+
+
+#pragma mark - Batched Points
+
+// Summarizes up to `kCBHPointAccumulatorChunkLength` points. The mean comes from a plain sum and the deviations from a
+// second pass about it, which is exact enough over a chunk and leaves the long-range accuracy to `merge()`.
+//
+// The vector passes read the coordinates as one array of values, so even lanes hold x coordinates and odd lanes hold
+// y coordinates. Scalar remainders pick up at the first point the vector passes did not finish.
+static CBHPointAccumulator _CBHPointAccumulator_ofChunk(const NSPoint * const points, const NSUInteger count)
+{
+	CBHPointAccumulator chunk = { .count = count, .first = points[0], .last = points[count - 1] };
+
+	CGFloat sums[2] = { 0.0, 0.0 };
+	CGFloat minimum[2] = { points[0].x, points[0].y };
+	CGFloat maximum[2] = { points[0].x, points[0].y };
+	NSUInteger i = 0;
+
+#if CBH_VECTOR
+	const double * const values = (const double *)points;
+	const NSUInteger valueCount = count * 2;
+	double lanes[2][CBH_VECTOR_WIDTH];
+
+	for (NSUInteger lane = 0; lane < CBH_VECTOR_WIDTH; ++lane)
+	{
+		lanes[0][lane] = minimum[lane % 2];
+	}
+
+	CBHVector vectorSums = CBHVector_set(0.0);
+	CBHVector vectorMinimum = CBHVector_load(lanes[0]);
+	CBHVector vectorMaximum = vectorMinimum;
+
+	for ( ; i + CBH_VECTOR_WIDTH <= valueCount; i += CBH_VECTOR_WIDTH )
+	{
+		const CBHVector vector = CBHVector_load(values + i);
+		vectorSums = CBHVector_add(vectorSums, vector);
+		vectorMinimum = CBHVector_min(vectorMinimum, vector);
+		vectorMaximum = CBHVector_max(vectorMaximum, vector);
+	}
+
+	double foldedMinimum[CBH_VECTOR_WIDTH];
+	double foldedMaximum[CBH_VECTOR_WIDTH];
+	CBHVector_store(lanes[0], vectorSums);
+	CBHVector_store(foldedMinimum, vectorMinimum);
+	CBHVector_store(foldedMaximum, vectorMaximum);
+
+	for (NSUInteger lane = 0; lane < CBH_VECTOR_WIDTH; ++lane)
+	{
+		sums[lane % 2] += lanes[0][lane];
+		minimum[lane % 2] = MIN(minimum[lane % 2], foldedMinimum[lane]);
+		maximum[lane % 2] = MAX(maximum[lane % 2], foldedMaximum[lane]);
+	}
+
+	i /= 2;
+#endif
+
+	for ( ; i < count; ++i )
+	{
+		sums[0] += points[i].x;
+		sums[1] += points[i].y;
+		minimum[0] = MIN(minimum[0], points[i].x);
+		minimum[1] = MIN(minimum[1], points[i].y);
+		maximum[0] = MAX(maximum[0], points[i].x);
+		maximum[1] = MAX(maximum[1], points[i].y);
+	}
+
+	chunk.minimum = NSPoint_init(minimum[0], minimum[1]);
+	chunk.maximum = NSPoint_init(maximum[0], maximum[1]);
+	chunk.mean = NSPoint_init(sums[0] / (CGFloat)count, sums[1] / (CGFloat)count);
+
+	CGFloat deviations[2] = { 0.0, 0.0 };
+	i = 0;
+
+#if CBH_VECTOR
+	for (NSUInteger lane = 0; lane < CBH_VECTOR_WIDTH; ++lane)
+	{
+		lanes[0][lane] = ( lane % 2 ) ? chunk.mean.y : chunk.mean.x;
+	}
+
+	const CBHVector mean = CBHVector_load(lanes[0]);
+	CBHVector squares = CBHVector_set(0.0);
+
+	for ( ; i + CBH_VECTOR_WIDTH <= valueCount; i += CBH_VECTOR_WIDTH )
+	{
+		const CBHVector deviation = CBHVector_sub(CBHVector_load(values + i), mean);
+		squares = CBHVector_add(squares, CBHVector_mul(deviation, deviation));
+	}
+
+	CBHVector_store(lanes[0], squares);
+
+	for (NSUInteger lane = 0; lane < CBH_VECTOR_WIDTH; ++lane)
+	{
+		deviations[lane % 2] += lanes[0][lane];
+	}
+
+	i /= 2;
+#endif
+
+	for ( ; i < count; ++i )
+	{
+		const CGFloat dx = points[i].x - chunk.mean.x;
+		const CGFloat dy = points[i].y - chunk.mean.y;
+		deviations[0] += dx * dx;
+		deviations[1] += dy * dy;
+	}
+
+	chunk.deviations = NSPoint_init(deviations[0], deviations[1]);
+
+	// Each lane keeps a Kahan sum of the distances, computed as `NSPoint_distance()` computes them. Swapping the squared
+	// differences within each pair leaves both lanes of a pair with the same distance, so only the even lanes are kept.
+	i = 0;
+
+#if CBH_VECTOR
+	CBHVector lengths = CBHVector_set(0.0);
+	CBHVector errors = CBHVector_set(0.0);
+
+	for ( ; i + 2 + CBH_VECTOR_WIDTH <= valueCount; i += CBH_VECTOR_WIDTH )
+	{
+		const CBHVector difference = CBHVector_sub(CBHVector_load(values + i), CBHVector_load(values + i + 2));
+		const CBHVector squared = CBHVector_mul(difference, difference);
+		const CBHVector distance = CBHVector_sqrt(CBHVector_add(squared, CBHVector_swapPairs(squared)));
+
+		const CBHVector term = CBHVector_sub(distance, errors);
+		const CBHVector sum = CBHVector_add(lengths, term);
+		errors = CBHVector_sub(CBHVector_sub(sum, lengths), term);
+		lengths = sum;
+	}
+
+	CBHVector_store(lanes[0], lengths);
+	CBHVector_store(lanes[1], errors);
+
+	for (NSUInteger lane = 0; lane < CBH_VECTOR_WIDTH; lane += 2)
+	{
+		_CBHPointAccumulator_addLength(&chunk, lanes[0][lane]);
+		chunk.lengthCompensation -= lanes[1][lane];
+	}
+
+	i /= 2;
+#endif
+
+	for ( ; i + 1 < count; ++i )
+	{
+		_CBHPointAccumulator_addLength(&chunk, NSPoint_distance(points[i], points[i + 1]));
+	}
+
+	return chunk;
+}
+
+// Summarizes a block chunk by chunk, always starting from an empty accumulator so the partial result for a block does
+// not depend on how blocks are shared between threads.
+static CBHPointAccumulator _CBHPointAccumulator_ofBlock(const NSPoint * const points, const NSUInteger count)
+{
+	CBHPointAccumulator block = CBHPointAccumulator_init();
+
+	for (NSUInteger i = 0; i < count; i += kCBHPointAccumulatorChunkLength)
+	{
+		const CBHPointAccumulator chunk = _CBHPointAccumulator_ofChunk(points + i, MIN((NSUInteger)kCBHPointAccumulatorChunkLength, count - i));
+		CBHPointAccumulator_merge(&block, &chunk);
+	}
+
+	return block;
+}
+
+typedef struct CBHPointAccumulation
+{
+	const NSPoint *points;
+	NSUInteger count;
+	CBHPointAccumulator *partials;
+} CBHPointAccumulation;
+
+static void _CBHPointAccumulator_blockWorker(void * const context, const NSRange blocks)
+{
+	const CBHPointAccumulation * const accumulation = context;
+
+	for (NSUInteger i = blocks.location; i < NSMaxRange(blocks); ++i)
+	{
+		const NSRange block = CBHParallel_block(accumulation->count, i);
+		accumulation->partials[i] = _CBHPointAccumulator_ofBlock(accumulation->points + block.location, block.length);
+	}
+}
+
+void CBHPointAccumulator_pushPoints(CBHPointAccumulator * const accumulator, const NSPoint * const points, const NSUInteger count)
+{
+	if ( count == 0 ) { return; }
+
+	const NSUInteger blockCount = CBHParallel_blockCount(count);
+	const NSUInteger grainSize = CBHParallel_grainSizeForUnit(kCBHParallelBlockLength);
+	CBHPointAccumulator * const partials = ( CBHParallel_isSplit(blockCount, grainSize) ) ? malloc(sizeof(CBHPointAccumulator) * blockCount) : NULL;
+
+	if ( partials != NULL )
+	{
+		CBHPointAccumulation accumulation = { .points = points, .count = count, .partials = partials };
+		CBHParallel_applyWithGrainSize(blockCount, grainSize, &accumulation, _CBHPointAccumulator_blockWorker);
+	}
+
+	for (NSUInteger i = 0; i < blockCount; ++i)
+	{
+		CBHPointAccumulator partial;
+
+		if ( partials != NULL ) { partial = partials[i]; }
+		else
+		{
+			const NSRange block = CBHParallel_block(count, i);
+			partial = _CBHPointAccumulator_ofBlock(points + block.location, block.length);
+		}
+
+		CBHPointAccumulator_merge(accumulator, &partial);
+	}
+
+	free(partials);
+}
+
+
+#pragma mark - Reading Statistics
+
+NSRect CBHPointAccumulator_bounds(const CBHPointAccumulator * const accumulator)
+{
+	if ( accumulator->count == 0 ) { return NSRect_initEmpty(); }
+
+	const NSPoint minimum = accumulator->minimum;
+	const NSPoint maximum = accumulator->maximum;
+
+	return NSRect_init(minimum.x, minimum.y, maximum.x - minimum.x, maximum.y - minimum.y);
+}
+
+NSPoint CBHPointAccumulator_centroid(const CBHPointAccumulator * const accumulator)
+{
+	return ( accumulator->count > 0 ) ? accumulator->mean : NSPoint_initZero();
+}
+
+NSPoint CBHPointAccumulator_variance(const CBHPointAccumulator * const accumulator)
+{
+	if ( accumulator->count == 0 ) { return NSPoint_initZero(); }
+
+	const CGFloat count = (CGFloat)accumulator->count;
+	return NSPoint_init(accumulator->deviations.x / count, accumulator->deviations.y / count);
+}
+
+NSPoint CBHPointAccumulator_standardDeviation(const CBHPointAccumulator * const accumulator)
+{
+	const NSPoint variance = CBHPointAccumulator_variance(accumulator);
+	return NSPoint_init(sqrt(variance.x), sqrt(variance.y));
+}
+
+CGFloat CBHPointAccumulator_length(const CBHPointAccumulator * const accumulator)
+{
+	return accumulator->length + accumulator->lengthCompensation;
+}
@@ -0,0 +1,169 @@
+//  CBHPointTree.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** An immutable k-d tree over a set of points.
+ *
+ * The tree is balanced, splits each range across its wider axis, and keeps small ranges as buckets which are scanned
+ * with the batched distance functions. Queries do not allocate.
+ *
+ * Distances are measured with `NSPoint_distanceSquared()` and `NSPoint_distance()` so results agree exactly with a
+ * brute force scan using them.
+ */
+typedef struct CBHPointTree CBHPointTree;
+
+/** A function called for each match during an enumeration.
+ *
+ * @param index         The index of the matching point.
+ * @param context       The context given to the enumeration.
+ * @param stop          Set to `YES` to stop the enumeration.
+ */
+typedef void (*CBHPointTreeCallback)(NSUInteger index, void * _Nullable context, BOOL *stop);
+
+
+#pragma mark - Creating Point Trees
+
+/**
+ * @name Creating Point Trees
+ */
+
+/** Creates a point tree from a C array of points.
+ *
+ * @param points        The points to index. The tree does not keep a reference to them.
+ * @param count         The number of points in _points_.
+ *
+ * @return              A new tree, or `NULL` if the storage could not be allocated. Release it with `CBHPointTree_destroy()`.
+ */
+CBHPointTree * _Nullable CBHPointTree_createWithPoints(const NSPoint *points, NSUInteger count);
+
+/** Releases a point tree.
+ *
+ * @param tree          The tree to release.
+ */
+void CBHPointTree_destroy(CBHPointTree * _Nullable tree);
+
+
+#pragma mark - Properties
+
+/**
+ * @name Properties
+ */
+
+/** The number of points in the tree.
+ *
+ * @param tree          The tree.
+ *
+ * @return              The number of points.
+ */
+NSUInteger CBHPointTree_count(const CBHPointTree *tree);
+
+
+#pragma mark - Finding Nearest Points
+
+/**
+ * @name Finding Nearest Points
+ *
+ * Points are ordered by their distance from the query and then by index, so equidistant points are reported the same
+ * way a stable sort of a brute force scan would report them.
+ */
+
+/** Finds the point nearest to a point.
+ *
+ * @param tree          The tree.
+ * @param point         The point to search from.
+ *
+ * @return              The index of the nearest point, or `NSNotFound` if the tree is empty.
+ */
+NSUInteger CBHPointTree_nearestIndex(const CBHPointTree *tree, NSPoint point);
+
+/** Finds the points nearest to a point.
+ *
+ * @param tree          The tree.
+ * @param point         The point to search from.
+ * @param count         The number of points to find.
+ * @param indexes       A buffer of at least _count_ elements to receive the indexes, nearest first.
+ * @param distances     A buffer of at least _count_ elements to receive the `NSPoint_distanceSquared()` of each point.
+ *
+ * @return              The number of points found, which is less than _count_ only if the tree holds fewer points.
+ */
+NSUInteger CBHPointTree_nearestIndexes(const CBHPointTree *tree, NSPoint point, NSUInteger count, NSUInteger *indexes, CGFloat *distances);
+
+
+#pragma mark - Querying Indexes
+
+/**
+ * @name Querying Indexes
+ *
+ * These functions write up to _capacity_ matching indexes in no particular order and return the total number of
+ * matches, which may exceed _capacity_.
+ */
+
+/** Finds the points within a distance of a point.
+ *
+ * @param tree          The tree.
+ * @param point         The point to search from.
+ * @param distance      The greatest distance to include.
+ * @param indexes       A buffer to receive the indexes.
+ * @param capacity      The number of elements _indexes_ can hold.
+ *
+ * @return              The number of points for which `NSPoint_distance()` is less than or equal to _distance_.
+ */
+NSUInteger CBHPointTree_withinDistanceIndexes(const CBHPointTree *tree, NSPoint point, CGFloat distance, NSUInteger * _Nullable indexes, NSUInteger capacity);
+
+/** Finds the points within a rect.
+ *
+ * @param tree          The tree.
+ * @param rect          The rect to search.
+ * @param indexes       A buffer to receive the indexes.
+ * @param capacity      The number of elements _indexes_ can hold.
+ *
+ * @return              The number of points for which `NSRect_isPointInRect()` is `YES`.
+ */
+NSUInteger CBHPointTree_inRectIndexes(const CBHPointTree *tree, NSRect rect, NSUInteger * _Nullable indexes, NSUInteger capacity);
+
+
+#pragma mark - Enumerating Matches
+
+/**
+ * @name Enumerating Matches
+ */
+
+/** Calls a function for each point within a distance of a point.
+ *
+ * @param tree          The tree.
+ * @param point         The point to search from.
+ * @param distance      The greatest distance to include.
+ * @param callback      The function to call for each match.
+ * @param context       A value passed to _callback_.
+ */
+void CBHPointTree_enumerateWithinDistance(const CBHPointTree *tree, NSPoint point, CGFloat distance, CBHPointTreeCallback callback, void * _Nullable context);
+
+/** Calls a function for each point within a rect.
+ *
+ * @param tree          The tree.
+ * @param rect          The rect to search.
+ * @param callback      The function to call for each match.
+ * @param context       A value passed to _callback_.
+ */
+void CBHPointTree_enumerateInRect(const CBHPointTree *tree, NSRect rect, CBHPointTreeCallback callback, void * _Nullable context);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,418 @@
+//  CBHPointTree.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHPointTree.h"
+
+#import "NSPoint+CBHGeometryKit.h"
+
+#import "_CBHGeometryKit+Utilities.h"
+#import "_CBHGeometryKit+Predicates.h"
+#import "_CBHGeometryKit+IndexSink.h"
+
+#import <stdlib.h>
+
+
+// Ranges of this many points or fewer are not split further but scanned with the batched distance functions.
+enum { kCBHPointTreeBucketSize = 16 };
+
+
+// The tree is implicit. A range `[start, end)` longer than a bucket is split at `middle = start + (end - start) / 2`:
+// points in `[start, middle)` lie at or below `splits[middle]` along `axes[middle]` and points in `[middle, end)` lie
+// at or above it. No two ranges share a middle.
+struct CBHPointTree
+{
+	NSPoint * _Nullable points;
+	NSUInteger * _Nullable indexes;
+	CGFloat * _Nullable splits;
+	uint8_t * _Nullable axes;
+
+	NSUInteger count;
+};
+
+
+NS_INLINE CGFloat _CBHPoint_coordinate(const NSPoint point, const NSUInteger axis)
+{
+	return ( axis == 0 ) ? point.x : point.y;
+}
+
+NS_INLINE NSUInteger _CBHPointTree_middle(const NSUInteger start, const NSUInteger end)
+{
+	return start + (end - start) / 2;
+}
+
+
+#pragma mark - Building
+
+NS_INLINE void _CBHPointTree_swap(CBHPointTree * const tree, const NSUInteger a, const NSUInteger b)
+{
+	const NSPoint point = tree->points[a];
+	tree->points[a] = tree->points[b];
+	tree->points[b] = point;
+
+	const NSUInteger index = tree->indexes[a];
+	tree->indexes[a] = tree->indexes[b];
+	tree->indexes[b] = index;
+}
+
+// Partially orders `[start, end)` along an axis so the point at `nth` is the one a full sort would place there.
+static void _CBHPointTree_select(CBHPointTree * const tree, const NSUInteger start, const NSUInteger end, const NSUInteger nth, const NSUInteger axis)
+{
+	NSInteger left = (NSInteger)start;
+	NSInteger right = (NSInteger)end - 1;
+	const NSInteger target = (NSInteger)nth;
+
+	while ( left < right )
+	{
+		// Moving the median of three to the target guards against already ordered input.
+		if ( _CBHPoint_coordinate(tree->points[target], axis) < _CBHPoint_coordinate(tree->points[left], axis) ) { _CBHPointTree_swap(tree, (NSUInteger)target, (NSUInteger)left); }
+		if ( _CBHPoint_coordinate(tree->points[right], axis) < _CBHPoint_coordinate(tree->points[target], axis) ) { _CBHPointTree_swap(tree, (NSUInteger)right, (NSUInteger)target); }
+		if ( _CBHPoint_coordinate(tree->points[target], axis) < _CBHPoint_coordinate(tree->points[left], axis) ) { _CBHPointTree_swap(tree, (NSUInteger)target, (NSUInteger)left); }
+
+		const CGFloat pivot = _CBHPoint_coordinate(tree->points[target], axis);
+
+		NSInteger i = left;
+		NSInteger j = right;
+
+		do
+		{
+			while ( _CBHPoint_coordinate(tree->points[i], axis) < pivot ) { ++i; }
+			while ( pivot < _CBHPoint_coordinate(tree->points[j], axis) ) { --j; }
+
+			if ( i <= j )
+			{
+				_CBHPointTree_swap(tree, (NSUInteger)i, (NSUInteger)j);
+				++i;
+				--j;
+			}
+		}
+		while ( i <= j );
+
+		if ( j < target ) { left = i; }
+		if ( target < i ) { right = j; }
+	}
+}
+
+static void _CBHPointTree_build(CBHPointTree * const tree, NSUInteger start, const NSUInteger end)
+{
+	while ( end - start > kCBHPointTreeBucketSize )
+	{
+		CGFloat minX = tree->points[start].x;
+		CGFloat maxX = minX;
+		CGFloat minY = tree->points[start].y;
+		CGFloat maxY = minY;
+
+		for (NSUInteger i = start + 1; i < end; ++i)
+		{
+			minX = MIN(minX, tree->points[i].x);
+			maxX = MAX(maxX, tree->points[i].x);
+			minY = MIN(minY, tree->points[i].y);
+			maxY = MAX(maxY, tree->points[i].y);
+		}
+
+		const NSUInteger axis = ( maxX - minX >= maxY - minY ) ? 0 : 1;
+		const NSUInteger middle = _CBHPointTree_middle(start, end);
+
+		_CBHPointTree_select(tree, start, end, middle, axis);
+		tree->splits[middle] = _CBHPoint_coordinate(tree->points[middle], axis);
+		tree->axes[middle] = (uint8_t)axis;
+
+		_CBHPointTree_build(tree, start, middle);
+		start = middle;
+	}
+}
+
+
+#pragma mark - Creating Point Trees
+
+CBHPointTree *CBHPointTree_createWithPoints(const NSPoint * const points, const NSUInteger count)
+{
+	CBHPointTree * const tree = calloc(1, sizeof(CBHPointTree));
+	if ( tree == NULL ) { return NULL; }
+
+	const NSUInteger length = MAX(count, 1UL);
+
+	tree->count = count;
+	tree->points = malloc(sizeof(NSPoint) * length);
+	tree->indexes = malloc(sizeof(NSUInteger) * length);
+	tree->splits = malloc(sizeof(CGFloat) * length);
+	tree->axes = malloc(sizeof(uint8_t) * length);
+
+	if ( tree->points == NULL || tree->indexes == NULL || tree->splits == NULL || tree->axes == NULL )
+	{
+		CBHPointTree_destroy(tree);
+		return NULL;
+	}
+
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		tree->points[i] = points[i];
+		tree->indexes[i] = i;
+	}
+
+	_CBHPointTree_build(tree, 0, count);
+
+	return tree;
+}
+
+void CBHPointTree_destroy(CBHPointTree * const tree)
+{
+	if ( tree == NULL ) { return; }
+
+	free(tree->points);
+	free(tree->indexes);
+	free(tree->splits);
+	free(tree->axes);
+	free(tree);
+}
+
+
+#pragma mark - Properties
+
+CBH_PURE NSUInteger CBHPointTree_count(const CBHPointTree * const tree)
+{
+	return tree->count;
+}
+
+
+#pragma mark - Finding Nearest Points
+
+// The best points found so far, held as a max-heap in the caller's buffers so the furthest is always at the top.
+typedef struct CBHPointTreeHeap
+{
+	NSUInteger *indexes;
+	CGFloat *distances;
+	NSUInteger count;
+	NSUInteger capacity;
+} CBHPointTreeHeap;
+
+NS_INLINE BOOL _CBHPointTreeHeap_isBefore(const CGFloat distance, const NSUInteger index, const CGFloat otherDistance, const NSUInteger otherIndex)
+{
+	return ( (distance < otherDistance) || ((distance == otherDistance) && (index < otherIndex)) );
+}
+
+static void _CBHPointTreeHeap_siftDown(CBHPointTreeHeap * const heap, NSUInteger position, const NSUInteger count)
+{
+	const CGFloat distance = heap->distances[position];
+	const NSUInteger index = heap->indexes[position];
+
+	while ( YES )
+	{
+		NSUInteger child = position * 2 + 1;
+		if ( child >= count ) { break; }
+
+		if ( child + 1 < count && _CBHPointTreeHeap_isBefore(heap->distances[child], heap->indexes[child], heap->distances[child + 1], heap->indexes[child + 1]) )
+		{
+			child += 1;
+		}
+
+		if ( !_CBHPointTreeHeap_isBefore(distance, index, heap->distances[child], heap->indexes[child]) ) { break; }
+
+		heap->distances[position] = heap->distances[child];
+		heap->indexes[position] = heap->indexes[child];
+		position = child;
+	}
+
+	heap->distances[position] = distance;
+	heap->indexes[position] = index;
+}
+
+static void _CBHPointTreeHeap_push(CBHPointTreeHeap * const heap, const CGFloat distance, const NSUInteger index)
+{
+	if ( heap->count < heap->capacity )
+	{
+		NSUInteger position = heap->count++;
+
+		while ( position > 0 )
+		{
+			const NSUInteger parent = (position - 1) / 2;
+			if ( !_CBHPointTreeHeap_isBefore(heap->distances[parent], heap->indexes[parent], distance, index) ) { break; }
+
+			heap->distances[position] = heap->distances[parent];
+			heap->indexes[position] = heap->indexes[parent];
+			position = parent;
+		}
+
+		heap->distances[position] = distance;
+		heap->indexes[position] = index;
+		return;
+	}
+
+	if ( !_CBHPointTreeHeap_isBefore(distance, index, heap->distances[0], heap->indexes[0]) ) { return; }
+
+	heap->distances[0] = distance;
+	heap->indexes[0] = index;
+	_CBHPointTreeHeap_siftDown(heap, 0, heap->count);
+}
+
+// Sorts the heap in place, nearest first.
+static void _CBHPointTreeHeap_sort(CBHPointTreeHeap * const heap)
+{
+	for (NSUInteger end = heap->count; end > 1; --end)
+	{
+		const CGFloat distance = heap->distances[0];
+		const NSUInteger index = heap->indexes[0];
+
+		heap->distances[0] = heap->distances[end - 1];
+		heap->indexes[0] = heap->indexes[end - 1];
+		_CBHPointTreeHeap_siftDown(heap, 0, end - 1);
+
+		heap->distances[end - 1] = distance;
+		heap->indexes[end - 1] = index;
+	}
+}
+
+// A point across a split is at least as far as the split itself, and the rounded squares and sums keep that order, so
+// the far side can be skipped once the split is further than the worst point kept.
+static void _CBHPointTree_nearest(const CBHPointTree * const tree, const NSUInteger start, const NSUInteger end, const NSPoint point, CBHPointTreeHeap * const heap)
+{
+	if ( end - start <= kCBHPointTreeBucketSize )
+	{
+		CGFloat distances[kCBHPointTreeBucketSize];
+		NSPoint_distancesSquaredToPoints(point, tree->points + start, distances, end - start);
+
+		for (NSUInteger i = 0; i < end - start; ++i)
+		{
+			_CBHPointTreeHeap_push(heap, distances[i], tree->indexes[start + i]);
+		}
+
+		return;
+	}
+
+	const NSUInteger middle = _CBHPointTree_middle(start, end);
+	const NSUInteger axis = tree->axes[middle];
+	const CGFloat delta = _CBHPoint_coordinate(point, axis) - tree->splits[middle];
+
+	if ( delta < 0.0 )
+	{
+		_CBHPointTree_nearest(tree, start, middle, point, heap);
+		if ( heap->count < heap->capacity || !(delta * delta > heap->distances[0]) ) { _CBHPointTree_nearest(tree, middle, end, point, heap); }
+	}
+	else
+	{
+		_CBHPointTree_nearest(tree, middle, end, point, heap);
+		if ( heap->count < heap->capacity || !(delta * delta > heap->distances[0]) ) { _CBHPointTree_nearest(tree, start, middle, point, heap); }
+	}
+}
+
+NSUInteger CBHPointTree_nearestIndex(const CBHPointTree * const tree, const NSPoint point)
+{
+	NSUInteger index = NSNotFound;
+	CGFloat distance = 0.0;
+
+	CBHPointTree_nearestIndexes(tree, point, 1, &index, &distance);
+
+	return index;
+}
+
+NSUInteger CBHPointTree_nearestIndexes(const CBHPointTree * const tree, const NSPoint point, const NSUInteger count, NSUInteger * const indexes, CGFloat * const distances)
+{
+	CBHPointTreeHeap heap = { .indexes = indexes, .distances = distances, .count = 0, .capacity = MIN(count, tree->count) };
+	if ( heap.capacity == 0 ) { return 0; }
+
+	_CBHPointTree_nearest(tree, 0, tree->count, point, &heap);
+	_CBHPointTreeHeap_sort(&heap);
+
+	return heap.count;
+}
+
+
+#pragma mark - Querying Indexes
+
+// `NSPoint_distance()` is never less than the distance to a split, so only splits within range need their far side.
+static void _CBHPointTree_withinDistance(const CBHPointTree * const tree, const NSUInteger start, const NSUInteger end, const NSPoint point, const CGFloat distance, CBHIndexSink * const sink)
+{
+	if ( sink->stop ) { return; }
+
+	if ( end - start <= kCBHPointTreeBucketSize )
+	{
+		CGFloat distances[kCBHPointTreeBucketSize];
+		NSPoint_distancesToPoints(point, tree->points + start, distances, end - start);
+
+		for (NSUInteger i = 0; i < end - start && !sink->stop; ++i)
+		{
+			if ( distances[i] <= distance ) { CBHIndexSink_emit(sink, tree->indexes[start + i]); }
+		}
+
+		return;
+	}
+
+	const NSUInteger middle = _CBHPointTree_middle(start, end);
+	const NSUInteger axis = tree->axes[middle];
+	const CGFloat delta = _CBHPoint_coordinate(point, axis) - tree->splits[middle];
+
+	if ( delta <= distance ) { _CBHPointTree_withinDistance(tree, start, middle, point, distance, sink); }
+	if ( -delta <= distance ) { _CBHPointTree_withinDistance(tree, middle, end, point, distance, sink); }
+}
+
+// The lower side can only hold points at or after the rect's minimum edge if the split is, and the upper side can
+// only hold points before the rect's maximum edge if the split is.
+static void _CBHPointTree_inRect(const CBHPointTree * const tree, const NSUInteger start, const NSUInteger end, const NSRect rect, CBHIndexSink * const sink)
+{
+	if ( sink->stop ) { return; }
+
+	if ( end - start <= kCBHPointTreeBucketSize )
+	{
+		for (NSUInteger i = start; i < end && !sink->stop; ++i)
+		{
+			if ( CBHRect_isPointInRect(rect, tree->points[i]) ) { CBHIndexSink_emit(sink, tree->indexes[i]); }
+		}
+
+		return;
+	}
+
+	const NSUInteger middle = _CBHPointTree_middle(start, end);
+	const NSUInteger axis = tree->axes[middle];
+	const CGFloat split = tree->splits[middle];
+
+	const CGFloat minimum = ( axis == 0 ) ? rect.origin.x : rect.origin.y;
+	const CGFloat maximum = ( axis == 0 ) ? rect.origin.x + rect.size.width : rect.origin.y + rect.size.height;
+
+	if ( minimum <= split ) { _CBHPointTree_inRect(tree, start, middle, rect, sink); }
+	if ( split < maximum ) { _CBHPointTree_inRect(tree, middle, end, rect, sink); }
+}
+
+NSUInteger CBHPointTree_withinDistanceIndexes(const CBHPointTree * const tree, const NSPoint point, const CGFloat distance, NSUInteger * const indexes, const NSUInteger capacity)
+{
+	CBHIndexSink sink = CBHIndexSink_initWithBuffer(indexes, capacity);
+	_CBHPointTree_withinDistance(tree, 0, tree->count, point, distance, &sink);
+
+	return sink.count;
+}
+
+NSUInteger CBHPointTree_inRectIndexes(const CBHPointTree * const tree, const NSRect rect, NSUInteger * const indexes, const NSUInteger capacity)
+{
+	CBHIndexSink sink = CBHIndexSink_initWithBuffer(indexes, capacity);
+	_CBHPointTree_inRect(tree, 0, tree->count, rect, &sink);
+
+	return sink.count;
+}
+
+
+#pragma mark - Enumerating Matches
+
+void CBHPointTree_enumerateWithinDistance(const CBHPointTree * const tree, const NSPoint point, const CGFloat distance, const CBHPointTreeCallback callback, void * const context)
+{
+	CBHIndexSink sink = CBHIndexSink_initWithCallback(callback, context);
+	_CBHPointTree_withinDistance(tree, 0, tree->count, point, distance, &sink);
+}
+
+void CBHPointTree_enumerateInRect(const CBHPointTree * const tree, const NSRect rect, const CBHPointTreeCallback callback, void * const context)
+{
+	CBHIndexSink sink = CBHIndexSink_initWithCallback(callback, context);
+	_CBHPointTree_inRect(tree, 0, tree->count, rect, &sink);
+}
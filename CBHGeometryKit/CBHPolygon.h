@@ -0,0 +1,128 @@
+//  CBHPolygon.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Functions for polygons stored as C arrays of `NSPoint` vertices.
+ *
+ * A polygon is closed implicitly: its last vertex connects back to its first, which need not be repeated. Its edges
+ * may cross, in which case the fill rule decides which regions are inside. A polygon with fewer than 3 vertices
+ * encloses nothing.
+ */
+
+/** The rule which decides whether a point is inside a polygon whose edges cross or wind more than once. */
+typedef NS_ENUM(NSInteger, CBHPolygonFillRule)
+{
+	/** A point is inside if the polygon winds around it a nonzero number of times. */
+	CBHPolygonFillRuleNonZero = 0,
+
+	/** A point is inside if a ray from it crosses the polygon's edges an odd number of times. */
+	CBHPolygonFillRuleEvenOdd,
+};
+
+
+#pragma mark - Measuring Polygons
+
+/**
+ * @name Measuring Polygons
+ */
+
+/** Calculates the signed area of a polygon.
+ *
+ * Vertices are taken relative to the first, which keeps precision for polygons far from the origin.
+ *
+ * @param points        The vertices of the polygon.
+ * @param count         The number of vertices in _points_.
+ *
+ * @return              The area, positive if the vertices run counterclockwise with y increasing upward, negative if
+ *                      they run clockwise, and 0 for fewer than 3 vertices. Regions wound more than once count more
+ *                      than once and those wound in opposite directions cancel.
+ */
+CGFloat CBHPolygon_signedArea(const NSPoint *points, NSUInteger count);
+
+/** Calculates the area of a polygon which does not cross itself.
+ *
+ * @param points        The vertices of the polygon.
+ * @param count         The number of vertices in _points_.
+ *
+ * @return              The absolute value of `CBHPolygon_signedArea()`.
+ */
+CGFloat CBHPolygon_area(const NSPoint *points, NSUInteger count);
+
+/** Calculates the perimeter of a polygon.
+ *
+ * @param points        The vertices of the polygon.
+ * @param count         The number of vertices in _points_.
+ *
+ * @return              The sum of `NSPoint_distance()` over every edge, including the closing edge, or 0 for fewer than 2
+ *                      vertices.
+ */
+CGFloat CBHPolygon_perimeter(const NSPoint *points, NSUInteger count);
+
+/** Finds the smallest rect containing a polygon.
+ *
+ * @param points        The vertices of the polygon.
+ * @param count         The number of vertices in _points_.
+ *
+ * @return              The rect found by `NSRect_boundingRectOfPoints()`.
+ */
+NSRect CBHPolygon_boundingRect(const NSPoint *points, NSUInteger count);
+
+
+#pragma mark - Testing Points
+
+/**
+ * @name Testing Points
+ *
+ * A point is tested by casting a ray toward increasing x and counting the edges it crosses. Each edge includes its
+ * lower vertex and excludes its upper one, and horizontal edges are never crossed, so a point on an edge shared by two
+ * polygons which do not overlap is inside exactly one of them.
+ */
+
+/** Checks whether a polygon contains a point.
+ *
+ * @param points        The vertices of the polygon.
+ * @param count         The number of vertices in _points_.
+ * @param point         The point to test.
+ * @param rule          The rule deciding which regions are inside.
+ *
+ * @return              `YES` if _point_ is inside the polygon, otherwise `NO`.
+ */
+BOOL CBHPolygon_containsPoint(const NSPoint *points, NSUInteger count, NSPoint point, CBHPolygonFillRule rule);
+
+/** Checks whether a polygon contains each point in an array.
+ *
+ * The points are tested several at a time and large arrays are split across cores. Every result equals
+ * `CBHPolygon_containsPoint()` for the same point.
+ *
+ * @param points        The vertices of the polygon.
+ * @param count         The number of vertices in _points_.
+ * @param queries       The points to test.
+ * @param results       A buffer of _queryCount_ elements to receive whether each point is inside.
+ * @param queryCount    The number of points in _queries_.
+ * @param rule          The rule deciding which regions are inside.
+ *
+ * @return              The number of points inside the polygon.
+ */
+NSUInteger CBHPolygon_containsPoints(const NSPoint *points, NSUInteger count, const NSPoint *queries, BOOL *results, NSUInteger queryCount, CBHPolygonFillRule rule);
+
+NS_ASSUME_NONNULL_END
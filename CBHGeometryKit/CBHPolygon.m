@@ -0,0 +1,220 @@
+//  CBHPolygon.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHPolygon.h"
+
+#import "NSPoint+CBHGeometryKit.h"
+#import "NSRect+CBHGeometryKit.h"
+
+#import "_CBHGeometryKit+Utilities.h"
+#import "_CBHGeometryKit+Vector.h"
+#import "_CBHGeometryKit+Parallel.h"
+
+#import <stdatomic.h>
+
+
+#pragma mark - Measuring Polygons
+
+CGFloat CBHPolygon_signedArea(const NSPoint * const points, const NSUInteger count)
+{
+	if ( count < 3 ) { return 0.0; }
+
+	// The shoelace formula about the first vertex, whose two edges contribute nothing.
+	const NSPoint origin = points[0];
+	CGFloat sum = 0.0;
+
+	for (NSUInteger i = 1; i + 1 < count; ++i)
+	{
+		const NSPoint a = NSPoint_init(points[i].x - origin.x, points[i].y - origin.y);
+		const NSPoint b = NSPoint_init(points[i + 1].x - origin.x, points[i + 1].y - origin.y);
+
+		sum += a.x * b.y - b.x * a.y;
+	}
+
+	return sum * 0.5;
+}
+
+CGFloat CBHPolygon_area(const NSPoint * const points, const NSUInteger count)
+{
+	return fabs(CBHPolygon_signedArea(points, count));
+}
+
+CGFloat CBHPolygon_perimeter(const NSPoint * const points, const NSUInteger count)
+{
+	if ( count < 2 ) { return 0.0; }
+
+	CGFloat perimeter = NSPoint_distance(points[count - 1], points[0]);
+
+	for (NSUInteger i = 1; i < count; ++i)
+	{
+		perimeter += NSPoint_distance(points[i - 1], points[i]);
+	}
+
+	return perimeter;
+}
+
+NSRect CBHPolygon_boundingRect(const NSPoint * const points, const NSUInteger count)
+{
+	return NSRect_boundingRectOfPoints(points, count);
+}
+
+
+#pragma mark - Testing Points
+
+// An edge is crossed when it spans the point's y, including its lower end and excluding its upper one, and meets that
+// line to the right of the point. The vector path evaluates the same expression for every lane, so every lane agrees
+// with the scalar test even though lanes which do not span the point may divide by 0.
+
+NS_INLINE BOOL _CBHPolygon_isCrossing(const NSPoint start, const NSPoint end, const NSPoint point)
+{
+	if ( (start.y > point.y) == (end.y > point.y) ) { return NO; }
+
+	return ( point.x < (end.x - start.x) * (point.y - start.y) / (end.y - start.y) + start.x );
+}
+
+BOOL CBHPolygon_containsPoint(const NSPoint * const points, const NSUInteger count, const NSPoint point, const CBHPolygonFillRule rule)
+{
+	if ( count < 3 ) { return NO; }
+
+	NSInteger winding = 0;
+	NSPoint start = points[count - 1];
+
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		const NSPoint end = points[i];
+
+		if ( _CBHPolygon_isCrossing(start, end, point) )
+		{
+			if ( rule == CBHPolygonFillRuleEvenOdd ) { winding ^= 1; }
+			else { winding += ( end.y > point.y ) ? 1 : -1; }
+		}
+
+		start = end;
+	}
+
+	return ( winding != 0 );
+}
+
+
+typedef struct CBHPolygonQuery
+{
+	const NSPoint *points;
+	NSUInteger count;
+	const NSPoint *queries;
+	BOOL *results;
+	CBHPolygonFillRule rule;
+	_Atomic(NSUInteger) matches;
+} CBHPolygonQuery;
+
+#if CBH_VECTOR
+
+// Tests `CBH_VECTOR_WIDTH` points against every edge, returning a bit per point.
+static unsigned int _CBHPolygon_containsVector(const CBHPolygonQuery * const query, const NSPoint * const queries)
+{
+	double xs[CBH_VECTOR_WIDTH];
+	double ys[CBH_VECTOR_WIDTH];
+
+	for (NSUInteger lane = 0; lane < CBH_VECTOR_WIDTH; ++lane)
+	{
+		xs[lane] = queries[lane].x;
+		ys[lane] = queries[lane].y;
+	}
+
+	const CBHVector x = CBHVector_load(xs);
+	const CBHVector y = CBHVector_load(ys);
+	const CBHVector zero = CBHVector_set(0.0);
+	const CBHVector up = CBHVector_set(1.0);
+	const CBHVector down = CBHVector_set(-1.0);
+
+	CBHVector winding = zero;
+	NSPoint start = query->points[query->count - 1];
+
+	for (NSUInteger i = 0; i < query->count; ++i)
+	{
+		const NSPoint end = query->points[i];
+
+		const CBHVector startX = CBHVector_set(start.x);
+		const CBHVector startY = CBHVector_set(start.y);
+		const CBHVector isEndAbove = CBHVector_isLess(y, CBHVector_set(end.y));
+		const CBHVector isSpanning = CBHVector_xor(CBHVector_isLess(y, startY), isEndAbove);
+
+		CBHVector meet = CBHVector_mul(CBHVector_set(end.x - start.x), CBHVector_sub(y, startY));
+		meet = CBHVector_div(meet, CBHVector_set(end.y - start.y));
+		meet = CBHVector_add(meet, startX);
+
+		const CBHVector isCrossing = CBHVector_and(isSpanning, CBHVector_isLess(x, meet));
+
+		if ( query->rule == CBHPolygonFillRuleEvenOdd ) { winding = CBHVector_xor(winding, isCrossing); }
+		else { winding = CBHVector_add(winding, CBHVector_and(isCrossing, CBHVector_select(isEndAbove, up, down))); }
+
+		start = end;
+	}
+
+	if ( query->rule == CBHPolygonFillRuleEvenOdd ) { return CBHVector_mask(winding); }
+	return CBHVector_mask(CBHVector_or(CBHVector_isLess(winding, zero), CBHVector_isLess(zero, winding)));
+}
+
+#endif
+
+static void _CBHPolygon_containsWorker(void * const context, const NSRange range)
+{
+	CBHPolygonQuery * const query = context;
+	const NSPoint * const queries = query->queries + range.location;
+	BOOL * const results = query->results + range.location;
+	NSUInteger matches = 0;
+	NSUInteger i = 0;
+
+#if CBH_VECTOR
+	for ( ; i + CBH_VECTOR_WIDTH <= range.length; i += CBH_VECTOR_WIDTH )
+	{
+		const unsigned int bits = _CBHPolygon_containsVector(query, queries + i);
+
+		for (NSUInteger lane = 0; lane < CBH_VECTOR_WIDTH; ++lane)
+		{
+			results[i + lane] = ( (bits >> lane) & 1 ) != 0;
+		}
+
+		matches += (NSUInteger)__builtin_popcount(bits);
+	}
+#endif
+
+	for ( ; i < range.length; ++i )
+	{
+		results[i] = CBHPolygon_containsPoint(query->points, query->count, queries[i], query->rule);
+		matches += ( results[i] ) ? 1 : 0;
+	}
+
+	atomic_fetch_add_explicit(&query->matches, matches, memory_order_relaxed);
+}
+
+NSUInteger CBHPolygon_containsPoints(const NSPoint * const points, const NSUInteger count, const NSPoint * const queries, BOOL * const results, const NSUInteger queryCount, const CBHPolygonFillRule rule)
+{
+	if ( count < 3 )
+	{
+		for (NSUInteger i = 0; i < queryCount; ++i) { results[i] = NO; }
+		return 0;
+	}
+
+	CBHPolygonQuery query = { .points = points, .count = count, .queries = queries, .results = results, .rule = rule };
+	atomic_init(&query.matches, 0);
+
+	// Each point costs a pass over every edge, so the grain is measured in edge tests.
+	CBHParallel_applyWithGrainSize(queryCount, CBHParallel_grainSizeForUnit(count), &query, _CBHPolygon_containsWorker);
+
+	return atomic_load_explicit(&query.matches, memory_order_relaxed);
+}
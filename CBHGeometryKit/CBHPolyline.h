@@ -0,0 +1,85 @@
+//  CBHPolyline.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Functions for open polylines stored as C arrays of `NSPoint` vertices, such as recorded tracks and strokes.
+ *
+ * The simplification functions work in place: they move the vertices they keep to the front of the array, in their
+ * original order, and return how many there are. The first and last vertices are always kept.
+ */
+
+
+#pragma mark - Measuring Polylines
+
+/**
+ * @name Measuring Polylines
+ */
+
+/** Calculates the length of a polyline.
+ *
+ * @param points        The vertices of the polyline.
+ * @param count         The number of vertices in _points_.
+ *
+ * @return              The sum of `NSPoint_distance()` between consecutive vertices, or 0 for fewer than 2 vertices.
+ */
+CGFloat CBHPolyline_length(const NSPoint *points, NSUInteger count);
+
+
+#pragma mark - Simplifying Polylines
+
+/**
+ * @name Simplifying Polylines
+ */
+
+/** Simplifies a polyline with the Ramer–Douglas–Peucker algorithm.
+ *
+ * Each span between kept vertices is split at the vertex farthest from the segment joining its ends for as long as
+ * that vertex is farther than _tolerance_, so no removed vertex lies farther than _tolerance_ from the result.
+ * Distances are measured to the nearest point on the segment.
+ *
+ * @param points        The vertices of the polyline, which are replaced by the kept vertices.
+ * @param count         The number of vertices in _points_.
+ * @param tolerance     The greatest distance a removed vertex may lie from the result.
+ *
+ * @return              The number of vertices kept, or `NSNotFound` if the working storage could not be allocated, in
+ *                      which case _points_ is unchanged.
+ */
+NSUInteger CBHPolyline_simplifyDouglasPeucker(NSPoint *points, NSUInteger count, CGFloat tolerance);
+
+/** Simplifies a polyline with the Visvalingam–Whyatt algorithm.
+ *
+ * Vertices are removed one at a time, smallest first, by the area of the triangle they form with their neighbours. A
+ * vertex's effective area is never less than that of a vertex removed before it, so the result is the same as removing
+ * vertices in order of importance until the least important one left is at least _minimumArea_. This tends to keep
+ * the shape of gentle curves better than `CBHPolyline_simplifyDouglasPeucker()`.
+ *
+ * @param points        The vertices of the polyline, which are replaced by the kept vertices.
+ * @param count         The number of vertices in _points_.
+ * @param minimumArea   The smallest effective area a vertex must have to be kept.
+ *
+ * @return              The number of vertices kept, or `NSNotFound` if the working storage could not be allocated, in
+ *                      which case _points_ is unchanged.
+ */
+NSUInteger CBHPolyline_simplifyVisvalingam(NSPoint *points, NSUInteger count, CGFloat minimumArea);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,297 @@
+//  CBHPolyline.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHPolyline.h"
+
+#import "NSPoint+CBHGeometryKit.h"
+
+#import "_CBHGeometryKit+Utilities.h"
+
+#import <stdlib.h>
+
+
+#pragma mark - Measuring Polylines
+
+CGFloat CBHPolyline_length(const NSPoint * const points, const NSUInteger count)
+{
+	CGFloat length = 0.0;
+
+	for (NSUInteger i = 1; i < count; ++i)
+	{
+		length += NSPoint_distance(points[i - 1], points[i]);
+	}
+
+	return length;
+}
+
+
+#pragma mark - Simplifying Polylines
+
+// Moves the vertices marked in `keep` to the front of `points`, returning how many there are.
+static NSUInteger _CBHPolyline_compact(NSPoint * const points, const NSUInteger count, const uint8_t * const keep)
+{
+	NSUInteger kept = 0;
+
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		if ( keep[i] ) { points[kept++] = points[i]; }
+	}
+
+	return kept;
+}
+
+
+#pragma mark Douglas–Peucker
+
+// The squared distance from `point` to the nearest point on the segment from `start` to `end`.
+NS_INLINE CGFloat _CBHPolyline_segmentDistanceSquared(const NSPoint point, const NSPoint start, const NSPoint end)
+{
+	const CGFloat dx = end.x - start.x;
+	const CGFloat dy = end.y - start.y;
+	const CGFloat lengthSquared = dx * dx + dy * dy;
+
+	if ( lengthSquared <= 0.0 ) { return NSPoint_distanceSquared(point, start); }
+
+	const CGFloat t = MIN(MAX(((point.x - start.x) * dx + (point.y - start.y) * dy) / lengthSquared, 0.0), 1.0);
+
+	return NSPoint_distanceSquared(point, NSPoint_init(start.x + t * dx, start.y + t * dy));
+}
+
+NSUInteger CBHPolyline_simplifyDouglasPeucker(NSPoint * const points, const NSUInteger count, const CGFloat tolerance)
+{
+	if ( count <= 2 ) { return count; }
+
+	// Spans waiting to be split are kept on an explicit stack so long tracks cannot exhaust the call stack. Every span
+	// on it ends at a distinct vertex, so it never holds more than `count` of them.
+	uint8_t * const keep = calloc(count, sizeof(uint8_t));
+	NSRange * const stack = malloc(count * sizeof(NSRange));
+
+	if ( !keep || !stack )
+	{
+		free(keep);
+		free(stack);
+		return NSNotFound;
+	}
+
+	const CGFloat limit = MAX(tolerance, 0.0) * MAX(tolerance, 0.0);
+	NSUInteger depth = 0;
+
+	keep[0] = 1;
+	keep[count - 1] = 1;
+	stack[depth++] = NSMakeRange(0, count - 1);
+
+	while ( depth > 0 )
+	{
+		const NSRange span = stack[--depth];
+		const NSUInteger first = span.location;
+		const NSUInteger last = span.location + span.length;
+
+		CGFloat farthest = limit;
+		NSUInteger split = NSNotFound;
+
+		for (NSUInteger i = first + 1; i < last; ++i)
+		{
+			const CGFloat distance = _CBHPolyline_segmentDistanceSquared(points[i], points[first], points[last]);
+			if ( distance > farthest )
+			{
+				farthest = distance;
+				split = i;
+			}
+		}
+
+		if ( split == NSNotFound ) { continue; }
+
+		keep[split] = 1;
+		if ( last - split > 1 ) { stack[depth++] = NSMakeRange(split, last - split); }
+		if ( split - first > 1 ) { stack[depth++] = NSMakeRange(first, split - first); }
+	}
+
+	const NSUInteger kept = _CBHPolyline_compact(points, count, keep);
+
+	free(keep);
+	free(stack);
+
+	return kept;
+}
+
+
+#pragma mark Visvalingam–Whyatt
+
+// A binary min-heap of interior vertices ordered by area, then by index so equal areas are removed deterministically.
+typedef struct CBHPolylineHeap
+{
+	NSUInteger *vertices;
+	NSUInteger *positions;
+	CGFloat *areas;
+	NSUInteger count;
+} CBHPolylineHeap;
+
+NS_INLINE BOOL _CBHPolylineHeap_isBefore(const CBHPolylineHeap * const heap, const NSUInteger a, const NSUInteger b)
+{
+	const CGFloat areaA = heap->areas[a];
+	const CGFloat areaB = heap->areas[b];
+
+	return ( areaA < areaB || (areaA == areaB && a < b) );
+}
+
+NS_INLINE void _CBHPolylineHeap_place(CBHPolylineHeap * const heap, const NSUInteger position, const NSUInteger vertex)
+{
+	heap->vertices[position] = vertex;
+	heap->positions[vertex] = position;
+}
+
+static void _CBHPolylineHeap_siftUp(CBHPolylineHeap * const heap, NSUInteger position)
+{
+	const NSUInteger vertex = heap->vertices[position];
+
+	while ( position > 0 )
+	{
+		const NSUInteger parent = (position - 1) / 2;
+		if ( !_CBHPolylineHeap_isBefore(heap, vertex, heap->vertices[parent]) ) { break; }
+
+		_CBHPolylineHeap_place(heap, position, heap->vertices[parent]);
+		position = parent;
+	}
+
+	_CBHPolylineHeap_place(heap, position, vertex);
+}
+
+static void _CBHPolylineHeap_siftDown(CBHPolylineHeap * const heap, NSUInteger position)
+{
+	const NSUInteger vertex = heap->vertices[position];
+
+	while ( YES )
+	{
+		NSUInteger child = position * 2 + 1;
+		if ( child >= heap->count ) { break; }
+
+		if ( child + 1 < heap->count && _CBHPolylineHeap_isBefore(heap, heap->vertices[child + 1], heap->vertices[child]) ) { ++child; }
+		if ( !_CBHPolylineHeap_isBefore(heap, heap->vertices[child], vertex) ) { break; }
+
+		_CBHPolylineHeap_place(heap, position, heap->vertices[child]);
+		position = child;
+	}
+
+	_CBHPolylineHeap_place(heap, position, vertex);
+}
+
+static void _CBHPolylineHeap_pop(CBHPolylineHeap * const heap)
+{
+	if ( --heap->count > 0 )
+	{
+		_CBHPolylineHeap_place(heap, 0, heap->vertices[heap->count]);
+		_CBHPolylineHeap_siftDown(heap, 0);
+	}
+}
+
+static void _CBHPolylineHeap_update(CBHPolylineHeap * const heap, const NSUInteger vertex, const CGFloat area)
+{
+	const CGFloat previous = heap->areas[vertex];
+	heap->areas[vertex] = area;
+
+	if ( area < previous ) { _CBHPolylineHeap_siftUp(heap, heap->positions[vertex]); }
+	else { _CBHPolylineHeap_siftDown(heap, heap->positions[vertex]); }
+}
+
+NS_INLINE CGFloat _CBHPolyline_triangleArea(const NSPoint a, const NSPoint b, const NSPoint c)
+{
+	return fabs((b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y)) * 0.5;
+}
+
+NSUInteger CBHPolyline_simplifyVisvalingam(NSPoint * const points, const NSUInteger count, const CGFloat minimumArea)
+{
+	if ( count <= 2 ) { return count; }
+
+	// Removed vertices are unlinked from a doubly linked list over the indexes, so each removal only revisits the two
+	// neighbours it leaves behind.
+	NSUInteger * const links = malloc(count * 2 * sizeof(NSUInteger));
+	NSUInteger * const slots = malloc(count * 2 * sizeof(NSUInteger));
+	CGFloat * const areas = malloc(count * sizeof(CGFloat));
+	uint8_t * const keep = malloc(count * sizeof(uint8_t));
+
+	if ( !links || !slots || !areas || !keep )
+	{
+		free(links);
+		free(slots);
+		free(areas);
+		free(keep);
+		return NSNotFound;
+	}
+
+	NSUInteger * const previous = links;
+	NSUInteger * const next = links + count;
+	CBHPolylineHeap heap = { .vertices = slots, .positions = slots + count, .areas = areas, .count = 0 };
+
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		previous[i] = i - 1;
+		next[i] = i + 1;
+		keep[i] = 1;
+	}
+
+	// The heap is built bottom-up once every interior vertex has its area.
+	for (NSUInteger i = 1; i + 1 < count; ++i)
+	{
+		areas[i] = _CBHPolyline_triangleArea(points[i - 1], points[i], points[i + 1]);
+		_CBHPolylineHeap_place(&heap, heap.count, i);
+		++heap.count;
+	}
+
+	for (NSUInteger position = heap.count / 2; position-- > 0; )
+	{
+		_CBHPolylineHeap_siftDown(&heap, position);
+	}
+
+	CGFloat effective = 0.0;
+
+	while ( heap.count > 0 )
+	{
+		const NSUInteger vertex = heap.vertices[0];
+
+		effective = MAX(effective, areas[vertex]);
+		if ( effective >= minimumArea ) { break; }
+
+		_CBHPolylineHeap_pop(&heap);
+		keep[vertex] = 0;
+
+		const NSUInteger before = previous[vertex];
+		const NSUInteger after = next[vertex];
+
+		next[before] = after;
+		previous[after] = before;
+
+		if ( before > 0 )
+		{
+			_CBHPolylineHeap_update(&heap, before, _CBHPolyline_triangleArea(points[previous[before]], points[before], points[after]));
+		}
+
+		if ( after < count - 1 )
+		{
+			_CBHPolylineHeap_update(&heap, after, _CBHPolyline_triangleArea(points[before], points[after], points[next[after]]));
+		}
+	}
+
+	const NSUInteger kept = _CBHPolyline_compact(points, count, keep);
+
+	free(links);
+	free(slots);
+	free(areas);
+	free(keep);
+
+	return kept;
+}
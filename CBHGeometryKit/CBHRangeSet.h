@@ -0,0 +1,281 @@
+//  CBHRangeSet.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** A set of locations stored as sorted, disjoint ranges.
+ *
+ * Ranges which overlap or touch are merged as they are added, so a set never holds two ranges where one would do and
+ * two sets holding the same locations hold the same ranges.
+ *
+ * Ranges are kept in fixed size blocks under a sorted directory. Lookups binary search the directory and then a block,
+ * and adding or removing a range moves at most one block's worth of ranges. The combining functions walk both sets once
+ * and run in time linear to their range counts.
+ *
+ * Ranges must not extend past `NSUIntegerMax`.
+ */
+typedef struct CBHRangeSet CBHRangeSet;
+
+/** A cursor over the ranges of a set, in ascending order.
+ *
+ * The set must not be modified while it is being iterated.
+ */
+typedef struct CBHRangeSetIterator
+{
+	const CBHRangeSet *set;
+	NSUInteger block;
+	NSUInteger index;
+} CBHRangeSetIterator;
+
+
+#pragma mark - Creating Range Sets
+
+/**
+ * @name Creating Range Sets
+ */
+
+/** Creates an empty range set.
+ *
+ * @return              A new set, or `NULL` if the storage could not be allocated. Release it with `CBHRangeSet_destroy()`.
+ */
+CBHRangeSet * _Nullable CBHRangeSet_create(void);
+
+/** Creates a range set holding the locations of a range.
+ *
+ * @param range         The range to add.
+ *
+ * @return              A new set, or `NULL` if the storage could not be allocated. Release it with `CBHRangeSet_destroy()`.
+ */
+CBHRangeSet * _Nullable CBHRangeSet_createWithRange(NSRange range);
+
+/** Creates a copy of a range set.
+ *
+ * @param set           The set to copy.
+ *
+ * @return              A new set, or `NULL` if the storage could not be allocated. Release it with `CBHRangeSet_destroy()`.
+ */
+CBHRangeSet * _Nullable CBHRangeSet_copy(const CBHRangeSet *set);
+
+/** Releases a range set.
+ *
+ * @param set           The set to release.
+ */
+void CBHRangeSet_destroy(CBHRangeSet * _Nullable set);
+
+
+#pragma mark - Properties
+
+/**
+ * @name Properties
+ */
+
+/** Indicates whether the set is empty.
+ *
+ * @param set           The set.
+ *
+ * @return              A `BOOL` value that indicates if the set holds no locations.
+ */
+BOOL CBHRangeSet_isEmpty(const CBHRangeSet *set);
+
+/** The number of locations in the set.
+ *
+ * @param set           The set.
+ *
+ * @return              The sum of the lengths of the ranges.
+ */
+NSUInteger CBHRangeSet_count(const CBHRangeSet *set);
+
+/** The number of disjoint ranges making up the set.
+ *
+ * @param set           The set.
+ *
+ * @return              The number of ranges.
+ */
+NSUInteger CBHRangeSet_rangeCount(const CBHRangeSet *set);
+
+/** The smallest range covering the set.
+ *
+ * @param set           The set.
+ *
+ * @return              A range from the first location to the end of the last range, or an empty range at 0 if the set is empty.
+ */
+NSRange CBHRangeSet_bounds(const CBHRangeSet *set);
+
+/** Indicates whether two sets hold the same locations.
+ *
+ * @param set           A set to compare.
+ * @param other         A set to compare against.
+ *
+ * @return              A `BOOL` value that indicates if the two sets are identical.
+ */
+BOOL CBHRangeSet_isEqual(const CBHRangeSet *set, const CBHRangeSet *other);
+
+
+#pragma mark - Modifying Range Sets
+
+/**
+ * @name Modifying Range Sets
+ *
+ * On failure these functions return `NO` and leave the set unchanged.
+ */
+
+/** Adds the locations of a range to a set.
+ *
+ * @param set           The set to modify.
+ * @param range         The range to add.
+ *
+ * @return              `YES` on success, or `NO` if the storage could not be allocated.
+ */
+BOOL CBHRangeSet_addRange(CBHRangeSet *set, NSRange range);
+
+/** Removes the locations of a range from a set.
+ *
+ * @param set           The set to modify.
+ * @param range         The range to remove.
+ *
+ * @return              `YES` on success, or `NO` if the storage could not be allocated.
+ */
+BOOL CBHRangeSet_removeRange(CBHRangeSet *set, NSRange range);
+
+/** Removes every location from a set.
+ *
+ * @param set           The set to empty.
+ */
+void CBHRangeSet_removeAll(CBHRangeSet *set);
+
+
+#pragma mark - Combining Range Sets
+
+/**
+ * @name Combining Range Sets
+ *
+ * These functions write their result to _result_, which may be the same set as either operand. On failure they return
+ * `NO` and leave _result_ unchanged.
+ */
+
+/** Calculates the union of two sets.
+ *
+ * @param result        The set to receive the result.
+ * @param set           A set.
+ * @param other         Another set.
+ *
+ * @return              `YES` on success, or `NO` if the storage could not be allocated.
+ */
+BOOL CBHRangeSet_union(CBHRangeSet *result, const CBHRangeSet *set, const CBHRangeSet *other);
+
+/** Calculates the intersection of two sets.
+ *
+ * @param result        The set to receive the result.
+ * @param set           A set.
+ * @param other         Another set.
+ *
+ * @return              `YES` on success, or `NO` if the storage could not be allocated.
+ */
+BOOL CBHRangeSet_intersection(CBHRangeSet *result, const CBHRangeSet *set, const CBHRangeSet *other);
+
+/** Calculates the locations of a set not in another.
+ *
+ * @param result        The set to receive the result.
+ * @param set           The set to subtract from.
+ * @param other         The set to subtract.
+ *
+ * @return              `YES` on success, or `NO` if the storage could not be allocated.
+ */
+BOOL CBHRangeSet_subtract(CBHRangeSet *result, const CBHRangeSet *set, const CBHRangeSet *other);
+
+
+#pragma mark - Checking Range Sets
+
+/**
+ * @name Checking Range Sets
+ */
+
+/** Indicates whether a location is in a set.
+ *
+ * @param set           A set.
+ * @param location      A location.
+ *
+ * @return              A `BOOL` value that indicates if `NSRange_isLocationInRange()` is `YES` for one of the ranges of _set_.
+ */
+BOOL CBHRangeSet_isLocationInSet(const CBHRangeSet *set, NSUInteger location);
+
+/** Indicates whether a set holds any location of a range.
+ *
+ * @param set           A set.
+ * @param range         A range.
+ *
+ * @return              A `BOOL` value that indicates if _set_ and _range_ share a location.
+ */
+BOOL CBHRangeSet_isIntersectingRange(const CBHRangeSet *set, NSRange range);
+
+/** Indicates whether a set holds every location of a range.
+ *
+ * @param set           The covering set.
+ * @param range         The covered range.
+ *
+ * @return              A `BOOL` value that indicates if _range_ is not empty and lies entirely within _set_.
+ */
+BOOL CBHRangeSet_isCoveringRange(const CBHRangeSet *set, NSRange range);
+
+
+#pragma mark - Iterating Ranges
+
+/**
+ * @name Iterating Ranges
+ */
+
+/** Creates an iterator over the ranges of a set.
+ *
+ * @param set           The set to iterate.
+ *
+ * @return              An iterator positioned before the first range.
+ */
+CBHRangeSetIterator CBHRangeSetIterator_init(const CBHRangeSet *set);
+
+/** Creates an iterator over the ranges of a set ending after a location.
+ *
+ * @param set           The set to iterate.
+ * @param location      The location to start from. The first range returned may begin before it.
+ *
+ * @return              An iterator positioned before the first range which holds _location_ or lies after it.
+ */
+CBHRangeSetIterator CBHRangeSetIterator_initWithLocation(const CBHRangeSet *set, NSUInteger location);
+
+/** Advances an iterator to the next range.
+ *
+ * @param iterator      The iterator.
+ * @param range         Receives the next range.
+ *
+ * @return              `YES` if a range was written to _range_, or `NO` if the iterator is exhausted.
+ */
+BOOL CBHRangeSetIterator_next(CBHRangeSetIterator *iterator, NSRange *range);
+
+/** Copies the ranges of a set into a buffer.
+ *
+ * @param set           The set.
+ * @param ranges        A buffer to receive the ranges, in ascending order.
+ * @param capacity      The number of elements _ranges_ can hold.
+ *
+ * @return              The number of ranges in the set, which may exceed _capacity_.
+ */
+NSUInteger CBHRangeSet_getRanges(const CBHRangeSet *set, NSRange * _Nullable ranges, NSUInteger capacity);
+
+NS_ASSUME_NONNULL_END
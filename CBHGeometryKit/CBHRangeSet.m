@@ -0,0 +1,702 @@
+//  CBHRangeSet.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHRangeSet.h"
+
+#import "NSRange+CBHGeometryKit.h"
+
+#import "_CBHGeometryKit+Utilities.h"
+
+#import <stdlib.h>
+#import <string.h>
+
+
+// The number of ranges a block holds. A full block is split in half to make room.
+enum { kCBHRangeSetBlockCapacity = 128 };
+
+
+typedef struct CBHRangeSetBlock
+{
+	NSUInteger count;
+	NSRange ranges[kCBHRangeSetBlockCapacity];
+} CBHRangeSetBlock;
+
+// A position is a block and an index within it. The position after the last range is `{ blockCount, 0 }`.
+typedef struct CBHRangeSetPosition
+{
+	NSUInteger block;
+	NSUInteger index;
+} CBHRangeSetPosition;
+
+
+// Every block holds at least one range, and `firsts` mirrors the location of the first range of each block so the
+// directory can be searched without touching the blocks. Ranges are sorted and separated by at least one location.
+//
+// A spare block is kept so that a modification never has to allocate after it has started changing the set.
+struct CBHRangeSet
+{
+	CBHRangeSetBlock * _Nonnull * _Nullable blocks;
+	NSUInteger * _Nullable firsts;
+	NSUInteger blockCount;
+	NSUInteger blockCapacity;
+
+	CBHRangeSetBlock * _Nullable spare;
+
+	NSUInteger rangeCount;
+	NSUInteger count;
+};
+
+
+#pragma mark - Storage
+
+static BOOL _CBHRangeSet_reserveBlocks(CBHRangeSet * const set, const NSUInteger capacity)
+{
+	if ( capacity <= set->blockCapacity ) { return YES; }
+
+	const NSUInteger newCapacity = MAX(capacity, set->blockCapacity * 2);
+	if ( newCapacity > NSUIntegerMax / sizeof(NSUInteger) ) { return NO; }
+
+	CBHRangeSetBlock ** const blocks = realloc(set->blocks, sizeof(CBHRangeSetBlock *) * newCapacity);
+	if ( blocks == NULL ) { return NO; }
+	set->blocks = blocks;
+
+	NSUInteger * const firsts = realloc(set->firsts, sizeof(NSUInteger) * newCapacity);
+	if ( firsts == NULL ) { return NO; }
+	set->firsts = firsts;
+
+	set->blockCapacity = newCapacity;
+
+	return YES;
+}
+
+static BOOL _CBHRangeSet_reserveSpare(CBHRangeSet * const set)
+{
+	if ( set->spare == NULL ) { set->spare = malloc(sizeof(CBHRangeSetBlock)); }
+
+	return ( set->spare != NULL ) && _CBHRangeSet_reserveBlocks(set, set->blockCount + 1);
+}
+
+// Inserts the spare block into the directory. The spare and a directory entry must have been reserved.
+static CBHRangeSetBlock *_CBHRangeSet_insertSpare(CBHRangeSet * const set, const NSUInteger index)
+{
+	CBHRangeSetBlock * const block = set->spare;
+	set->spare = NULL;
+	block->count = 0;
+
+	memmove(set->blocks + index + 1, set->blocks + index, sizeof(CBHRangeSetBlock *) * (set->blockCount - index));
+	memmove(set->firsts + index + 1, set->firsts + index, sizeof(NSUInteger) * (set->blockCount - index));
+	set->blocks[index] = block;
+	set->blockCount += 1;
+
+	return block;
+}
+
+static void _CBHRangeSet_removeBlocks(CBHRangeSet * const set, const NSUInteger index, const NSUInteger count)
+{
+	if ( count == 0 ) { return; }
+
+	for (NSUInteger i = index; i < index + count; ++i)
+	{
+		if ( set->spare == NULL ) { set->spare = set->blocks[i]; }
+		else { free(set->blocks[i]); }
+	}
+
+	memmove(set->blocks + index, set->blocks + index + count, sizeof(CBHRangeSetBlock *) * (set->blockCount - index - count));
+	memmove(set->firsts + index, set->firsts + index + count, sizeof(NSUInteger) * (set->blockCount - index - count));
+	set->blockCount -= count;
+}
+
+// Moves the storage of `source` into `set`, releasing what `set` held before.
+static void _CBHRangeSet_move(CBHRangeSet * const set, CBHRangeSet * const source)
+{
+	CBHRangeSet_removeAll(set);
+	free(set->blocks);
+	free(set->firsts);
+	free(set->spare);
+
+	*set = *source;
+	*source = (CBHRangeSet){ .blocks = NULL, .firsts = NULL, .spare = NULL };
+}
+
+
+#pragma mark - Positions
+
+NS_INLINE NSRange _CBHRangeSet_rangeAtPosition(const CBHRangeSet * const set, const CBHRangeSetPosition position)
+{
+	return set->blocks[position.block]->ranges[position.index];
+}
+
+NS_INLINE BOOL _CBHRangeSet_isPositionValid(const CBHRangeSet * const set, const CBHRangeSetPosition position)
+{
+	return ( position.block < set->blockCount );
+}
+
+NS_INLINE CBHRangeSetPosition _CBHRangeSet_nextPosition(const CBHRangeSet * const set, const CBHRangeSetPosition position)
+{
+	if ( position.index + 1 < set->blocks[position.block]->count )
+	{
+		return (CBHRangeSetPosition){ .block = position.block, .index = position.index + 1 };
+	}
+
+	return (CBHRangeSetPosition){ .block = position.block + 1, .index = 0 };
+}
+
+NS_INLINE BOOL _CBHRangeSet_isPositionEqual(const CBHRangeSetPosition position, const CBHRangeSetPosition other)
+{
+	return ( position.block == other.block ) && ( position.index == other.index );
+}
+
+// The position of the first range ending at or after `location`, which is the first range that could hold or touch it.
+static CBHRangeSetPosition _CBHRangeSet_lowerBound(const CBHRangeSet * const set, const NSUInteger location)
+{
+	if ( set->blockCount == 0 ) { return (CBHRangeSetPosition){ .block = 0, .index = 0 }; }
+
+	// Ranges in blocks before the last block starting at or before `location` all end before it.
+	NSUInteger low = 0;
+	NSUInteger high = set->blockCount;
+	while ( low < high )
+	{
+		const NSUInteger middle = low + (high - low) / 2;
+		if ( set->firsts[middle] <= location ) { low = middle + 1; }
+		else { high = middle; }
+	}
+
+	const NSUInteger block = ( low > 0 ) ? low - 1 : 0;
+	const NSRange * const ranges = set->blocks[block]->ranges;
+
+	low = 0;
+	high = set->blocks[block]->count;
+	while ( low < high )
+	{
+		const NSUInteger middle = low + (high - low) / 2;
+		if ( NSMaxRange(ranges[middle]) < location ) { low = middle + 1; }
+		else { high = middle; }
+	}
+
+	if ( low >= set->blocks[block]->count ) { return (CBHRangeSetPosition){ .block = block + 1, .index = 0 }; }
+
+	return (CBHRangeSetPosition){ .block = block, .index = low };
+}
+
+
+#pragma mark - Modifying
+
+// Replaces the ranges in `[from, to)` with up to two ranges which must fit in the gap they leave.
+static BOOL _CBHRangeSet_replace(CBHRangeSet * const set, CBHRangeSetPosition from, CBHRangeSetPosition to, const NSRange * const ranges, const NSUInteger count)
+{
+	NSUInteger removedRanges = 0;
+	NSUInteger removedLength = 0;
+	for (CBHRangeSetPosition position = from; !_CBHRangeSet_isPositionEqual(position, to); position = _CBHRangeSet_nextPosition(set, position))
+	{
+		removedRanges += 1;
+		removedLength += _CBHRangeSet_rangeAtPosition(set, position).length;
+	}
+
+	// Even when fewer ranges are inserted than removed, they may all land in a full block and split it.
+	if ( count > 0 && !_CBHRangeSet_reserveSpare(set) ) { return NO; }
+
+	set->rangeCount = set->rangeCount - removedRanges + count;
+	set->count -= removedLength;
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		set->count += ranges[i].length;
+	}
+
+	if ( set->blockCount == 0 )
+	{
+		CBHRangeSetBlock * const block = _CBHRangeSet_insertSpare(set, 0);
+		memcpy(block->ranges, ranges, sizeof(NSRange) * count);
+		block->count = count;
+		set->firsts[0] = ranges[0].location;
+		return YES;
+	}
+
+	// Positions past the end of a block are moved back onto it, so `from` and `to` are on the blocks they edit.
+	if ( from.block >= set->blockCount ) { from = (CBHRangeSetPosition){ .block = set->blockCount - 1, .index = set->blocks[set->blockCount - 1]->count }; }
+	if ( to.index == 0 && to.block > from.block ) { to = (CBHRangeSetPosition){ .block = to.block - 1, .index = set->blocks[to.block - 1]->count }; }
+
+	// Across blocks, trim both ends, drop the blocks between, and insert at the end of the first.
+	if ( from.block < to.block )
+	{
+		CBHRangeSetBlock * const last = set->blocks[to.block];
+		last->count -= to.index;
+		memmove(last->ranges, last->ranges + to.index, sizeof(NSRange) * last->count);
+
+		set->blocks[from.block]->count = from.index;
+		_CBHRangeSet_removeBlocks(set, from.block + 1, to.block - from.block - 1);
+
+		if ( last->count == 0 ) { _CBHRangeSet_removeBlocks(set, from.block + 1, 1); }
+		else { set->firsts[from.block + 1] = last->ranges[0].location; }
+
+		to = from;
+	}
+
+	NSUInteger blockIndex = from.block;
+	CBHRangeSetBlock *block = set->blocks[blockIndex];
+	NSUInteger index = from.index;
+
+	block->count -= to.index - from.index;
+	memmove(block->ranges + from.index, block->ranges + to.index, sizeof(NSRange) * (block->count - from.index));
+
+	if ( block->count + count > kCBHRangeSetBlockCapacity )
+	{
+		const NSUInteger middle = block->count / 2;
+		CBHRangeSetBlock * const upper = _CBHRangeSet_insertSpare(set, blockIndex + 1);
+
+		upper->count = block->count - middle;
+		memcpy(upper->ranges, block->ranges + middle, sizeof(NSRange) * upper->count);
+		block->count = middle;
+		set->firsts[blockIndex + 1] = upper->ranges[0].location;
+
+		if ( index > middle )
+		{
+			blockIndex += 1;
+			block = upper;
+			index -= middle;
+		}
+	}
+
+	memmove(block->ranges + index + count, block->ranges + index, sizeof(NSRange) * (block->count - index));
+	memcpy(block->ranges + index, ranges, sizeof(NSRange) * count);
+	block->count += count;
+
+	if ( block->count == 0 ) { _CBHRangeSet_removeBlocks(set, blockIndex, 1); }
+	else { set->firsts[blockIndex] = block->ranges[0].location; }
+
+	return YES;
+}
+
+// Appends a range starting at or after the start of the last range, merging it with the last range if they meet.
+static BOOL _CBHRangeSet_append(CBHRangeSet * const set, const NSRange range)
+{
+	if ( set->blockCount > 0 )
+	{
+		CBHRangeSetBlock * const block = set->blocks[set->blockCount - 1];
+		NSRange * const last = block->ranges + (block->count - 1);
+
+		if ( range.location <= NSMaxRange(*last) )
+		{
+			const NSUInteger end = MAX(NSMaxRange(*last), NSMaxRange(range));
+			set->count += end - NSMaxRange(*last);
+			last->length = end - last->location;
+			return YES;
+		}
+
+		if ( block->count < kCBHRangeSetBlockCapacity )
+		{
+			block->ranges[block->count++] = range;
+			set->rangeCount += 1;
+			set->count += range.length;
+			return YES;
+		}
+	}
+
+	if ( !_CBHRangeSet_reserveSpare(set) ) { return NO; }
+
+	CBHRangeSetBlock * const block = _CBHRangeSet_insertSpare(set, set->blockCount);
+	block->ranges[0] = range;
+	block->count = 1;
+	set->firsts[set->blockCount - 1] = range.location;
+	set->rangeCount += 1;
+	set->count += range.length;
+
+	return YES;
+}
+
+
+#pragma mark - Creating Range Sets
+
+CBHRangeSet *CBHRangeSet_create(void)
+{
+	return calloc(1, sizeof(CBHRangeSet));
+}
+
+CBHRangeSet *CBHRangeSet_createWithRange(const NSRange range)
+{
+	CBHRangeSet * const set = CBHRangeSet_create();
+	if ( set == NULL ) { return NULL; }
+
+	if ( !CBHRangeSet_addRange(set, range) )
+	{
+		CBHRangeSet_destroy(set);
+		return NULL;
+	}
+
+	return set;
+}
+
+CBHRangeSet *CBHRangeSet_copy(const CBHRangeSet * const set)
+{
+	CBHRangeSet * const copy = CBHRangeSet_create();
+	if ( copy == NULL ) { return NULL; }
+
+	if ( !_CBHRangeSet_reserveBlocks(copy, set->blockCount) )
+	{
+		CBHRangeSet_destroy(copy);
+		return NULL;
+	}
+
+	for (NSUInteger i = 0; i < set->blockCount; ++i)
+	{
+		CBHRangeSetBlock * const block = malloc(sizeof(CBHRangeSetBlock));
+		if ( block == NULL )
+		{
+			CBHRangeSet_destroy(copy);
+			return NULL;
+		}
+
+		block->count = set->blocks[i]->count;
+		memcpy(block->ranges, set->blocks[i]->ranges, sizeof(NSRange) * block->count);
+
+		copy->blocks[i] = block;
+		copy->firsts[i] = set->firsts[i];
+		copy->blockCount += 1;
+	}
+
+	copy->rangeCount = set->rangeCount;
+	copy->count = set->count;
+
+	return copy;
+}
+
+void CBHRangeSet_destroy(CBHRangeSet * const set)
+{
+	if ( set == NULL ) { return; }
+
+	for (NSUInteger i = 0; i < set->blockCount; ++i)
+	{
+		free(set->blocks[i]);
+	}
+
+	free(set->blocks);
+	free(set->firsts);
+	free(set->spare);
+	free(set);
+}
+
+
+#pragma mark - Properties
+
+BOOL CBHRangeSet_isEmpty(const CBHRangeSet * const set)
+{
+	return ( set->rangeCount == 0 );
+}
+
+NSUInteger CBHRangeSet_count(const CBHRangeSet * const set)
+{
+	return set->count;
+}
+
+NSUInteger CBHRangeSet_rangeCount(const CBHRangeSet * const set)
+{
+	return set->rangeCount;
+}
+
+NSRange CBHRangeSet_bounds(const CBHRangeSet * const set)
+{
+	if ( set->blockCount == 0 ) { return NSRange_initEmpty(); }
+
+	const CBHRangeSetBlock * const last = set->blocks[set->blockCount - 1];
+
+	return NSRange_initFromTo(set->firsts[0], NSMaxRange(last->ranges[last->count - 1]));
+}
+
+BOOL CBHRangeSet_isEqual(const CBHRangeSet * const set, const CBHRangeSet * const other)
+{
+	if ( set == other ) { return YES; }
+	if ( set->rangeCount != other->rangeCount || set->count != other->count ) { return NO; }
+
+	CBHRangeSetIterator iterator = CBHRangeSetIterator_init(set);
+	CBHRangeSetIterator otherIterator = CBHRangeSetIterator_init(other);
+	NSRange range;
+	NSRange otherRange;
+
+	while ( CBHRangeSetIterator_next(&iterator, &range) && CBHRangeSetIterator_next(&otherIterator, &otherRange) )
+	{
+		if ( !NSEqualRanges(range, otherRange) ) { return NO; }
+	}
+
+	return YES;
+}
+
+
+#pragma mark - Modifying Range Sets
+
+BOOL CBHRangeSet_addRange(CBHRangeSet * const set, const NSRange range)
+{
+	if ( range.length == 0 ) { return YES; }
+
+	NSUInteger start = range.location;
+	NSUInteger end = NSMaxRange(range);
+
+	const CBHRangeSetPosition from = _CBHRangeSet_lowerBound(set, start);
+	CBHRangeSetPosition to = from;
+
+	// Every range from here starting at or before the end overlaps or touches the new range.
+	while ( _CBHRangeSet_isPositionValid(set, to) )
+	{
+		const NSRange existing = _CBHRangeSet_rangeAtPosition(set, to);
+		if ( existing.location > end ) { break; }
+
+		if ( existing.location <= start && end <= NSMaxRange(existing) ) { return YES; }
+
+		start = MIN(start, existing.location);
+		end = MAX(end, NSMaxRange(existing));
+		to = _CBHRangeSet_nextPosition(set, to);
+	}
+
+	const NSRange merged = NSRange_initFromTo(start, end);
+
+	return _CBHRangeSet_replace(set, from, to, &merged, 1);
+}
+
+BOOL CBHRangeSet_removeRange(CBHRangeSet * const set, const NSRange range)
+{
+	if ( range.length == 0 ) { return YES; }
+
+	const NSUInteger start = range.location;
+	const NSUInteger end = NSMaxRange(range);
+
+	const CBHRangeSetPosition from = _CBHRangeSet_lowerBound(set, start + 1);
+	CBHRangeSetPosition to = from;
+
+	// Only the first and last overlapping ranges can reach past the removed range.
+	NSRange remainders[2];
+	NSUInteger count = 0;
+
+	while ( _CBHRangeSet_isPositionValid(set, to) )
+	{
+		const NSRange existing = _CBHRangeSet_rangeAtPosition(set, to);
+		if ( existing.location >= end ) { break; }
+
+		if ( existing.location < start ) { remainders[count++] = NSRange_initFromTo(existing.location, start); }
+		if ( NSMaxRange(existing) > end ) { remainders[count++] = NSRange_initFromTo(end, NSMaxRange(existing)); }
+
+		to = _CBHRangeSet_nextPosition(set, to);
+	}
+
+	if ( _CBHRangeSet_isPositionEqual(from, to) ) { return YES; }
+
+	return _CBHRangeSet_replace(set, from, to, remainders, count);
+}
+
+void CBHRangeSet_removeAll(CBHRangeSet * const set)
+{
+	_CBHRangeSet_removeBlocks(set, 0, set->blockCount);
+
+	set->rangeCount = 0;
+	set->count = 0;
+}
+
+
+#pragma mark - Combining Range Sets
+
+typedef enum CBHRangeSetOperation
+{
+	CBHRangeSetOperationUnion,
+	CBHRangeSetOperationIntersection,
+	CBHRangeSetOperationSubtract,
+} CBHRangeSetOperation;
+
+static BOOL _CBHRangeSet_combineInto(CBHRangeSet * const output, const CBHRangeSet * const set, const CBHRangeSet * const other, const CBHRangeSetOperation operation)
+{
+	CBHRangeSetPosition position = { .block = 0, .index = 0 };
+	CBHRangeSetPosition otherPosition = { .block = 0, .index = 0 };
+
+	switch ( operation )
+	{
+		case CBHRangeSetOperationUnion:
+			while ( _CBHRangeSet_isPositionValid(set, position) || _CBHRangeSet_isPositionValid(other, otherPosition) )
+			{
+				NSRange range;
+				if ( !_CBHRangeSet_isPositionValid(other, otherPosition) || (_CBHRangeSet_isPositionValid(set, position) && _CBHRangeSet_rangeAtPosition(set, position).location <= _CBHRangeSet_rangeAtPosition(other, otherPosition).location) )
+				{
+					range = _CBHRangeSet_rangeAtPosition(set, position);
+					position = _CBHRangeSet_nextPosition(set, position);
+				}
+				else
+				{
+					range = _CBHRangeSet_rangeAtPosition(other, otherPosition);
+					otherPosition = _CBHRangeSet_nextPosition(other, otherPosition);
+				}
+
+				if ( !_CBHRangeSet_append(output, range) ) { return NO; }
+			}
+			break;
+
+		case CBHRangeSetOperationIntersection:
+			while ( _CBHRangeSet_isPositionValid(set, position) && _CBHRangeSet_isPositionValid(other, otherPosition) )
+			{
+				const NSRange range = _CBHRangeSet_rangeAtPosition(set, position);
+				const NSRange otherRange = _CBHRangeSet_rangeAtPosition(other, otherPosition);
+
+				const NSRange intersection = NSRange_intersection(range, otherRange);
+				if ( intersection.length > 0 && !_CBHRangeSet_append(output, intersection) ) { return NO; }
+
+				if ( NSMaxRange(range) < NSMaxRange(otherRange) ) { position = _CBHRangeSet_nextPosition(set, position); }
+				else { otherPosition = _CBHRangeSet_nextPosition(other, otherPosition); }
+			}
+			break;
+
+		case CBHRangeSetOperationSubtract:
+			for (; _CBHRangeSet_isPositionValid(set, position); position = _CBHRangeSet_nextPosition(set, position))
+			{
+				const NSRange range = _CBHRangeSet_rangeAtPosition(set, position);
+				NSUInteger start = range.location;
+				const NSUInteger end = NSMaxRange(range);
+
+				while ( _CBHRangeSet_isPositionValid(other, otherPosition) && NSMaxRange(_CBHRangeSet_rangeAtPosition(other, otherPosition)) <= start )
+				{
+					otherPosition = _CBHRangeSet_nextPosition(other, otherPosition);
+				}
+
+				// A range reaching past this one may still cut the next, so it is only passed once it ends within this one.
+				for (CBHRangeSetPosition cut = otherPosition; _CBHRangeSet_isPositionValid(other, cut); cut = _CBHRangeSet_nextPosition(other, cut))
+				{
+					const NSRange otherRange = _CBHRangeSet_rangeAtPosition(other, cut);
+					if ( otherRange.location >= end ) { break; }
+
+					if ( start < otherRange.location && !_CBHRangeSet_append(output, NSRange_initFromTo(start, otherRange.location)) ) { return NO; }
+					start = MAX(start, NSMaxRange(otherRange));
+
+					if ( NSMaxRange(otherRange) >= end ) { break; }
+					otherPosition = _CBHRangeSet_nextPosition(other, cut);
+				}
+
+				if ( start < end && !_CBHRangeSet_append(output, NSRange_initFromTo(start, end)) ) { return NO; }
+			}
+			break;
+	}
+
+	return YES;
+}
+
+static BOOL _CBHRangeSet_combine(CBHRangeSet * const result, const CBHRangeSet * const set, const CBHRangeSet * const other, const CBHRangeSetOperation operation)
+{
+	CBHRangeSet output = { .blocks = NULL, .firsts = NULL, .spare = NULL };
+
+	if ( !_CBHRangeSet_combineInto(&output, set, other, operation) )
+	{
+		CBHRangeSet_removeAll(&output);
+		free(output.blocks);
+		free(output.firsts);
+		free(output.spare);
+		return NO;
+	}
+
+	_CBHRangeSet_move(result, &output);
+
+	return YES;
+}
+
+BOOL CBHRangeSet_union(CBHRangeSet * const result, const CBHRangeSet * const set, const CBHRangeSet * const other)
+{
+	return _CBHRangeSet_combine(result, set, other, CBHRangeSetOperationUnion);
+}
+
+BOOL CBHRangeSet_intersection(CBHRangeSet * const result, const CBHRangeSet * const set, const CBHRangeSet * const other)
+{
+	return _CBHRangeSet_combine(result, set, other, CBHRangeSetOperationIntersection);
+}
+
+BOOL CBHRangeSet_subtract(CBHRangeSet * const result, const CBHRangeSet * const set, const CBHRangeSet * const other)
+{
+	return _CBHRangeSet_combine(result, set, other, CBHRangeSetOperationSubtract);
+}
+
+
+#pragma mark - Checking Range Sets
+
+BOOL CBHRangeSet_isLocationInSet(const CBHRangeSet * const set, const NSUInteger location)
+{
+	if ( location == NSUIntegerMax ) { return NO; }
+
+	const CBHRangeSetPosition position = _CBHRangeSet_lowerBound(set, location + 1);
+	if ( !_CBHRangeSet_isPositionValid(set, position) ) { return NO; }
+
+	return NSRange_isLocationInRange(_CBHRangeSet_rangeAtPosition(set, position), location);
+}
+
+BOOL CBHRangeSet_isIntersectingRange(const CBHRangeSet * const set, const NSRange range)
+{
+	if ( range.length == 0 ) { return NO; }
+
+	const CBHRangeSetPosition position = _CBHRangeSet_lowerBound(set, range.location + 1);
+	if ( !_CBHRangeSet_isPositionValid(set, position) ) { return NO; }
+
+	return ( _CBHRangeSet_rangeAtPosition(set, position).location < NSMaxRange(range) );
+}
+
+BOOL CBHRangeSet_isCoveringRange(const CBHRangeSet * const set, const NSRange range)
+{
+	if ( range.length == 0 ) { return NO; }
+
+	const CBHRangeSetPosition position = _CBHRangeSet_lowerBound(set, range.location + 1);
+	if ( !_CBHRangeSet_isPositionValid(set, position) ) { return NO; }
+
+	const NSRange existing = _CBHRangeSet_rangeAtPosition(set, position);
+
+	return ( existing.location <= range.location ) && ( NSMaxRange(range) <= NSMaxRange(existing) );
+}
+
+
+#pragma mark - Iterating Ranges
+
+CBHRangeSetIterator CBHRangeSetIterator_init(const CBHRangeSet * const set)
+{
+	return (CBHRangeSetIterator){ .set = set, .block = 0, .index = 0 };
+}
+
+CBHRangeSetIterator CBHRangeSetIterator_initWithLocation(const CBHRangeSet * const set, const NSUInteger location)
+{
+	if ( location == NSUIntegerMax ) { return (CBHRangeSetIterator){ .set = set, .block = set->blockCount, .index = 0 }; }
+
+	const CBHRangeSetPosition position = _CBHRangeSet_lowerBound(set, location + 1);
+
+	return (CBHRangeSetIterator){ .set = set, .block = position.block, .index = position.index };
+}
+
+BOOL CBHRangeSetIterator_next(CBHRangeSetIterator * const iterator, NSRange * const range)
+{
+	const CBHRangeSet * const set = iterator->set;
+	if ( iterator->block >= set->blockCount ) { return NO; }
+
+	const CBHRangeSetPosition position = { .block = iterator->block, .index = iterator->index };
+	*range = _CBHRangeSet_rangeAtPosition(set, position);
+
+	const CBHRangeSetPosition next = _CBHRangeSet_nextPosition(set, position);
+	iterator->block = next.block;
+	iterator->index = next.index;
+
+	return YES;
+}
+
+NSUInteger CBHRangeSet_getRanges(const CBHRangeSet * const set, NSRange * const ranges, const NSUInteger capacity)
+{
+	if ( ranges == NULL ) { return set->rangeCount; }
+
+	NSUInteger written = 0;
+	for (NSUInteger i = 0; i < set->blockCount && written < capacity; ++i)
+	{
+		const NSUInteger length = MIN(set->blocks[i]->count, capacity - written);
+		memcpy(ranges + written, set->blocks[i]->ranges, sizeof(NSRange) * length);
+		written += length;
+	}
+
+	return set->rangeCount;
+}
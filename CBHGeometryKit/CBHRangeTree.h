@@ -0,0 +1,181 @@
+//  CBHRangeTree.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** A mutable interval tree over a collection of possibly overlapping ranges.
+ *
+ * The tree is a balanced binary search tree ordered by location, with each node recording the greatest end in its
+ * subtree so searches skip subtrees which end too soon. Nodes are stored contiguously and queries do not allocate.
+ *
+ * Each range is identified by an index which stays the same until the range is removed, after which it may be reused.
+ * A tree created from a C array uses the array's indexes.
+ *
+ * Queries agree with `NSRange_intersection()` and `NSRange_isLocationInRange()` except that ranges with an
+ * `NSNotFound` location and ranges extending past `NSUIntegerMax` are held but never reported, as are empty ranges.
+ * Likewise a query with an empty range or an `NSNotFound` location matches nothing. Matches are reported in order of
+ * location.
+ */
+typedef struct CBHRangeTree CBHRangeTree;
+
+/** A function called for each match during an enumeration.
+ *
+ * @param index         The index of the matching range.
+ * @param context       The context given to the enumeration.
+ * @param stop          Set to `YES` to stop the enumeration.
+ */
+typedef void (*CBHRangeTreeCallback)(NSUInteger index, void * _Nullable context, BOOL *stop);
+
+
+#pragma mark - Creating Range Trees
+
+/**
+ * @name Creating Range Trees
+ */
+
+/** Creates an empty range tree.
+ *
+ * @return              A new tree, or `NULL` if the storage could not be allocated. Release it with `CBHRangeTree_destroy()`.
+ */
+CBHRangeTree * _Nullable CBHRangeTree_create(void);
+
+/** Creates a range tree from a C array of ranges.
+ *
+ * @param ranges        The ranges to index. The tree does not keep a reference to them.
+ * @param count         The number of ranges in _ranges_.
+ *
+ * @return              A new tree, or `NULL` if the storage could not be allocated. Release it with `CBHRangeTree_destroy()`.
+ */
+CBHRangeTree * _Nullable CBHRangeTree_createWithRanges(const NSRange *ranges, NSUInteger count);
+
+/** Releases a range tree.
+ *
+ * @param tree          The tree to release.
+ */
+void CBHRangeTree_destroy(CBHRangeTree * _Nullable tree);
+
+
+#pragma mark - Properties
+
+/**
+ * @name Properties
+ */
+
+/** The number of ranges in the tree, including any which are never reported.
+ *
+ * @param tree          The tree.
+ *
+ * @return              The number of ranges.
+ */
+NSUInteger CBHRangeTree_count(const CBHRangeTree *tree);
+
+/** The range with an index.
+ *
+ * @param tree          The tree.
+ * @param index         The index of the range.
+ *
+ * @return              The range, or a range with a location of `NSNotFound` and a length of 0 if _index_ is not in use.
+ */
+NSRange CBHRangeTree_rangeAtIndex(const CBHRangeTree *tree, NSUInteger index);
+
+
+#pragma mark - Modifying Range Trees
+
+/**
+ * @name Modifying Range Trees
+ */
+
+/** Adds a range to the tree.
+ *
+ * @param tree          The tree to modify.
+ * @param range         The range to add.
+ *
+ * @return              The index of the range, or `NSNotFound` if the storage could not be allocated.
+ */
+NSUInteger CBHRangeTree_insertRange(CBHRangeTree *tree, NSRange range);
+
+/** Removes a range from the tree.
+ *
+ * @param tree          The tree to modify.
+ * @param index         The index of the range to remove.
+ *
+ * @return              `YES` if the range was removed, or `NO` if _index_ is not in use.
+ */
+BOOL CBHRangeTree_removeIndex(CBHRangeTree *tree, NSUInteger index);
+
+
+#pragma mark - Querying Indexes
+
+/**
+ * @name Querying Indexes
+ *
+ * These functions write up to _capacity_ matching indexes in order of location and return the total number of matches,
+ * which may exceed _capacity_.
+ */
+
+/** Finds the ranges overlapping a range.
+ *
+ * @param tree          The tree.
+ * @param range         The range to search.
+ * @param indexes       A buffer to receive the indexes.
+ * @param capacity      The number of elements _indexes_ can hold.
+ *
+ * @return              The number of reported ranges for which `NSRange_intersection()` with _range_ is not empty.
+ */
+NSUInteger CBHRangeTree_overlappingIndexes(const CBHRangeTree *tree, NSRange range, NSUInteger * _Nullable indexes, NSUInteger capacity);
+
+/** Finds the ranges containing a location.
+ *
+ * @param tree          The tree.
+ * @param location      The location to search.
+ * @param indexes       A buffer to receive the indexes.
+ * @param capacity      The number of elements _indexes_ can hold.
+ *
+ * @return              The number of reported ranges for which `NSRange_isLocationInRange()` is `YES`.
+ */
+NSUInteger CBHRangeTree_containingLocationIndexes(const CBHRangeTree *tree, NSUInteger location, NSUInteger * _Nullable indexes, NSUInteger capacity);
+
+
+#pragma mark - Enumerating Matches
+
+/**
+ * @name Enumerating Matches
+ */
+
+/** Calls a function for each range overlapping a range.
+ *
+ * @param tree          The tree.
+ * @param range         The range to search.
+ * @param callback      The function to call for each match.
+ * @param context       A value passed to _callback_.
+ */
+void CBHRangeTree_enumerateOverlapping(const CBHRangeTree *tree, NSRange range, CBHRangeTreeCallback callback, void * _Nullable context);
+
+/** Calls a function for each range containing a location.
+ *
+ * @param tree          The tree.
+ * @param location      The location to search.
+ * @param callback      The function to call for each match.
+ * @param context       A value passed to _callback_.
+ */
+void CBHRangeTree_enumerateContainingLocation(const CBHRangeTree *tree, NSUInteger location, CBHRangeTreeCallback callback, void * _Nullable context);
+
+NS_ASSUME_NONNULL_END
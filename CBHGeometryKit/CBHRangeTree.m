@@ -0,0 +1,462 @@
+//  CBHRangeTree.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHRangeTree.h"
+
+#import "_CBHGeometryKit+Utilities.h"
+#import "_CBHGeometryKit+IndexSink.h"
+
+#import <stdlib.h>
+
+
+// The tallest an AVL tree of `NSUIntegerMax` nodes can be, which bounds the search stack.
+enum { kCBHRangeTreeMaxHeight = 96 };
+
+static const NSUInteger kCBHRangeTreeNil = NSNotFound;
+
+// Heights of nodes which are not linked into the tree.
+static const NSInteger kCBHRangeTreeUnlinked = 0;
+static const NSInteger kCBHRangeTreeFree = -1;
+
+
+// A node is its range's index. Nodes holding ranges which can never match are kept out of the tree, and free nodes are
+// chained through `left`.
+typedef struct CBHRangeTreeNode
+{
+	NSUInteger location;
+	NSUInteger length;
+	NSUInteger end;
+	NSUInteger maxEnd;
+
+	NSUInteger left;
+	NSUInteger right;
+	NSInteger height;
+} CBHRangeTreeNode;
+
+struct CBHRangeTree
+{
+	CBHRangeTreeNode * _Nullable nodes;
+	NSUInteger length;
+	NSUInteger capacity;
+
+	NSUInteger root;
+	NSUInteger free;
+	NSUInteger count;
+};
+
+
+#pragma mark - Nodes
+
+// Ranges which are empty, not found, or run past the last location never match a query.
+NS_INLINE BOOL _CBHRangeTree_isMatchable(const NSRange range)
+{
+	return ( range.length > 0 ) && ( range.location != NSNotFound ) && ( range.location <= NSUIntegerMax - range.length );
+}
+
+static void _CBHRangeTree_initNode(CBHRangeTree * const tree, const NSUInteger index, const NSRange range)
+{
+	CBHRangeTreeNode * const node = tree->nodes + index;
+	const BOOL isMatchable = _CBHRangeTree_isMatchable(range);
+
+	*node = (CBHRangeTreeNode){
+		.location = range.location,
+		.length = range.length,
+		.end = ( isMatchable ) ? NSMaxRange(range) : 0,
+		.maxEnd = ( isMatchable ) ? NSMaxRange(range) : 0,
+		.left = kCBHRangeTreeNil,
+		.right = kCBHRangeTreeNil,
+		.height = kCBHRangeTreeUnlinked,
+	};
+}
+
+NS_INLINE NSInteger _CBHRangeTree_height(const CBHRangeTree * const tree, const NSUInteger index)
+{
+	return ( index != kCBHRangeTreeNil ) ? tree->nodes[index].height : 0;
+}
+
+NS_INLINE NSUInteger _CBHRangeTree_maxEnd(const CBHRangeTree * const tree, const NSUInteger index)
+{
+	return ( index != kCBHRangeTreeNil ) ? tree->nodes[index].maxEnd : 0;
+}
+
+// Nodes are ordered by location and then by index so every node has a distinct key.
+NS_INLINE BOOL _CBHRangeTree_isBefore(const CBHRangeTree * const tree, const NSUInteger index, const NSUInteger other)
+{
+	const NSUInteger location = tree->nodes[index].location;
+	const NSUInteger otherLocation = tree->nodes[other].location;
+
+	return ( location < otherLocation ) || ( location == otherLocation && index < other );
+}
+
+static void _CBHRangeTree_update(CBHRangeTree * const tree, const NSUInteger index)
+{
+	CBHRangeTreeNode * const node = tree->nodes + index;
+
+	node->height = 1 + MAX(_CBHRangeTree_height(tree, node->left), _CBHRangeTree_height(tree, node->right));
+	node->maxEnd = MAX(node->end, MAX(_CBHRangeTree_maxEnd(tree, node->left), _CBHRangeTree_maxEnd(tree, node->right)));
+}
+
+
+#pragma mark - Balancing
+
+static NSUInteger _CBHRangeTree_rotateRight(CBHRangeTree * const tree, const NSUInteger index)
+{
+	const NSUInteger pivot = tree->nodes[index].left;
+
+	tree->nodes[index].left = tree->nodes[pivot].right;
+	tree->nodes[pivot].right = index;
+
+	_CBHRangeTree_update(tree, index);
+	_CBHRangeTree_update(tree, pivot);
+
+	return pivot;
+}
+
+static NSUInteger _CBHRangeTree_rotateLeft(CBHRangeTree * const tree, const NSUInteger index)
+{
+	const NSUInteger pivot = tree->nodes[index].right;
+
+	tree->nodes[index].right = tree->nodes[pivot].left;
+	tree->nodes[pivot].left = index;
+
+	_CBHRangeTree_update(tree, index);
+	_CBHRangeTree_update(tree, pivot);
+
+	return pivot;
+}
+
+static NSUInteger _CBHRangeTree_balance(CBHRangeTree * const tree, const NSUInteger index)
+{
+	_CBHRangeTree_update(tree, index);
+
+	CBHRangeTreeNode * const node = tree->nodes + index;
+	const NSInteger balance = _CBHRangeTree_height(tree, node->left) - _CBHRangeTree_height(tree, node->right);
+
+	if ( balance > 1 )
+	{
+		const CBHRangeTreeNode * const left = tree->nodes + node->left;
+		if ( _CBHRangeTree_height(tree, left->left) < _CBHRangeTree_height(tree, left->right) )
+		{
+			node->left = _CBHRangeTree_rotateLeft(tree, node->left);
+		}
+
+		return _CBHRangeTree_rotateRight(tree, index);
+	}
+
+	if ( balance < -1 )
+	{
+		const CBHRangeTreeNode * const right = tree->nodes + node->right;
+		if ( _CBHRangeTree_height(tree, right->right) < _CBHRangeTree_height(tree, right->left) )
+		{
+			node->right = _CBHRangeTree_rotateRight(tree, node->right);
+		}
+
+		return _CBHRangeTree_rotateLeft(tree, index);
+	}
+
+	return index;
+}
+
+static NSUInteger _CBHRangeTree_link(CBHRangeTree * const tree, const NSUInteger root, const NSUInteger index)
+{
+	if ( root == kCBHRangeTreeNil )
+	{
+		_CBHRangeTree_update(tree, index);
+		return index;
+	}
+
+	if ( _CBHRangeTree_isBefore(tree, index, root) ) { tree->nodes[root].left = _CBHRangeTree_link(tree, tree->nodes[root].left, index); }
+	else { tree->nodes[root].right = _CBHRangeTree_link(tree, tree->nodes[root].right, index); }
+
+	return _CBHRangeTree_balance(tree, root);
+}
+
+// Detaches the first node of a subtree, returning the new root of the subtree and the node through `first`.
+static NSUInteger _CBHRangeTree_unlinkFirst(CBHRangeTree * const tree, const NSUInteger root, NSUInteger * const first)
+{
+	if ( tree->nodes[root].left == kCBHRangeTreeNil )
+	{
+		*first = root;
+		return tree->nodes[root].right;
+	}
+
+	tree->nodes[root].left = _CBHRangeTree_unlinkFirst(tree, tree->nodes[root].left, first);
+
+	return _CBHRangeTree_balance(tree, root);
+}
+
+static NSUInteger _CBHRangeTree_unlink(CBHRangeTree * const tree, const NSUInteger root, const NSUInteger index)
+{
+	if ( root == index )
+	{
+		const NSUInteger left = tree->nodes[root].left;
+		const NSUInteger right = tree->nodes[root].right;
+
+		if ( left == kCBHRangeTreeNil ) { return right; }
+		if ( right == kCBHRangeTreeNil ) { return left; }
+
+		NSUInteger successor = kCBHRangeTreeNil;
+		const NSUInteger newRight = _CBHRangeTree_unlinkFirst(tree, right, &successor);
+
+		tree->nodes[successor].left = left;
+		tree->nodes[successor].right = newRight;
+
+		return _CBHRangeTree_balance(tree, successor);
+	}
+
+	if ( _CBHRangeTree_isBefore(tree, index, root) ) { tree->nodes[root].left = _CBHRangeTree_unlink(tree, tree->nodes[root].left, index); }
+	else { tree->nodes[root].right = _CBHRangeTree_unlink(tree, tree->nodes[root].right, index); }
+
+	return _CBHRangeTree_balance(tree, root);
+}
+
+
+#pragma mark - Building
+
+typedef struct CBHRangeTreeKey
+{
+	NSUInteger location;
+	NSUInteger index;
+} CBHRangeTreeKey;
+
+static int _CBHRangeTreeKey_compare(const void * const a, const void * const b)
+{
+	const CBHRangeTreeKey * const lhs = a;
+	const CBHRangeTreeKey * const rhs = b;
+
+	if ( lhs->location != rhs->location ) { return (lhs->location > rhs->location) - (lhs->location < rhs->location); }
+
+	return (lhs->index > rhs->index) - (lhs->index < rhs->index);
+}
+
+// Links sorted nodes into a perfectly balanced subtree, which is a valid AVL tree.
+static NSUInteger _CBHRangeTree_build(CBHRangeTree * const tree, const CBHRangeTreeKey * const keys, const NSUInteger count)
+{
+	if ( count == 0 ) { return kCBHRangeTreeNil; }
+
+	const NSUInteger middle = count / 2;
+	const NSUInteger index = keys[middle].index;
+
+	tree->nodes[index].left = _CBHRangeTree_build(tree, keys, middle);
+	tree->nodes[index].right = _CBHRangeTree_build(tree, keys + middle + 1, count - middle - 1);
+	_CBHRangeTree_update(tree, index);
+
+	return index;
+}
+
+
+#pragma mark - Storage
+
+static BOOL _CBHRangeTree_reserve(CBHRangeTree * const tree, const NSUInteger capacity)
+{
+	if ( capacity <= tree->capacity ) { return YES; }
+
+	const NSUInteger newCapacity = MAX(capacity, MAX(tree->capacity * 2, 16UL));
+	if ( newCapacity > NSUIntegerMax / sizeof(CBHRangeTreeNode) ) { return NO; }
+
+	CBHRangeTreeNode * const nodes = realloc(tree->nodes, sizeof(CBHRangeTreeNode) * newCapacity);
+	if ( nodes == NULL ) { return NO; }
+
+	tree->nodes = nodes;
+	tree->capacity = newCapacity;
+
+	return YES;
+}
+
+
+#pragma mark - Creating Range Trees
+
+CBHRangeTree *CBHRangeTree_create(void)
+{
+	CBHRangeTree * const tree = calloc(1, sizeof(CBHRangeTree));
+	if ( tree == NULL ) { return NULL; }
+
+	tree->root = kCBHRangeTreeNil;
+	tree->free = kCBHRangeTreeNil;
+
+	return tree;
+}
+
+CBHRangeTree *CBHRangeTree_createWithRanges(const NSRange * const ranges, const NSUInteger count)
+{
+	CBHRangeTree * const tree = CBHRangeTree_create();
+	if ( tree == NULL ) { return NULL; }
+
+	CBHRangeTreeKey * const keys = malloc(sizeof(CBHRangeTreeKey) * MAX(count, 1UL));
+	if ( keys == NULL || !_CBHRangeTree_reserve(tree, count) )
+	{
+		free(keys);
+		CBHRangeTree_destroy(tree);
+		return NULL;
+	}
+
+	NSUInteger keyCount = 0;
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		_CBHRangeTree_initNode(tree, i, ranges[i]);
+		if ( _CBHRangeTree_isMatchable(ranges[i]) ) { keys[keyCount++] = (CBHRangeTreeKey){ .location = ranges[i].location, .index = i }; }
+	}
+
+	qsort(keys, keyCount, sizeof(CBHRangeTreeKey), _CBHRangeTreeKey_compare);
+
+	tree->root = _CBHRangeTree_build(tree, keys, keyCount);
+	tree->length = count;
+	tree->count = count;
+
+	free(keys);
+
+	return tree;
+}
+
+void CBHRangeTree_destroy(CBHRangeTree * const tree)
+{
+	if ( tree == NULL ) { return; }
+
+	free(tree->nodes);
+	free(tree);
+}
+
+
+#pragma mark - Properties
+
+NSUInteger CBHRangeTree_count(const CBHRangeTree * const tree)
+{
+	return tree->count;
+}
+
+NSRange CBHRangeTree_rangeAtIndex(const CBHRangeTree * const tree, const NSUInteger index)
+{
+	if ( index >= tree->length || tree->nodes[index].height == kCBHRangeTreeFree ) { return NSMakeRange(NSNotFound, 0); }
+
+	return NSMakeRange(tree->nodes[index].location, tree->nodes[index].length);
+}
+
+
+#pragma mark - Modifying Range Trees
+
+NSUInteger CBHRangeTree_insertRange(CBHRangeTree * const tree, const NSRange range)
+{
+	NSUInteger index = tree->free;
+
+	if ( index != kCBHRangeTreeNil ) { tree->free = tree->nodes[index].left; }
+	else
+	{
+		if ( tree->length >= NSNotFound - 1 || !_CBHRangeTree_reserve(tree, tree->length + 1) ) { return NSNotFound; }
+		index = tree->length++;
+	}
+
+	_CBHRangeTree_initNode(tree, index, range);
+	if ( _CBHRangeTree_isMatchable(range) ) { tree->root = _CBHRangeTree_link(tree, tree->root, index); }
+
+	tree->count += 1;
+
+	return index;
+}
+
+BOOL CBHRangeTree_removeIndex(CBHRangeTree * const tree, const NSUInteger index)
+{
+	if ( index >= tree->length || tree->nodes[index].height == kCBHRangeTreeFree ) { return NO; }
+
+	if ( tree->nodes[index].height != kCBHRangeTreeUnlinked ) { tree->root = _CBHRangeTree_unlink(tree, tree->root, index); }
+
+	tree->nodes[index].height = kCBHRangeTreeFree;
+	tree->nodes[index].left = tree->free;
+	tree->free = index;
+	tree->count -= 1;
+
+	return YES;
+}
+
+
+#pragma mark - Searching
+
+// Walks the tree in order, skipping subtrees which end at or before `start` and stopping at the first node starting at
+// or after `end`, since every node after it starts later still.
+static void _CBHRangeTree_search(const CBHRangeTree * const tree, const NSUInteger start, const NSUInteger end, CBHIndexSink * const sink)
+{
+	NSUInteger stack[kCBHRangeTreeMaxHeight];
+	NSUInteger depth = 0;
+	NSUInteger index = tree->root;
+
+	while ( !sink->stop )
+	{
+		while ( index != kCBHRangeTreeNil && tree->nodes[index].maxEnd > start )
+		{
+			stack[depth++] = index;
+			index = tree->nodes[index].left;
+		}
+
+		if ( depth == 0 ) { return; }
+
+		const CBHRangeTreeNode * const node = tree->nodes + stack[--depth];
+		if ( node->location >= end ) { return; }
+
+		if ( node->end > start ) { CBHIndexSink_emit(sink, (NSUInteger)(node - tree->nodes)); }
+
+		index = node->right;
+	}
+}
+
+// Queries never match empty or not found ranges. A query running past the last location is clamped to it.
+NS_INLINE BOOL _CBHRangeTree_queryBounds(const NSRange range, NSUInteger * const start, NSUInteger * const end)
+{
+	if ( range.length == 0 || range.location == NSNotFound ) { return NO; }
+
+	*start = range.location;
+	*end = ( range.location <= NSUIntegerMax - range.length ) ? NSMaxRange(range) : NSUIntegerMax;
+
+	return YES;
+}
+
+
+#pragma mark - Querying Indexes
+
+NSUInteger CBHRangeTree_overlappingIndexes(const CBHRangeTree * const tree, const NSRange range, NSUInteger * const indexes, const NSUInteger capacity)
+{
+	NSUInteger start;
+	NSUInteger end;
+	if ( !_CBHRangeTree_queryBounds(range, &start, &end) ) { return 0; }
+
+	CBHIndexSink sink = CBHIndexSink_initWithBuffer(indexes, capacity);
+	_CBHRangeTree_search(tree, start, end, &sink);
+
+	return sink.count;
+}
+
+NSUInteger CBHRangeTree_containingLocationIndexes(const CBHRangeTree * const tree, const NSUInteger location, NSUInteger * const indexes, const NSUInteger capacity)
+{
+	return CBHRangeTree_overlappingIndexes(tree, NSMakeRange(location, 1), indexes, capacity);
+}
+
+
+#pragma mark - Enumerating Matches
+
+void CBHRangeTree_enumerateOverlapping(const CBHRangeTree * const tree, const NSRange range, const CBHRangeTreeCallback callback, void * const context)
+{
+	NSUInteger start;
+	NSUInteger end;
+	if ( !_CBHRangeTree_queryBounds(range, &start, &end) ) { return; }
+
+	CBHIndexSink sink = CBHIndexSink_initWithCallback(callback, context);
+	_CBHRangeTree_search(tree, start, end, &sink);
+}
+
+void CBHRangeTree_enumerateContainingLocation(const CBHRangeTree * const tree, const NSUInteger location, const CBHRangeTreeCallback callback, void * const context)
+{
+	CBHRangeTree_enumerateOverlapping(tree, NSMakeRange(location, 1), callback, context);
+}
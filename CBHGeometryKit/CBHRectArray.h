@@ -0,0 +1,295 @@
+//  CBHRectArray.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** A growable collection of rects stored as separate x, y, width, and height columns.
+ *
+ * Each column is aligned to a 64 byte cache line. The columns may be read directly but should only be modified
+ * through the functions below.
+ */
+typedef struct CBHRectArray
+{
+	CGFloat * _Nullable x;
+	CGFloat * _Nullable y;
+	CGFloat * _Nullable width;
+	CGFloat * _Nullable height;
+
+	NSUInteger count;
+	NSUInteger capacity;
+} CBHRectArray;
+
+
+#pragma mark - Creating Rect Arrays
+
+/**
+ * @name Creating Rect Arrays
+ */
+
+/** Initializes an empty rect array.
+ *
+ * @param array         The array to initialize.
+ * @param capacity      The number of rects to reserve space for.
+ *
+ * @return              `YES` if the storage could be allocated, otherwise `NO`.
+ */
+BOOL CBHRectArray_init(CBHRectArray *array, NSUInteger capacity);
+
+/** Initializes a rect array with the contents of a C array of rects.
+ *
+ * @param array         The array to initialize.
+ * @param rects         The rects to import.
+ * @param count         The number of rects in _rects_.
+ *
+ * @return              `YES` if the storage could be allocated, otherwise `NO`.
+ */
+BOOL CBHRectArray_initWithRects(CBHRectArray *array, const NSRect *rects, NSUInteger count);
+
+/** Releases the storage held by a rect array and leaves it empty.
+ *
+ * @param array         The array to destroy.
+ */
+void CBHRectArray_destroy(CBHRectArray *array);
+
+
+#pragma mark - Managing Storage
+
+/**
+ * @name Managing Storage
+ */
+
+/** Ensures a rect array can hold at least the given number of rects without reallocating.
+ *
+ * @param array         The array.
+ * @param capacity      The number of rects to reserve space for.
+ *
+ * @return              `YES` if the storage could be allocated, otherwise `NO`. On failure the array is unchanged.
+ */
+BOOL CBHRectArray_reserve(CBHRectArray *array, NSUInteger capacity);
+
+/** Removes all rects from a rect array while keeping its storage.
+ *
+ * @param array         The array.
+ */
+void CBHRectArray_removeAll(CBHRectArray *array);
+
+
+#pragma mark - Adding and Accessing Rects
+
+/**
+ * @name Adding and Accessing Rects
+ */
+
+/** Appends a rect to a rect array.
+ *
+ * @param array         The array.
+ * @param rect          The rect to append.
+ *
+ * @return              `YES` if the rect was appended, otherwise `NO`.
+ */
+BOOL CBHRectArray_append(CBHRectArray *array, NSRect rect);
+
+/** Appends the contents of a C array of rects to a rect array.
+ *
+ * @param array         The array.
+ * @param rects         The rects to append.
+ * @param count         The number of rects in _rects_.
+ *
+ * @return              `YES` if the rects were appended, otherwise `NO`.
+ */
+BOOL CBHRectArray_appendRects(CBHRectArray *array, const NSRect *rects, NSUInteger count);
+
+/** Gets the rect at an index.
+ *
+ * @param array         The array.
+ * @param index         The index of the rect. Must be less than the array's count.
+ *
+ * @return              The `NSRect` at _index_.
+ */
+NSRect CBHRectArray_rectAtIndex(const CBHRectArray *array, NSUInteger index);
+
+/** Replaces the rect at an index.
+ *
+ * @param array         The array.
+ * @param rect          The replacement rect.
+ * @param index         The index of the rect. Must be less than the array's count.
+ */
+void CBHRectArray_setRectAtIndex(CBHRectArray *array, NSRect rect, NSUInteger index);
+
+/** Exports a range of rects to a C array of rects.
+ *
+ * @param array         The array.
+ * @param rects         A buffer of at least _range_.length elements to receive the rects.
+ * @param range         The range of rects to export. Must lie within the array's count.
+ */
+void CBHRectArray_getRects(const CBHRectArray *array, NSRect *rects, NSRange range);
+
+
+#pragma mark - Checking Rects
+
+/**
+ * @name Checking Rects
+ *
+ * The mask functions set bit `i % 64` of `mask[i / 64]` for each matching rect and clear all other bits. The mask must
+ * hold at least `(count + 63) / 64` words. They return the number of matching rects.
+ *
+ * The index functions write the indexes of matching rects in ascending order. The buffer must be large enough to hold
+ * every match, at most the array's count. They return the number of indexes written.
+ */
+
+/** Evaluates `NSRect_isEmpty()` for every rect in a rect array.
+ *
+ * @param array         The array.
+ * @param mask          The bitmask to receive the results.
+ *
+ * @return              The number of empty rects.
+ */
+NSUInteger CBHRectArray_isEmptyMask(const CBHRectArray *array, uint64_t *mask);
+
+/** Evaluates `NSRect_isIntersecting()` between every rect in a rect array and another rect.
+ *
+ * @param array         The array.
+ * @param rect          The rect to test against.
+ * @param mask          The bitmask to receive the results.
+ *
+ * @return              The number of intersecting rects.
+ */
+NSUInteger CBHRectArray_isIntersectingMask(const CBHRectArray *array, NSRect rect, uint64_t *mask);
+
+/** Evaluates `NSRect_isCovering()` for every rect in a rect array covering another rect.
+ *
+ * @param array         The array.
+ * @param rect          The rect which must be covered.
+ * @param mask          The bitmask to receive the results.
+ *
+ * @return              The number of rects covering _rect_.
+ */
+NSUInteger CBHRectArray_isCoveringMask(const CBHRectArray *array, NSRect rect, uint64_t *mask);
+
+/** Evaluates `NSRect_isCovering()` for another rect covering every rect in a rect array.
+ *
+ * @param array         The array.
+ * @param rect          The covering rect.
+ * @param mask          The bitmask to receive the results.
+ *
+ * @return              The number of rects covered by _rect_.
+ */
+NSUInteger CBHRectArray_isCoveredByMask(const CBHRectArray *array, NSRect rect, uint64_t *mask);
+
+/** Evaluates `NSRect_isPointInRect()` for every rect in a rect array.
+ *
+ * @param array         The array.
+ * @param point         The point.
+ * @param mask          The bitmask to receive the results.
+ *
+ * @return              The number of rects containing _point_.
+ */
+NSUInteger CBHRectArray_isPointInRectMask(const CBHRectArray *array, NSPoint point, uint64_t *mask);
+
+
+/** Finds the indexes of the empty rects in a rect array.
+ *
+ * @param array         The array.
+ * @param indexes       A buffer to receive the indexes.
+ *
+ * @return              The number of indexes written.
+ */
+NSUInteger CBHRectArray_isEmptyIndexes(const CBHRectArray *array, NSUInteger *indexes);
+
+/** Finds the indexes of the rects in a rect array which intersect another rect.
+ *
+ * @param array         The array.
+ * @param rect          The rect to test against.
+ * @param indexes       A buffer to receive the indexes.
+ *
+ * @return              The number of indexes written.
+ */
+NSUInteger CBHRectArray_isIntersectingIndexes(const CBHRectArray *array, NSRect rect, NSUInteger *indexes);
+
+/** Finds the indexes of the rects in a rect array which cover another rect.
+ *
+ * @param array         The array.
+ * @param rect          The rect which must be covered.
+ * @param indexes       A buffer to receive the indexes.
+ *
+ * @return              The number of indexes written.
+ */
+NSUInteger CBHRectArray_isCoveringIndexes(const CBHRectArray *array, NSRect rect, NSUInteger *indexes);
+
+/** Finds the indexes of the rects in a rect array which are covered by another rect.
+ *
+ * @param array         The array.
+ * @param rect          The covering rect.
+ * @param indexes       A buffer to receive the indexes.
+ *
+ * @return              The number of indexes written.
+ */
+NSUInteger CBHRectArray_isCoveredByIndexes(const CBHRectArray *array, NSRect rect, NSUInteger *indexes);
+
+/** Finds the indexes of the rects in a rect array which contain a point.
+ *
+ * @param array         The array.
+ * @param point         The point.
+ * @param indexes       A buffer to receive the indexes.
+ *
+ * @return              The number of indexes written.
+ */
+NSUInteger CBHRectArray_isPointInRectIndexes(const CBHRectArray *array, NSPoint point, NSUInteger *indexes);
+
+
+#pragma mark - Snapping Rects to Pixels
+
+/**
+ * @name Snapping Rects to Pixels
+ *
+ * These functions replace every rect in the array with the result of the matching `NSRect` batch function at a backing
+ * scale factor, working on the columns directly. At a scale of 1 the results are identical to the single rect functions.
+ */
+
+/** Expands every rect in a rect array outward to whole pixels, as `NSRect_integralRects()` does.
+ *
+ * @param array         The array to modify.
+ * @param scale         The number of pixels per point. Must be positive.
+ */
+void CBHRectArray_integral(CBHRectArray *array, CGFloat scale);
+
+/** Truncates the components of every rect in a rect array to the pixel grid, as `NSRect_truncateRects()` does.
+ *
+ * @param array         The array to modify.
+ * @param scale         The number of pixels per point. Must be positive.
+ */
+void CBHRectArray_truncate(CBHRectArray *array, CGFloat scale);
+
+/** Rounds the components of every rect in a rect array to the pixel grid, as `NSRect_roundRects()` does.
+ *
+ * @param array         The array to modify.
+ * @param scale         The number of pixels per point. Must be positive.
+ */
+void CBHRectArray_round(CBHRectArray *array, CGFloat scale);
+
+/** Aligns every rect in a rect array with the pixel grid, as `NSRect_alignRectsWithPixels()` does.
+ *
+ * @param array         The array to modify.
+ * @param scale         The number of pixels per point. Must be positive.
+ */
+void CBHRectArray_alignWithPixels(CBHRectArray *array, CGFloat scale);
+
+NS_ASSUME_NONNULL_END
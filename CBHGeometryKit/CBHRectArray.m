@@ -0,0 +1,555 @@
+//  CBHRectArray.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHRectArray.h"
+
+#import "_CBHGeometryKit+Utilities.h"
+#import "_CBHGeometryKit+Vector.h"
+#import "_CBHGeometryKit+Predicates.h"
+#import "_CBHGeometryKit+Parallel.h"
+#import "_CBHGeometryKit+Pixels.h"
+
+#import <stdatomic.h>
+#import <stdlib.h>
+#import <string.h>
+
+
+// Columns are padded to whole cache lines so each one starts on a 64 byte boundary.
+static const NSUInteger kCBHRectArrayAlignment = 64;
+static const NSUInteger kCBHRectArrayColumnGranularity = 64 / sizeof(CGFloat);
+
+static const NSUInteger kCBHMaskBits = 64;
+
+
+#pragma mark - Creating Rect Arrays
+
+BOOL CBHRectArray_init(CBHRectArray * const array, const NSUInteger capacity)
+{
+	*array = (CBHRectArray){ .x = NULL, .y = NULL, .width = NULL, .height = NULL, .count = 0, .capacity = 0 };
+
+	return CBHRectArray_reserve(array, capacity);
+}
+
+BOOL CBHRectArray_initWithRects(CBHRectArray * const array, const NSRect * const rects, const NSUInteger count)
+{
+	if ( !CBHRectArray_init(array, count) ) { return NO; }
+
+	return CBHRectArray_appendRects(array, rects, count);
+}
+
+void CBHRectArray_destroy(CBHRectArray * const array)
+{
+	free(array->x);
+
+	*array = (CBHRectArray){ .x = NULL, .y = NULL, .width = NULL, .height = NULL, .count = 0, .capacity = 0 };
+}
+
+
+#pragma mark - Managing Storage
+
+BOOL CBHRectArray_reserve(CBHRectArray * const array, const NSUInteger capacity)
+{
+	if ( capacity <= array->capacity ) { return YES; }
+
+	NSUInteger newCapacity = MAX(capacity, array->capacity * 2);
+	if ( newCapacity > (NSUIntegerMax / (4 * sizeof(CGFloat))) - kCBHRectArrayColumnGranularity ) { return NO; }
+	newCapacity = (newCapacity + kCBHRectArrayColumnGranularity - 1) & ~(kCBHRectArrayColumnGranularity - 1);
+
+	void *storage = NULL;
+	if ( posix_memalign(&storage, kCBHRectArrayAlignment, newCapacity * 4 * sizeof(CGFloat)) != 0 ) { return NO; }
+
+	CGFloat * const columns = storage;
+	CGFloat * const x = columns;
+	CGFloat * const y = columns + newCapacity;
+	CGFloat * const width = columns + (newCapacity * 2);
+	CGFloat * const height = columns + (newCapacity * 3);
+
+	if ( array->count > 0 )
+	{
+		const size_t length = array->count * sizeof(CGFloat);
+
+		memcpy(x, array->x, length);
+		memcpy(y, array->y, length);
+		memcpy(width, array->width, length);
+		memcpy(height, array->height, length);
+	}
+
+	free(array->x);
+
+	array->x = x;
+	array->y = y;
+	array->width = width;
+	array->height = height;
+	array->capacity = newCapacity;
+
+	return YES;
+}
+
+void CBHRectArray_removeAll(CBHRectArray * const array)
+{
+	array->count = 0;
+}
+
+
+#pragma mark - Adding and Accessing Rects
+
+BOOL CBHRectArray_append(CBHRectArray * const array, const NSRect rect)
+{
+	return CBHRectArray_appendRects(array, &rect, 1);
+}
+
+BOOL CBHRectArray_appendRects(CBHRectArray * const array, const NSRect * const rects, const NSUInteger count)
+{
+	if ( count == 0 ) { return YES; }
+	if ( count > NSUIntegerMax - array->count ) { return NO; }
+	if ( !CBHRectArray_reserve(array, array->count + count) ) { return NO; }
+
+	CGFloat * const x = array->x + array->count;
+	CGFloat * const y = array->y + array->count;
+	CGFloat * const width = array->width + array->count;
+	CGFloat * const height = array->height + array->count;
+
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		x[i] = rects[i].origin.x;
+		y[i] = rects[i].origin.y;
+		width[i] = rects[i].size.width;
+		height[i] = rects[i].size.height;
+	}
+
+	array->count += count;
+
+	return YES;
+}
+
+CBH_PURE NSRect CBHRectArray_rectAtIndex(const CBHRectArray * const array, const NSUInteger index)
+{
+	return (NSRect){ { .x = array->x[index], .y = array->y[index] }, { .width = array->width[index], .height = array->height[index] } };
+}
+
+void CBHRectArray_setRectAtIndex(CBHRectArray * const array, const NSRect rect, const NSUInteger index)
+{
+	array->x[index] = rect.origin.x;
+	array->y[index] = rect.origin.y;
+	array->width[index] = rect.size.width;
+	array->height[index] = rect.size.height;
+}
+
+void CBHRectArray_getRects(const CBHRectArray * const array, NSRect * const rects, const NSRange range)
+{
+	for (NSUInteger i = 0; i < range.length; ++i)
+	{
+		rects[i] = CBHRectArray_rectAtIndex(array, range.location + i);
+	}
+}
+
+
+#pragma mark - Predicates
+
+// Each predicate is evaluated between an element of the array and a query rect. Point queries use the query's origin.
+
+typedef BOOL (*CBHRectArrayScalarPredicate)(NSRect element, NSRect query);
+
+NS_INLINE BOOL _CBHRectArray_isEmpty(const NSRect element, const NSRect query)
+{
+	return CBHRect_isEmpty(element);
+}
+
+NS_INLINE BOOL _CBHRectArray_isIntersecting(const NSRect element, const NSRect query)
+{
+	return CBHRect_isIntersecting(element, query);
+}
+
+NS_INLINE BOOL _CBHRectArray_isCovering(const NSRect element, const NSRect query)
+{
+	return CBHRect_isCovering(element, query);
+}
+
+NS_INLINE BOOL _CBHRectArray_isCoveredBy(const NSRect element, const NSRect query)
+{
+	return CBHRect_isCovering(query, element);
+}
+
+NS_INLINE BOOL _CBHRectArray_isPointInRect(const NSRect element, const NSRect query)
+{
+	return CBHRect_isPointInRect(element, query.origin);
+}
+
+#if CBH_VECTOR
+
+typedef CBHVector (*CBHRectArrayVectorPredicate)(CBHVector x, CBHVector y, CBHVector width, CBHVector height, NSRect query);
+
+NS_INLINE CBHVector _CBHRectArray_vectorIsEmpty(const CBHVector x, const CBHVector y, const CBHVector width, const CBHVector height, const NSRect query)
+{
+	const CBHVector zero = CBHVector_set(0.0);
+
+	return CBHVector_or(CBHVector_isLessOrEqual(width, zero), CBHVector_isLessOrEqual(height, zero));
+}
+
+NS_INLINE CBHVector _CBHRectArray_vectorIsIntersecting(const CBHVector x, const CBHVector y, const CBHVector width, const CBHVector height, const NSRect query)
+{
+	const CBHVector minX = CBHVector_set(query.origin.x);
+	const CBHVector minY = CBHVector_set(query.origin.y);
+	const CBHVector maxX = CBHVector_set(query.origin.x + query.size.width);
+	const CBHVector maxY = CBHVector_set(query.origin.y + query.size.height);
+
+	CBHVector result = CBHVector_and(CBHVector_isLess(x, maxX), CBHVector_isLess(minX, CBHVector_add(x, width)));
+	result = CBHVector_and(result, CBHVector_and(CBHVector_isLess(y, maxY), CBHVector_isLess(minY, CBHVector_add(y, height))));
+
+	return CBHVector_andNot(result, _CBHRectArray_vectorIsEmpty(x, y, width, height, query));
+}
+
+NS_INLINE CBHVector _CBHRectArray_vectorIsCovering(const CBHVector x, const CBHVector y, const CBHVector width, const CBHVector height, const NSRect query)
+{
+	const CBHVector minX = CBHVector_set(query.origin.x);
+	const CBHVector minY = CBHVector_set(query.origin.y);
+	const CBHVector maxX = CBHVector_set(query.origin.x + query.size.width);
+	const CBHVector maxY = CBHVector_set(query.origin.y + query.size.height);
+
+	CBHVector result = CBHVector_and(CBHVector_isLessOrEqual(x, minX), CBHVector_isLessOrEqual(y, minY));
+	result = CBHVector_and(result, CBHVector_and(CBHVector_isLessOrEqual(maxX, CBHVector_add(x, width)), CBHVector_isLessOrEqual(maxY, CBHVector_add(y, height))));
+
+	return result;
+}
+
+NS_INLINE CBHVector _CBHRectArray_vectorIsCoveredBy(const CBHVector x, const CBHVector y, const CBHVector width, const CBHVector height, const NSRect query)
+{
+	const CBHVector minX = CBHVector_set(query.origin.x);
+	const CBHVector minY = CBHVector_set(query.origin.y);
+	const CBHVector maxX = CBHVector_set(query.origin.x + query.size.width);
+	const CBHVector maxY = CBHVector_set(query.origin.y + query.size.height);
+
+	CBHVector result = CBHVector_and(CBHVector_isLessOrEqual(minX, x), CBHVector_isLessOrEqual(minY, y));
+	result = CBHVector_and(result, CBHVector_and(CBHVector_isLessOrEqual(CBHVector_add(x, width), maxX), CBHVector_isLessOrEqual(CBHVector_add(y, height), maxY)));
+
+	return CBHVector_andNot(result, _CBHRectArray_vectorIsEmpty(x, y, width, height, query));
+}
+
+NS_INLINE CBHVector _CBHRectArray_vectorIsPointInRect(const CBHVector x, const CBHVector y, const CBHVector width, const CBHVector height, const NSRect query)
+{
+	const CBHVector pointX = CBHVector_set(query.origin.x);
+	const CBHVector pointY = CBHVector_set(query.origin.y);
+
+	CBHVector result = CBHVector_and(CBHVector_isLessOrEqual(x, pointX), CBHVector_isLess(pointX, CBHVector_add(x, width)));
+	result = CBHVector_and(result, CBHVector_and(CBHVector_isLessOrEqual(y, pointY), CBHVector_isLess(pointY, CBHVector_add(y, height))));
+
+	return result;
+}
+
+#else
+
+typedef void *CBHRectArrayVectorPredicate;
+
+#define _CBHRectArray_vectorIsEmpty NULL
+#define _CBHRectArray_vectorIsIntersecting NULL
+#define _CBHRectArray_vectorIsCovering NULL
+#define _CBHRectArray_vectorIsCoveredBy NULL
+#define _CBHRectArray_vectorIsPointInRect NULL
+
+#endif
+
+
+#pragma mark - Evaluating Predicates
+
+// Evaluates a predicate over the rects in [start, end) which must not span more than one mask word.
+NS_INLINE uint64_t _CBHRectArray_evaluateBlock(const CBHRectArray * const array, const NSUInteger start, const NSUInteger end, const NSRect query, const CBHRectArrayScalarPredicate scalar, const CBHRectArrayVectorPredicate vector)
+{
+	uint64_t bits = 0;
+	NSUInteger i = start;
+
+#if CBH_VECTOR
+	for ( ; i + CBH_VECTOR_WIDTH <= end; i += CBH_VECTOR_WIDTH )
+	{
+		const CBHVector result = vector(CBHVector_load(array->x + i), CBHVector_load(array->y + i), CBHVector_load(array->width + i), CBHVector_load(array->height + i), query);
+		bits |= (uint64_t)CBHVector_mask(result) << (i - start);
+	}
+#endif
+
+	for ( ; i < end; ++i )
+	{
+		bits |= (uint64_t)( scalar(CBHRectArray_rectAtIndex(array, i), query) ? 1 : 0 ) << (i - start);
+	}
+
+	return bits;
+}
+
+// Masks of large arrays are split between threads by mask word with `CBHParallel_apply()`, each range writing its own
+// words and adding its matches to the total.
+typedef struct CBHRectArrayMaskBatch
+{
+	const CBHRectArray *array;
+	NSRect query;
+	uint64_t *mask;
+	_Atomic(NSUInteger) matches;
+} CBHRectArrayMaskBatch;
+
+NS_INLINE void _CBHRectArray_maskWords(CBHRectArrayMaskBatch * const batch, const NSRange words, const CBHRectArrayScalarPredicate scalar, const CBHRectArrayVectorPredicate vector)
+{
+	const CBHRectArray * const array = batch->array;
+	NSUInteger matches = 0;
+
+	for (NSUInteger word = words.location; word < NSMaxRange(words); ++word)
+	{
+		const NSUInteger start = word * kCBHMaskBits;
+		const uint64_t bits = _CBHRectArray_evaluateBlock(array, start, MIN(start + kCBHMaskBits, array->count), batch->query, scalar, vector);
+
+		batch->mask[word] = bits;
+		matches += (NSUInteger)__builtin_popcountll(bits);
+	}
+
+	atomic_fetch_add_explicit(&batch->matches, matches, memory_order_relaxed);
+}
+
+static void _CBHRectArray_isEmptyWorker(void * const context, const NSRange words)
+{
+	_CBHRectArray_maskWords(context, words, _CBHRectArray_isEmpty, _CBHRectArray_vectorIsEmpty);
+}
+
+static void _CBHRectArray_isIntersectingWorker(void * const context, const NSRange words)
+{
+	_CBHRectArray_maskWords(context, words, _CBHRectArray_isIntersecting, _CBHRectArray_vectorIsIntersecting);
+}
+
+static void _CBHRectArray_isCoveringWorker(void * const context, const NSRange words)
+{
+	_CBHRectArray_maskWords(context, words, _CBHRectArray_isCovering, _CBHRectArray_vectorIsCovering);
+}
+
+static void _CBHRectArray_isCoveredByWorker(void * const context, const NSRange words)
+{
+	_CBHRectArray_maskWords(context, words, _CBHRectArray_isCoveredBy, _CBHRectArray_vectorIsCoveredBy);
+}
+
+static void _CBHRectArray_isPointInRectWorker(void * const context, const NSRange words)
+{
+	_CBHRectArray_maskWords(context, words, _CBHRectArray_isPointInRect, _CBHRectArray_vectorIsPointInRect);
+}
+
+static NSUInteger _CBHRectArray_mask(const CBHRectArray * const array, const NSRect query, uint64_t * const mask, const CBHParallelFunction worker)
+{
+	const NSUInteger words = (array->count + kCBHMaskBits - 1) / kCBHMaskBits;
+
+	CBHRectArrayMaskBatch batch = { .array = array, .query = query, .mask = mask };
+	atomic_init(&batch.matches, 0);
+
+	CBHParallel_applyWithGrainSize(words, CBHParallel_grainSizeForUnit(kCBHMaskBits), &batch, worker);
+
+	return atomic_load_explicit(&batch.matches, memory_order_relaxed);
+}
+
+NS_INLINE NSUInteger _CBHRectArray_indexes(const CBHRectArray * const array, const NSRect query, NSUInteger * const indexes, const CBHRectArrayScalarPredicate scalar, const CBHRectArrayVectorPredicate vector)
+{
+	NSUInteger matches = 0;
+
+	for (NSUInteger start = 0; start < array->count; start += kCBHMaskBits)
+	{
+		uint64_t bits = _CBHRectArray_evaluateBlock(array, start, MIN(start + kCBHMaskBits, array->count), query, scalar, vector);
+
+		while ( bits != 0 )
+		{
+			indexes[matches++] = start + (NSUInteger)__builtin_ctzll(bits);
+			bits &= bits - 1;
+		}
+	}
+
+	return matches;
+}
+
+static NSUInteger _CBHRectArray_clearMask(const CBHRectArray * const array, uint64_t * const mask)
+{
+	const NSUInteger words = (array->count + kCBHMaskBits - 1) / kCBHMaskBits;
+	if ( words > 0 ) { memset(mask, 0, words * sizeof(uint64_t)); }
+
+	return 0;
+}
+
+
+#pragma mark - Checking Rects
+
+NSUInteger CBHRectArray_isEmptyMask(const CBHRectArray * const array, uint64_t * const mask)
+{
+	return _CBHRectArray_mask(array, NSZeroRect, mask, _CBHRectArray_isEmptyWorker);
+}
+
+NSUInteger CBHRectArray_isIntersectingMask(const CBHRectArray * const array, const NSRect rect, uint64_t * const mask)
+{
+	if ( CBHRect_isEmpty(rect) ) { return _CBHRectArray_clearMask(array, mask); }
+
+	return _CBHRectArray_mask(array, rect, mask, _CBHRectArray_isIntersectingWorker);
+}
+
+NSUInteger CBHRectArray_isCoveringMask(const CBHRectArray * const array, const NSRect rect, uint64_t * const mask)
+{
+	if ( CBHRect_isEmpty(rect) ) { return _CBHRectArray_clearMask(array, mask); }
+
+	return _CBHRectArray_mask(array, rect, mask, _CBHRectArray_isCoveringWorker);
+}
+
+NSUInteger CBHRectArray_isCoveredByMask(const CBHRectArray * const array, const NSRect rect, uint64_t * const mask)
+{
+	return _CBHRectArray_mask(array, rect, mask, _CBHRectArray_isCoveredByWorker);
+}
+
+NSUInteger CBHRectArray_isPointInRectMask(const CBHRectArray * const array, const NSPoint point, uint64_t * const mask)
+{
+	const NSRect query = (NSRect){ point, { .width = 0.0, .height = 0.0 } };
+
+	return _CBHRectArray_mask(array, query, mask, _CBHRectArray_isPointInRectWorker);
+}
+
+
+NSUInteger CBHRectArray_isEmptyIndexes(const CBHRectArray * const array, NSUInteger * const indexes)
+{
+	return _CBHRectArray_indexes(array, NSZeroRect, indexes, _CBHRectArray_isEmpty, _CBHRectArray_vectorIsEmpty);
+}
+
+NSUInteger CBHRectArray_isIntersectingIndexes(const CBHRectArray * const array, const NSRect rect, NSUInteger * const indexes)
+{
+	if ( CBHRect_isEmpty(rect) ) { return 0; }
+
+	return _CBHRectArray_indexes(array, rect, indexes, _CBHRectArray_isIntersecting, _CBHRectArray_vectorIsIntersecting);
+}
+
+NSUInteger CBHRectArray_isCoveringIndexes(const CBHRectArray * const array, const NSRect rect, NSUInteger * const indexes)
+{
+	if ( CBHRect_isEmpty(rect) ) { return 0; }
+
+	return _CBHRectArray_indexes(array, rect, indexes, _CBHRectArray_isCovering, _CBHRectArray_vectorIsCovering);
+}
+
+NSUInteger CBHRectArray_isCoveredByIndexes(const CBHRectArray * const array, const NSRect rect, NSUInteger * const indexes)
+{
+	return _CBHRectArray_indexes(array, rect, indexes, _CBHRectArray_isCoveredBy, _CBHRectArray_vectorIsCoveredBy);
+}
+
+NSUInteger CBHRectArray_isPointInRectIndexes(const CBHRectArray * const array, const NSPoint point, NSUInteger * const indexes)
+{
+	const NSRect query = (NSRect){ point, { .width = 0.0, .height = 0.0 } };
+
+	return _CBHRectArray_indexes(array, query, indexes, _CBHRectArray_isPointInRect, _CBHRectArray_vectorIsPointInRect);
+}
+
+
+#pragma mark - Snapping Rects to Pixels
+
+typedef struct CBHRectArraySnap
+{
+	CBHRectArray *array;
+	CGFloat scale;
+} CBHRectArraySnap;
+
+NS_INLINE void _CBHRectArray_snapColumns(const CBHRectArraySnap * const batch, const NSRange range, const CBHPixelSnap originSnap, const CBHPixelSnap sizeSnap)
+{
+	CBHRectArray * const array = batch->array;
+	const CGFloat factor = batch->scale;
+	NSUInteger i = range.location;
+
+#if CBH_VECTOR
+	const CBHVector scale = CBHVector_set(factor);
+
+	for ( ; i + CBH_VECTOR_WIDTH <= NSMaxRange(range); i += CBH_VECTOR_WIDTH )
+	{
+		CBHVector_store(array->x + i, CBHPixelVector_snap(CBHVector_load(array->x + i), scale, originSnap));
+		CBHVector_store(array->y + i, CBHPixelVector_snap(CBHVector_load(array->y + i), scale, originSnap));
+		CBHVector_store(array->width + i, CBHPixelVector_snap(CBHVector_load(array->width + i), scale, sizeSnap));
+		CBHVector_store(array->height + i, CBHPixelVector_snap(CBHVector_load(array->height + i), scale, sizeSnap));
+	}
+#endif
+
+	for ( ; i < NSMaxRange(range); ++i )
+	{
+		array->x[i] = CBHPixel_snap(array->x[i], factor, originSnap);
+		array->y[i] = CBHPixel_snap(array->y[i], factor, originSnap);
+		array->width[i] = CBHPixel_snap(array->width[i], factor, sizeSnap);
+		array->height[i] = CBHPixel_snap(array->height[i], factor, sizeSnap);
+	}
+}
+
+static void _CBHRectArray_integralWorker(void * const context, const NSRange range)
+{
+	const CBHRectArraySnap * const batch = context;
+	CBHRectArray * const array = batch->array;
+	NSUInteger i = range.location;
+
+#if CBH_VECTOR
+	const CBHVector scale = CBHVector_set(batch->scale);
+	const CBHVector zero = CBHVector_set(0.0);
+
+	for ( ; i + CBH_VECTOR_WIDTH <= NSMaxRange(range); i += CBH_VECTOR_WIDTH )
+	{
+		CBHVector x = CBHVector_load(array->x + i);
+		CBHVector y = CBHVector_load(array->y + i);
+		CBHVector width = CBHVector_load(array->width + i);
+		CBHVector height = CBHVector_load(array->height + i);
+
+		const CBHVector filled = CBHVector_and(CBHVector_isLess(zero, width), CBHVector_isLess(zero, height));
+		CBHPixelVector_integral(&x, &width, filled, scale);
+		CBHPixelVector_integral(&y, &height, filled, scale);
+
+		CBHVector_store(array->x + i, x);
+		CBHVector_store(array->y + i, y);
+		CBHVector_store(array->width + i, width);
+		CBHVector_store(array->height + i, height);
+	}
+#endif
+
+	for ( ; i < NSMaxRange(range); ++i )
+	{
+		CBHRectArray_setRectAtIndex(array, CBHPixel_integralRect(CBHRectArray_rectAtIndex(array, i), batch->scale), i);
+	}
+}
+
+static void _CBHRectArray_truncateWorker(void * const context, const NSRange range)
+{
+	_CBHRectArray_snapColumns(context, range, CBHPixelSnapTruncate, CBHPixelSnapTruncate);
+}
+
+static void _CBHRectArray_roundWorker(void * const context, const NSRange range)
+{
+	_CBHRectArray_snapColumns(context, range, CBHPixelSnapRound, CBHPixelSnapRound);
+}
+
+static void _CBHRectArray_alignWorker(void * const context, const NSRange range)
+{
+	_CBHRectArray_snapColumns(context, range, CBHPixelSnapCenter, CBHPixelSnapTruncate);
+}
+
+
+void CBHRectArray_integral(CBHRectArray * const array, const CGFloat scale)
+{
+	CBHRectArraySnap batch = { .array = array, .scale = scale };
+	CBHParallel_apply(array->count, &batch, _CBHRectArray_integralWorker);
+}
+
+void CBHRectArray_truncate(CBHRectArray * const array, const CGFloat scale)
+{
+	CBHRectArraySnap batch = { .array = array, .scale = scale };
+	CBHParallel_apply(array->count, &batch, _CBHRectArray_truncateWorker);
+}
+
+void CBHRectArray_round(CBHRectArray * const array, const CGFloat scale)
+{
+	CBHRectArraySnap batch = { .array = array, .scale = scale };
+	CBHParallel_apply(array->count, &batch, _CBHRectArray_roundWorker);
+}
+
+void CBHRectArray_alignWithPixels(CBHRectArray * const array, const CGFloat scale)
+{
+	CBHRectArraySnap batch = { .array = array, .scale = scale };
+	CBHParallel_apply(array->count, &batch, _CBHRectArray_alignWorker);
+}
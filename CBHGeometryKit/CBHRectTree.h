@@ -0,0 +1,165 @@
+//  CBHRectTree.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** An immutable R-tree over a set of rects, bulk-loaded with Sort-Tile-Recursive packing.
+ *
+ * Nodes are stored contiguously in breadth-first order with each node's child bounds held in columns so a node can be
+ * tested in a handful of vector operations. Queries do not allocate.
+ *
+ * Queries report the index of each matching rect in the array the tree was created from and agree exactly with
+ * `NSRect_isIntersecting()`, `NSRect_isCovering()`, and `NSRect_isPointInRect()`. In particular empty rects (those
+ * with a 0 or negative width or height) are never reported.
+ */
+typedef struct CBHRectTree CBHRectTree;
+
+/** A function called for each match during an enumeration.
+ *
+ * @param index         The index of the matching rect.
+ * @param context       The context given to the enumeration.
+ * @param stop          Set to `YES` to stop the enumeration.
+ */
+typedef void (*CBHRectTreeCallback)(NSUInteger index, void * _Nullable context, BOOL *stop);
+
+
+#pragma mark - Creating Rect Trees
+
+/**
+ * @name Creating Rect Trees
+ */
+
+/** Creates a rect tree from a C array of rects.
+ *
+ * @param rects         The rects to index. The tree does not keep a reference to them.
+ * @param count         The number of rects in _rects_.
+ *
+ * @return              A new tree, or `NULL` if the storage could not be allocated. Release it with `CBHRectTree_destroy()`.
+ */
+CBHRectTree * _Nullable CBHRectTree_createWithRects(const NSRect *rects, NSUInteger count);
+
+/** Releases a rect tree.
+ *
+ * @param tree          The tree to release.
+ */
+void CBHRectTree_destroy(CBHRectTree * _Nullable tree);
+
+
+#pragma mark - Properties
+
+/**
+ * @name Properties
+ */
+
+/** The number of rects the tree was created from, including any empty rects.
+ *
+ * @param tree          The tree.
+ *
+ * @return              The number of rects.
+ */
+NSUInteger CBHRectTree_count(const CBHRectTree *tree);
+
+/** The union of all the non-empty rects in the tree.
+ *
+ * @param tree          The tree.
+ *
+ * @return              A `NSRect` covering every indexed rect, or an empty rect if there are none.
+ */
+NSRect CBHRectTree_bounds(const CBHRectTree *tree);
+
+
+#pragma mark - Querying Indexes
+
+/**
+ * @name Querying Indexes
+ *
+ * These functions write up to _capacity_ matching indexes in no particular order and return the total number of
+ * matches, which may exceed _capacity_.
+ */
+
+/** Finds the rects which intersect a rect.
+ *
+ * @param tree          The tree.
+ * @param rect          The rect to test against.
+ * @param indexes       A buffer to receive the indexes.
+ * @param capacity      The number of elements _indexes_ can hold.
+ *
+ * @return              The number of rects for which `NSRect_isIntersecting()` is `YES`.
+ */
+NSUInteger CBHRectTree_intersectingIndexes(const CBHRectTree *tree, NSRect rect, NSUInteger * _Nullable indexes, NSUInteger capacity);
+
+/** Finds the rects which are covered by a rect.
+ *
+ * @param tree          The tree.
+ * @param rect          The covering rect.
+ * @param indexes       A buffer to receive the indexes.
+ * @param capacity      The number of elements _indexes_ can hold.
+ *
+ * @return              The number of rects for which `NSRect_isCovering(rect, ...)` is `YES`.
+ */
+NSUInteger CBHRectTree_coveredByIndexes(const CBHRectTree *tree, NSRect rect, NSUInteger * _Nullable indexes, NSUInteger capacity);
+
+/** Finds the rects which contain a point.
+ *
+ * @param tree          The tree.
+ * @param point         The point.
+ * @param indexes       A buffer to receive the indexes.
+ * @param capacity      The number of elements _indexes_ can hold.
+ *
+ * @return              The number of rects for which `NSRect_isPointInRect()` is `YES`.
+ */
+NSUInteger CBHRectTree_containingPointIndexes(const CBHRectTree *tree, NSPoint point, NSUInteger * _Nullable indexes, NSUInteger capacity);
+
+
+#pragma mark - Enumerating Matches
+
+/**
+ * @name Enumerating Matches
+ */
+
+/** Calls a function for each rect which intersects a rect.
+ *
+ * @param tree          The tree.
+ * @param rect          The rect to test against.
+ * @param callback      The function to call for each match.
+ * @param context       A value passed to _callback_.
+ */
+void CBHRectTree_enumerateIntersecting(const CBHRectTree *tree, NSRect rect, CBHRectTreeCallback callback, void * _Nullable context);
+
+/** Calls a function for each rect which is covered by a rect.
+ *
+ * @param tree          The tree.
+ * @param rect          The covering rect.
+ * @param callback      The function to call for each match.
+ * @param context       A value passed to _callback_.
+ */
+void CBHRectTree_enumerateCoveredBy(const CBHRectTree *tree, NSRect rect, CBHRectTreeCallback callback, void * _Nullable context);
+
+/** Calls a function for each rect which contains a point.
+ *
+ * @param tree          The tree.
+ * @param point         The point.
+ * @param callback      The function to call for each match.
+ * @param context       A value passed to _callback_.
+ */
+void CBHRectTree_enumerateContainingPoint(const CBHRectTree *tree, NSPoint point, CBHRectTreeCallback callback, void * _Nullable context);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,593 @@
+//  CBHRectTree.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHRectTree.h"
+
+#import "_CBHGeometryKit+Utilities.h"
+#import "_CBHGeometryKit+Vector.h"
+#import "_CBHGeometryKit+Predicates.h"
+#import "_CBHGeometryKit+IndexSink.h"
+
+#import <math.h>
+#import <stdlib.h>
+#import <string.h>
+
+
+// Sixteen children keep a node's bounds within eight cache lines and a whole number of vector steps. With this
+// fan-out no tree over an addressable number of rects is taller than `kCBHRectTreeMaxHeight`, which bounds the
+// query stack.
+enum { kCBHRectTreeFanout = 16 };
+enum { kCBHRectTreeMaxHeight = 16 };
+
+static const NSUInteger kCBHRectTreeAlignment = 64;
+
+
+// Nodes are stored breadth first so the children of every node, and the entries beneath every node, are contiguous.
+// Leaves make up the last level. Child bounds are stored as edges rather than sizes so that a rect's maximum edges are
+// computed once, exactly as the predicates compute them.
+typedef struct CBHRectTreeNode
+{
+	CGFloat minX[kCBHRectTreeFanout];
+	CGFloat minY[kCBHRectTreeFanout];
+	CGFloat maxX[kCBHRectTreeFanout];
+	CGFloat maxY[kCBHRectTreeFanout];
+
+	NSUInteger first;	// The first child node, or for leaves the first entry.
+	NSUInteger count;
+	NSUInteger start;	// The entries beneath the node.
+	NSUInteger end;
+} CBHRectTreeNode;
+
+struct CBHRectTree
+{
+	CBHRectTreeNode * _Nullable nodes;
+	NSUInteger * _Nullable indexes;
+
+	NSUInteger nodeCount;
+	NSUInteger leafStart;
+	NSUInteger count;
+	NSRect bounds;
+};
+
+
+#pragma mark - Packing
+
+typedef struct CBHRectTreeEntry
+{
+	CGFloat minX;
+	CGFloat minY;
+	CGFloat maxX;
+	CGFloat maxY;
+
+	NSUInteger index;
+} CBHRectTreeEntry;
+
+// Entries are ordered by their centres. The sum of the edges orders the same way without the division.
+static int _CBHRectTreeEntry_compareX(const void * const a, const void * const b)
+{
+	const CBHRectTreeEntry * const lhs = a;
+	const CBHRectTreeEntry * const rhs = b;
+
+	const CGFloat left = lhs->minX + lhs->maxX;
+	const CGFloat right = rhs->minX + rhs->maxX;
+
+	return (left > right) - (left < right);
+}
+
+static int _CBHRectTreeEntry_compareY(const void * const a, const void * const b)
+{
+	const CBHRectTreeEntry * const lhs = a;
+	const CBHRectTreeEntry * const rhs = b;
+
+	const CGFloat left = lhs->minY + lhs->maxY;
+	const CGFloat right = rhs->minY + rhs->maxY;
+
+	return (left > right) - (left < right);
+}
+
+NS_INLINE NSUInteger _CBHRectTree_nodeCount(const NSUInteger entries)
+{
+	return (entries + kCBHRectTreeFanout - 1) / kCBHRectTreeFanout;
+}
+
+// Sorts entries into vertical slices of whole nodes and each slice from bottom to top, so that each run of
+// `kCBHRectTreeFanout` entries forms a compact node.
+static void _CBHRectTree_sortTiles(CBHRectTreeEntry * const entries, const NSUInteger count)
+{
+	const NSUInteger slices = (NSUInteger)ceil(sqrt((double)_CBHRectTree_nodeCount(count)));
+	const NSUInteger sliceLength = slices * kCBHRectTreeFanout;
+
+	qsort(entries, count, sizeof(CBHRectTreeEntry), _CBHRectTreeEntry_compareX);
+
+	for (NSUInteger start = 0; start < count; start += sliceLength)
+	{
+		qsort(entries + start, MIN(sliceLength, count - start), sizeof(CBHRectTreeEntry), _CBHRectTreeEntry_compareY);
+	}
+}
+
+static CBHRectTreeEntry _CBHRectTree_unionEntries(const CBHRectTreeEntry * const entries, const NSUInteger count, const NSUInteger index)
+{
+	CBHRectTreeEntry result = entries[0];
+	result.index = index;
+
+	for (NSUInteger i = 1; i < count; ++i)
+	{
+		result.minX = MIN(result.minX, entries[i].minX);
+		result.minY = MIN(result.minY, entries[i].minY);
+		result.maxX = MAX(result.maxX, entries[i].maxX);
+		result.maxY = MAX(result.maxY, entries[i].maxY);
+	}
+
+	return result;
+}
+
+// Packs each level from the one below it and then lays the nodes out breadth first. `entries[level]` holds the
+// children of that level's nodes in packed order, each node taking the next `kCBHRectTreeFanout` of them.
+static BOOL _CBHRectTree_build(CBHRectTree * const tree, const NSRect * const rects, const NSUInteger count, CBHRectTreeEntry * _Nullable * const entries)
+{
+	NSUInteger lengths[kCBHRectTreeMaxHeight] = { 0 };
+	NSUInteger offsets[kCBHRectTreeMaxHeight] = { 0 };
+
+	entries[0] = malloc(sizeof(CBHRectTreeEntry) * MAX(count, 1UL));
+	if ( entries[0] == NULL ) { return NO; }
+
+	// Empty rects never match so they are left out, as are rects with a NaN edge which would disorder the sort.
+	NSUInteger length = 0;
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		const NSRect rect = rects[i];
+		if ( CBHRect_isEmpty(rect) ) { continue; }
+
+		const CGFloat maxX = rect.origin.x + rect.size.width;
+		const CGFloat maxY = rect.origin.y + rect.size.height;
+		if ( !((rect.origin.x <= maxX) && (rect.origin.y <= maxY)) ) { continue; }
+
+		entries[0][length++] = (CBHRectTreeEntry){ .minX = rect.origin.x, .minY = rect.origin.y, .maxX = maxX, .maxY = maxY, .index = i };
+	}
+
+	if ( length == 0 ) { return YES; }
+
+	NSUInteger height = 0;
+	while ( YES )
+	{
+		_CBHRectTree_sortTiles(entries[height], length);
+		lengths[height] = length;
+
+		const NSUInteger nodes = _CBHRectTree_nodeCount(length);
+		height += 1;
+
+		if ( nodes == 1 ) { break; }
+		if ( height == kCBHRectTreeMaxHeight ) { return NO; }
+
+		entries[height] = malloc(sizeof(CBHRectTreeEntry) * nodes);
+		if ( entries[height] == NULL ) { return NO; }
+
+		for (NSUInteger j = 0; j < nodes; ++j)
+		{
+			const NSUInteger start = j * kCBHRectTreeFanout;
+			entries[height][j] = _CBHRectTree_unionEntries(entries[height - 1] + start, MIN((NSUInteger)kCBHRectTreeFanout, length - start), j);
+		}
+
+		length = nodes;
+	}
+
+	NSUInteger nodeCount = 0;
+	for (NSUInteger level = height; level-- > 0; )
+	{
+		offsets[level] = nodeCount;
+		nodeCount += _CBHRectTree_nodeCount(lengths[level]);
+	}
+
+	void *storage = NULL;
+	if ( posix_memalign(&storage, kCBHRectTreeAlignment, sizeof(CBHRectTreeNode) * nodeCount) != 0 ) { return NO; }
+	memset(storage, 0, sizeof(CBHRectTreeNode) * nodeCount);
+
+	tree->nodes = storage;
+	tree->nodeCount = nodeCount;
+	tree->leafStart = offsets[0];
+
+	tree->indexes = malloc(sizeof(NSUInteger) * lengths[0]);
+	if ( tree->indexes == NULL ) { return NO; }
+
+	// The packed group placed at each breadth first position.
+	NSUInteger * const groups = malloc(sizeof(NSUInteger) * nodeCount);
+	if ( groups == NULL ) { return NO; }
+
+	groups[0] = 0;
+	NSUInteger indexCount = 0;
+
+	for (NSUInteger level = height; level-- > 0; )
+	{
+		const NSUInteger levelNodes = _CBHRectTree_nodeCount(lengths[level]);
+		NSUInteger children = 0;
+
+		for (NSUInteger k = 0; k < levelNodes; ++k)
+		{
+			const NSUInteger position = offsets[level] + k;
+			const NSUInteger start = groups[position] * kCBHRectTreeFanout;
+			const CBHRectTreeEntry * const members = entries[level] + start;
+
+			CBHRectTreeNode * const node = &tree->nodes[position];
+			node->count = MIN((NSUInteger)kCBHRectTreeFanout, lengths[level] - start);
+			node->first = ( level == 0 ) ? indexCount : offsets[level - 1] + children;
+
+			for (NSUInteger i = 0; i < node->count; ++i)
+			{
+				node->minX[i] = members[i].minX;
+				node->minY[i] = members[i].minY;
+				node->maxX[i] = members[i].maxX;
+				node->maxY[i] = members[i].maxY;
+
+				if ( level == 0 ) { tree->indexes[indexCount++] = members[i].index; }
+				else { groups[offsets[level - 1] + children++] = members[i].index; }
+			}
+		}
+	}
+
+	free(groups);
+
+	// Children always follow their parent so a reverse pass sees them first.
+	for (NSUInteger position = nodeCount; position-- > 0; )
+	{
+		CBHRectTreeNode * const node = &tree->nodes[position];
+
+		if ( position >= tree->leafStart )
+		{
+			node->start = node->first;
+			node->end = node->first + node->count;
+		}
+		else
+		{
+			node->start = tree->nodes[node->first].start;
+			node->end = tree->nodes[node->first + node->count - 1].end;
+		}
+	}
+
+	const CBHRectTreeEntry bounds = _CBHRectTree_unionEntries(entries[height - 1], lengths[height - 1], 0);
+	tree->bounds = (NSRect){ { .x = bounds.minX, .y = bounds.minY }, { .width = bounds.maxX - bounds.minX, .height = bounds.maxY - bounds.minY } };
+
+	return YES;
+}
+
+
+#pragma mark - Creating Rect Trees
+
+CBHRectTree *CBHRectTree_createWithRects(const NSRect * const rects, const NSUInteger count)
+{
+	CBHRectTree * const tree = calloc(1, sizeof(CBHRectTree));
+	if ( tree == NULL ) { return NULL; }
+
+	tree->count = count;
+	tree->bounds = NSZeroRect;
+
+	CBHRectTreeEntry *entries[kCBHRectTreeMaxHeight] = { NULL };
+	const BOOL success = _CBHRectTree_build(tree, rects, count, entries);
+
+	for (NSUInteger level = 0; level < kCBHRectTreeMaxHeight; ++level)
+	{
+		free(entries[level]);
+	}
+
+	if ( !success )
+	{
+		CBHRectTree_destroy(tree);
+		return NULL;
+	}
+
+	return tree;
+}
+
+void CBHRectTree_destroy(CBHRectTree * const tree)
+{
+	if ( tree == NULL ) { return; }
+
+	free(tree->nodes);
+	free(tree->indexes);
+	free(tree);
+}
+
+
+#pragma mark - Properties
+
+CBH_PURE NSUInteger CBHRectTree_count(const CBHRectTree * const tree)
+{
+	return tree->count;
+}
+
+CBH_PURE NSRect CBHRectTree_bounds(const CBHRectTree * const tree)
+{
+	return tree->bounds;
+}
+
+
+#pragma mark - Testing Nodes
+
+// A query is held as edges. Point queries have equal minimum and maximum edges.
+typedef struct CBHRectTreeQuery
+{
+	CGFloat minX;
+	CGFloat minY;
+	CGFloat maxX;
+	CGFloat maxY;
+} CBHRectTreeQuery;
+
+NS_INLINE CBHRectTreeQuery _CBHRectTreeQuery_initWithRect(const NSRect rect)
+{
+	return (CBHRectTreeQuery){ .minX = rect.origin.x, .minY = rect.origin.y, .maxX = rect.origin.x + rect.size.width, .maxY = rect.origin.y + rect.size.height };
+}
+
+NS_INLINE CBHRectTreeQuery _CBHRectTreeQuery_initWithPoint(const NSPoint point)
+{
+	return (CBHRectTreeQuery){ .minX = point.x, .minY = point.y, .maxX = point.x, .maxY = point.y };
+}
+
+NS_INLINE unsigned int _CBHRectTreeNode_usedMask(const CBHRectTreeNode * const node)
+{
+	return (unsigned int)((1UL << node->count) - 1);
+}
+
+// Children whose bounds overlap the query. For a leaf this is `CBHRect_isIntersecting()`, and a node can only hold an
+// intersecting rect if it overlaps. With `inclusive` the edges may touch, which is what a node needs to hold a rect
+// covered by the query.
+NS_INLINE unsigned int _CBHRectTreeNode_overlapping(const CBHRectTreeNode * const node, const CBHRectTreeQuery query, const BOOL inclusive)
+{
+	unsigned int bits = 0;
+
+#if CBH_VECTOR
+	const CBHVector minX = CBHVector_set(query.minX);
+	const CBHVector minY = CBHVector_set(query.minY);
+	const CBHVector maxX = CBHVector_set(query.maxX);
+	const CBHVector maxY = CBHVector_set(query.maxY);
+
+	for (NSUInteger i = 0; i < kCBHRectTreeFanout; i += CBH_VECTOR_WIDTH)
+	{
+		CBHVector result;
+
+		if ( inclusive )
+		{
+			result = CBHVector_and(CBHVector_isLessOrEqual(CBHVector_load(node->minX + i), maxX), CBHVector_isLessOrEqual(minX, CBHVector_load(node->maxX + i)));
+			result = CBHVector_and(result, CBHVector_and(CBHVector_isLessOrEqual(CBHVector_load(node->minY + i), maxY), CBHVector_isLessOrEqual(minY, CBHVector_load(node->maxY + i))));
+		}
+		else
+		{
+			result = CBHVector_and(CBHVector_isLess(CBHVector_load(node->minX + i), maxX), CBHVector_isLess(minX, CBHVector_load(node->maxX + i)));
+			result = CBHVector_and(result, CBHVector_and(CBHVector_isLess(CBHVector_load(node->minY + i), maxY), CBHVector_isLess(minY, CBHVector_load(node->maxY + i))));
+		}
+
+		bits |= CBHVector_mask(result) << i;
+	}
+#else
+	for (NSUInteger i = 0; i < kCBHRectTreeFanout; ++i)
+	{
+		BOOL result;
+
+		if ( inclusive )
+		{
+			result = ( (node->minX[i] <= query.maxX) && (query.minX <= node->maxX[i]) && (node->minY[i] <= query.maxY) && (query.minY <= node->maxY[i]) );
+		}
+		else
+		{
+			result = ( (node->minX[i] < query.maxX) && (query.minX < node->maxX[i]) && (node->minY[i] < query.maxY) && (query.minY < node->maxY[i]) );
+		}
+
+		bits |= (unsigned int)( result ? 1 : 0 ) << i;
+	}
+#endif
+
+	return bits & _CBHRectTreeNode_usedMask(node);
+}
+
+// Children whose bounds lie within the query. For a leaf this is `CBHRect_isCovering()` by the query. Everything
+// beneath a node which lies strictly within the query also intersects it.
+NS_INLINE unsigned int _CBHRectTreeNode_within(const CBHRectTreeNode * const node, const CBHRectTreeQuery query, const BOOL strict)
+{
+	unsigned int bits = 0;
+
+#if CBH_VECTOR
+	const CBHVector minX = CBHVector_set(query.minX);
+	const CBHVector minY = CBHVector_set(query.minY);
+	const CBHVector maxX = CBHVector_set(query.maxX);
+	const CBHVector maxY = CBHVector_set(query.maxY);
+
+	for (NSUInteger i = 0; i < kCBHRectTreeFanout; i += CBH_VECTOR_WIDTH)
+	{
+		CBHVector result;
+
+		if ( strict )
+		{
+			result = CBHVector_and(CBHVector_isLess(minX, CBHVector_load(node->minX + i)), CBHVector_isLess(CBHVector_load(node->maxX + i), maxX));
+			result = CBHVector_and(result, CBHVector_and(CBHVector_isLess(minY, CBHVector_load(node->minY + i)), CBHVector_isLess(CBHVector_load(node->maxY + i), maxY)));
+		}
+		else
+		{
+			result = CBHVector_and(CBHVector_isLessOrEqual(minX, CBHVector_load(node->minX + i)), CBHVector_isLessOrEqual(CBHVector_load(node->maxX + i), maxX));
+			result = CBHVector_and(result, CBHVector_and(CBHVector_isLessOrEqual(minY, CBHVector_load(node->minY + i)), CBHVector_isLessOrEqual(CBHVector_load(node->maxY + i), maxY)));
+		}
+
+		bits |= CBHVector_mask(result) << i;
+	}
+#else
+	for (NSUInteger i = 0; i < kCBHRectTreeFanout; ++i)
+	{
+		BOOL result;
+
+		if ( strict )
+		{
+			result = ( (query.minX < node->minX[i]) && (node->maxX[i] < query.maxX) && (query.minY < node->minY[i]) && (node->maxY[i] < query.maxY) );
+		}
+		else
+		{
+			result = ( (query.minX <= node->minX[i]) && (node->maxX[i] <= query.maxX) && (query.minY <= node->minY[i]) && (node->maxY[i] <= query.maxY) );
+		}
+
+		bits |= (unsigned int)( result ? 1 : 0 ) << i;
+	}
+#endif
+
+	return bits & _CBHRectTreeNode_usedMask(node);
+}
+
+// Children whose bounds contain the point held in the query's minimum edges. For a leaf this is
+// `CBHRect_isPointInRect()`.
+NS_INLINE unsigned int _CBHRectTreeNode_containing(const CBHRectTreeNode * const node, const CBHRectTreeQuery query)
+{
+	unsigned int bits = 0;
+
+#if CBH_VECTOR
+	const CBHVector x = CBHVector_set(query.minX);
+	const CBHVector y = CBHVector_set(query.minY);
+
+	for (NSUInteger i = 0; i < kCBHRectTreeFanout; i += CBH_VECTOR_WIDTH)
+	{
+		CBHVector result = CBHVector_and(CBHVector_isLessOrEqual(CBHVector_load(node->minX + i), x), CBHVector_isLess(x, CBHVector_load(node->maxX + i)));
+		result = CBHVector_and(result, CBHVector_and(CBHVector_isLessOrEqual(CBHVector_load(node->minY + i), y), CBHVector_isLess(y, CBHVector_load(node->maxY + i))));
+
+		bits |= CBHVector_mask(result) << i;
+	}
+#else
+	for (NSUInteger i = 0; i < kCBHRectTreeFanout; ++i)
+	{
+		const BOOL result = ( (node->minX[i] <= query.minX) && (query.minX < node->maxX[i]) && (node->minY[i] <= query.minY) && (query.minY < node->maxY[i]) );
+		bits |= (unsigned int)( result ? 1 : 0 ) << i;
+	}
+#endif
+
+	return bits & _CBHRectTreeNode_usedMask(node);
+}
+
+
+#pragma mark - Searching
+
+typedef NS_ENUM(NSUInteger, CBHRectTreeSearch)
+{
+	CBHRectTreeSearchIntersecting,
+	CBHRectTreeSearchCoveredBy,
+	CBHRectTreeSearchContainingPoint,
+};
+
+static void _CBHRectTree_search(const CBHRectTree * const tree, const CBHRectTreeQuery query, const CBHRectTreeSearch search, CBHIndexSink * const sink)
+{
+	if ( tree->nodeCount == 0 ) { return; }
+
+	NSUInteger stack[kCBHRectTreeMaxHeight * kCBHRectTreeFanout];
+	NSUInteger depth = 0;
+	stack[depth++] = 0;
+
+	while ( depth > 0 && !sink->stop )
+	{
+		const NSUInteger position = stack[--depth];
+		const CBHRectTreeNode * const node = &tree->nodes[position];
+
+		unsigned int candidates = 0;
+		unsigned int matches = 0;
+
+		switch ( search )
+		{
+			case CBHRectTreeSearchIntersecting:
+				candidates = _CBHRectTreeNode_overlapping(node, query, NO);
+				matches = ( position >= tree->leafStart ) ? candidates : _CBHRectTreeNode_within(node, query, YES);
+				break;
+
+			case CBHRectTreeSearchCoveredBy:
+				matches = _CBHRectTreeNode_within(node, query, NO);
+				candidates = ( position >= tree->leafStart ) ? matches : _CBHRectTreeNode_overlapping(node, query, YES);
+				break;
+
+			case CBHRectTreeSearchContainingPoint:
+				candidates = _CBHRectTreeNode_containing(node, query);
+				matches = ( position >= tree->leafStart ) ? candidates : 0;
+				break;
+		}
+
+		if ( position >= tree->leafStart )
+		{
+			for ( ; matches != 0 && !sink->stop; matches &= matches - 1)
+			{
+				CBHIndexSink_emit(sink, tree->indexes[node->first + (NSUInteger)__builtin_ctz(matches)]);
+			}
+
+			continue;
+		}
+
+		for (unsigned int pending = candidates & ~matches; pending != 0; pending &= pending - 1)
+		{
+			stack[depth++] = node->first + (NSUInteger)__builtin_ctz(pending);
+		}
+
+		// Children entirely within the query report everything beneath them without being visited.
+		for ( ; matches != 0 && !sink->stop; matches &= matches - 1)
+		{
+			const CBHRectTreeNode * const child = &tree->nodes[node->first + (NSUInteger)__builtin_ctz(matches)];
+			CBHIndexSink_emitRange(sink, tree->indexes + child->start, child->end - child->start);
+		}
+	}
+}
+
+static NSUInteger _CBHRectTree_searchIndexes(const CBHRectTree * const tree, const CBHRectTreeQuery query, const CBHRectTreeSearch search, NSUInteger * const indexes, const NSUInteger capacity)
+{
+	CBHIndexSink sink = CBHIndexSink_initWithBuffer(indexes, capacity);
+	_CBHRectTree_search(tree, query, search, &sink);
+
+	return sink.count;
+}
+
+static void _CBHRectTree_searchCallback(const CBHRectTree * const tree, const CBHRectTreeQuery query, const CBHRectTreeSearch search, const CBHRectTreeCallback callback, void * const context)
+{
+	CBHIndexSink sink = CBHIndexSink_initWithCallback(callback, context);
+	_CBHRectTree_search(tree, query, search, &sink);
+}
+
+
+#pragma mark - Querying Indexes
+
+NSUInteger CBHRectTree_intersectingIndexes(const CBHRectTree * const tree, const NSRect rect, NSUInteger * const indexes, const NSUInteger capacity)
+{
+	if ( CBHRect_isEmpty(rect) ) { return 0; }
+
+	return _CBHRectTree_searchIndexes(tree, _CBHRectTreeQuery_initWithRect(rect), CBHRectTreeSearchIntersecting, indexes, capacity);
+}
+
+NSUInteger CBHRectTree_coveredByIndexes(const CBHRectTree * const tree, const NSRect rect, NSUInteger * const indexes, const NSUInteger capacity)
+{
+	return _CBHRectTree_searchIndexes(tree, _CBHRectTreeQuery_initWithRect(rect), CBHRectTreeSearchCoveredBy, indexes, capacity);
+}
+
+NSUInteger CBHRectTree_containingPointIndexes(const CBHRectTree * const tree, const NSPoint point, NSUInteger * const indexes, const NSUInteger capacity)
+{
+	return _CBHRectTree_searchIndexes(tree, _CBHRectTreeQuery_initWithPoint(point), CBHRectTreeSearchContainingPoint, indexes, capacity);
+}
+
+
+#pragma mark - Enumerating Matches
+
+void CBHRectTree_enumerateIntersecting(const CBHRectTree * const tree, const NSRect rect, const CBHRectTreeCallback callback, void * const context)
+{
+	if ( CBHRect_isEmpty(rect) ) { return; }
+
+	_CBHRectTree_searchCallback(tree, _CBHRectTreeQuery_initWithRect(rect), CBHRectTreeSearchIntersecting, callback, context);
+}
+
+void CBHRectTree_enumerateCoveredBy(const CBHRectTree * const tree, const NSRect rect, const CBHRectTreeCallback callback, void * const context)
+{
+	_CBHRectTree_searchCallback(tree, _CBHRectTreeQuery_initWithRect(rect), CBHRectTreeSearchCoveredBy, callback, context);
+}
+
+void CBHRectTree_enumerateContainingPoint(const CBHRectTree * const tree, const NSPoint point, const CBHRectTreeCallback callback, void * const context)
+{
+	_CBHRectTree_searchCallback(tree, _CBHRectTreeQuery_initWithPoint(point), CBHRectTreeSearchContainingPoint, callback, context);
+}
@@ -0,0 +1,293 @@
+//  CBHRegion.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** An area made of disjoint rects.
+ *
+ * A region is stored as bands sorted along the y axis, each holding sorted spans along the x axis. Bands never overlap,
+ * spans within a band never overlap or touch, and vertically adjacent bands with identical spans are merged. The
+ * representation of an area is therefore unique: two regions covering the same area hold the same rects in the same
+ * order.
+ *
+ * Rects are half-open like `NSRect_isPointInRect()`. Rects for which `NSRect_isEmpty()` is `YES`, including those with a
+ * negative size, cover nothing; pass them through `NSRect_absolute()` first to use their extent.
+ *
+ * The combining functions sweep both operands once and run in time linear to their band and span counts.
+ */
+typedef struct CBHRegion CBHRegion;
+
+/** A cursor over the rects of a region, from top to bottom and then left to right.
+ *
+ * The region must not be modified while it is being iterated.
+ */
+typedef struct CBHRegionIterator
+{
+	const CBHRegion *region;
+	NSUInteger band;
+	NSUInteger span;
+} CBHRegionIterator;
+
+
+#pragma mark - Creating Regions
+
+/**
+ * @name Creating Regions
+ */
+
+/** Creates an empty region.
+ *
+ * @return              A new region, or `NULL` if the storage could not be allocated. Release it with `CBHRegion_destroy()`.
+ */
+CBHRegion * _Nullable CBHRegion_create(void);
+
+/** Creates a region covering a rect.
+ *
+ * @param rect          The rect to cover.
+ *
+ * @return              A new region, or `NULL` if the storage could not be allocated. Release it with `CBHRegion_destroy()`.
+ */
+CBHRegion * _Nullable CBHRegion_createWithRect(NSRect rect);
+
+/** Creates a region covering the union of a C array of rects.
+ *
+ * @param rects         The rects to cover.
+ * @param count         The number of rects in _rects_.
+ *
+ * @return              A new region, or `NULL` if the storage could not be allocated. Release it with `CBHRegion_destroy()`.
+ */
+CBHRegion * _Nullable CBHRegion_createWithRects(const NSRect *rects, NSUInteger count);
+
+/** Creates a copy of a region.
+ *
+ * @param region        The region to copy.
+ *
+ * @return              A new region, or `NULL` if the storage could not be allocated. Release it with `CBHRegion_destroy()`.
+ */
+CBHRegion * _Nullable CBHRegion_copy(const CBHRegion *region);
+
+/** Releases a region.
+ *
+ * @param region        The region to release.
+ */
+void CBHRegion_destroy(CBHRegion * _Nullable region);
+
+
+#pragma mark - Properties
+
+/**
+ * @name Properties
+ */
+
+/** Indicates whether the region is empty.
+ *
+ * @param region        The region.
+ *
+ * @return              A `BOOL` value that indicates if the region covers nothing.
+ */
+BOOL CBHRegion_isEmpty(const CBHRegion *region);
+
+/** The smallest rect covering the region.
+ *
+ * @param region        The region.
+ *
+ * @return              The bounds of the region, or a rect with its components set to 0 if the region is empty.
+ */
+NSRect CBHRegion_bounds(const CBHRegion *region);
+
+/** The number of disjoint rects making up the region.
+ *
+ * @param region        The region.
+ *
+ * @return              The number of rects.
+ */
+NSUInteger CBHRegion_rectCount(const CBHRegion *region);
+
+/** Indicates whether two regions cover the same area.
+ *
+ * @param region        A region to compare.
+ * @param other         A region to compare against.
+ *
+ * @return              A `BOOL` value that indicates if the two regions are identical.
+ */
+BOOL CBHRegion_isEqual(const CBHRegion *region, const CBHRegion *other);
+
+
+#pragma mark - Modifying Regions
+
+/**
+ * @name Modifying Regions
+ */
+
+/** Removes everything from a region.
+ *
+ * @param region        The region to empty.
+ */
+void CBHRegion_removeAll(CBHRegion *region);
+
+/** Replaces the contents of a region with a rect.
+ *
+ * @param region        The region to modify.
+ * @param rect          The rect to cover.
+ *
+ * @return              `YES` on success, or `NO` if the storage could not be allocated, in which case _region_ is unchanged.
+ */
+BOOL CBHRegion_setRect(CBHRegion *region, NSRect rect);
+
+
+#pragma mark - Combining Regions
+
+/**
+ * @name Combining Regions
+ *
+ * These functions write their result to _result_, which may be the same region as either operand. On failure they
+ * return `NO` and leave _result_ unchanged.
+ */
+
+/** Calculates the union of two regions.
+ *
+ * @param result        The region to receive the result.
+ * @param region        A region.
+ * @param other         Another region.
+ *
+ * @return              `YES` on success, or `NO` if the storage could not be allocated.
+ */
+BOOL CBHRegion_union(CBHRegion *result, const CBHRegion *region, const CBHRegion *other);
+
+/** Calculates the intersection of two regions.
+ *
+ * @param result        The region to receive the result.
+ * @param region        A region.
+ * @param other         Another region.
+ *
+ * @return              `YES` on success, or `NO` if the storage could not be allocated.
+ */
+BOOL CBHRegion_intersection(CBHRegion *result, const CBHRegion *region, const CBHRegion *other);
+
+/** Calculates the area of a region not covered by another.
+ *
+ * @param result        The region to receive the result.
+ * @param region        The region to subtract from.
+ * @param other         The region to subtract.
+ *
+ * @return              `YES` on success, or `NO` if the storage could not be allocated.
+ */
+BOOL CBHRegion_subtract(CBHRegion *result, const CBHRegion *region, const CBHRegion *other);
+
+/** Calculates the union of a region and a rect.
+ *
+ * @param result        The region to receive the result.
+ * @param region        A region.
+ * @param rect          A rect.
+ *
+ * @return              `YES` on success, or `NO` if the storage could not be allocated.
+ */
+BOOL CBHRegion_unionRect(CBHRegion *result, const CBHRegion *region, NSRect rect);
+
+/** Calculates the intersection of a region and a rect.
+ *
+ * @param result        The region to receive the result.
+ * @param region        A region.
+ * @param rect          A rect.
+ *
+ * @return              `YES` on success, or `NO` if the storage could not be allocated.
+ */
+BOOL CBHRegion_intersectionRect(CBHRegion *result, const CBHRegion *region, NSRect rect);
+
+/** Calculates the area of a region not covered by a rect.
+ *
+ * @param result        The region to receive the result.
+ * @param region        The region to subtract from.
+ * @param rect          The rect to subtract.
+ *
+ * @return              `YES` on success, or `NO` if the storage could not be allocated.
+ */
+BOOL CBHRegion_subtractRect(CBHRegion *result, const CBHRegion *region, NSRect rect);
+
+
+#pragma mark - Checking Regions
+
+/**
+ * @name Checking Regions
+ */
+
+/** Indicates whether a point is contained in a region.
+ *
+ * @param region        A region.
+ * @param point         A point.
+ *
+ * @return              A `BOOL` value that indicates if _point_ lies within one of the rects of _region_.
+ */
+BOOL CBHRegion_isPointInRegion(const CBHRegion *region, NSPoint point);
+
+/** Indicates whether a region intersects a rect.
+ *
+ * @param region        A region.
+ * @param rect          A rect.
+ *
+ * @return              A `BOOL` value that indicates if _region_ and _rect_ share any area.
+ */
+BOOL CBHRegion_isIntersectingRect(const CBHRegion *region, NSRect rect);
+
+/** Indicates whether a region completely covers a rect.
+ *
+ * @param region        The covering region.
+ * @param rect          The covered rect.
+ *
+ * @return              A `BOOL` value that indicates if _rect_ is not empty and lies entirely within _region_.
+ */
+BOOL CBHRegion_isCoveringRect(const CBHRegion *region, NSRect rect);
+
+
+#pragma mark - Iterating Rects
+
+/**
+ * @name Iterating Rects
+ */
+
+/** Creates an iterator over the rects of a region.
+ *
+ * @param region        The region to iterate.
+ *
+ * @return              An iterator positioned before the first rect.
+ */
+CBHRegionIterator CBHRegionIterator_init(const CBHRegion *region);
+
+/** Advances an iterator to the next rect.
+ *
+ * @param iterator      The iterator.
+ * @param rect          Receives the next rect.
+ *
+ * @return              `YES` if a rect was written to _rect_, or `NO` if the iterator is exhausted.
+ */
+BOOL CBHRegionIterator_next(CBHRegionIterator *iterator, NSRect *rect);
+
+/** Copies the rects of a region into a buffer.
+ *
+ * @param region        The region.
+ * @param rects         A buffer to receive the rects, in iteration order.
+ * @param capacity      The number of elements _rects_ can hold.
+ *
+ * @return              The number of rects in the region, which may exceed _capacity_.
+ */
+NSUInteger CBHRegion_getRects(const CBHRegion *region, NSRect * _Nullable rects, NSUInteger capacity);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,692 @@
+//  CBHRegion.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHRegion.h"
+
+#import "NSRect+CBHGeometryKit.h"
+
+#import "_CBHGeometryKit+Utilities.h"
+#import "_CBHGeometryKit+Predicates.h"
+
+#import <stdlib.h>
+#import <string.h>
+
+
+typedef struct CBHRegionSpan
+{
+	CGFloat minX;
+	CGFloat maxX;
+} CBHRegionSpan;
+
+typedef struct CBHRegionBand
+{
+	CGFloat minY;
+	CGFloat maxY;
+	NSUInteger start;
+	NSUInteger count;
+} CBHRegionBand;
+
+typedef enum CBHRegionOperation
+{
+	CBHRegionOperationUnion,
+	CBHRegionOperationIntersection,
+	CBHRegionOperationSubtract,
+} CBHRegionOperation;
+
+
+// Bands are sorted and disjoint along the y axis and each holds at least one span. The spans of a band are stored
+// contiguously from `start`, sorted and separated by a gap along the x axis, and the bands store theirs in band order.
+struct CBHRegion
+{
+	CBHRegionBand * _Nullable bands;
+	NSUInteger bandCount;
+	NSUInteger bandCapacity;
+
+	CBHRegionSpan * _Nullable spans;
+	NSUInteger spanCount;
+	NSUInteger spanCapacity;
+
+	NSRect bounds;
+};
+
+
+#pragma mark - Storage
+
+static BOOL _CBHRegion_reserveBands(CBHRegion * const region, const NSUInteger capacity)
+{
+	if ( capacity <= region->bandCapacity ) { return YES; }
+
+	const NSUInteger newCapacity = MAX(capacity, region->bandCapacity * 2);
+	if ( newCapacity > NSUIntegerMax / sizeof(CBHRegionBand) ) { return NO; }
+
+	CBHRegionBand * const bands = realloc(region->bands, sizeof(CBHRegionBand) * newCapacity);
+	if ( bands == NULL ) { return NO; }
+
+	region->bands = bands;
+	region->bandCapacity = newCapacity;
+
+	return YES;
+}
+
+static BOOL _CBHRegion_reserveSpans(CBHRegion * const region, const NSUInteger capacity)
+{
+	if ( capacity <= region->spanCapacity ) { return YES; }
+
+	const NSUInteger newCapacity = MAX(capacity, region->spanCapacity * 2);
+	if ( newCapacity > NSUIntegerMax / sizeof(CBHRegionSpan) ) { return NO; }
+
+	CBHRegionSpan * const spans = realloc(region->spans, sizeof(CBHRegionSpan) * newCapacity);
+	if ( spans == NULL ) { return NO; }
+
+	region->spans = spans;
+	region->spanCapacity = newCapacity;
+
+	return YES;
+}
+
+static void _CBHRegion_updateBounds(CBHRegion * const region)
+{
+	if ( region->bandCount == 0 )
+	{
+		region->bounds = NSZeroRect;
+		return;
+	}
+
+	const CBHRegionBand * const first = region->bands;
+	const CBHRegionBand * const last = region->bands + (region->bandCount - 1);
+
+	CGFloat minX = region->spans[first->start].minX;
+	CGFloat maxX = region->spans[first->start + first->count - 1].maxX;
+
+	for (NSUInteger i = 1; i < region->bandCount; ++i)
+	{
+		const CBHRegionBand * const band = region->bands + i;
+		minX = MIN(minX, region->spans[band->start].minX);
+		maxX = MAX(maxX, region->spans[band->start + band->count - 1].maxX);
+	}
+
+	region->bounds = NSRect_init(minX, first->minY, maxX - minX, last->maxY - first->minY);
+}
+
+// Moves the storage of `source` into `region`, releasing what `region` held before.
+static void _CBHRegion_move(CBHRegion * const region, CBHRegion * const source)
+{
+	free(region->bands);
+	free(region->spans);
+
+	*region = *source;
+	*source = (CBHRegion){ .bands = NULL, .spans = NULL };
+}
+
+
+#pragma mark - Rects
+
+// Rects which are empty, or too thin to have distinct edges at their magnitude, cover nothing.
+NS_INLINE BOOL _CBHRegion_rectEdges(const NSRect rect, CBHRegionSpan * const span, CGFloat * const minY, CGFloat * const maxY)
+{
+	if ( CBHRect_isEmpty(rect) ) { return NO; }
+
+	*span = (CBHRegionSpan){ .minX = rect.origin.x, .maxX = rect.origin.x + rect.size.width };
+	*minY = rect.origin.y;
+	*maxY = rect.origin.y + rect.size.height;
+
+	return ( span->minX < span->maxX ) && ( *minY < *maxY );
+}
+
+// Makes `view` a region borrowing `band` and `span` as its storage. It must not be modified or destroyed.
+static void _CBHRegion_initView(CBHRegion * const view, CBHRegionBand * const band, CBHRegionSpan * const span, const NSRect rect)
+{
+	*view = (CBHRegion){ .bands = band, .bandCount = 0, .bandCapacity = 1, .spans = span, .spanCount = 0, .spanCapacity = 1 };
+
+	if ( !_CBHRegion_rectEdges(rect, span, &band->minY, &band->maxY) ) { return; }
+
+	band->start = 0;
+	band->count = 1;
+	view->bandCount = 1;
+	view->spanCount = 1;
+}
+
+
+#pragma mark - Combining Spans
+
+// Each function writes at most `count + otherCount` spans.
+
+static NSUInteger _CBHRegionSpan_union(CBHRegionSpan * const output, const CBHRegionSpan * const spans, const NSUInteger count, const CBHRegionSpan * const others, const NSUInteger otherCount)
+{
+	NSUInteger length = 0;
+	NSUInteger i = 0;
+	NSUInteger j = 0;
+
+	while ( i < count || j < otherCount )
+	{
+		CBHRegionSpan span;
+		if ( j >= otherCount || (i < count && spans[i].minX <= others[j].minX) ) { span = spans[i++]; }
+		else { span = others[j++]; }
+
+		if ( length > 0 && span.minX <= output[length - 1].maxX )
+		{
+			output[length - 1].maxX = MAX(output[length - 1].maxX, span.maxX);
+			continue;
+		}
+
+		output[length++] = span;
+	}
+
+	return length;
+}
+
+static NSUInteger _CBHRegionSpan_intersection(CBHRegionSpan * const output, const CBHRegionSpan * const spans, const NSUInteger count, const CBHRegionSpan * const others, const NSUInteger otherCount)
+{
+	NSUInteger length = 0;
+	NSUInteger i = 0;
+	NSUInteger j = 0;
+
+	while ( i < count && j < otherCount )
+	{
+		const CGFloat minX = MAX(spans[i].minX, others[j].minX);
+		const CGFloat maxX = MIN(spans[i].maxX, others[j].maxX);
+
+		if ( minX < maxX ) { output[length++] = (CBHRegionSpan){ .minX = minX, .maxX = maxX }; }
+
+		if ( spans[i].maxX < others[j].maxX ) { ++i; }
+		else { ++j; }
+	}
+
+	return length;
+}
+
+static NSUInteger _CBHRegionSpan_subtract(CBHRegionSpan * const output, const CBHRegionSpan * const spans, const NSUInteger count, const CBHRegionSpan * const others, const NSUInteger otherCount)
+{
+	NSUInteger length = 0;
+	NSUInteger j = 0;
+
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		CGFloat minX = spans[i].minX;
+		const CGFloat maxX = spans[i].maxX;
+
+		while ( j < otherCount && others[j].maxX <= minX ) { ++j; }
+
+		// A span reaching past this one may still cut the next, so it is only passed once it ends within this one.
+		for (NSUInteger k = j; k < otherCount && others[k].minX < maxX; ++k)
+		{
+			if ( minX < others[k].minX ) { output[length++] = (CBHRegionSpan){ .minX = minX, .maxX = others[k].minX }; }
+			minX = MAX(minX, others[k].maxX);
+
+			if ( others[k].maxX >= maxX ) { break; }
+			j = k + 1;
+		}
+
+		if ( minX < maxX ) { output[length++] = (CBHRegionSpan){ .minX = minX, .maxX = maxX }; }
+	}
+
+	return length;
+}
+
+
+#pragma mark - Combining Bands
+
+static BOOL _CBHRegion_isSpansEqual(const CBHRegionSpan * const spans, const CBHRegionSpan * const others, const NSUInteger count)
+{
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		if ( spans[i].minX != others[i].minX || spans[i].maxX != others[i].maxX ) { return NO; }
+	}
+
+	return YES;
+}
+
+// Appends the band `[minY, maxY)` holding the combination of two span lists, extending the last band instead when it
+// meets this one and holds the same spans.
+static BOOL _CBHRegion_appendBand(CBHRegion * const region, const CGFloat minY, const CGFloat maxY, const CBHRegionSpan * const spans, const NSUInteger count, const CBHRegionSpan * const others, const NSUInteger otherCount, const CBHRegionOperation operation)
+{
+	if ( !_CBHRegion_reserveSpans(region, region->spanCount + count + otherCount) ) { return NO; }
+
+	CBHRegionSpan * const output = region->spans + region->spanCount;
+	NSUInteger length = 0;
+
+	switch ( operation )
+	{
+		case CBHRegionOperationUnion:
+			length = _CBHRegionSpan_union(output, spans, count, others, otherCount);
+			break;
+
+		case CBHRegionOperationIntersection:
+			length = _CBHRegionSpan_intersection(output, spans, count, others, otherCount);
+			break;
+
+		case CBHRegionOperationSubtract:
+			length = _CBHRegionSpan_subtract(output, spans, count, others, otherCount);
+			break;
+	}
+
+	if ( length == 0 ) { return YES; }
+
+	if ( region->bandCount > 0 )
+	{
+		CBHRegionBand * const last = region->bands + (region->bandCount - 1);
+		if ( last->maxY == minY && last->count == length && _CBHRegion_isSpansEqual(region->spans + last->start, output, length) )
+		{
+			last->maxY = maxY;
+			return YES;
+		}
+	}
+
+	if ( !_CBHRegion_reserveBands(region, region->bandCount + 1) ) { return NO; }
+
+	region->bands[region->bandCount++] = (CBHRegionBand){ .minY = minY, .maxY = maxY, .start = region->spanCount, .count = length };
+	region->spanCount += length;
+
+	return YES;
+}
+
+// Sweeps down both regions one slab at a time, where a slab ends at the next band edge of either region. Within a slab
+// each region is covered by at most one band, so the slab is the combination of those two span lists.
+static BOOL _CBHRegion_combine(CBHRegion * const result, const CBHRegion * const region, const CBHRegion * const other, const CBHRegionOperation operation)
+{
+	CBHRegion output = { .bands = NULL, .spans = NULL };
+	if ( !_CBHRegion_reserveBands(&output, region->bandCount + other->bandCount) || !_CBHRegion_reserveSpans(&output, region->spanCount + other->spanCount) )
+	{
+		free(output.bands);
+		free(output.spans);
+		return NO;
+	}
+
+	const CBHRegionBand *band = region->bands;
+	const CBHRegionBand * const bandEnd = region->bands + region->bandCount;
+	const CBHRegionBand *otherBand = other->bands;
+	const CBHRegionBand * const otherBandEnd = other->bands + other->bandCount;
+
+	CGFloat y = 0.0;
+	if ( band < bandEnd && otherBand < otherBandEnd ) { y = MIN(band->minY, otherBand->minY); }
+	else if ( band < bandEnd ) { y = band->minY; }
+	else if ( otherBand < otherBandEnd ) { y = otherBand->minY; }
+
+	while ( band < bandEnd || otherBand < otherBandEnd )
+	{
+		if ( operation == CBHRegionOperationIntersection && (band >= bandEnd || otherBand >= otherBandEnd) ) { break; }
+		if ( operation == CBHRegionOperationSubtract && band >= bandEnd ) { break; }
+
+		const BOOL isActive = ( band < bandEnd && band->minY <= y );
+		const BOOL isOtherActive = ( otherBand < otherBandEnd && otherBand->minY <= y );
+
+		CGFloat next = 0.0;
+		BOOL hasNext = NO;
+
+		if ( band < bandEnd )
+		{
+			next = ( isActive ) ? band->maxY : band->minY;
+			hasNext = YES;
+		}
+
+		if ( otherBand < otherBandEnd )
+		{
+			const CGFloat edge = ( isOtherActive ) ? otherBand->maxY : otherBand->minY;
+			next = ( hasNext ) ? MIN(next, edge) : edge;
+		}
+
+		if ( isActive || isOtherActive )
+		{
+			const CBHRegionSpan * const spans = ( isActive ) ? region->spans + band->start : NULL;
+			const NSUInteger count = ( isActive ) ? band->count : 0;
+			const CBHRegionSpan * const others = ( isOtherActive ) ? other->spans + otherBand->start : NULL;
+			const NSUInteger otherCount = ( isOtherActive ) ? otherBand->count : 0;
+
+			if ( !_CBHRegion_appendBand(&output, y, next, spans, count, others, otherCount, operation) )
+			{
+				free(output.bands);
+				free(output.spans);
+				return NO;
+			}
+		}
+
+		y = next;
+
+		if ( band < bandEnd && band->maxY <= y ) { ++band; }
+		if ( otherBand < otherBandEnd && otherBand->maxY <= y ) { ++otherBand; }
+	}
+
+	_CBHRegion_updateBounds(&output);
+	_CBHRegion_move(result, &output);
+
+	return YES;
+}
+
+
+#pragma mark - Searching
+
+// The first band of `region` ending below `y`, or `bandCount` if there is none.
+static NSUInteger _CBHRegion_bandEndingAfter(const CBHRegion * const region, const CGFloat y)
+{
+	NSUInteger low = 0;
+	NSUInteger high = region->bandCount;
+
+	while ( low < high )
+	{
+		const NSUInteger middle = low + (high - low) / 2;
+		if ( region->bands[middle].maxY <= y ) { low = middle + 1; }
+		else { high = middle; }
+	}
+
+	return low;
+}
+
+// The first span of `band` ending after `x`, or `NULL` if there is none.
+static const CBHRegionSpan * _Nullable _CBHRegion_spanEndingAfter(const CBHRegion * const region, const CBHRegionBand * const band, const CGFloat x)
+{
+	const CBHRegionSpan * const spans = region->spans + band->start;
+	NSUInteger low = 0;
+	NSUInteger high = band->count;
+
+	while ( low < high )
+	{
+		const NSUInteger middle = low + (high - low) / 2;
+		if ( spans[middle].maxX <= x ) { low = middle + 1; }
+		else { high = middle; }
+	}
+
+	return ( low < band->count ) ? spans + low : NULL;
+}
+
+
+#pragma mark - Creating Regions
+
+CBHRegion *CBHRegion_create(void)
+{
+	return calloc(1, sizeof(CBHRegion));
+}
+
+CBHRegion *CBHRegion_createWithRect(const NSRect rect)
+{
+	CBHRegion * const region = CBHRegion_create();
+	if ( region == NULL ) { return NULL; }
+
+	if ( !CBHRegion_setRect(region, rect) )
+	{
+		CBHRegion_destroy(region);
+		return NULL;
+	}
+
+	return region;
+}
+
+CBHRegion *CBHRegion_createWithRects(const NSRect * const rects, const NSUInteger count)
+{
+	if ( count <= 1 ) { return ( count == 1 ) ? CBHRegion_createWithRect(rects[0]) : CBHRegion_create(); }
+
+	// Halves are combined pairwise so each rect is swept once per level rather than once per rect after it.
+	const NSUInteger half = count / 2;
+	CBHRegion * const region = CBHRegion_createWithRects(rects, half);
+	CBHRegion * const other = CBHRegion_createWithRects(rects + half, count - half);
+
+	if ( region == NULL || other == NULL || !CBHRegion_union(region, region, other) )
+	{
+		CBHRegion_destroy(region);
+		CBHRegion_destroy(other);
+		return NULL;
+	}
+
+	CBHRegion_destroy(other);
+
+	return region;
+}
+
+CBHRegion *CBHRegion_copy(const CBHRegion * const region)
+{
+	CBHRegion * const copy = CBHRegion_create();
+	if ( copy == NULL ) { return NULL; }
+
+	if ( !_CBHRegion_reserveBands(copy, region->bandCount) || !_CBHRegion_reserveSpans(copy, region->spanCount) )
+	{
+		CBHRegion_destroy(copy);
+		return NULL;
+	}
+
+	if ( region->bandCount > 0 )
+	{
+		memcpy(copy->bands, region->bands, sizeof(CBHRegionBand) * region->bandCount);
+		memcpy(copy->spans, region->spans, sizeof(CBHRegionSpan) * region->spanCount);
+	}
+
+	copy->bandCount = region->bandCount;
+	copy->spanCount = region->spanCount;
+	copy->bounds = region->bounds;
+
+	return copy;
+}
+
+void CBHRegion_destroy(CBHRegion * const region)
+{
+	if ( region == NULL ) { return; }
+
+	free(region->bands);
+	free(region->spans);
+	free(region);
+}
+
+
+#pragma mark - Properties
+
+BOOL CBHRegion_isEmpty(const CBHRegion * const region)
+{
+	return ( region->bandCount == 0 );
+}
+
+NSRect CBHRegion_bounds(const CBHRegion * const region)
+{
+	return region->bounds;
+}
+
+NSUInteger CBHRegion_rectCount(const CBHRegion * const region)
+{
+	return region->spanCount;
+}
+
+BOOL CBHRegion_isEqual(const CBHRegion * const region, const CBHRegion * const other)
+{
+	if ( region == other ) { return YES; }
+	if ( region->bandCount != other->bandCount || region->spanCount != other->spanCount ) { return NO; }
+
+	for (NSUInteger i = 0; i < region->bandCount; ++i)
+	{
+		const CBHRegionBand * const band = region->bands + i;
+		const CBHRegionBand * const otherBand = other->bands + i;
+
+		if ( band->minY != otherBand->minY || band->maxY != otherBand->maxY || band->count != otherBand->count ) { return NO; }
+	}
+
+	return ( region->spanCount == 0 ) || _CBHRegion_isSpansEqual(region->spans, other->spans, region->spanCount);
+}
+
+
+#pragma mark - Modifying Regions
+
+void CBHRegion_removeAll(CBHRegion * const region)
+{
+	region->bandCount = 0;
+	region->spanCount = 0;
+	region->bounds = NSZeroRect;
+}
+
+BOOL CBHRegion_setRect(CBHRegion * const region, const NSRect rect)
+{
+	CBHRegionSpan span;
+	CGFloat minY;
+	CGFloat maxY;
+
+	if ( !_CBHRegion_rectEdges(rect, &span, &minY, &maxY) )
+	{
+		CBHRegion_removeAll(region);
+		return YES;
+	}
+
+	if ( !_CBHRegion_reserveBands(region, 1) || !_CBHRegion_reserveSpans(region, 1) ) { return NO; }
+
+	region->bands[0] = (CBHRegionBand){ .minY = minY, .maxY = maxY, .start = 0, .count = 1 };
+	region->spans[0] = span;
+	region->bandCount = 1;
+	region->spanCount = 1;
+	region->bounds = NSRect_init(span.minX, minY, span.maxX - span.minX, maxY - minY);
+
+	return YES;
+}
+
+
+#pragma mark - Combining Regions
+
+BOOL CBHRegion_union(CBHRegion * const result, const CBHRegion * const region, const CBHRegion * const other)
+{
+	return _CBHRegion_combine(result, region, other, CBHRegionOperationUnion);
+}
+
+BOOL CBHRegion_intersection(CBHRegion * const result, const CBHRegion * const region, const CBHRegion * const other)
+{
+	return _CBHRegion_combine(result, region, other, CBHRegionOperationIntersection);
+}
+
+BOOL CBHRegion_subtract(CBHRegion * const result, const CBHRegion * const region, const CBHRegion * const other)
+{
+	return _CBHRegion_combine(result, region, other, CBHRegionOperationSubtract);
+}
+
+BOOL CBHRegion_unionRect(CBHRegion * const result, const CBHRegion * const region, const NSRect rect)
+{
+	CBHRegionBand band;
+	CBHRegionSpan span;
+	CBHRegion view;
+	_CBHRegion_initView(&view, &band, &span, rect);
+
+	return _CBHRegion_combine(result, region, &view, CBHRegionOperationUnion);
+}
+
+BOOL CBHRegion_intersectionRect(CBHRegion * const result, const CBHRegion * const region, const NSRect rect)
+{
+	CBHRegionBand band;
+	CBHRegionSpan span;
+	CBHRegion view;
+	_CBHRegion_initView(&view, &band, &span, rect);
+
+	return _CBHRegion_combine(result, region, &view, CBHRegionOperationIntersection);
+}
+
+BOOL CBHRegion_subtractRect(CBHRegion * const result, const CBHRegion * const region, const NSRect rect)
+{
+	CBHRegionBand band;
+	CBHRegionSpan span;
+	CBHRegion view;
+	_CBHRegion_initView(&view, &band, &span, rect);
+
+	return _CBHRegion_combine(result, region, &view, CBHRegionOperationSubtract);
+}
+
+
+#pragma mark - Checking Regions
+
+BOOL CBHRegion_isPointInRegion(const CBHRegion * const region, const NSPoint point)
+{
+	const NSUInteger index = _CBHRegion_bandEndingAfter(region, point.y);
+	if ( index >= region->bandCount ) { return NO; }
+
+	const CBHRegionBand * const band = region->bands + index;
+	if ( point.y < band->minY ) { return NO; }
+
+	const CBHRegionSpan * const span = _CBHRegion_spanEndingAfter(region, band, point.x);
+
+	return ( span != NULL ) && ( span->minX <= point.x );
+}
+
+BOOL CBHRegion_isIntersectingRect(const CBHRegion * const region, const NSRect rect)
+{
+	CBHRegionSpan edges;
+	CGFloat minY;
+	CGFloat maxY;
+
+	if ( !_CBHRegion_rectEdges(rect, &edges, &minY, &maxY) ) { return NO; }
+
+	for (NSUInteger i = _CBHRegion_bandEndingAfter(region, minY); i < region->bandCount && region->bands[i].minY < maxY; ++i)
+	{
+		const CBHRegionSpan * const span = _CBHRegion_spanEndingAfter(region, region->bands + i, edges.minX);
+		if ( span != NULL && span->minX < edges.maxX ) { return YES; }
+	}
+
+	return NO;
+}
+
+BOOL CBHRegion_isCoveringRect(const CBHRegion * const region, const NSRect rect)
+{
+	CBHRegionSpan edges;
+	CGFloat minY;
+	CGFloat maxY;
+
+	if ( !_CBHRegion_rectEdges(rect, &edges, &minY, &maxY) ) { return NO; }
+
+	// Each band in turn must start where the last ended and hold a span across the whole rect.
+	CGFloat y = minY;
+	for (NSUInteger i = _CBHRegion_bandEndingAfter(region, minY); i < region->bandCount; ++i)
+	{
+		const CBHRegionBand * const band = region->bands + i;
+		if ( y < band->minY ) { return NO; }
+
+		const CBHRegionSpan * const span = _CBHRegion_spanEndingAfter(region, band, edges.minX);
+		if ( span == NULL || edges.minX < span->minX || span->maxX < edges.maxX ) { return NO; }
+
+		y = band->maxY;
+		if ( maxY <= y ) { return YES; }
+	}
+
+	return NO;
+}
+
+
+#pragma mark - Iterating Rects
+
+CBHRegionIterator CBHRegionIterator_init(const CBHRegion * const region)
+{
+	return (CBHRegionIterator){ .region = region, .band = 0, .span = 0 };
+}
+
+BOOL CBHRegionIterator_next(CBHRegionIterator * const iterator, NSRect * const rect)
+{
+	const CBHRegion * const region = iterator->region;
+	if ( iterator->band >= region->bandCount ) { return NO; }
+
+	const CBHRegionBand * const band = region->bands + iterator->band;
+	const CBHRegionSpan * const span = region->spans + iterator->span;
+
+	*rect = NSRect_init(span->minX, band->minY, span->maxX - span->minX, band->maxY - band->minY);
+
+	iterator->span += 1;
+	if ( iterator->span >= band->start + band->count ) { iterator->band += 1; }
+
+	return YES;
+}
+
+NSUInteger CBHRegion_getRects(const CBHRegion * const region, NSRect * const rects, const NSUInteger capacity)
+{
+	if ( rects == NULL ) { return region->spanCount; }
+
+	CBHRegionIterator iterator = CBHRegionIterator_init(region);
+	NSRect rect;
+
+	for (NSUInteger i = 0; i < capacity && CBHRegionIterator_next(&iterator, &rect); ++i)
+	{
+		rects[i] = rect;
+	}
+
+	return region->spanCount;
+}
@@ -0,0 +1,155 @@
+//  CBHSweepAndPrune.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** A sweep and prune broadphase which finds every pair of overlapping rects in a set of moving rects.
+ *
+ * Rects are kept sorted by their minimum x edge, so a search only tests each rect against those which start before it
+ * ends. The order is kept between searches: after the rects move, a search re-sorts them with an insertion sort which
+ * costs little when few rects have passed one another, falling back to a full sort when many have.
+ *
+ * Each rect is identified by its index in the array the broadphase was created from. Pairs agree exactly with
+ * `NSRect_isIntersecting()`. In particular empty rects (those with a 0 or negative width or height) are never paired.
+ */
+typedef struct CBHSweepAndPrune CBHSweepAndPrune;
+
+/** A pair of overlapping rects. */
+typedef struct CBHSweepAndPrunePair
+{
+	/** The lesser of the two indexes. */
+	NSUInteger first;
+
+	/** The greater of the two indexes. */
+	NSUInteger second;
+} CBHSweepAndPrunePair;
+
+/** A function called for each pair during an enumeration.
+ *
+ * @param first         The lesser index of the pair.
+ * @param second        The greater index of the pair.
+ * @param context       The context given to the enumeration.
+ * @param stop          Set to `YES` to stop the enumeration.
+ */
+typedef void (*CBHSweepAndPruneCallback)(NSUInteger first, NSUInteger second, void * _Nullable context, BOOL *stop);
+
+
+#pragma mark - Creating Broadphases
+
+/**
+ * @name Creating Broadphases
+ */
+
+/** Creates a broadphase from a C array of rects.
+ *
+ * @param rects         The rects to pair. The broadphase copies them and does not keep a reference.
+ * @param count         The number of rects in _rects_.
+ *
+ * @return              A new broadphase, or `NULL` if the storage could not be allocated. Release it with
+ *                      `CBHSweepAndPrune_destroy()`.
+ */
+CBHSweepAndPrune * _Nullable CBHSweepAndPrune_createWithRects(const NSRect *rects, NSUInteger count);
+
+/** Releases a broadphase.
+ *
+ * @param broadphase    The broadphase to release.
+ */
+void CBHSweepAndPrune_destroy(CBHSweepAndPrune * _Nullable broadphase);
+
+
+#pragma mark - Properties
+
+/**
+ * @name Properties
+ */
+
+/** The number of rects in the broadphase, including any empty rects.
+ *
+ * @param broadphase    The broadphase.
+ *
+ * @return              The number of rects.
+ */
+NSUInteger CBHSweepAndPrune_count(const CBHSweepAndPrune *broadphase);
+
+/** The rect with an index.
+ *
+ * @param broadphase    The broadphase.
+ * @param index         The index of the rect, which must be less than the count.
+ *
+ * @return              The rect.
+ */
+NSRect CBHSweepAndPrune_rectAtIndex(const CBHSweepAndPrune *broadphase, NSUInteger index);
+
+
+#pragma mark - Moving Rects
+
+/**
+ * @name Moving Rects
+ *
+ * These functions only record the new rects. The next search re-sorts them starting from the previous order.
+ */
+
+/** Replaces every rect.
+ *
+ * @param broadphase    The broadphase to modify.
+ * @param rects         The new rects, in the same order and of the same number as those the broadphase was created from.
+ */
+void CBHSweepAndPrune_updateRects(CBHSweepAndPrune *broadphase, const NSRect *rects);
+
+/** Replaces a single rect.
+ *
+ * @param broadphase    The broadphase to modify.
+ * @param index         The index of the rect, which must be less than the count.
+ * @param rect          The new rect.
+ */
+void CBHSweepAndPrune_setRect(CBHSweepAndPrune *broadphase, NSUInteger index, NSRect rect);
+
+
+#pragma mark - Finding Pairs
+
+/**
+ * @name Finding Pairs
+ *
+ * Each pair of overlapping rects is reported once, in no particular order, with its lesser index first.
+ */
+
+/** Finds the pairs of overlapping rects.
+ *
+ * The buffer can be kept from one search to the next. When the result exceeds _capacity_ the buffer can be grown to
+ * fit and the search repeated, which is cheap as the rects are already sorted.
+ *
+ * @param broadphase    The broadphase.
+ * @param pairs         A buffer to receive the pairs.
+ * @param capacity      The number of elements _pairs_ can hold.
+ *
+ * @return              The number of pairs for which `NSRect_isIntersecting()` is `YES`, which may exceed _capacity_.
+ */
+NSUInteger CBHSweepAndPrune_overlappingPairs(CBHSweepAndPrune *broadphase, CBHSweepAndPrunePair * _Nullable pairs, NSUInteger capacity);
+
+/** Calls a function for each pair of overlapping rects.
+ *
+ * @param broadphase    The broadphase.
+ * @param callback      The function to call for each pair.
+ * @param context       A value passed to _callback_.
+ */
+void CBHSweepAndPrune_enumerateOverlappingPairs(CBHSweepAndPrune *broadphase, CBHSweepAndPruneCallback callback, void * _Nullable context);
+
+NS_ASSUME_NONNULL_END
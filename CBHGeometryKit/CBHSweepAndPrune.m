@@ -0,0 +1,330 @@
+//  CBHSweepAndPrune.m
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHSweepAndPrune.h"
+
+#import "_CBHGeometryKit+Utilities.h"
+#import "_CBHGeometryKit+Vector.h"
+#import "_CBHGeometryKit+Predicates.h"
+
+#import <math.h>
+#import <stdlib.h>
+#import <string.h>
+
+
+// The number of moves per rect the insertion sort may make before giving up for a full sort. Rects which only pass a
+// few neighbours between searches stay well within it.
+static const NSUInteger kCBHSweepAndPruneMovesPerRect = 16;
+
+
+// Entries hold a rect's edges, computed once exactly as the predicates compute them. A rect which can never intersect
+// anything, because it is empty, has a NaN edge, or starts at infinity, gets a minimum x of infinity. It sorts after
+// every other rect and is left out of the sweep.
+typedef struct CBHSweepAndPruneEntry
+{
+	CGFloat minX;
+	CGFloat maxX;
+	CGFloat minY;
+	CGFloat maxY;
+
+	NSUInteger index;
+} CBHSweepAndPruneEntry;
+
+// Sorting moves whole entries, but the sweep reads the sorted edges from columns so several candidates can be tested
+// in one vector step. Only the entries which can intersect something are copied to the columns.
+struct CBHSweepAndPrune
+{
+	NSRect *rects;
+	CBHSweepAndPruneEntry *entries;
+
+	CGFloat *minX;
+	CGFloat *maxX;
+	CGFloat *minY;
+	CGFloat *maxY;
+	NSUInteger *indexes;
+
+	NSUInteger count;
+	NSUInteger activeCount;
+	BOOL isSorted;
+};
+
+
+#pragma mark - Sorting
+
+static void _CBHSweepAndPruneEntry_refresh(CBHSweepAndPruneEntry * const entry, const NSRect rect)
+{
+	entry->minX = rect.origin.x;
+	entry->maxX = rect.origin.x + rect.size.width;
+	entry->minY = rect.origin.y;
+	entry->maxY = rect.origin.y + rect.size.height;
+
+	const BOOL isNaN = isnan(entry->minX) || isnan(entry->maxX) || isnan(entry->minY) || isnan(entry->maxY);
+	if ( CBHRect_isEmpty(rect) || isNaN ) { entry->minX = INFINITY; }
+}
+
+static int _CBHSweepAndPruneEntry_compare(const void * const a, const void * const b)
+{
+	const CBHSweepAndPruneEntry * const lhs = a;
+	const CBHSweepAndPruneEntry * const rhs = b;
+
+	if ( lhs->minX != rhs->minX ) { return ( lhs->minX > rhs->minX ) ? 1 : -1; }
+	return (lhs->index > rhs->index) - (lhs->index < rhs->index);
+}
+
+static void _CBHSweepAndPrune_refresh(CBHSweepAndPrune * const broadphase)
+{
+	for (NSUInteger i = 0; i < broadphase->count; ++i)
+	{
+		CBHSweepAndPruneEntry * const entry = &broadphase->entries[i];
+		_CBHSweepAndPruneEntry_refresh(entry, broadphase->rects[entry->index]);
+	}
+}
+
+static void _CBHSweepAndPrune_fillColumns(CBHSweepAndPrune * const broadphase)
+{
+	const CBHSweepAndPruneEntry * const entries = broadphase->entries;
+	NSUInteger active = 0;
+
+	for ( ; active < broadphase->count && entries[active].minX < INFINITY; ++active )
+	{
+		broadphase->minX[active] = entries[active].minX;
+		broadphase->maxX[active] = entries[active].maxX;
+		broadphase->minY[active] = entries[active].minY;
+		broadphase->maxY[active] = entries[active].maxY;
+		broadphase->indexes[active] = entries[active].index;
+	}
+
+	broadphase->activeCount = active;
+	broadphase->isSorted = YES;
+}
+
+// Restores the order after the rects have moved. Between frames most rects pass few others, so an insertion sort
+// from the previous order does little work. If it has to do too much it stops and sorts the entries from scratch.
+static void _CBHSweepAndPrune_sort(CBHSweepAndPrune * const broadphase)
+{
+	if ( broadphase->isSorted ) { return; }
+
+	_CBHSweepAndPrune_refresh(broadphase);
+
+	CBHSweepAndPruneEntry * const entries = broadphase->entries;
+	const NSUInteger count = broadphase->count;
+	NSUInteger budget = count * kCBHSweepAndPruneMovesPerRect;
+
+	for (NSUInteger i = 1; i < count; ++i)
+	{
+		const CBHSweepAndPruneEntry entry = entries[i];
+		NSUInteger j = i;
+
+		while ( j > 0 && entries[j - 1].minX > entry.minX )
+		{
+			if ( budget == 0 )
+			{
+				entries[j] = entry;
+				qsort(entries, count, sizeof(CBHSweepAndPruneEntry), _CBHSweepAndPruneEntry_compare);
+				_CBHSweepAndPrune_fillColumns(broadphase);
+				return;
+			}
+
+			entries[j] = entries[j - 1];
+			--j;
+			--budget;
+		}
+
+		entries[j] = entry;
+	}
+
+	_CBHSweepAndPrune_fillColumns(broadphase);
+}
+
+
+#pragma mark - Creating Broadphases
+
+CBHSweepAndPrune *CBHSweepAndPrune_createWithRects(const NSRect * const rects, const NSUInteger count)
+{
+	CBHSweepAndPrune * const broadphase = calloc(1, sizeof(CBHSweepAndPrune));
+	if ( broadphase == NULL ) { return NULL; }
+
+	const NSUInteger capacity = MAX(count, 1UL);
+
+	broadphase->count = count;
+	broadphase->rects = malloc(sizeof(NSRect) * capacity);
+	broadphase->entries = malloc(sizeof(CBHSweepAndPruneEntry) * capacity);
+	broadphase->minX = malloc(sizeof(CGFloat) * capacity * 4);
+	broadphase->indexes = malloc(sizeof(NSUInteger) * capacity);
+
+	if ( broadphase->rects == NULL || broadphase->entries == NULL || broadphase->minX == NULL || broadphase->indexes == NULL )
+	{
+		CBHSweepAndPrune_destroy(broadphase);
+		return NULL;
+	}
+
+	broadphase->maxX = broadphase->minX + capacity;
+	broadphase->minY = broadphase->maxX + capacity;
+	broadphase->maxY = broadphase->minY + capacity;
+
+	if ( count > 0 ) { memcpy(broadphase->rects, rects, sizeof(NSRect) * count); }
+
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		broadphase->entries[i].index = i;
+	}
+
+	// There is no previous order to start from, so the first sort is a full one.
+	_CBHSweepAndPrune_refresh(broadphase);
+	qsort(broadphase->entries, count, sizeof(CBHSweepAndPruneEntry), _CBHSweepAndPruneEntry_compare);
+	_CBHSweepAndPrune_fillColumns(broadphase);
+
+	return broadphase;
+}
+
+void CBHSweepAndPrune_destroy(CBHSweepAndPrune * const broadphase)
+{
+	if ( broadphase == NULL ) { return; }
+
+	free(broadphase->rects);
+	free(broadphase->entries);
+	free(broadphase->minX);
+	free(broadphase->indexes);
+	free(broadphase);
+}
+
+
+#pragma mark - Properties
+
+CBH_PURE NSUInteger CBHSweepAndPrune_count(const CBHSweepAndPrune * const broadphase)
+{
+	return broadphase->count;
+}
+
+CBH_PURE NSRect CBHSweepAndPrune_rectAtIndex(const CBHSweepAndPrune * const broadphase, const NSUInteger index)
+{
+	return broadphase->rects[index];
+}
+
+
+#pragma mark - Moving Rects
+
+void CBHSweepAndPrune_updateRects(CBHSweepAndPrune * const broadphase, const NSRect * const rects)
+{
+	if ( broadphase->count > 0 ) { memcpy(broadphase->rects, rects, sizeof(NSRect) * broadphase->count); }
+	broadphase->isSorted = NO;
+}
+
+void CBHSweepAndPrune_setRect(CBHSweepAndPrune * const broadphase, const NSUInteger index, const NSRect rect)
+{
+	broadphase->rects[index] = rect;
+	broadphase->isSorted = NO;
+}
+
+
+#pragma mark - Finding Pairs
+
+// The destination for the pairs found by a search, as `CBHIndexSink` is for the indexes found by a spatial query.
+typedef struct CBHPairSink
+{
+	CBHSweepAndPrunePair * _Nullable pairs;
+	NSUInteger capacity;
+	NSUInteger count;
+
+	CBHSweepAndPruneCallback _Nullable callback;
+	void * _Nullable context;
+	BOOL stop;
+} CBHPairSink;
+
+NS_INLINE void _CBHPairSink_emit(CBHPairSink * const sink, const NSUInteger a, const NSUInteger b)
+{
+	const NSUInteger first = MIN(a, b);
+	const NSUInteger second = MAX(a, b);
+
+	if ( sink->callback != NULL )
+	{
+		sink->callback(first, second, sink->context, &sink->stop);
+		return;
+	}
+
+	if ( sink->count < sink->capacity ) { sink->pairs[sink->count] = (CBHSweepAndPrunePair){ .first = first, .second = second }; }
+	sink->count += 1;
+}
+
+// Candidates are sorted by minimum x, so once one starts at or after the current rect's maximum x neither it nor any
+// after it can satisfy `minX[j] < maxX`. The remaining comparisons are those of `CBHRect_isIntersecting()`, made on the
+// same edges, so vector lanes and the scalar remainder agree.
+static void _CBHSweepAndPrune_search(CBHSweepAndPrune * const broadphase, CBHPairSink * const sink)
+{
+	_CBHSweepAndPrune_sort(broadphase);
+
+	const CGFloat * const minX = broadphase->minX;
+	const CGFloat * const maxX = broadphase->maxX;
+	const CGFloat * const minY = broadphase->minY;
+	const CGFloat * const maxY = broadphase->maxY;
+	const NSUInteger * const indexes = broadphase->indexes;
+	const NSUInteger count = broadphase->activeCount;
+
+	for (NSUInteger i = 0; i < count && !sink->stop; ++i)
+	{
+		NSUInteger j = i + 1;
+
+#if CBH_VECTOR
+		const CBHVector entryMinX = CBHVector_set(minX[i]);
+		const CBHVector entryMaxX = CBHVector_set(maxX[i]);
+		const CBHVector entryMinY = CBHVector_set(minY[i]);
+		const CBHVector entryMaxY = CBHVector_set(maxY[i]);
+		const unsigned int allLanes = (1U << CBH_VECTOR_WIDTH) - 1;
+
+		for ( ; j + CBH_VECTOR_WIDTH <= count && !sink->stop; j += CBH_VECTOR_WIDTH )
+		{
+			const CBHVector isStarted = CBHVector_isLess(CBHVector_load(minX + j), entryMaxX);
+
+			CBHVector isOverlapping = CBHVector_and(isStarted, CBHVector_isLess(entryMinX, CBHVector_load(maxX + j)));
+			isOverlapping = CBHVector_and(isOverlapping, CBHVector_isLess(entryMinY, CBHVector_load(maxY + j)));
+			isOverlapping = CBHVector_and(isOverlapping, CBHVector_isLess(CBHVector_load(minY + j), entryMaxY));
+
+			for (unsigned int matches = CBHVector_mask(isOverlapping); matches != 0 && !sink->stop; matches &= matches - 1)
+			{
+				_CBHPairSink_emit(sink, indexes[i], indexes[j + (NSUInteger)__builtin_ctz(matches)]);
+			}
+
+			if ( CBHVector_mask(isStarted) != allLanes ) { break; }
+		}
+
+		if ( j + CBH_VECTOR_WIDTH <= count ) { continue; }
+#endif
+
+		for ( ; j < count && minX[j] < maxX[i] && !sink->stop; ++j )
+		{
+			if ( (minX[i] < maxX[j]) && (minY[i] < maxY[j]) && (minY[j] < maxY[i]) )
+			{
+				_CBHPairSink_emit(sink, indexes[i], indexes[j]);
+			}
+		}
+	}
+}
+
+NSUInteger CBHSweepAndPrune_overlappingPairs(CBHSweepAndPrune * const broadphase, CBHSweepAndPrunePair * const pairs, const NSUInteger capacity)
+{
+	CBHPairSink sink = { .pairs = pairs, .capacity = ( pairs != NULL ) ? capacity : 0, .count = 0, .callback = NULL, .context = NULL, .stop = NO };
+	_CBHSweepAndPrune_search(broadphase, &sink);
+
+	return sink.count;
+}
+
+void CBHSweepAndPrune_enumerateOverlappingPairs(CBHSweepAndPrune * const broadphase, const CBHSweepAndPruneCallback callback, void * const context)
+{
+	CBHPairSink sink = { .pairs = NULL, .capacity = 0, .count = 0, .callback = callback, .context = context, .stop = NO };
+	_CBHSweepAndPrune_search(broadphase, &sink);
+}
@@ -18,6 +18,9 @@
 
 @import Foundation;
 
+#import <CBHGeometryKit/CBHInlining.h>
+#import <CBHGeometryKit/CBHParseStatus.h>
+
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -34,7 +37,7 @@ NS_ASSUME_NONNULL_BEGIN
  *
  * @return              A `NSPoint` with its components provided by _x_ and _y_.
  */
-NSPoint NSPoint_init(CGFloat x, CGFloat y);
+CBH_INLINABLE NSPoint NSPoint_init(CGFloat x, CGFloat y);
 
 /** Creates a new `NSPoint` from a text-based representation.
  *
@@ -44,13 +47,47 @@ NSPoint NSPoint_init(CGFloat x, CGFloat y);
  *
  * @warning             If _string_ does not contain any numbers the returned `NSPoint` will have its components set to 0.
  */
-NSPoint NSPoint_initWithString(NSString *string);
+CBH_INLINABLE NSPoint NSPoint_initWithString(NSString *string);
 
 /** Creates a new `NSPoint` with both the x and y components set to 0.
  *
  * @return              A `NSPoint` with its components set to 0.
  */
-NSPoint NSPoint_initZero(void);
+CBH_INLINABLE NSPoint NSPoint_initZero(void);
+
+
+#pragma mark - Parsing Points
+
+/**
+ * @name Parsing Points
+ *
+ * These functions read the text accepted by `NSPoint_initWithString()` straight from bytes without creating any objects.
+ * Numbers are read the same way in every locale, and the results match `NSPointFromString()` exactly, including setting
+ * missing components to 0.
+ */
+
+/** Creates a new `NSPoint` from a text-based representation in a buffer of bytes.
+ *
+ * @param bytes         The UTF-8 text to parse. It does not need to be terminated.
+ * @param length        The number of bytes in _bytes_.
+ * @param consumed      Receives the number of bytes read, which is all of them if a component is missing.
+ * @param status        Receives whether all of the x and y components were found.
+ *
+ * @return              A `NSPoint` with its components provided by the first 2 reals in _bytes_.
+ */
+NSPoint NSPoint_initWithBytes(const char *bytes, NSUInteger length, NSUInteger * _Nullable consumed, CBHParseStatus * _Nullable status);
+
+/** Parses one `NSPoint` from each line of a buffer of bytes.
+ *
+ * @param bytes         The UTF-8 text to parse, with one point per line. It does not need to be terminated.
+ * @param length        The number of bytes in _bytes_.
+ * @param points        A buffer to receive the points.
+ * @param statuses      A buffer to receive the status of each line, or `NULL`.
+ * @param capacity      The number of elements _points_ and _statuses_ can hold.
+ *
+ * @return              The number of lines, which may exceed _capacity_. A newline ending _bytes_ does not start a line.
+ */
+NSUInteger NSPoint_parseLines(const char *bytes, NSUInteger length, NSPoint *points, CBHParseStatus * _Nullable statuses, NSUInteger capacity);
 
 
 #pragma mark - Checking Points
@@ -66,7 +103,7 @@ NSPoint NSPoint_initZero(void);
  *
  * @return              A `BOOL` value that indicates if the two points are identical.
  */
-BOOL NSPoint_isEqual(NSPoint point, NSPoint other);
+CBH_INLINABLE BOOL NSPoint_isEqual(NSPoint point, NSPoint other);
 
 
 #pragma mark - Derived Points
@@ -81,7 +118,7 @@ BOOL NSPoint_isEqual(NSPoint point, NSPoint other);
  *
  * @return              A `NSPoint` derived from _point_ by having its components truncated.
  */
-NSPoint NSPoint_truncate(NSPoint point);
+CBH_INLINABLE NSPoint NSPoint_truncate(NSPoint point);
 
 /** Derives a new `NSPoint` for which the x and y components have been rounded to the nearest whole value.
  *
@@ -89,7 +126,7 @@ NSPoint NSPoint_truncate(NSPoint point);
  *
  * @return              A `NSPoint` derived from _point_ by having its components rounded.
  */
-NSPoint NSPoint_round(NSPoint point);
+CBH_INLINABLE NSPoint NSPoint_round(NSPoint point);
 
 
 /** Derives a new `NSPoint` for which the x and y components have been shifted by the components of a second point.
@@ -99,7 +136,7 @@ NSPoint NSPoint_round(NSPoint point);
  *
  * @return              A `NSPoint` derived from _point_ by having it components shifted by the provided amounts.
  */
-NSPoint NSPoint_shift(NSPoint point, NSPoint delta);
+CBH_INLINABLE NSPoint NSPoint_shift(NSPoint point, NSPoint delta);
 
 /** Derives a new `NSPoint` for which the x and y components have been shifted by the provided values.
  *
@@ -109,7 +146,7 @@ NSPoint NSPoint_shift(NSPoint point, NSPoint delta);
  *
  * @return              A `NSPoint` derived from _point_ by having its components shifted by the provided amounts.
  */
-NSPoint NSPoint_shiftParametric(NSPoint point, CGFloat dX, CGFloat dY);
+CBH_INLINABLE NSPoint NSPoint_shiftParametric(NSPoint point, CGFloat dX, CGFloat dY);
 
 
 /** Derives a new `NSPoint` for which the x and y components fall in the middle of a pixel.
@@ -118,7 +155,7 @@ NSPoint NSPoint_shiftParametric(NSPoint point, CGFloat dX, CGFloat dY);
  *
  * @return              A `NSPoint` derived from _point_ by having its components truncated and then shifted by 0.5 so that it falls in the middle of a pixel.
  */
-NSPoint NSPoint_nearestPixel(NSPoint point);
+CBH_INLINABLE NSPoint NSPoint_nearestPixel(NSPoint point);
 
 
 #pragma mark - Distance
@@ -136,7 +173,7 @@ NSPoint NSPoint_nearestPixel(NSPoint point);
  *
  * @warning            This function makes use of `sqrt()` and is considered slow. If preforming distance comparison consider comparing the squared distances instead.
  */
-CGFloat NSPoint_distance(NSPoint start, NSPoint end);
+CBH_INLINABLE CGFloat NSPoint_distance(NSPoint start, NSPoint end);
 
 /** Calculates the squared distance between two points.
  *
@@ -147,7 +184,167 @@ CGFloat NSPoint_distance(NSPoint start, NSPoint end);
  *
  * @warning             This function does __NOT__ make use of `sqrt()`. Comparison of this value can be much quicker than comparing the actual distances.
  */
-CGFloat NSPoint_distanceSquared(NSPoint start, NSPoint end);
+CBH_INLINABLE CGFloat NSPoint_distanceSquared(NSPoint start, NSPoint end);
+
+/** Approximates the distance between two points.
+ *
+ * The estimate is `max(M, 0.898204193266868 * M + 0.485968200201465 * m)` where _M_ and _m_ are the larger and
+ * smaller of the absolute component deltas.
+ *
+ * @param start         The starting point.
+ * @param end           The ending point.
+ *
+ * @return              A `CGFloat` approximating the distance between the two points.
+ *
+ * @warning             This function does __NOT__ make use of `sqrt()`. The result is within ±2.13% of the exact distance and may be either larger or smaller.
+ */
+CBH_INLINABLE CGFloat NSPoint_approximateDistance(NSPoint start, NSPoint end);
+
+
+#pragma mark - Batched Distance
+
+/**
+ * @name Batched Distance
+ */
+
+/** Calculates the distances between a point and each point in an array.
+ *
+ * @param point         The starting point.
+ * @param points        The ending points.
+ * @param distances     A buffer of at least _count_ elements to receive the distances.
+ * @param count         The number of points in _points_.
+ *
+ * @warning             The results are identical to calling `NSPoint_distance()` for each point.
+ */
+void NSPoint_distancesToPoints(NSPoint point, const NSPoint *points, CGFloat *distances, NSUInteger count);
+
+/** Calculates the squared distances between a point and each point in an array.
+ *
+ * @param point         The starting point.
+ * @param points        The ending points.
+ * @param distances     A buffer of at least _count_ elements to receive the squared distances.
+ * @param count         The number of points in _points_.
+ *
+ * @warning             The results are identical to calling `NSPoint_distanceSquared()` for each point.
+ */
+void NSPoint_distancesSquaredToPoints(NSPoint point, const NSPoint *points, CGFloat *distances, NSUInteger count);
+
+/** Calculates the distances between corresponding points in two arrays.
+ *
+ * @param starts        The starting points.
+ * @param ends          The ending points.
+ * @param distances     A buffer of at least _count_ elements to receive the distances.
+ * @param count         The number of points in both _starts_ and _ends_.
+ *
+ * @warning             The results are identical to calling `NSPoint_distance()` for each pair.
+ */
+void NSPoint_distancesBetweenPoints(const NSPoint *starts, const NSPoint *ends, CGFloat *distances, NSUInteger count);
+
+/** Calculates the squared distances between corresponding points in two arrays.
+ *
+ * @param starts        The starting points.
+ * @param ends          The ending points.
+ * @param distances     A buffer of at least _count_ elements to receive the squared distances.
+ * @param count         The number of points in both _starts_ and _ends_.
+ *
+ * @warning             The results are identical to calling `NSPoint_distanceSquared()` for each pair.
+ */
+void NSPoint_distancesSquaredBetweenPoints(const NSPoint *starts, const NSPoint *ends, CGFloat *distances, NSUInteger count);
+
+/** Approximates the distances between a point and each point in an array.
+ *
+ * @param point         The starting point.
+ * @param points        The ending points.
+ * @param distances     A buffer of at least _count_ elements to receive the approximate distances.
+ * @param count         The number of points in _points_.
+ *
+ * @warning             The results are identical to calling `NSPoint_approximateDistance()` for each point and share its ±2.13% error bound.
+ */
+void NSPoint_approximateDistancesToPoints(NSPoint point, const NSPoint *points, CGFloat *distances, NSUInteger count);
+
+/** Approximates the distances between corresponding points in two arrays.
+ *
+ * @param starts        The starting points.
+ * @param ends          The ending points.
+ * @param distances     A buffer of at least _count_ elements to receive the approximate distances.
+ * @param count         The number of points in both _starts_ and _ends_.
+ *
+ * @warning             The results are identical to calling `NSPoint_approximateDistance()` for each pair and share its ±2.13% error bound.
+ */
+void NSPoint_approximateDistancesBetweenPoints(const NSPoint *starts, const NSPoint *ends, CGFloat *distances, NSUInteger count);
+
+
+#pragma mark - Batched Reductions
+
+/**
+ * @name Batched Reductions
+ *
+ * These functions are vectorized and split large arrays across cores. Points with a NaN component give unspecified
+ * results.
+ */
+
+/** Finds the least and greatest coordinates of the points in an array.
+ *
+ * @param points        The points to examine.
+ * @param count         The number of points in _points_.
+ * @param minimum       Set to a point with the least x and the least y coordinates.
+ * @param maximum       Set to a point with the greatest x and the greatest y coordinates.
+ *
+ * @return              `YES` if _points_ is not empty, otherwise `NO` and _minimum_ and _maximum_ are not modified.
+ *
+ * @warning             The results are equal to folding the coordinates with `MIN()` and `MAX()`.
+ */
+BOOL NSPoint_extentsOfPoints(const NSPoint *points, NSUInteger count, NSPoint *minimum, NSPoint *maximum);
+
+/** Calculates the mean of the points in an array.
+ *
+ * The coordinates are summed in a fixed order which does not depend on the instruction set or the number of threads,
+ * so an array always has the same centroid.
+ *
+ * @param points        The points to average.
+ * @param count         The number of points in _points_.
+ *
+ * @return              The centroid of _points_, or the origin if _points_ is empty.
+ */
+NSPoint NSPoint_centroidOfPoints(const NSPoint *points, NSUInteger count);
+
+
+#pragma mark - Batched Pixel Alignment
+
+/**
+ * @name Batched Pixel Alignment
+ *
+ * These functions snap to the pixels of a display with a backing scale factor, such as 2 for a Retina display. Each
+ * component is scaled into pixels, snapped, and scaled back. At a scale of 1 every result is identical to the single
+ * point function. They are vectorized, split large arrays across cores, and may write their results over their input.
+ */
+
+/** Truncates each point in an array to the pixel grid.
+ *
+ * @param points        The points to truncate.
+ * @param results       A buffer of _count_ points to receive the results.
+ * @param count         The number of points in _points_.
+ * @param scale         The number of pixels per point. Must be positive.
+ */
+void NSPoint_truncatePoints(const NSPoint *points, NSPoint *results, NSUInteger count, CGFloat scale);
+
+/** Rounds each point in an array to the pixel grid, with halfway cases rounded away from zero.
+ *
+ * @param points        The points to round.
+ * @param results       A buffer of _count_ points to receive the results.
+ * @param count         The number of points in _points_.
+ * @param scale         The number of pixels per point. Must be positive.
+ */
+void NSPoint_roundPoints(const NSPoint *points, NSPoint *results, NSUInteger count, CGFloat scale);
+
+/** Moves each point in an array to the center of the pixel it truncates to, as `NSPoint_nearestPixel()` does.
+ *
+ * @param points        The points to move.
+ * @param results       A buffer of _count_ points to receive the results.
+ * @param count         The number of points in _points_.
+ * @param scale         The number of pixels per point. Must be positive.
+ */
+void NSPoint_nearestPixels(const NSPoint *points, NSPoint *results, NSUInteger count, CGFloat scale);
 
 
 #pragma mark - Description
@@ -162,6 +359,23 @@ CGFloat NSPoint_distanceSquared(NSPoint start, NSPoint end);
  *
  * @return              A `NSString` representing the provided _point_.
  */
-NSString *NSPoint_description(NSPoint point);
+CBH_INLINABLE NSString *NSPoint_description(NSPoint point);
+
+/** Writes a text representation of the provided point into a buffer without creating any objects.
+ *
+ * The text has the layout of `NSPoint_description()` with each number written in the fewest digits which convert back
+ * to the same value, so it round-trips through `NSPoint_initWithString()` and `NSPoint_initWithBytes()`.
+ *
+ * @param point         The point.
+ * @param buffer        A buffer to receive the text. Like `snprintf()`, the text is truncated to fit and terminated.
+ * @param capacity      The number of bytes _buffer_ can hold. 128 bytes are always enough.
+ *
+ * @return              The length of the full text, not counting the terminator.
+ */
+NSUInteger NSPoint_getDescription(NSPoint point, char * _Nullable buffer, NSUInteger capacity);
 
 NS_ASSUME_NONNULL_END
+
+#if CBH_GEOMETRY_INLINE
+#import <CBHGeometryKit/NSPoint+CBHGeometryKitInline.h>
+#endif
@@ -16,114 +16,675 @@
 //  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
 //  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 
+// The framework always exports the out of line definitions, whichever mode its clients use.
+#undef CBH_GEOMETRY_INLINE
+#define CBH_GEOMETRY_INLINE 0
+#define _CBH_GEOMETRY_EXPORTING 1
+
 #import "NSPoint+CBHGeometryKit.h"
+#import "NSPoint+CBHGeometryKitInline.h"
 
 #import "_CBHGeometryKit+Utilities.h"
+#import "_CBHGeometryKit+Formatter.h"
+#import "_CBHGeometryKit+Scanner.h"
+#import "_CBHGeometryKit+Parallel.h"
+#import "_CBHGeometryKit+Pixels.h"
 #import <math.h>
+#import <stdlib.h>
 
 
-#pragma mark - Creating Points
+#pragma mark - Parsing Points
 
-CBH_CONST NSPoint NSPoint_init(const CGFloat x, const CGFloat y)
+NSPoint NSPoint_initWithBytes(const char * const bytes, const NSUInteger length, NSUInteger * const consumed, CBHParseStatus * const status)
 {
-	return (NSPoint){ .x = x, .y = y };
+	CGFloat components[2];
+	const CBHParseStatus result = CBHScanner_scanReals(bytes, length, components, 2, consumed);
+
+	if ( status != NULL ) { *status = result; }
+	return NSPoint_init(components[0], components[1]);
 }
 
-CBH_CONST NSPoint NSPoint_initWithString(NSString * const string)
+NSUInteger NSPoint_parseLines(const char * const bytes, const NSUInteger length, NSPoint * const points, CBHParseStatus * const statuses, const NSUInteger capacity)
 {
-	return NSPointFromString(string);
+	NSUInteger count = 0;
+	NSUInteger offset = 0;
+	NSUInteger lineLength;
+
+	for (NSUInteger start = 0; CBHScanner_nextLine(bytes, length, &offset, &lineLength); start = offset, ++count)
+	{
+		if ( count >= capacity ) { continue; }
+
+		CBHParseStatus status;
+		points[count] = NSPoint_initWithBytes(bytes + start, lineLength, NULL, &status);
+
+		if ( statuses != NULL ) { statuses[count] = status; }
+	}
+
+	return count;
 }
 
-CBH_CONST NSPoint NSPoint_initZero(void)
+
+#pragma mark - Batched Distance
+
+// The vector paths perform the same subtract, multiply, add, and correctly rounded square root as the scalar
+// functions, in the same order, so every lane is bit-identical to its scalar counterpart.
+
+static inline void _CBHPoint_distancesToPoints(const NSPoint point, const NSPoint * const points, CGFloat * const distances, const NSUInteger count, const BOOL root)
 {
-	return (NSPoint){ .x = 0.0, .y = 0.0 };
+	NSUInteger i = 0;
+
+#if CBH_VECTOR_AVX2
+	const __m256d start = _mm256_setr_pd(point.x, point.y, point.x, point.y);
+
+	for ( ; i + 4 <= count; i += 4 )
+	{
+		const double * const ends = (const double *)(points + i);
+
+		__m256d a = _mm256_sub_pd(start, _mm256_loadu_pd(ends));
+		__m256d b = _mm256_sub_pd(start, _mm256_loadu_pd(ends + 4));
+
+		a = _mm256_mul_pd(a, a);
+		b = _mm256_mul_pd(b, b);
+
+		// hadd yields { p0, p2, p1, p3 }, restore the order.
+		__m256d sum = _mm256_permute4x64_pd(_mm256_hadd_pd(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+		if ( root ) { sum = _mm256_sqrt_pd(sum); }
+
+		_mm256_storeu_pd(distances + i, sum);
+	}
+#elif CBH_VECTOR_SSE2
+	const __m128d start = _mm_setr_pd(point.x, point.y);
+
+	for ( ; i + 2 <= count; i += 2 )
+	{
+		const double * const ends = (const double *)(points + i);
+
+		__m128d a = _mm_sub_pd(start, _mm_loadu_pd(ends));
+		__m128d b = _mm_sub_pd(start, _mm_loadu_pd(ends + 2));
+
+		a = _mm_mul_pd(a, a);
+		b = _mm_mul_pd(b, b);
+
+		__m128d sum = _mm_add_pd(_mm_unpacklo_pd(a, b), _mm_unpackhi_pd(a, b));
+		if ( root ) { sum = _mm_sqrt_pd(sum); }
+
+		_mm_storeu_pd(distances + i, sum);
+	}
+#elif CBH_VECTOR_NEON
+	const float64x2_t startX = vdupq_n_f64(point.x);
+	const float64x2_t startY = vdupq_n_f64(point.y);
+
+	for ( ; i + 2 <= count; i += 2 )
+	{
+		const float64x2x2_t ends = vld2q_f64((const double *)(points + i));
+
+		float64x2_t x = vsubq_f64(startX, ends.val[0]);
+		float64x2_t y = vsubq_f64(startY, ends.val[1]);
+
+		x = vmulq_f64(x, x);
+		y = vmulq_f64(y, y);
+
+		float64x2_t sum = vaddq_f64(x, y);
+		if ( root ) { sum = vsqrtq_f64(sum); }
+
+		vst1q_f64(distances + i, sum);
+	}
+#endif
+
+	for ( ; i < count; ++i )
+	{
+		distances[i] = ( root ) ? NSPoint_distance(point, points[i]) : NSPoint_distanceSquared(point, points[i]);
+	}
 }
 
+static inline void _CBHPoint_distancesBetweenPoints(const NSPoint * const starts, const NSPoint * const ends, CGFloat * const distances, const NSUInteger count, const BOOL root)
+{
+	NSUInteger i = 0;
+
+#if CBH_VECTOR_AVX2
+	for ( ; i + 4 <= count; i += 4 )
+	{
+		const double * const start = (const double *)(starts + i);
+		const double * const end = (const double *)(ends + i);
+
+		__m256d a = _mm256_sub_pd(_mm256_loadu_pd(start), _mm256_loadu_pd(end));
+		__m256d b = _mm256_sub_pd(_mm256_loadu_pd(start + 4), _mm256_loadu_pd(end + 4));
+
+		a = _mm256_mul_pd(a, a);
+		b = _mm256_mul_pd(b, b);
+
+		// hadd yields { p0, p2, p1, p3 }, restore the order.
+		__m256d sum = _mm256_permute4x64_pd(_mm256_hadd_pd(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+		if ( root ) { sum = _mm256_sqrt_pd(sum); }
+
+		_mm256_storeu_pd(distances + i, sum);
+	}
+#elif CBH_VECTOR_SSE2
+	for ( ; i + 2 <= count; i += 2 )
+	{
+		const double * const start = (const double *)(starts + i);
+		const double * const end = (const double *)(ends + i);
+
+		__m128d a = _mm_sub_pd(_mm_loadu_pd(start), _mm_loadu_pd(end));
+		__m128d b = _mm_sub_pd(_mm_loadu_pd(start + 2), _mm_loadu_pd(end + 2));
 
-#pragma mark - Checking Points
+		a = _mm_mul_pd(a, a);
+		b = _mm_mul_pd(b, b);
 
-CBH_CONST BOOL NSPoint_isEqual(const NSPoint point, const NSPoint other)
+		__m128d sum = _mm_add_pd(_mm_unpacklo_pd(a, b), _mm_unpackhi_pd(a, b));
+		if ( root ) { sum = _mm_sqrt_pd(sum); }
+
+		_mm_storeu_pd(distances + i, sum);
+	}
+#elif CBH_VECTOR_NEON
+	for ( ; i + 2 <= count; i += 2 )
+	{
+		const float64x2x2_t start = vld2q_f64((const double *)(starts + i));
+		const float64x2x2_t end = vld2q_f64((const double *)(ends + i));
+
+		float64x2_t x = vsubq_f64(start.val[0], end.val[0]);
+		float64x2_t y = vsubq_f64(start.val[1], end.val[1]);
+
+		x = vmulq_f64(x, x);
+		y = vmulq_f64(y, y);
+
+		float64x2_t sum = vaddq_f64(x, y);
+		if ( root ) { sum = vsqrtq_f64(sum); }
+
+		vst1q_f64(distances + i, sum);
+	}
+#endif
+
+	for ( ; i < count; ++i )
+	{
+		distances[i] = ( root ) ? NSPoint_distance(starts[i], ends[i]) : NSPoint_distanceSquared(starts[i], ends[i]);
+	}
+}
+
+
+// When _pairwise_ is `NO` only the first element of _starts_ is read and it is measured against every end.
+static inline void _CBHPoint_approximateDistances(const NSPoint * const starts, const NSPoint * const ends, CGFloat * const distances, const NSUInteger count, const BOOL pairwise)
 {
-	return ( (point.x == other.x) && (point.y == other.y) );
+	if ( count == 0 ) { return; }
+
+	NSUInteger i = 0;
+
+#if CBH_VECTOR_AVX2
+	const __m256d alpha = _mm256_set1_pd(kCBHApproximateDistanceAlpha);
+	const __m256d beta = _mm256_set1_pd(kCBHApproximateDistanceBeta);
+	const __m256d sign = _mm256_set1_pd(-0.0);
+	const __m256d point = _mm256_setr_pd(starts[0].x, starts[0].y, starts[0].x, starts[0].y);
+
+	for ( ; i + 4 <= count; i += 4 )
+	{
+		const double * const end = (const double *)(ends + i);
+
+		__m256d a = _mm256_sub_pd(( pairwise ) ? _mm256_loadu_pd((const double *)(starts + i)) : point, _mm256_loadu_pd(end));
+		__m256d b = _mm256_sub_pd(( pairwise ) ? _mm256_loadu_pd((const double *)(starts + i + 2)) : point, _mm256_loadu_pd(end + 4));
+
+		a = _mm256_andnot_pd(sign, a);
+		b = _mm256_andnot_pd(sign, b);
+
+		// Lanes are ordered { p0, p2, p1, p3 } until the final permute.
+		const __m256d x = _mm256_unpacklo_pd(a, b);
+		const __m256d y = _mm256_unpackhi_pd(a, b);
+
+		const __m256d high = _mm256_max_pd(x, y);
+		const __m256d low = _mm256_min_pd(x, y);
+
+		__m256d estimate = _mm256_add_pd(_mm256_mul_pd(alpha, high), _mm256_mul_pd(beta, low));
+		estimate = _mm256_max_pd(high, estimate);
+
+		_mm256_storeu_pd(distances + i, _mm256_permute4x64_pd(estimate, _MM_SHUFFLE(3, 1, 2, 0)));
+	}
+#elif CBH_VECTOR_SSE2
+	const __m128d alpha = _mm_set1_pd(kCBHApproximateDistanceAlpha);
+	const __m128d beta = _mm_set1_pd(kCBHApproximateDistanceBeta);
+	const __m128d sign = _mm_set1_pd(-0.0);
+	const __m128d point = _mm_setr_pd(starts[0].x, starts[0].y);
+
+	for ( ; i + 2 <= count; i += 2 )
+	{
+		const double * const end = (const double *)(ends + i);
+
+		__m128d a = _mm_sub_pd(( pairwise ) ? _mm_loadu_pd((const double *)(starts + i)) : point, _mm_loadu_pd(end));
+		__m128d b = _mm_sub_pd(( pairwise ) ? _mm_loadu_pd((const double *)(starts + i + 1)) : point, _mm_loadu_pd(end + 2));
+
+		a = _mm_andnot_pd(sign, a);
+		b = _mm_andnot_pd(sign, b);
+
+		const __m128d x = _mm_unpacklo_pd(a, b);
+		const __m128d y = _mm_unpackhi_pd(a, b);
+
+		const __m128d high = _mm_max_pd(x, y);
+		const __m128d low = _mm_min_pd(x, y);
+
+		__m128d estimate = _mm_add_pd(_mm_mul_pd(alpha, high), _mm_mul_pd(beta, low));
+		estimate = _mm_max_pd(high, estimate);
+
+		_mm_storeu_pd(distances + i, estimate);
+	}
+#elif CBH_VECTOR_NEON
+	const float64x2_t alpha = vdupq_n_f64(kCBHApproximateDistanceAlpha);
+	const float64x2_t beta = vdupq_n_f64(kCBHApproximateDistanceBeta);
+	const float64x2x2_t point = { { vdupq_n_f64(starts[0].x), vdupq_n_f64(starts[0].y) } };
+
+	for ( ; i + 2 <= count; i += 2 )
+	{
+		const float64x2x2_t start = ( pairwise ) ? vld2q_f64((const double *)(starts + i)) : point;
+		const float64x2x2_t end = vld2q_f64((const double *)(ends + i));
+
+		const float64x2_t x = vabsq_f64(vsubq_f64(start.val[0], end.val[0]));
+		const float64x2_t y = vabsq_f64(vsubq_f64(start.val[1], end.val[1]));
+
+		const float64x2_t high = vmaxq_f64(x, y);
+		const float64x2_t low = vminq_f64(x, y);
+
+		float64x2_t estimate = vaddq_f64(vmulq_f64(alpha, high), vmulq_f64(beta, low));
+		estimate = vmaxq_f64(high, estimate);
+
+		vst1q_f64(distances + i, estimate);
+	}
+#endif
+
+	for ( ; i < count; ++i )
+	{
+		distances[i] = NSPoint_approximateDistance(starts[( pairwise ) ? i : 0], ends[i]);
+	}
 }
 
 
-#pragma mark - Derived Points
+// Large batches are split between threads with `CBHParallel_apply()`. Each range writes only its own distances.
+typedef struct CBHPointDistances
+{
+	const NSPoint *starts;
+	const NSPoint *ends;
+	CGFloat *distances;
+	BOOL isPairwise;
+	BOOL isRoot;
+} CBHPointDistances;
+
+static void _CBHPoint_distancesWorker(void * const context, const NSRange range)
+{
+	const CBHPointDistances * const batch = context;
+	const NSPoint * const ends = batch->ends + range.location;
+	CGFloat * const distances = batch->distances + range.location;
+
+	if ( batch->isPairwise ) { _CBHPoint_distancesBetweenPoints(batch->starts + range.location, ends, distances, range.length, batch->isRoot); }
+	else { _CBHPoint_distancesToPoints(*batch->starts, ends, distances, range.length, batch->isRoot); }
+}
+
+static void _CBHPoint_approximateDistancesWorker(void * const context, const NSRange range)
+{
+	const CBHPointDistances * const batch = context;
+	const NSPoint * const starts = ( batch->isPairwise ) ? batch->starts + range.location : batch->starts;
+
+	_CBHPoint_approximateDistances(starts, batch->ends + range.location, batch->distances + range.location, range.length, batch->isPairwise);
+}
+
+
+void NSPoint_distancesToPoints(const NSPoint point, const NSPoint * const points, CGFloat * const distances, const NSUInteger count)
+{
+	CBHPointDistances batch = { .starts = &point, .ends = points, .distances = distances, .isPairwise = NO, .isRoot = YES };
+	CBHParallel_apply(count, &batch, _CBHPoint_distancesWorker);
+}
+
+void NSPoint_distancesSquaredToPoints(const NSPoint point, const NSPoint * const points, CGFloat * const distances, const NSUInteger count)
+{
+	CBHPointDistances batch = { .starts = &point, .ends = points, .distances = distances, .isPairwise = NO, .isRoot = NO };
+	CBHParallel_apply(count, &batch, _CBHPoint_distancesWorker);
+}
+
+void NSPoint_distancesBetweenPoints(const NSPoint * const starts, const NSPoint * const ends, CGFloat * const distances, const NSUInteger count)
+{
+	CBHPointDistances batch = { .starts = starts, .ends = ends, .distances = distances, .isPairwise = YES, .isRoot = YES };
+	CBHParallel_apply(count, &batch, _CBHPoint_distancesWorker);
+}
+
+void NSPoint_distancesSquaredBetweenPoints(const NSPoint * const starts, const NSPoint * const ends, CGFloat * const distances, const NSUInteger count)
+{
+	CBHPointDistances batch = { .starts = starts, .ends = ends, .distances = distances, .isPairwise = YES, .isRoot = NO };
+	CBHParallel_apply(count, &batch, _CBHPoint_distancesWorker);
+}
+
+void NSPoint_approximateDistancesToPoints(const NSPoint point, const NSPoint * const points, CGFloat * const distances, const NSUInteger count)
+{
+	CBHPointDistances batch = { .starts = &point, .ends = points, .distances = distances, .isPairwise = NO };
+	CBHParallel_apply(count, &batch, _CBHPoint_approximateDistancesWorker);
+}
+
+void NSPoint_approximateDistancesBetweenPoints(const NSPoint * const starts, const NSPoint * const ends, CGFloat * const distances, const NSUInteger count)
+{
+	CBHPointDistances batch = { .starts = starts, .ends = ends, .distances = distances, .isPairwise = YES };
+	CBHParallel_apply(count, &batch, _CBHPoint_approximateDistancesWorker);
+}
+
+
+#pragma mark - Batched Reductions
+
+// Extents and sums are gathered per block and then combined in block order. Within a block the sums are accumulated in
+// four lanes, lane `i % 4` taking the `i`th point, and the lanes are added pairwise. Every path follows that order.
+
+typedef struct CBHPointExtents
+{
+	NSPoint minimum;
+	NSPoint maximum;
+} CBHPointExtents;
+
+typedef struct CBHPointReduction
+{
+	const NSPoint *points;
+	NSUInteger count;
+	void *partials;
+} CBHPointReduction;
 
-CBH_CONST NSPoint NSPoint_truncate(const NSPoint point)
+// `count` must not be 0.
+static CBHPointExtents _CBHPoint_extentsOfChunk(const NSPoint * const points, const NSUInteger count)
 {
-	NSPoint newPoint = point;
+	CBHPointExtents extents = { .minimum = points[0], .maximum = points[0] };
+	NSUInteger i = 1;
+
+#if CBH_VECTOR_AVX2
+	if ( count >= 4 )
+	{
+		__m256d lower = _mm256_loadu_pd((const double *)points);
+		__m256d upper = lower;
+
+		for ( i = 2; i + 2 <= count; i += 2 )
+		{
+			const __m256d point = _mm256_loadu_pd((const double *)(points + i));
+
+			lower = _mm256_min_pd(lower, point);
+			upper = _mm256_max_pd(upper, point);
+		}
+
+		const __m128d minimum = _mm_min_pd(_mm256_castpd256_pd128(lower), _mm256_extractf128_pd(lower, 1));
+		const __m128d maximum = _mm_max_pd(_mm256_castpd256_pd128(upper), _mm256_extractf128_pd(upper, 1));
+
+		_mm_storeu_pd((double *)&extents.minimum, minimum);
+		_mm_storeu_pd((double *)&extents.maximum, maximum);
+	}
+#elif CBH_VECTOR_SSE2
+	__m128d lower = _mm_loadu_pd((const double *)points);
+	__m128d upper = lower;
+
+	for ( ; i < count; ++i )
+	{
+		const __m128d point = _mm_loadu_pd((const double *)(points + i));
+
+		lower = _mm_min_pd(lower, point);
+		upper = _mm_max_pd(upper, point);
+	}
+
+	_mm_storeu_pd((double *)&extents.minimum, lower);
+	_mm_storeu_pd((double *)&extents.maximum, upper);
+#elif CBH_VECTOR_NEON
+	float64x2_t lower = vld1q_f64((const double *)points);
+	float64x2_t upper = lower;
+
+	for ( ; i < count; ++i )
+	{
+		const float64x2_t point = vld1q_f64((const double *)(points + i));
+
+		lower = vminq_f64(lower, point);
+		upper = vmaxq_f64(upper, point);
+	}
+
+	vst1q_f64((double *)&extents.minimum, lower);
+	vst1q_f64((double *)&extents.maximum, upper);
+#endif
 
-	newPoint.x = trunc(point.x);
-	newPoint.y = trunc(point.y);
+	for ( ; i < count; ++i )
+	{
+		extents.minimum.x = MIN(extents.minimum.x, points[i].x);
+		extents.minimum.y = MIN(extents.minimum.y, points[i].y);
+		extents.maximum.x = MAX(extents.maximum.x, points[i].x);
+		extents.maximum.y = MAX(extents.maximum.y, points[i].y);
+	}
 
-	return newPoint;
+	return extents;
 }
 
-CBH_CONST NSPoint NSPoint_round(const NSPoint point)
+static NSPoint _CBHPoint_sumOfChunk(const NSPoint * const points, const NSUInteger count)
 {
-	NSPoint newPoint = point;
+	CGFloat x[4] = { 0.0, 0.0, 0.0, 0.0 };
+	CGFloat y[4] = { 0.0, 0.0, 0.0, 0.0 };
+	NSUInteger i = 0;
+
+#if CBH_VECTOR_AVX2
+	// Lanes 0 and 1 share one register and lanes 2 and 3 the other.
+	__m256d low = _mm256_setzero_pd();
+	__m256d high = _mm256_setzero_pd();
+
+	for ( ; i + 4 <= count; i += 4 )
+	{
+		low = _mm256_add_pd(low, _mm256_loadu_pd((const double *)(points + i)));
+		high = _mm256_add_pd(high, _mm256_loadu_pd((const double *)(points + i + 2)));
+	}
+
+	CGFloat lanes[8];
+	_mm256_storeu_pd(lanes, low);
+	_mm256_storeu_pd(lanes + 4, high);
+
+	for (NSUInteger lane = 0; lane < 4; ++lane)
+	{
+		x[lane] = lanes[lane * 2];
+		y[lane] = lanes[lane * 2 + 1];
+	}
+#elif CBH_VECTOR_SSE2
+	__m128d sums[4] = { _mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd() };
+
+	for ( ; i + 4 <= count; i += 4 )
+	{
+		for (NSUInteger lane = 0; lane < 4; ++lane)
+		{
+			sums[lane] = _mm_add_pd(sums[lane], _mm_loadu_pd((const double *)(points + i + lane)));
+		}
+	}
+
+	for (NSUInteger lane = 0; lane < 4; ++lane)
+	{
+		x[lane] = _mm_cvtsd_f64(sums[lane]);
+		y[lane] = _mm_cvtsd_f64(_mm_unpackhi_pd(sums[lane], sums[lane]));
+	}
+#elif CBH_VECTOR_NEON
+	float64x2_t sums[4] = { vdupq_n_f64(0.0), vdupq_n_f64(0.0), vdupq_n_f64(0.0), vdupq_n_f64(0.0) };
+
+	for ( ; i + 4 <= count; i += 4 )
+	{
+		for (NSUInteger lane = 0; lane < 4; ++lane)
+		{
+			sums[lane] = vaddq_f64(sums[lane], vld1q_f64((const double *)(points + i + lane)));
+		}
+	}
+
+	for (NSUInteger lane = 0; lane < 4; ++lane)
+	{
+		x[lane] = vgetq_lane_f64(sums[lane], 0);
+		y[lane] = vgetq_lane_f64(sums[lane], 1);
+	}
+#endif
 
-	newPoint.x = round(point.x);
-	newPoint.y = round(point.y);
+	for ( ; i < count; ++i )
+	{
+		x[i % 4] += points[i].x;
+		y[i % 4] += points[i].y;
+	}
 
-	return newPoint;
+	return NSPoint_init((x[0] + x[1]) + (x[2] + x[3]), (y[0] + y[1]) + (y[2] + y[3]));
 }
 
-CBH_CONST NSPoint NSPoint_shift(const NSPoint point, const NSPoint delta)
+static void _CBHPoint_extentsWorker(void * const context, const NSRange blocks)
 {
-	return NSPoint_shiftParametric(point, delta.x, delta.y);
+	const CBHPointReduction * const reduction = context;
+
+	for (NSUInteger i = blocks.location; i < NSMaxRange(blocks); ++i)
+	{
+		const NSRange block = CBHParallel_block(reduction->count, i);
+		((CBHPointExtents *)reduction->partials)[i] = _CBHPoint_extentsOfChunk(reduction->points + block.location, block.length);
+	}
 }
 
-CBH_CONST NSPoint NSPoint_shiftParametric(const NSPoint point, const CGFloat x, const CGFloat y)
+static void _CBHPoint_sumWorker(void * const context, const NSRange blocks)
 {
-	NSPoint newPoint = point;
-	
-	newPoint.x += x;
-	newPoint.y += y;
+	const CBHPointReduction * const reduction = context;
 
-	return newPoint;
+	for (NSUInteger i = blocks.location; i < NSMaxRange(blocks); ++i)
+	{
+		const NSRange block = CBHParallel_block(reduction->count, i);
+		((NSPoint *)reduction->partials)[i] = _CBHPoint_sumOfChunk(reduction->points + block.location, block.length);
+	}
 }
 
-CBH_CONST NSPoint NSPoint_nearestPixel(const NSPoint point)
+
+BOOL NSPoint_extentsOfPoints(const NSPoint * const points, const NSUInteger count, NSPoint * const minimum, NSPoint * const maximum)
 {
-	NSPoint newPoint = point;
+	if ( count == 0 ) { return NO; }
+
+	const NSUInteger blockCount = CBHParallel_blockCount(count);
+	const NSUInteger grainSize = CBHParallel_grainSizeForUnit(kCBHParallelBlockLength);
+	CBHPointExtents * const partials = ( CBHParallel_isSplit(blockCount, grainSize) ) ? malloc(sizeof(CBHPointExtents) * blockCount) : NULL;
+
+	CBHPointExtents extents;
+
+	if ( partials != NULL )
+	{
+		CBHPointReduction reduction = { .points = points, .count = count, .partials = partials };
+		CBHParallel_applyWithGrainSize(blockCount, grainSize, &reduction, _CBHPoint_extentsWorker);
+
+		extents = partials[0];
+		for (NSUInteger i = 1; i < blockCount; ++i)
+		{
+			extents.minimum.x = MIN(extents.minimum.x, partials[i].minimum.x);
+			extents.minimum.y = MIN(extents.minimum.y, partials[i].minimum.y);
+			extents.maximum.x = MAX(extents.maximum.x, partials[i].maximum.x);
+			extents.maximum.y = MAX(extents.maximum.y, partials[i].maximum.y);
+		}
+
+		free(partials);
+	}
+	else
+	{
+		extents = _CBHPoint_extentsOfChunk(points, count);
+	}
+
+	*minimum = extents.minimum;
+	*maximum = extents.maximum;
+
+	return YES;
+}
+
+NSPoint NSPoint_centroidOfPoints(const NSPoint * const points, const NSUInteger count)
+{
+	if ( count == 0 ) { return NSPoint_initZero(); }
+
+	const NSUInteger blockCount = CBHParallel_blockCount(count);
+	const NSUInteger grainSize = CBHParallel_grainSizeForUnit(kCBHParallelBlockLength);
+	NSPoint * const partials = ( CBHParallel_isSplit(blockCount, grainSize) ) ? malloc(sizeof(NSPoint) * blockCount) : NULL;
 
-	newPoint.x = trunc(point.x) + 0.5;
-	newPoint.y = trunc(point.y) + 0.5;
+	if ( partials != NULL )
+	{
+		CBHPointReduction reduction = { .points = points, .count = count, .partials = partials };
+		CBHParallel_applyWithGrainSize(blockCount, grainSize, &reduction, _CBHPoint_sumWorker);
+	}
 
-	return newPoint;
+	CGFloat x = 0.0;
+	CGFloat y = 0.0;
+
+	for (NSUInteger i = 0; i < blockCount; ++i)
+	{
+		NSPoint sum;
+
+		if ( partials != NULL ) { sum = partials[i]; }
+		else
+		{
+			const NSRange block = CBHParallel_block(count, i);
+			sum = _CBHPoint_sumOfChunk(points + block.location, block.length);
+		}
+
+		x += sum.x;
+		y += sum.y;
+	}
+
+	free(partials);
+
+	return NSPoint_init(x / (CGFloat)count, y / (CGFloat)count);
 }
 
 
-#pragma mark - Distance
+#pragma mark - Batched Pixel Alignment
+
+typedef struct CBHPointSnap
+{
+	const NSPoint *points;
+	NSPoint *results;
+	CGFloat scale;
+} CBHPointSnap;
 
-CBH_CONST CGFloat NSPoint_distance(const NSPoint start, const NSPoint end)
+// The coordinates of the points are snapped as one array of values.
+NS_INLINE void _CBHPoint_snapPoints(const CBHPointSnap * const batch, const NSRange range, const CBHPixelSnap snap)
 {
-#if CGFLOAT_IS_DOUBLE
-	return (CGFloat)sqrt(NSPoint_distanceSquared(start, end));
-#else
-	return (CGFloat)sqrtf(NSPoint_distanceSquared(start, end));
+	const CGFloat * const values = (const CGFloat *)(batch->points + range.location);
+	CGFloat * const results = (CGFloat *)(batch->results + range.location);
+	const NSUInteger count = range.length * 2;
+	NSUInteger i = 0;
+
+#if CBH_VECTOR
+	const CBHVector scale = CBHVector_set(batch->scale);
+
+	for ( ; i + CBH_VECTOR_WIDTH <= count; i += CBH_VECTOR_WIDTH )
+	{
+		CBHVector_store(results + i, CBHPixelVector_snap(CBHVector_load(values + i), scale, snap));
+	}
 #endif
+
+	for ( ; i < count; ++i )
+	{
+		results[i] = CBHPixel_snap(values[i], batch->scale, snap);
+	}
 }
 
-CBH_CONST CGFloat NSPoint_distanceSquared(const NSPoint start, const NSPoint end)
+static void _CBHPoint_truncateWorker(void * const context, const NSRange range)
 {
-	NSPoint newPoint = start;
+	_CBHPoint_snapPoints(context, range, CBHPixelSnapTruncate);
+}
+
+static void _CBHPoint_roundWorker(void * const context, const NSRange range)
+{
+	_CBHPoint_snapPoints(context, range, CBHPixelSnapRound);
+}
+
+static void _CBHPoint_centerWorker(void * const context, const NSRange range)
+{
+	_CBHPoint_snapPoints(context, range, CBHPixelSnapCenter);
+}
+
 
-	newPoint.x -= end.x;
-	newPoint.y -= end.y;
-	
-	newPoint.x *= newPoint.x;
-	newPoint.y *= newPoint.y;
-	
-	return newPoint.x + newPoint.y;
+void NSPoint_truncatePoints(const NSPoint * const points, NSPoint * const results, const NSUInteger count, const CGFloat scale)
+{
+	CBHPointSnap batch = { .points = points, .results = results, .scale = scale };
+	CBHParallel_apply(count, &batch, _CBHPoint_truncateWorker);
+}
+
+void NSPoint_roundPoints(const NSPoint * const points, NSPoint * const results, const NSUInteger count, const CGFloat scale)
+{
+	CBHPointSnap batch = { .points = points, .results = results, .scale = scale };
+	CBHParallel_apply(count, &batch, _CBHPoint_roundWorker);
+}
+
+void NSPoint_nearestPixels(const NSPoint * const points, NSPoint * const results, const NSUInteger count, const CGFloat scale)
+{
+	CBHPointSnap batch = { .points = points, .results = results, .scale = scale };
+	CBHParallel_apply(count, &batch, _CBHPoint_centerWorker);
 }
 
 
 #pragma mark - Description
 
-CBH_CONST NSString *NSPoint_description(const NSPoint point)
+NSUInteger NSPoint_getDescription(const NSPoint point, char * const buffer, const NSUInteger capacity)
 {
-	return NSStringFromPoint(point);
+	char text[kCBHFormatterValueLength];
+	const NSUInteger length = (NSUInteger)(CBHFormatter_writePoint(text, point) - text);
+
+	return CBHFormatter_copy(text, length, buffer, capacity);
 }
@@ -18,6 +18,9 @@
 
 @import Foundation;
 
+#import <CBHGeometryKit/CBHInlining.h>
+#import <CBHGeometryKit/CBHParseStatus.h>
+
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -34,7 +37,7 @@ NS_ASSUME_NONNULL_BEGIN
  *
  * @return          A `NSRange` with its components provided by the _location_ and _length_.
  */
-NSRange NSRange_init(NSUInteger location, NSUInteger length);
+CBH_INLINABLE NSRange NSRange_init(NSUInteger location, NSUInteger length);
 
 /** Creates a new `NSRange` between two points inclusively.
  *
@@ -43,7 +46,7 @@ NSRange NSRange_init(NSUInteger location, NSUInteger length);
  *
  * @return      A `NSRange` with its components derived from _from_ and _to_.
  */
-NSRange NSRange_initFromTo(NSUInteger from, NSUInteger to);
+CBH_INLINABLE NSRange NSRange_initFromTo(NSUInteger from, NSUInteger to);
 
 /** Creates a new `NSRange` from a text-based representation.
  *
@@ -53,13 +56,47 @@ NSRange NSRange_initFromTo(NSUInteger from, NSUInteger to);
  *
  * @warning         If _string_ only contains a single integer it is used as the location. If _string_ does not contain any integers the returned `NSRange` will have its components set to 0.
  */
-NSRange NSRange_initWithString(NSString *string);
+CBH_INLINABLE NSRange NSRange_initWithString(NSString *string);
 
 /** Creates a new `NSRange` with both the location and length components set to 0.
  *
  * @return  A `NSRange` with its components set to 0.
  */
-NSRange NSRange_initEmpty(void);
+CBH_INLINABLE NSRange NSRange_initEmpty(void);
+
+
+#pragma mark - Parsing Ranges
+
+/**
+ * @name Parsing Ranges
+ *
+ * These functions read the text accepted by `NSRange_initWithString()` straight from bytes without creating any objects.
+ * Numbers are read the same way in every locale, and the results match `NSRangeFromString()` exactly, including setting
+ * missing components to 0.
+ */
+
+/** Creates a new `NSRange` from a text-based representation in a buffer of bytes.
+ *
+ * @param bytes         The UTF-8 text to parse. It does not need to be terminated.
+ * @param length        The number of bytes in _bytes_.
+ * @param consumed      Receives the number of bytes read, which is all of them if a component is missing.
+ * @param status        Receives whether all of the location and length components were found.
+ *
+ * @return              A `NSRange` with its components provided by the first 2 unsigned integers in _bytes_.
+ */
+NSRange NSRange_initWithBytes(const char *bytes, NSUInteger length, NSUInteger * _Nullable consumed, CBHParseStatus * _Nullable status);
+
+/** Parses one `NSRange` from each line of a buffer of bytes.
+ *
+ * @param bytes         The UTF-8 text to parse, with one range per line. It does not need to be terminated.
+ * @param length        The number of bytes in _bytes_.
+ * @param ranges        A buffer to receive the ranges.
+ * @param statuses      A buffer to receive the status of each line, or `NULL`.
+ * @param capacity      The number of elements _ranges_ and _statuses_ can hold.
+ *
+ * @return              The number of lines, which may exceed _capacity_. A newline ending _bytes_ does not start a line.
+ */
+NSUInteger NSRange_parseLines(const char *bytes, NSUInteger length, NSRange *ranges, CBHParseStatus * _Nullable statuses, NSUInteger capacity);
 
 
 #pragma mark - Checking Range
@@ -76,7 +113,7 @@ NSRange NSRange_initEmpty(void);
  *
  * @warning         A range with a 0 length is considered empty.
  */
-BOOL NSRange_isEmpty(NSRange range);
+CBH_INLINABLE BOOL NSRange_isEmpty(NSRange range);
 
 /** Indicates whether the two ranges are equal.
  *
@@ -85,7 +122,7 @@ BOOL NSRange_isEmpty(NSRange range);
  *
  * @return          A `BOOL` value that indicates if the two ranges are identical.
  */
-BOOL NSRange_isEqual(NSRange range, NSRange other);
+CBH_INLINABLE BOOL NSRange_isEqual(NSRange range, NSRange other);
 
 /** Indicates whether the a location is contained in a range.
  *
@@ -94,7 +131,7 @@ BOOL NSRange_isEqual(NSRange range, NSRange other);
  *
  * @return          A `BOOL` value that indicates if _range_ contains the _location_.
  */
-BOOL NSRange_isLocationInRange(NSRange range, NSUInteger location);
+CBH_INLINABLE BOOL NSRange_isLocationInRange(NSRange range, NSUInteger location);
 
 
 #pragma mark - Derived Ranges
@@ -112,7 +149,7 @@ BOOL NSRange_isLocationInRange(NSRange range, NSUInteger location);
  *
  * @warning         If the returned range’s length field is 0, then the two ranges don’t intersect, and the value of the location field is undefined.
  */
-NSRange NSRange_intersection(NSRange range, NSRange other);
+CBH_INLINABLE NSRange NSRange_intersection(NSRange range, NSRange other);
 
 /** Derives a new `NSRange` representing the union (smallest rectangle which completely includes) the two ranges.
  *
@@ -121,7 +158,7 @@ NSRange NSRange_intersection(NSRange range, NSRange other);
  *
  * @return          A `NSRange` derived from the union of _range_ and _other_.
  */
-NSRange NSRange_union(NSRange range, NSRange other);
+CBH_INLINABLE NSRange NSRange_union(NSRange range, NSRange other);
 
 
 #pragma mark - Calculated Properties
@@ -136,7 +173,7 @@ NSRange NSRange_union(NSRange range, NSRange other);
  *
  * @return          An `NSUInteger` representing the maximum location in the range.
  */
-NSUInteger NSRange_max(NSRange range);
+CBH_INLINABLE NSUInteger NSRange_max(NSRange range);
 
 /** Derives a location with a given offset in a range.
  *
@@ -147,7 +184,7 @@ NSUInteger NSRange_max(NSRange range);
  *
  * @warning         If the offset exceeds the ranges length `NSNotFound` will be returned.
  */
-NSUInteger NSRange_locationAtOffset(NSRange range, NSUInteger offset);
+CBH_INLINABLE NSUInteger NSRange_locationAtOffset(NSRange range, NSUInteger offset);
 
 
 #pragma mark - Description
@@ -166,6 +203,23 @@ NSUInteger NSRange_locationAtOffset(NSRange range, NSUInteger offset);
  *
  * @return          A `NSString` representing the provided _range_.
  */
-NSString *NSRange_description(NSRange range);
+CBH_INLINABLE NSString *NSRange_description(NSRange range);
+
+/** Writes a text representation of the provided range into a buffer without creating any objects.
+ *
+ * The text has the layout of `NSRange_description()`, so it round-trips through `NSRange_initWithString()` and
+ * `NSRange_initWithBytes()`.
+ *
+ * @param range         The range.
+ * @param buffer        A buffer to receive the text. Like `snprintf()`, the text is truncated to fit and terminated.
+ * @param capacity      The number of bytes _buffer_ can hold. 128 bytes are always enough.
+ *
+ * @return              The length of the full text, not counting the terminator.
+ */
+NSUInteger NSRange_getDescription(NSRange range, char * _Nullable buffer, NSUInteger capacity);
 
 NS_ASSUME_NONNULL_END
+
+#if CBH_GEOMETRY_INLINE
+#import <CBHGeometryKit/NSRange+CBHGeometryKitInline.h>
+#endif
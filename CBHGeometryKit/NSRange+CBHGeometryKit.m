@@ -16,83 +16,56 @@
 //  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
 //  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 
+// The framework always exports the out of line definitions, whichever mode its clients use.
+#undef CBH_GEOMETRY_INLINE
+#define CBH_GEOMETRY_INLINE 0
+#define _CBH_GEOMETRY_EXPORTING 1
+
 #import "NSRange+CBHGeometryKit.h"
+#import "NSRange+CBHGeometryKitInline.h"
 
 #import "_CBHGeometryKit+Utilities.h"
+#import "_CBHGeometryKit+Formatter.h"
+#import "_CBHGeometryKit+Scanner.h"
 
 
-#pragma mark - Creating Ranges
-
-CBH_CONST NSRange NSRange_init(const NSUInteger location, const NSUInteger length)
-{
-	return NSMakeRange(location, length);
-}
+#pragma mark - Parsing Ranges
 
-CBH_CONST NSRange NSRange_initFromTo(const NSUInteger from, const NSUInteger to)
+NSRange NSRange_initWithBytes(const char * const bytes, const NSUInteger length, NSUInteger * const consumed, CBHParseStatus * const status)
 {
-	return NSMakeRange(from, to - from);
-}
+	NSUInteger components[2];
+	const CBHParseStatus result = CBHScanner_scanIntegers(bytes, length, components, 2, consumed);
 
-CBH_CONST NSRange NSRange_initWithString(NSString * const string)
-{
-	return NSRangeFromString(string);
+	if ( status != NULL ) { *status = result; }
+	return NSRange_init(components[0], components[1]);
 }
 
-CBH_CONST NSRange NSRange_initEmpty()
+NSUInteger NSRange_parseLines(const char * const bytes, const NSUInteger length, NSRange * const ranges, CBHParseStatus * const statuses, const NSUInteger capacity)
 {
-	return NSMakeRange(0, 0);
-}
-
+	NSUInteger count = 0;
+	NSUInteger offset = 0;
+	NSUInteger lineLength;
 
-#pragma mark - Checking Range
+	for (NSUInteger start = 0; CBHScanner_nextLine(bytes, length, &offset, &lineLength); start = offset, ++count)
+	{
+		if ( count >= capacity ) { continue; }
 
-CBH_CONST BOOL NSRange_isEmpty(const NSRange range)
-{
-	return ( range.length <= 0 );
-}
-
-CBH_CONST BOOL NSRange_isEqual(const NSRange range, const NSRange other)
-{
-	return NSEqualRanges(range, other);
-}
+		CBHParseStatus status;
+		ranges[count] = NSRange_initWithBytes(bytes + start, lineLength, NULL, &status);
 
+		if ( statuses != NULL ) { statuses[count] = status; }
+	}
 
-CBH_CONST BOOL NSRange_isLocationInRange(const NSRange range, const NSUInteger location)
-{
-	return NSLocationInRange(location, range);
-}
-
-
-#pragma mark - Derived Ranges
-
-CBH_CONST NSRange NSRange_intersection(const NSRange range, const NSRange other)
-{
-	return NSIntersectionRange(range, other);
-}
-
-CBH_CONST NSRange NSRange_union(const NSRange range, const NSRange other)
-{
-	return NSUnionRange(range, other);
-}
-
-
-#pragma mark - Calculated Properties
-
-CBH_CONST NSUInteger NSRange_max(const NSRange range)
-{
-	return NSMaxRange(range);
-}
-
-CBH_CONST NSUInteger NSRange_locationAtOffset(const NSRange range, const NSUInteger offset)
-{
-	if ( offset >= range.length ) { return NSNotFound; }
-	return range.location + offset;
+	return count;
 }
 
 
 #pragma mark - Description
 
-CBH_CONST NSString *NSRange_description(const NSRange range)
+NSUInteger NSRange_getDescription(const NSRange range, char * const buffer, const NSUInteger capacity)
 {
-	return NSStringFromRange(range);
+	char text[kCBHFormatterValueLength];
+	const NSUInteger length = (NSUInteger)(CBHFormatter_writeRange(text, range) - text);
+
+	return CBHFormatter_copy(text, length, buffer, capacity);
 }
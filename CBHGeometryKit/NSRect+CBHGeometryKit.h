@@ -18,6 +18,9 @@
 
 @import Foundation;
 
+#import <CBHGeometryKit/CBHInlining.h>
+#import <CBHGeometryKit/CBHParseStatus.h>
+
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -36,7 +39,7 @@ NS_ASSUME_NONNULL_BEGIN
  *
  * @return              A `NSRect` with its components provided by _x_, _y_, _width_, and _height_.
  */
-NSRect NSRect_init(CGFloat x, CGFloat y, CGFloat width, CGFloat height);
+CBH_INLINABLE NSRect NSRect_init(CGFloat x, CGFloat y, CGFloat width, CGFloat height);
 
 /** Creates a new `NSRect` from the specified structs.
  *
@@ -45,7 +48,7 @@ NSRect NSRect_init(CGFloat x, CGFloat y, CGFloat width, CGFloat height);
  *
  * @return              A `NSRect` with its components provided by the _origin_ and _size_.
  */
-NSRect NSRect_initWithStructs(NSPoint origin, NSSize size);
+CBH_INLINABLE NSRect NSRect_initWithStructs(NSPoint origin, NSSize size);
 
 /** Creates a new `NSRect` with an origin at {0, 0} and a specified size.
  *
@@ -53,7 +56,7 @@ NSRect NSRect_initWithStructs(NSPoint origin, NSSize size);
  *
  * @return              A `NSRect` with an origin at {0, 0} and its size component provided by _size_.
  */
-NSRect NSRect_initWithSize(NSSize size);
+CBH_INLINABLE NSRect NSRect_initWithSize(NSSize size);
 
 /** Creates a new `NSRect` from a text-based representation.
  *
@@ -63,13 +66,47 @@ NSRect NSRect_initWithSize(NSSize size);
  *
  * @warning             If _string_ does not contain any numbers the returned `NSRect` will have its components set to 0.
  */
-NSRect NSRect_initWithString(NSString *string);
+CBH_INLINABLE NSRect NSRect_initWithString(NSString *string);
 
 /** Creates a new `NSRect` with both the x, y, width, and height components set to 0.
  *
  * @return              A `NSRect` with its components set to 0.
  */
-NSRect NSRect_initEmpty(void);
+CBH_INLINABLE NSRect NSRect_initEmpty(void);
+
+
+#pragma mark - Parsing Rects
+
+/**
+ * @name Parsing Rects
+ *
+ * These functions read the text accepted by `NSRect_initWithString()` straight from bytes without creating any objects.
+ * Numbers are read the same way in every locale, and the results match `NSRectFromString()` exactly, including setting
+ * missing components to 0.
+ */
+
+/** Creates a new `NSRect` from a text-based representation in a buffer of bytes.
+ *
+ * @param bytes         The UTF-8 text to parse. It does not need to be terminated.
+ * @param length        The number of bytes in _bytes_.
+ * @param consumed      Receives the number of bytes read, which is all of them if a component is missing.
+ * @param status        Receives whether all of the x, y, width and height components were found.
+ *
+ * @return              A `NSRect` with its components provided by the first 4 reals in _bytes_.
+ */
+NSRect NSRect_initWithBytes(const char *bytes, NSUInteger length, NSUInteger * _Nullable consumed, CBHParseStatus * _Nullable status);
+
+/** Parses one `NSRect` from each line of a buffer of bytes.
+ *
+ * @param bytes         The UTF-8 text to parse, with one rect per line. It does not need to be terminated.
+ * @param length        The number of bytes in _bytes_.
+ * @param rects         A buffer to receive the rects.
+ * @param statuses      A buffer to receive the status of each line, or `NULL`.
+ * @param capacity      The number of elements _rects_ and _statuses_ can hold.
+ *
+ * @return              The number of lines, which may exceed _capacity_. A newline ending _bytes_ does not start a line.
+ */
+NSUInteger NSRect_parseLines(const char *bytes, NSUInteger length, NSRect *rects, CBHParseStatus * _Nullable statuses, NSUInteger capacity);
 
 
 #pragma mark - Checking Rects
@@ -86,7 +123,7 @@ NSRect NSRect_initEmpty(void);
  *
  * @warning             A rect size with a 0 or negative component is considered empty.
  */
-BOOL NSRect_isEmpty(NSRect rect);
+CBH_INLINABLE BOOL NSRect_isEmpty(NSRect rect);
 
 /** Indicates whether the rect is negative.
 *
@@ -94,7 +131,7 @@ BOOL NSRect_isEmpty(NSRect rect);
 *
 * @return               A `BOOL` value that indicates if the rects size has a component which is less than 0.
 */
-BOOL NSRect_isNegative(const NSRect rect);
+CBH_INLINABLE BOOL NSRect_isNegative(const NSRect rect);
 
 /** Indicates whether the two rects are equal.
  *
@@ -103,7 +140,7 @@ BOOL NSRect_isNegative(const NSRect rect);
  *
  * @return              A `BOOL` value that indicates if the two rects are identical.
  */
-BOOL NSRect_isEqual(NSRect rect, NSRect other);
+CBH_INLINABLE BOOL NSRect_isEqual(NSRect rect, NSRect other);
 
 
 /** Indicates whether a rect is completely covering another rect.
@@ -113,7 +150,7 @@ BOOL NSRect_isEqual(NSRect rect, NSRect other);
  *
  * @return              A `BOOL` value that indicates if _rect_ is completely covering _other_.
  */
-BOOL NSRect_isCovering(NSRect rect, NSRect other);
+CBH_INLINABLE BOOL NSRect_isCovering(NSRect rect, NSRect other);
 
 /** Indicates whether the two rects intersect.
  *
@@ -122,7 +159,7 @@ BOOL NSRect_isCovering(NSRect rect, NSRect other);
  *
  * @return              A `BOOL` value that indicates if _rect_ is intersecting _other_.
  */
-BOOL NSRect_isIntersecting(NSRect rect, NSRect other);
+CBH_INLINABLE BOOL NSRect_isIntersecting(NSRect rect, NSRect other);
 
 /** Indicates whether the a point is contained in a rect.
  *
@@ -131,7 +168,7 @@ BOOL NSRect_isIntersecting(NSRect rect, NSRect other);
  *
  * @return              A `BOOL` value that indicates if _rect_ contains the _point_.
  */
-BOOL NSRect_isPointInRect(NSRect rect, NSPoint point);
+CBH_INLINABLE BOOL NSRect_isPointInRect(NSRect rect, NSPoint point);
 
 /** Indicates whether the a mouse point is contained in a rect.
  *
@@ -141,7 +178,7 @@ BOOL NSRect_isPointInRect(NSRect rect, NSPoint point);
  *
  * @return              A `BOOL` value that indicates if _rect_ contains the mouse _point_.
  */
-BOOL NSRect_isMouseInRect(NSRect rect, NSPoint point, BOOL flipped);
+CBH_INLINABLE BOOL NSRect_isMouseInRect(NSRect rect, NSPoint point, BOOL flipped);
 
 
 #pragma mark - Derived Rects
@@ -158,7 +195,7 @@ BOOL NSRect_isMouseInRect(NSRect rect, NSPoint point, BOOL flipped);
  *
  * @return              A `NSRect` derived from _rect_ by having its sides inset.
  */
-NSRect NSRect_inset(NSRect rect, CGFloat dX, CGFloat dY);
+CBH_INLINABLE NSRect NSRect_inset(NSRect rect, CGFloat dX, CGFloat dY);
 
 /** Derives a new `NSRect` for which the x, and y components have been offset by the given amounts.
  *
@@ -168,7 +205,7 @@ NSRect NSRect_inset(NSRect rect, CGFloat dX, CGFloat dY);
  *
  * @return              A `NSRect` derived from _rect_ by having its origin offset.
  */
-NSRect NSRect_offset(NSRect rect, CGFloat dX, CGFloat dY);
+CBH_INLINABLE NSRect NSRect_offset(NSRect rect, CGFloat dX, CGFloat dY);
 
 
 /** Derives a new `NSRect` by adjusting its sides to be integer values.
@@ -179,7 +216,7 @@ NSRect NSRect_offset(NSRect rect, CGFloat dX, CGFloat dY);
  *
  * @warning             Wraps NSIntegralRect
  */
-NSRect NSRect_integral(NSRect rect);
+CBH_INLINABLE NSRect NSRect_integral(NSRect rect);
 
 
 /** Derives a new `NSRect` for which the x, y, width, and height components have been truncated.
@@ -188,7 +225,7 @@ NSRect NSRect_integral(NSRect rect);
  *
  * @return              A `NSRect` derived from _rect_ by having its components truncated.
  */
-NSRect NSRect_truncate(NSRect rect);
+CBH_INLINABLE NSRect NSRect_truncate(NSRect rect);
 
 /** Derives a new `NSRect` for which the x, y, width, and height components have been rounded.
  *
@@ -196,7 +233,7 @@ NSRect NSRect_truncate(NSRect rect);
  *
  * @return              A `NSRect` derived from _rect_ by having its components rounded.
  */
-NSRect NSRect_round(NSRect rect);
+CBH_INLINABLE NSRect NSRect_round(NSRect rect);
 
 /** Derives a new `NSRect` for which the size components have been converted to absolute values.
  *
@@ -204,7 +241,7 @@ NSRect NSRect_round(NSRect rect);
  *
  * @return              A `NSRect` derived from _rect_ by having its components converted to absolute values.
  */
-NSRect NSRect_absolute(NSRect rect);
+CBH_INLINABLE NSRect NSRect_absolute(NSRect rect);
 
 
 /** Derives a new `NSRect` for which the x, y, width, and height components have been truncated and the origin x and y has been shifted by 0.5.
@@ -213,7 +250,7 @@ NSRect NSRect_absolute(NSRect rect);
  *
  * @return              A `NSRect` derived from _rect_ by having its components truncated and the origin components shifted by 0.5
  */
-NSRect NSRect_alignWithPixels(NSRect rect);
+CBH_INLINABLE NSRect NSRect_alignWithPixels(NSRect rect);
 
 
 /** Derives a new `NSRect` representing the intersection (largest overlap) of two rects.
@@ -225,7 +262,7 @@ NSRect NSRect_alignWithPixels(NSRect rect);
  *
  * @warning             If there is no overlap an empty rect with its origin at {0, 0} is returned.
  */
-NSRect NSRect_intersection(NSRect rect, NSRect other);
+CBH_INLINABLE NSRect NSRect_intersection(NSRect rect, NSRect other);
 
 /** Derives a new `NSRect` representing the union (smallest rectangle which completely covers) the two rects.
  *
@@ -236,7 +273,7 @@ NSRect NSRect_intersection(NSRect rect, NSRect other);
  *
  * @warning             If one of the rects are empty the other rect is returned. If both are empty, an empty rect is returned with its origin at {0, 0}.
  */
-NSRect NSRect_union(NSRect rect, NSRect other);
+CBH_INLINABLE NSRect NSRect_union(NSRect rect, NSRect other);
 
 /** Derives a new `NSRect` with the same size as the first given rect shifted so the it is aligned with the center of the second rect.
  *
@@ -245,7 +282,7 @@ NSRect NSRect_union(NSRect rect, NSRect other);
  *
  * @return              A `NSRect` derived from _rect_ but is centered on _other_.
  */
-NSRect NSRect_centeredInRect(NSRect rect, NSRect inRect);
+CBH_INLINABLE NSRect NSRect_centeredInRect(NSRect rect, NSRect inRect);
 
 
 #pragma mark - Derived Points
@@ -262,7 +299,7 @@ NSRect NSRect_centeredInRect(NSRect rect, NSRect inRect);
  *
  * @warning             In the case of a negative size, this may be the origin.
  */
-NSPoint NSRect_maxPoint(NSRect rect);
+CBH_INLINABLE NSPoint NSRect_maxPoint(NSRect rect);
 
 /** Derives a `NSPoint` with the middle x and y values for the rect.
  *
@@ -270,7 +307,7 @@ NSPoint NSRect_maxPoint(NSRect rect);
  *
  * @return              A `NSPoint` with the minimum x and y values for the rect.
  */
-NSPoint NSRect_midPoint(NSRect rect);
+CBH_INLINABLE NSPoint NSRect_midPoint(NSRect rect);
 
 /** Derives a `NSPoint` minimum x and y values for the rect.
  *
@@ -280,7 +317,7 @@ NSPoint NSRect_midPoint(NSRect rect);
  *
  * @warning             In the case of a negative size, this is not the origin.
  */
-NSPoint NSRect_minPoint(NSRect rect);
+CBH_INLINABLE NSPoint NSRect_minPoint(NSRect rect);
 
 
 #pragma mark - Calculated Properties
@@ -293,7 +330,7 @@ NSPoint NSRect_minPoint(NSRect rect);
  *
  * @warning             In the case of a negative size, this may be the origins x value.
  */
-CGFloat NSRect_maxX(NSRect rect);
+CBH_INLINABLE CGFloat NSRect_maxX(NSRect rect);
 
 /** Derives the maximum y value for the rect.
  *
@@ -303,7 +340,7 @@ CGFloat NSRect_maxX(NSRect rect);
  *
  * @warning             In the case of a negative size, this may be the origins y value.
  */
-CGFloat NSRect_maxY(NSRect rect);
+CBH_INLINABLE CGFloat NSRect_maxY(NSRect rect);
 
 /** Derives the middle x value for the rect.
  *
@@ -311,7 +348,7 @@ CGFloat NSRect_maxY(NSRect rect);
  *
  * @return              A `CGFloat` representing the middle x value for the rect.
  */
-CGFloat NSRect_midX(NSRect rect);
+CBH_INLINABLE CGFloat NSRect_midX(NSRect rect);
 
 /** Derives the middle y value for the rect.
  *
@@ -319,7 +356,7 @@ CGFloat NSRect_midX(NSRect rect);
  *
  * @return              A `CGFloat` representing the middle y value for the rect.
  */
-CGFloat NSRect_midY(NSRect rect);
+CBH_INLINABLE CGFloat NSRect_midY(NSRect rect);
 
 /** Derives the minimum x value for the rect.
  *
@@ -329,7 +366,7 @@ CGFloat NSRect_midY(NSRect rect);
  *
  * @warning             In the case of a negative size, this is not the origins x value.
  */
-CGFloat NSRect_minX(NSRect rect);
+CBH_INLINABLE CGFloat NSRect_minX(NSRect rect);
 
 /** Derives the minimum y value for the rect.
  *
@@ -339,7 +376,85 @@ CGFloat NSRect_minX(NSRect rect);
  *
  * @warning             In the case of a negative size, this is not the origins y value.
  */
-CGFloat NSRect_minY(NSRect rect);
+CBH_INLINABLE CGFloat NSRect_minY(NSRect rect);
+
+
+#pragma mark - Batched Reductions
+
+/**
+ * @name Batched Reductions
+ *
+ * These functions are vectorized and split large arrays across cores.
+ */
+
+/** Derives the smallest `NSRect` containing every point in an array.
+ *
+ * @param points        The points to bound.
+ * @param count         The number of points in _points_.
+ *
+ * @return              A `NSRect` spanning the extents found by `NSPoint_extentsOfPoints()`, or an empty rect at {0, 0} if _points_ is empty.
+ */
+NSRect NSRect_boundingRectOfPoints(const NSPoint *points, NSUInteger count);
+
+/** Derives the union of the rects in an array.
+ *
+ * @param rects         The rects to combine.
+ * @param count         The number of rects in _rects_.
+ *
+ * @return              A `NSRect` covering every non-empty rect in _rects_, or an empty rect at {0, 0} if there are none.
+ *
+ * @warning             The result follows the rules of `NSRect_union()`, ignoring empty rects. Each edge is found
+ *                      exactly, so the result equals folding the rects with `NSRect_union()` whenever that fold rounds
+ *                      nothing, as with integral coordinates, and may otherwise differ from it in the last place.
+ */
+NSRect NSRect_unionOfRects(const NSRect *rects, NSUInteger count);
+
+
+#pragma mark - Batched Pixel Alignment
+
+/**
+ * @name Batched Pixel Alignment
+ *
+ * These functions snap to the pixels of a display with a backing scale factor, such as 2 for a Retina display. Each
+ * component is scaled into pixels, snapped, and scaled back. At a scale of 1 every result is identical to the single
+ * rect function. They are vectorized, split large arrays across cores, and may write their results over their input.
+ */
+
+/** Expands each rect in an array outward to whole pixels, as `NSRect_integral()` does.
+ *
+ * @param rects         The rects to expand.
+ * @param results       A buffer of _count_ rects to receive the results. Empty rects become `NSZeroRect`.
+ * @param count         The number of rects in _rects_.
+ * @param scale         The number of pixels per point. Must be positive.
+ */
+void NSRect_integralRects(const NSRect *rects, NSRect *results, NSUInteger count, CGFloat scale);
+
+/** Truncates the components of each rect in an array to the pixel grid.
+ *
+ * @param rects         The rects to truncate.
+ * @param results       A buffer of _count_ rects to receive the results.
+ * @param count         The number of rects in _rects_.
+ * @param scale         The number of pixels per point. Must be positive.
+ */
+void NSRect_truncateRects(const NSRect *rects, NSRect *results, NSUInteger count, CGFloat scale);
+
+/** Rounds the components of each rect in an array to the pixel grid, with halfway cases rounded away from zero.
+ *
+ * @param rects         The rects to round.
+ * @param results       A buffer of _count_ rects to receive the results.
+ * @param count         The number of rects in _rects_.
+ * @param scale         The number of pixels per point. Must be positive.
+ */
+void NSRect_roundRects(const NSRect *rects, NSRect *results, NSUInteger count, CGFloat scale);
+
+/** Aligns each rect in an array with the pixel grid, as `NSRect_alignWithPixels()` does.
+ *
+ * @param rects         The rects to align.
+ * @param results       A buffer of _count_ rects to receive the results.
+ * @param count         The number of rects in _rects_.
+ * @param scale         The number of pixels per point. Must be positive.
+ */
+void NSRect_alignRectsWithPixels(const NSRect *rects, NSRect *results, NSUInteger count, CGFloat scale);
 
 
 #pragma mark - Description
@@ -356,6 +471,23 @@ CGFloat NSRect_minY(NSRect rect);
  *
  * @return              A `NSString` representing the provided _rect_.
  */
-NSString *NSRect_description(NSRect rect);
+CBH_INLINABLE NSString *NSRect_description(NSRect rect);
+
+/** Writes a text representation of the provided rect into a buffer without creating any objects.
+ *
+ * The text has the layout of `NSRect_description()` with each number written in the fewest digits which convert back
+ * to the same value, so it round-trips through `NSRect_initWithString()` and `NSRect_initWithBytes()`.
+ *
+ * @param rect          The rect.
+ * @param buffer        A buffer to receive the text. Like `snprintf()`, the text is truncated to fit and terminated.
+ * @param capacity      The number of bytes _buffer_ can hold. 128 bytes are always enough.
+ *
+ * @return              The length of the full text, not counting the terminator.
+ */
+NSUInteger NSRect_getDescription(NSRect rect, char * _Nullable buffer, NSUInteger capacity);
 
 NS_ASSUME_NONNULL_END
+
+#if CBH_GEOMETRY_INLINE
+#import <CBHGeometryKit/NSRect+CBHGeometryKitInline.h>
+#endif
@@ -16,235 +16,344 @@
 //  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
 //  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 
+// The framework always exports the out of line definitions, whichever mode its clients use.
+#undef CBH_GEOMETRY_INLINE
+#define CBH_GEOMETRY_INLINE 0
+#define _CBH_GEOMETRY_EXPORTING 1
+
 #import "NSRect+CBHGeometryKit.h"
+#import "NSRect+CBHGeometryKitInline.h"
+#import "NSPoint+CBHGeometryKit.h"
 
 #import "_CBHGeometryKit+Utilities.h"
-
-#import "NSPoint+CBHGeometryKit.h"
-#import "NSSize+CBHGeometryKit.h"
+#import "_CBHGeometryKit+Formatter.h"
+#import "_CBHGeometryKit+Scanner.h"
+#import "_CBHGeometryKit+Parallel.h"
+#import "_CBHGeometryKit+Pixels.h"
+#import <math.h>
+#import <stdlib.h>
 
 
-#pragma mark - Creating Rects
+#pragma mark - Parsing Rects
 
-CBH_CONST NSRect NSRect_init(const CGFloat x, const CGFloat y, const CGFloat width, const CGFloat height)
+NSRect NSRect_initWithBytes(const char * const bytes, const NSUInteger length, NSUInteger * const consumed, CBHParseStatus * const status)
 {
-	return (NSRect){ (NSPoint){ .x = x, .y = y }, (NSSize){ .width = width, .height = height } };
-}
+	CGFloat components[4];
+	const CBHParseStatus result = CBHScanner_scanReals(bytes, length, components, 4, consumed);
 
-CBH_CONST NSRect NSRect_initWithStructs(const NSPoint origin, const NSSize size)
-{
-	return (NSRect){origin, size};
+	if ( status != NULL ) { *status = result; }
+	return NSRect_init(components[0], components[1], components[2], components[3]);
 }
 
-CBH_CONST NSRect NSRect_initWithSize(const NSSize size)
+NSUInteger NSRect_parseLines(const char * const bytes, const NSUInteger length, NSRect * const rects, CBHParseStatus * const statuses, const NSUInteger capacity)
 {
-	return (NSRect){ { .x = 0.0, .y = 0.0 }, size};
-}
+	NSUInteger count = 0;
+	NSUInteger offset = 0;
+	NSUInteger lineLength;
 
-CBH_CONST NSRect NSRect_initWithString(NSString * const string)
-{
-	return NSRectFromString(string);
-}
+	for (NSUInteger start = 0; CBHScanner_nextLine(bytes, length, &offset, &lineLength); start = offset, ++count)
+	{
+		if ( count >= capacity ) { continue; }
 
-CBH_CONST NSRect NSRect_initEmpty(void)
-{
-	return (NSRect){ { .x = 0.0, .y = 0.0 }, { .width = 0.0, .height = 0.0 } };
+		CBHParseStatus status;
+		rects[count] = NSRect_initWithBytes(bytes + start, lineLength, NULL, &status);
+
+		if ( statuses != NULL ) { statuses[count] = status; }
+	}
+
+	return count;
 }
 
 
-#pragma mark - Checking Rects
+#pragma mark - Batched Reductions
 
-CBH_CONST BOOL NSRect_isEmpty(const NSRect rect)
-{
-	return ( (rect.size.width <= 0.0) || (rect.size.height <= 0.0) );
-}
+// A rect is empty unless both sides are positive, as with `NSIsEmptyRect()`, so a NaN side is empty too. Empty rects
+// are swapped for an infinite origin and an infinitely negative maximum, which leave the bounds unchanged.
 
-CBH_CONST BOOL NSRect_isNegative(const NSRect rect)
+typedef struct CBHRectBounds
 {
-	return ( (rect.size.width < 0.0) || (rect.size.height < 0.0) );
-}
+	NSPoint minimum;
+	NSPoint maximum;
+} CBHRectBounds;
 
-CBH_CONST BOOL NSRect_isEqual(const NSRect rect, const NSRect other)
+typedef struct CBHRectReduction
 {
-	return NSEqualRects(rect, other);
-}
+	const NSRect *rects;
+	NSUInteger count;
+	CBHRectBounds *partials;
+} CBHRectReduction;
 
-
-CBH_CONST BOOL NSRect_isCovering(const NSRect rect, const NSRect other)
+static CBHRectBounds _CBHRect_boundsOfChunk(const NSRect * const rects, const NSUInteger count)
 {
-	return NSContainsRect(rect, other);
-}
+	CBHRectBounds bounds = { .minimum = { INFINITY, INFINITY }, .maximum = { -INFINITY, -INFINITY } };
+	NSUInteger i = 0;
 
-CBH_CONST BOOL NSRect_isIntersecting(const NSRect rect, const NSRect other)
-{
-	return NSIntersectsRect(rect, other);
-}
+#if CBH_VECTOR_AVX2
+	const __m256d zero = _mm256_setzero_pd();
+	const __m256d infinity = _mm256_set1_pd(INFINITY);
+	const __m256d negativeInfinity = _mm256_set1_pd(-INFINITY);
 
+	__m256d lower = infinity;
+	__m256d upper = negativeInfinity;
 
-CBH_CONST BOOL NSRect_isPointInRect(const NSRect rect, const NSPoint point)
-{
-	return NSPointInRect(point, rect);
-}
+	for ( ; i + 2 <= count; i += 2 )
+	{
+		const __m256d first = _mm256_loadu_pd((const double *)(rects + i));
+		const __m256d second = _mm256_loadu_pd((const double *)(rects + i + 1));
 
-CBH_CONST BOOL NSRect_isMouseInRect(const NSRect rect, const NSPoint point, const BOOL flipped)
-{
-	return NSMouseInRect(point, rect, flipped);
-}
+		// { x0, y0, x1, y1 } and { w0, h0, w1, h1 }.
+		const __m256d origins = _mm256_permute2f128_pd(first, second, 0x20);
+		const __m256d sizes = _mm256_permute2f128_pd(first, second, 0x31);
 
+		const __m256d positive = _mm256_cmp_pd(sizes, zero, _CMP_GT_OQ);
+		const __m256d isFilled = _mm256_and_pd(positive, _mm256_permute_pd(positive, 0x5));
 
-#pragma mark - Derived Rects
+		lower = _mm256_min_pd(lower, _mm256_blendv_pd(infinity, origins, isFilled));
+		upper = _mm256_max_pd(upper, _mm256_blendv_pd(negativeInfinity, _mm256_add_pd(origins, sizes), isFilled));
+	}
 
-CBH_CONST NSRect NSRect_inset(const NSRect rect, const CGFloat dX, const CGFloat dY)
-{
-	return NSInsetRect(rect, dX, dY);
-}
+	_mm_storeu_pd((double *)&bounds.minimum, _mm_min_pd(_mm256_castpd256_pd128(lower), _mm256_extractf128_pd(lower, 1)));
+	_mm_storeu_pd((double *)&bounds.maximum, _mm_max_pd(_mm256_castpd256_pd128(upper), _mm256_extractf128_pd(upper, 1)));
+#elif CBH_VECTOR_SSE2
+	const __m128d zero = _mm_setzero_pd();
+	const __m128d infinity = _mm_set1_pd(INFINITY);
+	const __m128d negativeInfinity = _mm_set1_pd(-INFINITY);
 
-CBH_CONST NSRect NSRect_offset(const NSRect rect, const CGFloat dX, const CGFloat dY)
-{
-	return NSOffsetRect(rect, dX, dY);
-}
+	__m128d lower = infinity;
+	__m128d upper = negativeInfinity;
 
+	for ( ; i < count; ++i )
+	{
+		const __m128d origin = _mm_loadu_pd((const double *)(rects + i));
+		const __m128d size = _mm_loadu_pd((const double *)(rects + i) + 2);
 
-CBH_CONST NSRect NSRect_integral(const NSRect rect)
-{
-	return NSIntegralRect(rect);
-}
+		const __m128d positive = _mm_cmpgt_pd(size, zero);
+		const __m128d isFilled = _mm_and_pd(positive, _mm_shuffle_pd(positive, positive, 0x1));
 
-CBH_CONST NSRect NSRect_truncate(const NSRect rect)
-{
-	NSRect newRect;
+		lower = _mm_min_pd(lower, _mm_or_pd(_mm_and_pd(isFilled, origin), _mm_andnot_pd(isFilled, infinity)));
+		upper = _mm_max_pd(upper, _mm_or_pd(_mm_and_pd(isFilled, _mm_add_pd(origin, size)), _mm_andnot_pd(isFilled, negativeInfinity)));
+	}
 
-	newRect.origin = NSPoint_truncate(rect.origin);
-	newRect.size = NSSize_truncate(rect.size);
+	_mm_storeu_pd((double *)&bounds.minimum, lower);
+	_mm_storeu_pd((double *)&bounds.maximum, upper);
+#elif CBH_VECTOR_NEON
+	const float64x2_t zero = vdupq_n_f64(0.0);
+	const float64x2_t infinity = vdupq_n_f64(INFINITY);
+	const float64x2_t negativeInfinity = vdupq_n_f64(-INFINITY);
 
-	return newRect;
-}
+	float64x2_t lower = infinity;
+	float64x2_t upper = negativeInfinity;
 
-CBH_CONST NSRect NSRect_round(const NSRect rect)
-{
-	NSRect newRect;
+	for ( ; i < count; ++i )
+	{
+		const float64x2_t origin = vld1q_f64((const double *)(rects + i));
+		const float64x2_t size = vld1q_f64((const double *)(rects + i) + 2);
 
-	newRect.origin = NSPoint_round(rect.origin);
-	newRect.size = NSSize_round(rect.size);
+		const uint64x2_t positive = vcgtq_f64(size, zero);
+		const uint64x2_t isFilled = vandq_u64(positive, vextq_u64(positive, positive, 1));
 
-	return newRect;
-}
+		lower = vminq_f64(lower, vbslq_f64(isFilled, origin, infinity));
+		upper = vmaxq_f64(upper, vbslq_f64(isFilled, vaddq_f64(origin, size), negativeInfinity));
+	}
 
-CBH_CONST NSRect NSRect_absolute(const NSRect rect)
-{
-	if ( !NSRect_isNegative(rect) ) { return rect; }
+	vst1q_f64((double *)&bounds.minimum, lower);
+	vst1q_f64((double *)&bounds.maximum, upper);
+#endif
 
-	NSRect newRect = rect;
+	for ( ; i < count; ++i )
+	{
+		const NSRect rect = rects[i];
+		if ( !(rect.size.width > 0.0 && rect.size.height > 0.0) ) { continue; }
 
-	newRect.origin = NSRect_minPoint(rect);
-	newRect.size = NSSize_absolute(rect.size);
+		bounds.minimum.x = MIN(bounds.minimum.x, rect.origin.x);
+		bounds.minimum.y = MIN(bounds.minimum.y, rect.origin.y);
+		bounds.maximum.x = MAX(bounds.maximum.x, rect.origin.x + rect.size.width);
+		bounds.maximum.y = MAX(bounds.maximum.y, rect.origin.y + rect.size.height);
+	}
 
-	return newRect;
+	return bounds;
 }
 
-
-CBH_CONST NSRect NSRect_alignWithPixels(const NSRect rect)
+static void _CBHRect_boundsWorker(void * const context, const NSRange blocks)
 {
-	NSRect newRect;
-
-	newRect.origin = NSPoint_nearestPixel(rect.origin);
-	newRect.size = NSSize_truncate(rect.size);
+	const CBHRectReduction * const reduction = context;
 
-	return newRect;
+	for (NSUInteger i = blocks.location; i < NSMaxRange(blocks); ++i)
+	{
+		const NSRange block = CBHParallel_block(reduction->count, i);
+		reduction->partials[i] = _CBHRect_boundsOfChunk(reduction->rects + block.location, block.length);
+	}
 }
 
 
-CBH_CONST NSRect NSRect_intersection(const NSRect rect, const NSRect other)
+NSRect NSRect_boundingRectOfPoints(const NSPoint * const points, const NSUInteger count)
 {
-	return NSIntersectionRect(rect, other);
+	NSPoint minimum;
+	NSPoint maximum;
+
+	if ( !NSPoint_extentsOfPoints(points, count, &minimum, &maximum) ) { return NSRect_initEmpty(); }
+	return NSRect_init(minimum.x, minimum.y, maximum.x - minimum.x, maximum.y - minimum.y);
 }
 
-CBH_CONST NSRect NSRect_union(const NSRect rect, const NSRect other)
+NSRect NSRect_unionOfRects(const NSRect * const rects, const NSUInteger count)
 {
-	return NSUnionRect(rect, other);
-}
+	const NSUInteger blockCount = CBHParallel_blockCount(count);
+	const NSUInteger grainSize = CBHParallel_grainSizeForUnit(kCBHParallelBlockLength);
+	CBHRectBounds * const partials = ( CBHParallel_isSplit(blockCount, grainSize) ) ? malloc(sizeof(CBHRectBounds) * blockCount) : NULL;
 
+	CBHRectBounds bounds;
 
-CBH_CONST NSRect NSRect_centeredInRect(const NSRect rect, const NSRect inRect)
-{
-	NSRect newRect = rect;
+	if ( partials != NULL )
+	{
+		CBHRectReduction reduction = { .rects = rects, .count = count, .partials = partials };
+		CBHParallel_applyWithGrainSize(blockCount, grainSize, &reduction, _CBHRect_boundsWorker);
+
+		bounds = partials[0];
+		for (NSUInteger i = 1; i < blockCount; ++i)
+		{
+			bounds.minimum.x = MIN(bounds.minimum.x, partials[i].minimum.x);
+			bounds.minimum.y = MIN(bounds.minimum.y, partials[i].minimum.y);
+			bounds.maximum.x = MAX(bounds.maximum.x, partials[i].maximum.x);
+			bounds.maximum.y = MAX(bounds.maximum.y, partials[i].maximum.y);
+		}
 
-	newRect.origin.x = inRect.origin.x + ((inRect.size.width - rect.size.width) / 2.0);
-	newRect.origin.y = inRect.origin.y + ((inRect.size.height - rect.size.height) / 2.0);
+		free(partials);
+	}
+	else
+	{
+		bounds = _CBHRect_boundsOfChunk(rects, count);
+	}
 
-	return newRect;
+	// Only a rect with positive sides can raise the maximum above the minimum.
+	if ( !(bounds.minimum.x < bounds.maximum.x) ) { return NSRect_initEmpty(); }
+	return NSRect_init(bounds.minimum.x, bounds.minimum.y, bounds.maximum.x - bounds.minimum.x, bounds.maximum.y - bounds.minimum.y);
 }
 
 
-#pragma mark - Derived Points
+#pragma mark - Batched Pixel Alignment
+
+// The vector paths load the origins and sizes of `CBH_VECTOR_WIDTH / 2` rects at a time into separate vectors.
 
-CBH_CONST NSPoint NSRect_maxPoint(const NSRect rect)
+typedef struct CBHRectSnap
 {
-	NSPoint point;
+	const NSRect *rects;
+	NSRect *results;
+	CGFloat scale;
+} CBHRectSnap;
 
-	point.x = NSRect_maxX(rect);
-	point.y = NSRect_maxY(rect);
+NS_INLINE void _CBHRect_snapRects(const CBHRectSnap * const batch, const NSRange range, const CBHPixelSnap originSnap, const CBHPixelSnap sizeSnap)
+{
+	const NSRect * const rects = batch->rects + range.location;
+	NSRect * const results = batch->results + range.location;
+	const CGFloat factor = batch->scale;
+	NSUInteger i = 0;
 
-	return point;
-}
+#if CBH_VECTOR
+	const CBHVector scale = CBHVector_set(factor);
 
-CBH_CONST NSPoint NSRect_midPoint(const NSRect rect)
-{
-	NSPoint point;
+	for ( ; i + CBH_VECTOR_WIDTH / 2 <= range.length; i += CBH_VECTOR_WIDTH / 2 )
+	{
+		CBHVector origin;
+		CBHVector size;
+		CBHVector_loadPairs((const double *)(rects + i), &origin, &size);
+
+		origin = CBHPixelVector_snap(origin, scale, originSnap);
+		size = CBHPixelVector_snap(size, scale, sizeSnap);
 
-	point.x = NSRect_midX(rect);
-	point.y = NSRect_midY(rect);
+		CBHVector_storePairs((double *)(results + i), origin, size);
+	}
+#endif
 
-	return point;
+	for ( ; i < range.length; ++i )
+	{
+		const NSRect rect = rects[i];
+
+		results[i].origin.x = CBHPixel_snap(rect.origin.x, factor, originSnap);
+		results[i].origin.y = CBHPixel_snap(rect.origin.y, factor, originSnap);
+		results[i].size.width = CBHPixel_snap(rect.size.width, factor, sizeSnap);
+		results[i].size.height = CBHPixel_snap(rect.size.height, factor, sizeSnap);
+	}
 }
 
-CBH_CONST NSPoint NSRect_minPoint(const NSRect rect)
+static void _CBHRect_integralWorker(void * const context, const NSRange range)
 {
-	NSPoint point;
+	const CBHRectSnap * const batch = context;
+	const NSRect * const rects = batch->rects + range.location;
+	NSRect * const results = batch->results + range.location;
+	NSUInteger i = 0;
 
-	point.x = NSRect_minX(rect);
-	point.y = NSRect_minY(rect);
+#if CBH_VECTOR
+	const CBHVector scale = CBHVector_set(batch->scale);
+	const CBHVector zero = CBHVector_set(0.0);
 
-	return point;
-}
+	for ( ; i + CBH_VECTOR_WIDTH / 2 <= range.length; i += CBH_VECTOR_WIDTH / 2 )
+	{
+		CBHVector origin;
+		CBHVector size;
+		CBHVector_loadPairs((const double *)(rects + i), &origin, &size);
 
+		// A rect is filled only if both sides are greater than 0, so each lane is combined with the other axis of its rect.
+		CBHVector filled = CBHVector_isLess(zero, size);
+		filled = CBHVector_and(filled, CBHVector_swapPairs(filled));
 
-#pragma mark - Calculated Properties
+		CBHPixelVector_integral(&origin, &size, filled, scale);
+		CBHVector_storePairs((double *)(results + i), origin, size);
+	}
+#endif
 
-CBH_CONST CGFloat NSRect_maxX(const NSRect rect)
+	for ( ; i < range.length; ++i )
+	{
+		results[i] = CBHPixel_integralRect(rects[i], batch->scale);
+	}
+}
+
+static void _CBHRect_truncateWorker(void * const context, const NSRange range)
+{
+	_CBHRect_snapRects(context, range, CBHPixelSnapTruncate, CBHPixelSnapTruncate);
+}
+
+static void _CBHRect_roundWorker(void * const context, const NSRange range)
 {
-	return ( rect.size.width <= 0 ) ? rect.origin.x : rect.origin.x + rect.size.width;
+	_CBHRect_snapRects(context, range, CBHPixelSnapRound, CBHPixelSnapRound);
 }
 
-CBH_CONST CGFloat NSRect_maxY(const NSRect rect)
+static void _CBHRect_alignWorker(void * const context, const NSRange range)
 {
-	return ( rect.size.height <= 0 ) ? rect.origin.y : rect.origin.y + rect.size.height;
+	_CBHRect_snapRects(context, range, CBHPixelSnapCenter, CBHPixelSnapTruncate);
 }
 
-CBH_CONST CGFloat NSRect_midX(const NSRect rect)
+
+void NSRect_integralRects(const NSRect * const rects, NSRect * const results, const NSUInteger count, const CGFloat scale)
 {
-	return rect.origin.x + (rect.size.width / 2.0);
+	CBHRectSnap batch = { .rects = rects, .results = results, .scale = scale };
+	CBHParallel_apply(count, &batch, _CBHRect_integralWorker);
 }
 
-CBH_CONST CGFloat NSRect_midY(const NSRect rect)
+void NSRect_truncateRects(const NSRect * const rects, NSRect * const results, const NSUInteger count, const CGFloat scale)
 {
-	return rect.origin.y + (rect.size.height / 2.0);
+	CBHRectSnap batch = { .rects = rects, .results = results, .scale = scale };
+	CBHParallel_apply(count, &batch, _CBHRect_truncateWorker);
 }
 
-CBH_CONST CGFloat NSRect_minX(const NSRect rect)
+void NSRect_roundRects(const NSRect * const rects, NSRect * const results, const NSUInteger count, const CGFloat scale)
 {
-	return ( rect.size.width >= 0 ) ? rect.origin.x : rect.origin.x + rect.size.width;
+	CBHRectSnap batch = { .rects = rects, .results = results, .scale = scale };
+	CBHParallel_apply(count, &batch, _CBHRect_roundWorker);
 }
 
-CBH_CONST CGFloat NSRect_minY(const NSRect rect)
+void NSRect_alignRectsWithPixels(const NSRect * const rects, NSRect * const results, const NSUInteger count, const CGFloat scale)
 {
-	return ( rect.size.height >= 0 ) ? rect.origin.y : rect.origin.y + rect.size.height;
+	CBHRectSnap batch = { .rects = rects, .results = results, .scale = scale };
+	CBHParallel_apply(count, &batch, _CBHRect_alignWorker);
 }
 
 
 #pragma mark - Description
 
-CBH_CONST NSString *NSRect_description(const NSRect rect)
+NSUInteger NSRect_getDescription(const NSRect rect, char * const buffer, const NSUInteger capacity)
 {
-	return NSStringFromRect(rect);
+	char text[kCBHFormatterValueLength];
+	const NSUInteger length = (NSUInteger)(CBHFormatter_writeRect(text, rect) - text);
+
+	return CBHFormatter_copy(text, length, buffer, capacity);
 }
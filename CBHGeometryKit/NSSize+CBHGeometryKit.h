@@ -18,6 +18,9 @@
 
 @import Foundation;
 
+#import <CBHGeometryKit/CBHInlining.h>
+#import <CBHGeometryKit/CBHParseStatus.h>
+
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -34,7 +37,7 @@ NS_ASSUME_NONNULL_BEGIN
  *
  * @return              A `NSSize` with its components provided by _width_ and _height_.
  */
-NSSize NSSize_init(CGFloat width, CGFloat height);
+CBH_INLINABLE NSSize NSSize_init(CGFloat width, CGFloat height);
 
 /** Creates a new `NSSize` from a text-based representation.
  *
@@ -44,13 +47,47 @@ NSSize NSSize_init(CGFloat width, CGFloat height);
  *
  * @warning If _string_ does not contain any numbers the returned `NSSize` will have its components set to 0.
  */
-NSSize NSSize_initWithString(NSString *string);
+CBH_INLINABLE NSSize NSSize_initWithString(NSString *string);
 
 /** Creates a new `NSSize` with both the width and height components set to 0.
  *
  * @return              A `NSSize` with its components set to 0.
  */
-NSSize NSSize_initEmpty(void);
+CBH_INLINABLE NSSize NSSize_initEmpty(void);
+
+
+#pragma mark - Parsing Sizes
+
+/**
+ * @name Parsing Sizes
+ *
+ * These functions read the text accepted by `NSSize_initWithString()` straight from bytes without creating any objects.
+ * Numbers are read the same way in every locale, and the results match `NSSizeFromString()` exactly, including setting
+ * missing components to 0.
+ */
+
+/** Creates a new `NSSize` from a text-based representation in a buffer of bytes.
+ *
+ * @param bytes         The UTF-8 text to parse. It does not need to be terminated.
+ * @param length        The number of bytes in _bytes_.
+ * @param consumed      Receives the number of bytes read, which is all of them if a component is missing.
+ * @param status        Receives whether all of the width and height components were found.
+ *
+ * @return              A `NSSize` with its components provided by the first 2 reals in _bytes_.
+ */
+NSSize NSSize_initWithBytes(const char *bytes, NSUInteger length, NSUInteger * _Nullable consumed, CBHParseStatus * _Nullable status);
+
+/** Parses one `NSSize` from each line of a buffer of bytes.
+ *
+ * @param bytes         The UTF-8 text to parse, with one size per line. It does not need to be terminated.
+ * @param length        The number of bytes in _bytes_.
+ * @param sizes         A buffer to receive the sizes.
+ * @param statuses      A buffer to receive the status of each line, or `NULL`.
+ * @param capacity      The number of elements _sizes_ and _statuses_ can hold.
+ *
+ * @return              The number of lines, which may exceed _capacity_. A newline ending _bytes_ does not start a line.
+ */
+NSUInteger NSSize_parseLines(const char *bytes, NSUInteger length, NSSize *sizes, CBHParseStatus * _Nullable statuses, NSUInteger capacity);
 
 
 #pragma mark - Checking Sizes
@@ -67,7 +104,7 @@ NSSize NSSize_initEmpty(void);
  *
  * @warning A size with a 0 or negative component is considered empty.
  */
-BOOL NSSize_isEmpty(NSSize size);
+CBH_INLINABLE BOOL NSSize_isEmpty(NSSize size);
 
 /** Indicates whether the size has a component that is negative.
  *
@@ -75,7 +112,7 @@ BOOL NSSize_isEmpty(NSSize size);
  *
  * @return              A `BOOL` value that indicates if the size has a component that is negative.
  */
-BOOL NSSize_isNegative(NSSize size);
+CBH_INLINABLE BOOL NSSize_isNegative(NSSize size);
 
 /** Indicates whether the two sizes are equal.
  *
@@ -84,7 +121,7 @@ BOOL NSSize_isNegative(NSSize size);
  *
  * @return              A `BOOL` value that indicates if the two sizes are identical.
  */
-BOOL NSSize_isEqual(NSSize size, NSSize other);
+CBH_INLINABLE BOOL NSSize_isEqual(NSSize size, NSSize other);
 
 
 #pragma mark - Derived Sizes
@@ -99,7 +136,7 @@ BOOL NSSize_isEqual(NSSize size, NSSize other);
  *
  * @return              A `NSSize` derived from _size_ by having its components truncated.
  */
-NSSize NSSize_truncate(NSSize size);
+CBH_INLINABLE NSSize NSSize_truncate(NSSize size);
 
 /** Derives a new `NSSize` for which the width and height components have been rounded.
  *
@@ -107,7 +144,7 @@ NSSize NSSize_truncate(NSSize size);
  *
  * @return              A `NSSize` derived from _size_ by having its components rounded.
  */
-NSSize NSSize_round(NSSize size);
+CBH_INLINABLE NSSize NSSize_round(NSSize size);
 
 /** Derives a new `NSSize` for which the width and height components have been converted to their absolute values.
  *
@@ -115,7 +152,7 @@ NSSize NSSize_round(NSSize size);
  *
  * @return              A `NSSize` derived from _size_ by having its components converted to their absolute values.
  */
-NSSize NSSize_absolute(NSSize size);
+CBH_INLINABLE NSSize NSSize_absolute(NSSize size);
 
 
 /** Derives a new `NSSize` for which the width and height components have been shifted by the components of a second point.
@@ -125,7 +162,7 @@ NSSize NSSize_absolute(NSSize size);
  *
  * @return              A `NSSize` derived from _size_ by having it components scaled by the provided amounts.
  */
-NSSize NSSize_scale(NSSize size, NSSize delta);
+CBH_INLINABLE NSSize NSSize_scale(NSSize size, NSSize delta);
 
 /** Derives a new `NSSize` for which the width and height components have been scaled by the provided values.
  *
@@ -135,7 +172,7 @@ NSSize NSSize_scale(NSSize size, NSSize delta);
  *
  * @return              A `NSPoint` derived from _point_ by having its components scaled by the provided amounts.
  */
-NSSize NSSize_scaleParametric(NSSize size, CGFloat dWidth, CGFloat dHeight);
+CBH_INLINABLE NSSize NSSize_scaleParametric(NSSize size, CGFloat dWidth, CGFloat dHeight);
 
 
 #pragma mark - Description
@@ -152,6 +189,23 @@ NSSize NSSize_scaleParametric(NSSize size, CGFloat dWidth, CGFloat dHeight);
  *
  * @return              A `NSString` representing the provided _size_.
  */
-NSString *NSSize_description(NSSize size);
+CBH_INLINABLE NSString *NSSize_description(NSSize size);
+
+/** Writes a text representation of the provided size into a buffer without creating any objects.
+ *
+ * The text has the layout of `NSSize_description()` with each number written in the fewest digits which convert back
+ * to the same value, so it round-trips through `NSSize_initWithString()` and `NSSize_initWithBytes()`.
+ *
+ * @param size          The size.
+ * @param buffer        A buffer to receive the text. Like `snprintf()`, the text is truncated to fit and terminated.
+ * @param capacity      The number of bytes _buffer_ can hold. 128 bytes are always enough.
+ *
+ * @return              The length of the full text, not counting the terminator.
+ */
+NSUInteger NSSize_getDescription(NSSize size, char * _Nullable buffer, NSUInteger capacity);
 
 NS_ASSUME_NONNULL_END
+
+#if CBH_GEOMETRY_INLINE
+#import <CBHGeometryKit/NSSize+CBHGeometryKitInline.h>
+#endif
@@ -16,99 +16,56 @@
 //  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
 //  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 
+// The framework always exports the out of line definitions, whichever mode its clients use.
+#undef CBH_GEOMETRY_INLINE
+#define CBH_GEOMETRY_INLINE 0
+#define _CBH_GEOMETRY_EXPORTING 1
+
 #import "NSSize+CBHGeometryKit.h"
+#import "NSSize+CBHGeometryKitInline.h"
 
 #import "_CBHGeometryKit+Utilities.h"
+#import "_CBHGeometryKit+Formatter.h"
+#import "_CBHGeometryKit+Scanner.h"
 
 
-#pragma mark - Creating Sizes
+#pragma mark - Parsing Sizes
 
-CBH_CONST NSSize NSSize_init(const CGFloat width, const CGFloat height)
+NSSize NSSize_initWithBytes(const char * const bytes, const NSUInteger length, NSUInteger * const consumed, CBHParseStatus * const status)
 {
-	return (NSSize){ .width = width, .height = height };
-}
+	CGFloat components[2];
+	const CBHParseStatus result = CBHScanner_scanReals(bytes, length, components, 2, consumed);
 
-CBH_CONST NSSize NSSize_initWithString(NSString * const string)
-{
-	return NSSizeFromString(string);
+	if ( status != NULL ) { *status = result; }
+	return NSSize_init(components[0], components[1]);
 }
 
-CBH_CONST NSSize NSSize_initEmpty(void)
+NSUInteger NSSize_parseLines(const char * const bytes, const NSUInteger length, NSSize * const sizes, CBHParseStatus * const statuses, const NSUInteger capacity)
 {
-	return (NSSize){ .width = 0.0, .height = 0.0 };
-}
-
+	NSUInteger count = 0;
+	NSUInteger offset = 0;
+	NSUInteger lineLength;
 
-#pragma mark - Checking Sizes
+	for (NSUInteger start = 0; CBHScanner_nextLine(bytes, length, &offset, &lineLength); start = offset, ++count)
+	{
+		if ( count >= capacity ) { continue; }
 
-CBH_CONST BOOL NSSize_isEmpty(const NSSize size)
-{
-	return ( (size.width <= 0.0) || (size.height <= 0.0) );
-}
+		CBHParseStatus status;
+		sizes[count] = NSSize_initWithBytes(bytes + start, lineLength, NULL, &status);
 
-CBH_CONST BOOL NSSize_isNegative(const NSSize size)
-{
-	return ( (size.width < 0.0) || (size.height < 0.0) );
-}
+		if ( statuses != NULL ) { statuses[count] = status; }
+	}
 
-CBH_CONST BOOL NSSize_isEqual(const NSSize size, const NSSize other)
-{
-	return ( (size.width == other.width) && (size.height == other.height) );
-}
-
-
-#pragma mark - Derived Sizes
-
-CBH_CONST NSSize NSSize_truncate(const NSSize size)
-{
-	NSSize newSize;
-
-	newSize.width = trunc(size.width);
-	newSize.height = trunc(size.height);
-
-	return newSize;
-}
-
-CBH_CONST NSSize NSSize_round(const NSSize size)
-{
-	NSSize newSize;
-
-	newSize.width = round(size.width);
-	newSize.height = round(size.height);
-
-	return newSize;
-}
-
-CBH_CONST NSSize NSSize_absolute(const NSSize size)
-{
-	NSSize newSize;
-
-	newSize.width = fabs(size.width);
-	newSize.height = fabs(size.height);
-
-	return newSize;
-}
-
-
-CBH_CONST NSSize NSSize_scale(const NSSize size, const NSSize delta)
-{
-	return NSSize_scaleParametric(size, delta.width, delta.height);
-}
-
-CBH_CONST NSSize NSSize_scaleParametric(const NSSize size, const CGFloat dWidth, const CGFloat dHeight)
-{
-	NSSize newSize = size;
-
-	newSize.width += dWidth;
-	newSize.height += dHeight;
-
-	return newSize;
+	return count;
 }
 
 
 #pragma mark - Description
 
-CBH_CONST NSString *NSSize_description(const NSSize size)
+NSUInteger NSSize_getDescription(const NSSize size, char * const buffer, const NSUInteger capacity)
 {
-	return NSStringFromSize(size);
+	char text[kCBHFormatterValueLength];
+	const NSUInteger length = (NSUInteger)(CBHFormatter_writeSize(text, size) - text);
+
+	return CBHFormatter_copy(text, length, buffer, capacity);
 }
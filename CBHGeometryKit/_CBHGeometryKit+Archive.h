@@ -0,0 +1,106 @@
+//  _CBHGeometryKit+Archive.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#pragma once
+
+#import "CBHGeometryArchive.h"
+
+
+// The on-disk structures of a `CBHGeometryArchive`, shared by the reader and `CBHGeometryArchiveWriter`. See
+// `CBHGeometryArchive.h` for the layout.
+
+enum
+{
+	kCBHArchiveVersion = 1,
+	kCBHArchiveByteOrderMark = 0x01020304,
+	kCBHArchiveSwappedByteOrderMark = 0x04030201,
+	kCBHArchiveAlignment = 16,
+};
+
+static const char kCBHArchiveMagic[8] = "CBHGEOM";
+
+typedef struct CBHArchiveHeader
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t byteOrderMark;
+	uint8_t reserved[16];
+} CBHArchiveHeader;
+
+typedef struct CBHArchiveEntry
+{
+	uint32_t kind;
+	uint32_t storage;
+	uint64_t count;
+	uint64_t offset;
+	uint64_t reserved;
+} CBHArchiveEntry;
+
+typedef struct CBHArchiveTrailer
+{
+	uint64_t tableOffset;
+	uint64_t sectionCount;
+	char magic[8];
+	uint8_t reserved[8];
+} CBHArchiveTrailer;
+
+_Static_assert(sizeof(CBHArchiveHeader) == 32, "The archive header must be 32 bytes.");
+_Static_assert(sizeof(CBHArchiveEntry) == 32, "Archive entries must be 32 bytes.");
+_Static_assert(sizeof(CBHArchiveTrailer) == 32, "The archive trailer must be 32 bytes.");
+
+
+#pragma mark - Layouts
+
+NS_INLINE NSUInteger CBHArchive_componentCount(const uint32_t kind)
+{
+	return ( kind == CBHGeometryArchiveKindRects ) ? 4 : 2;
+}
+
+NS_INLINE NSUInteger CBHArchive_componentSize(const uint32_t storage)
+{
+	return ( storage == CBHGeometryArchiveStorageFloat32 ) ? sizeof(float) : sizeof(uint64_t);
+}
+
+NS_INLINE BOOL CBHArchive_isValidLayout(const uint32_t kind, const uint32_t storage)
+{
+	switch ( kind )
+	{
+		case CBHGeometryArchiveKindPoints:
+		case CBHGeometryArchiveKindSizes:
+		case CBHGeometryArchiveKindRects:
+			return ( storage == CBHGeometryArchiveStorageFloat64 ) || ( storage == CBHGeometryArchiveStorageFloat32 );
+
+		case CBHGeometryArchiveKindRanges:
+			return ( storage == CBHGeometryArchiveStorageUInt64 );
+
+		default:
+			return NO;
+	}
+}
+
+/// Whether values with `storage` can be read in place as `CGFloat` or `NSUInteger` components.
+NS_INLINE BOOL CBHArchive_isNativeStorage(const uint32_t storage)
+{
+	switch ( storage )
+	{
+		case CBHGeometryArchiveStorageFloat64: return ( sizeof(CGFloat) == sizeof(double) );
+		case CBHGeometryArchiveStorageFloat32: return ( sizeof(CGFloat) == sizeof(float) );
+		case CBHGeometryArchiveStorageUInt64: return ( sizeof(NSUInteger) == sizeof(uint64_t) );
+		default: return NO;
+	}
+}
@@ -0,0 +1,175 @@
+//  _CBHGeometryKit+Formatter.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#pragma once
+
+#import <math.h>
+#import <stdio.h>
+#import <stdlib.h>
+#import <string.h>
+
+#import "_CBHGeometryKit+Locale.h"
+
+
+// Locale independent formatting of geometry values into bytes, shared by the `*_getDescription()` functions and
+// `CBHGeometryWriter`.
+//
+// Values use the layout of the `NSStringFrom*()` functions. Reals are written with the fewest significant digits that
+// convert back to the same value, as `%g` would print them. Most layout values are integers or short fractions which
+// are written directly; anything else tries `%.15g`, `%.16g` and `%.17g` in turn.
+
+enum
+{
+	kCBHFormatterRealLength = 32,
+	kCBHFormatterValueLength = 128,
+	kCBHFormatterShortDigits = 15,
+	kCBHFormatterFractionDigits = 6,
+};
+
+static const double kCBHFormatterScales[kCBHFormatterFractionDigits + 1] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6 };
+
+
+NS_INLINE char *_CBHFormatter_writeDigits(char *cursor, uint64_t value, NSUInteger minimumDigits)
+{
+	char digits[24];
+	NSUInteger count = 0;
+
+	do
+	{
+		digits[count++] = (char)('0' + value % 10);
+		value /= 10;
+	}
+	while ( value != 0 || count < minimumDigits );
+
+	while ( count > 0 ) { *cursor++ = digits[--count]; }
+	return cursor;
+}
+
+__attribute__((noinline, unused)) static char *_CBHFormatter_writeGeneralReal(char *cursor, const double value)
+{
+	int length = 0;
+	for (int precision = kCBHFormatterShortDigits; precision <= 17; ++precision)
+	{
+		length = CBHLocale_writeReal(cursor, kCBHFormatterRealLength, precision, value);
+		if ( CBHLocale_readReal(cursor) == value ) { break; }
+	}
+
+	return cursor + length;
+}
+
+/// Writes the shortest text which converts back to `value`, returning the end of the text. At most
+/// `kCBHFormatterRealLength` bytes are written.
+NS_INLINE char *CBHFormatter_writeReal(char *cursor, const double value)
+{
+	const double magnitude = fabs(value);
+
+	// Values which `%.15g` would print without an exponent and with at most six decimals.
+	if ( magnitude == 0.0 || ( magnitude >= 1e-4 && magnitude < 1e15 ) )
+	{
+		for (NSUInteger decimals = 0; decimals <= kCBHFormatterFractionDigits; ++decimals)
+		{
+			const double scaled = magnitude * kCBHFormatterScales[decimals];
+			if ( scaled >= 1e15 ) { break; }
+
+			uint64_t mantissa = (uint64_t)scaled;
+			if ( (double)mantissa != scaled || (double)mantissa / kCBHFormatterScales[decimals] != magnitude ) { continue; }
+
+			// A product can round onto an integer one decimal late, leaving a trailing zero.
+			for (; decimals > 0 && mantissa % 10 == 0; --decimals) { mantissa /= 10; }
+
+			if ( signbit(value) ) { *cursor++ = '-'; }
+
+			const uint64_t scale = (uint64_t)kCBHFormatterScales[decimals];
+			cursor = _CBHFormatter_writeDigits(cursor, mantissa / scale, 1);
+			if ( decimals == 0 ) { return cursor; }
+
+			*cursor++ = '.';
+			return _CBHFormatter_writeDigits(cursor, mantissa % scale, decimals);
+		}
+	}
+
+	return _CBHFormatter_writeGeneralReal(cursor, value);
+}
+
+NS_INLINE char *CBHFormatter_writeString(char *cursor, const char * const string)
+{
+	const size_t length = strlen(string);
+	memcpy(cursor, string, length);
+	return cursor + length;
+}
+
+
+#pragma mark - Writing Values
+
+/// Writes `{a, b}` for two reals, returning the end of the text. At most `kCBHFormatterValueLength` bytes are written.
+NS_INLINE char *CBHFormatter_writeRealPair(char *cursor, const double a, const double b)
+{
+	*cursor++ = '{';
+	cursor = CBHFormatter_writeReal(cursor, a);
+	cursor = CBHFormatter_writeString(cursor, ", ");
+	cursor = CBHFormatter_writeReal(cursor, b);
+	*cursor++ = '}';
+	return cursor;
+}
+
+NS_INLINE char *CBHFormatter_writePoint(char *cursor, const NSPoint point)
+{
+	return CBHFormatter_writeRealPair(cursor, point.x, point.y);
+}
+
+NS_INLINE char *CBHFormatter_writeSize(char *cursor, const NSSize size)
+{
+	return CBHFormatter_writeRealPair(cursor, size.width, size.height);
+}
+
+NS_INLINE char *CBHFormatter_writeRect(char *cursor, const NSRect rect)
+{
+	*cursor++ = '{';
+	cursor = CBHFormatter_writePoint(cursor, rect.origin);
+	cursor = CBHFormatter_writeString(cursor, ", ");
+	cursor = CBHFormatter_writeSize(cursor, rect.size);
+	*cursor++ = '}';
+	return cursor;
+}
+
+NS_INLINE char *CBHFormatter_writeRange(char *cursor, const NSRange range)
+{
+	*cursor++ = '{';
+	cursor = _CBHFormatter_writeDigits(cursor, range.location, 1);
+	cursor = CBHFormatter_writeString(cursor, ", ");
+	cursor = _CBHFormatter_writeDigits(cursor, range.length, 1);
+	*cursor++ = '}';
+	return cursor;
+}
+
+
+#pragma mark - Copying Out
+
+/// Copies formatted text to a caller's buffer like `snprintf()`: the copy is truncated to fit and terminated when
+/// `capacity` is not 0, and the full length is returned.
+NS_INLINE NSUInteger CBHFormatter_copy(const char * const text, const NSUInteger length, char * const _Nullable buffer, const NSUInteger capacity)
+{
+	if ( buffer != NULL && capacity > 0 )
+	{
+		const NSUInteger copied = MIN(length, capacity - 1);
+		memcpy(buffer, text, copied);
+		buffer[copied] = '\0';
+	}
+
+	return length;
+}
@@ -0,0 +1,80 @@
+//  _CBHGeometryKit+IndexSink.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#pragma once
+
+#import <string.h>
+
+
+// The destination for the indexes found by a spatial query. Public queries come in two forms which share one search:
+//
+// - Buffer queries write up to `capacity` indexes and keep counting past it, so the caller learns the full count.
+// - Callback queries call a function for each index until it sets its stop flag.
+
+typedef struct CBHIndexSink
+{
+	NSUInteger * _Nullable indexes;
+	NSUInteger capacity;
+	NSUInteger count;
+
+	void (* _Nullable callback)(NSUInteger index, void * _Nullable context, BOOL *stop);
+	void * _Nullable context;
+	BOOL stop;
+} CBHIndexSink;
+
+
+NS_INLINE CBHIndexSink CBHIndexSink_initWithBuffer(NSUInteger * _Nullable indexes, NSUInteger capacity)
+{
+	return (CBHIndexSink){ .indexes = indexes, .capacity = ( indexes != NULL ) ? capacity : 0, .count = 0, .callback = NULL, .context = NULL, .stop = NO };
+}
+
+NS_INLINE CBHIndexSink CBHIndexSink_initWithCallback(void (*callback)(NSUInteger index, void * _Nullable context, BOOL *stop), void * _Nullable context)
+{
+	return (CBHIndexSink){ .indexes = NULL, .capacity = 0, .count = 0, .callback = callback, .context = context, .stop = NO };
+}
+
+NS_INLINE void CBHIndexSink_emit(CBHIndexSink *sink, NSUInteger index)
+{
+	if ( sink->callback != NULL )
+	{
+		sink->callback(index, sink->context, &sink->stop);
+		return;
+	}
+
+	if ( sink->count < sink->capacity ) { sink->indexes[sink->count] = index; }
+	sink->count += 1;
+}
+
+NS_INLINE void CBHIndexSink_emitRange(CBHIndexSink *sink, const NSUInteger *indexes, NSUInteger length)
+{
+	if ( sink->callback == NULL )
+	{
+		if ( sink->count < sink->capacity )
+		{
+			memcpy(sink->indexes + sink->count, indexes, sizeof(NSUInteger) * MIN(length, sink->capacity - sink->count));
+		}
+
+		sink->count += length;
+		return;
+	}
+
+	for (NSUInteger i = 0; i < length && !sink->stop; ++i)
+	{
+		sink->callback(indexes[i], sink->context, &sink->stop);
+	}
+}
@@ -0,0 +1,91 @@
+//  _CBHGeometryKit+Locale.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#pragma once
+
+#import <locale.h>
+#import <stdio.h>
+#import <stdlib.h>
+
+#if defined(__APPLE__)
+#	import <xlocale.h>
+#else
+#	import <stdatomic.h>
+#endif
+
+
+// Conversions between reals and text in the C locale, whatever locale the process has installed, shared by the scanner
+// and the formatter.
+//
+// Darwin provides `_l` variants of `strtod()` and `snprintf()` taking a locale. Elsewhere the C locale is installed on
+// the calling thread with `uselocale()` for the duration of the call.
+
+#if !defined(__APPLE__)
+
+NS_INLINE locale_t _CBHLocale_c(void)
+{
+	static _Atomic(locale_t) shared;
+
+	locale_t locale = atomic_load_explicit(&shared, memory_order_acquire);
+	if ( locale != (locale_t)0 ) { return locale; }
+
+	locale = newlocale(LC_ALL_MASK, "C", (locale_t)0);
+	if ( locale == (locale_t)0 ) { return LC_GLOBAL_LOCALE; }
+
+	locale_t expected = (locale_t)0;
+	if ( !atomic_compare_exchange_strong_explicit(&shared, &expected, locale, memory_order_acq_rel, memory_order_acquire) )
+	{
+		freelocale(locale);
+		locale = expected;
+	}
+
+	return locale;
+}
+
+#endif
+
+
+#pragma mark - Converting Reals
+
+/// Converts the null terminated text at `string` to a real, as `strtod()` would in the C locale.
+NS_INLINE double CBHLocale_readReal(const char * const string)
+{
+#if defined(__APPLE__)
+	return strtod_l(string, NULL, LC_C_LOCALE);
+#else
+	const locale_t previous = uselocale(_CBHLocale_c());
+	const double value = strtod(string, NULL);
+	uselocale(previous);
+
+	return value;
+#endif
+}
+
+/// Writes `value` with `%.*g` and the given precision, as `snprintf()` would in the C locale.
+NS_INLINE int CBHLocale_writeReal(char * const buffer, const size_t capacity, const int precision, const double value)
+{
+#if defined(__APPLE__)
+	return snprintf_l(buffer, capacity, LC_C_LOCALE, "%.*g", precision, value);
+#else
+	const locale_t previous = uselocale(_CBHLocale_c());
+	const int length = snprintf(buffer, capacity, "%.*g", precision, value);
+	uselocale(previous);
+
+	return length;
+#endif
+}
@@ -0,0 +1,51 @@
+//  _CBHGeometryKit+Parallel.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#pragma once
+
+#import "CBHParallel.h"
+
+
+// Reductions gather a partial result for each block of a fixed length and combine the partials in block order. Only
+// whole blocks are shared between threads, so a partial sum covers the same elements however the work is split and the
+// result is the same on every run.
+
+enum { kCBHParallelBlockLength = 1 << 16 };
+
+NS_INLINE NSUInteger CBHParallel_blockCount(const NSUInteger count)
+{
+	return ( count / kCBHParallelBlockLength ) + ( ( count % kCBHParallelBlockLength ) ? 1 : 0 );
+}
+
+NS_INLINE NSRange CBHParallel_block(const NSUInteger count, const NSUInteger index)
+{
+	const NSUInteger location = index * kCBHParallelBlockLength;
+	return NSMakeRange(location, MIN((NSUInteger)kCBHParallelBlockLength, count - location));
+}
+
+// The grain size for work measured in units of `length` elements, such as blocks or mask words.
+NS_INLINE NSUInteger CBHParallel_grainSizeForUnit(const NSUInteger length)
+{
+	return MAX(CBHParallel_grainSize() / length, 1UL);
+}
+
+// Whether `CBHParallel_applyWithGrainSize()` would split work of `count` indexes, so callers can skip preparing for it.
+__attribute__((visibility("hidden"))) BOOL CBHParallel_isSplit(NSUInteger count, NSUInteger grainSize);
+
+// `CBHParallel_apply()` with a grain size other than the configured one.
+__attribute__((visibility("hidden"))) void CBHParallel_applyWithGrainSize(NSUInteger count, NSUInteger grainSize, void * _Nullable context, CBHParallelFunction function);
@@ -0,0 +1,101 @@
+//  _CBHGeometryKit+Pixels.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#pragma once
+
+#import "_CBHGeometryKit+Vector.h"
+
+#import <math.h>
+
+
+// Pixel snapping at a backing scale. Each value is scaled into device pixels, snapped there, and scaled back, so at a
+// scale of 1 the multiply and divide are exact and the results equal the unscaled functions:
+//
+// - Truncating and rounding match `NSPoint_truncate()`, `NSPoint_round()`, and their size and rect forms.
+// - Centering matches `NSPoint_nearestPixel()`, the truncated value plus half a pixel.
+// - Integral rects match `NSRect_integral()`: empty rects become the zero rect and others grow outward to whole pixels.
+//
+// The vector forms perform the same operations in the same order as the scalar forms, so every lane is bit-identical.
+
+
+typedef enum CBHPixelSnap
+{
+	CBHPixelSnapTruncate,
+	CBHPixelSnapRound,
+	CBHPixelSnapCenter,
+} CBHPixelSnap;
+
+
+#pragma mark - Scalar Snapping
+
+NS_INLINE CGFloat CBHPixel_snap(const CGFloat value, const CGFloat scale, const CBHPixelSnap snap)
+{
+	switch ( snap )
+	{
+		case CBHPixelSnapTruncate: return trunc(value * scale) / scale;
+		case CBHPixelSnapRound: return round(value * scale) / scale;
+		case CBHPixelSnapCenter: break;
+	}
+
+	return (trunc(value * scale) + 0.5) / scale;
+}
+
+// Empty rects are tested as `NSIsEmptyRect()` tests them, so a NaN side is empty.
+NS_INLINE NSRect CBHPixel_integralRect(const NSRect rect, const CGFloat scale)
+{
+	if ( !(rect.size.width > 0.0 && rect.size.height > 0.0) ) { return NSZeroRect; }
+
+	const CGFloat minX = floor(rect.origin.x * scale);
+	const CGFloat minY = floor(rect.origin.y * scale);
+	const CGFloat maxX = ceil((rect.origin.x + rect.size.width) * scale);
+	const CGFloat maxY = ceil((rect.origin.y + rect.size.height) * scale);
+
+	return (NSRect){ { minX / scale, minY / scale }, { (maxX - minX) / scale, (maxY - minY) / scale } };
+}
+
+
+#pragma mark - Vector Snapping
+
+#if CBH_VECTOR
+
+NS_INLINE CBHVector CBHPixelVector_snap(const CBHVector value, const CBHVector scale, const CBHPixelSnap snap)
+{
+	const CBHVector scaled = CBHVector_mul(value, scale);
+
+	switch ( snap )
+	{
+		case CBHPixelSnapTruncate: return CBHVector_div(CBHVector_truncate(scaled), scale);
+		case CBHPixelSnapRound: return CBHVector_div(CBHVector_round(scaled), scale);
+		case CBHPixelSnapCenter: break;
+	}
+
+	return CBHVector_div(CBHVector_add(CBHVector_truncate(scaled), CBHVector_set(0.5)), scale);
+}
+
+// Lane `i` of _origin_ and _size_ are the same axis of the same rect. Lanes of rects with both sides greater than 0 are
+// set in _filled_, and the others become 0 so NaN sides are empty as in `CBHPixel_integralRect()`.
+NS_INLINE void CBHPixelVector_integral(CBHVector * const origin, CBHVector * const size, const CBHVector filled, const CBHVector scale)
+{
+	const CBHVector minimum = CBHVector_floor(CBHVector_mul(*origin, scale));
+	const CBHVector maximum = CBHVector_ceil(CBHVector_mul(CBHVector_add(*origin, *size), scale));
+
+	*origin = CBHVector_and(CBHVector_div(minimum, scale), filled);
+	*size = CBHVector_and(CBHVector_div(CBHVector_sub(maximum, minimum), scale), filled);
+}
+
+#endif
@@ -0,0 +1,68 @@
+//  _CBHGeometryKit+Predicates.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#pragma once
+
+
+// Inline equivalents of the Foundation rect predicates wrapped by NSRect+CBHGeometryKit. Bulk and indexed operations
+// are written against these so their scalar remainders, and any vector lanes derived from them, agree with the
+// single-rect functions:
+//
+// - A rect with a 0 or negative width or height is empty (`NSRect_isEmpty`).
+// - Empty rects never intersect anything and are never covered (`NSIntersectsRect`, `NSContainsRect`).
+// - Rects are half open: the minimum edges are inside, the maximum edges are outside (`NSPointInRect`).
+// - An unflipped mouse test moves the inclusive y edge to the maximum (`NSMouseInRect`).
+
+
+#pragma mark - Checking Rects
+
+NS_INLINE BOOL CBHRect_isEmpty(const NSRect rect)
+{
+	return ( (rect.size.width <= 0.0) || (rect.size.height <= 0.0) );
+}
+
+NS_INLINE BOOL CBHRect_isIntersecting(const NSRect rect, const NSRect other)
+{
+	if ( CBHRect_isEmpty(rect) || CBHRect_isEmpty(other) ) { return NO; }
+
+	return ( (rect.origin.x < other.origin.x + other.size.width) && (other.origin.x < rect.origin.x + rect.size.width)
+		  && (rect.origin.y < other.origin.y + other.size.height) && (other.origin.y < rect.origin.y + rect.size.height) );
+}
+
+NS_INLINE BOOL CBHRect_isCovering(const NSRect rect, const NSRect other)
+{
+	if ( CBHRect_isEmpty(other) ) { return NO; }
+
+	return ( (rect.origin.x <= other.origin.x) && (rect.origin.y <= other.origin.y)
+		  && (other.origin.x + other.size.width <= rect.origin.x + rect.size.width)
+		  && (other.origin.y + other.size.height <= rect.origin.y + rect.size.height) );
+}
+
+NS_INLINE BOOL CBHRect_isPointInRect(const NSRect rect, const NSPoint point)
+{
+	return ( (rect.origin.x <= point.x) && (point.x < rect.origin.x + rect.size.width)
+		  && (rect.origin.y <= point.y) && (point.y < rect.origin.y + rect.size.height) );
+}
+
+NS_INLINE BOOL CBHRect_isMouseInRect(const NSRect rect, const NSPoint point, const BOOL flipped)
+{
+	if ( flipped ) { return CBHRect_isPointInRect(rect, point); }
+
+	return ( (rect.origin.x <= point.x) && (point.x < rect.origin.x + rect.size.width)
+		  && (rect.origin.y < point.y) && (point.y <= rect.origin.y + rect.size.height) );
+}
@@ -0,0 +1,267 @@
+//  _CBHGeometryKit+Scanner.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#pragma once
+
+#import "CBHParseStatus.h"
+
+#import <math.h>
+#import <stdlib.h>
+#import <string.h>
+
+#import "_CBHGeometryKit+Locale.h"
+
+
+// Locale independent number scanning over raw bytes, shared by the `*_initWithBytes()` parsers.
+//
+// The rules follow the `NS*FromString()` functions: bytes which cannot start a number are skipped, reals may carry a
+// sign, a fraction and an exponent, and integers are unsigned runs of digits. Reals with at most 19 significant digits
+// and a small exponent are converted exactly with a single multiplication or division. Anything else is handed to
+// `CBHLocale_readReal()`, so every result is correctly rounded.
+
+enum { kCBHScannerDigitLimit = 19, kCBHScannerExponentLimit = 22, kCBHScannerBufferLength = 64 };
+
+static const double kCBHScannerPowers[kCBHScannerExponentLimit + 1] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+
+NS_INLINE BOOL _CBHScanner_isDigit(const char * const bytes, const NSUInteger length, const NSUInteger index)
+{
+	return ( index < length ) && ( (unsigned char)(bytes[index] - '0') < 10 );
+}
+
+NS_INLINE BOOL _CBHScanner_isRealStart(const char * const bytes, const NSUInteger length, const NSUInteger index)
+{
+	switch ( bytes[index] )
+	{
+		case '+':
+		case '-':
+			if ( _CBHScanner_isDigit(bytes, length, index + 1) ) { return YES; }
+			return ( index + 1 < length ) && ( bytes[index + 1] == '.' ) && _CBHScanner_isDigit(bytes, length, index + 2);
+
+		case '.':
+			return _CBHScanner_isDigit(bytes, length, index + 1);
+
+		default:
+			return _CBHScanner_isDigit(bytes, length, index);
+	}
+}
+
+__attribute__((noinline, unused)) static double _CBHScanner_convertReal(const char * const bytes, const NSUInteger length)
+{
+	char stackBuffer[kCBHScannerBufferLength];
+	char *buffer = ( length < kCBHScannerBufferLength ) ? stackBuffer : malloc(length + 1);
+	if ( buffer == NULL ) { return NAN; }
+
+	memcpy(buffer, bytes, length);
+	buffer[length] = '\0';
+
+	double value = CBHLocale_readReal(buffer);
+
+	if ( buffer != stackBuffer ) { free(buffer); }
+	return value;
+}
+
+
+#pragma mark - Scanning Numbers
+
+/// Scans the next real at or after `*offset`, leaving `*offset` after it. Returns `NO` when no number remains.
+NS_INLINE BOOL CBHScanner_scanReal(const char * const bytes, const NSUInteger length, NSUInteger * const offset, double * const value, BOOL * const isOutOfRange)
+{
+	NSUInteger index = *offset;
+	while ( index < length && !_CBHScanner_isRealStart(bytes, length, index) ) { ++index; }
+
+	if ( index >= length )
+	{
+		*offset = length;
+		return NO;
+	}
+
+	const NSUInteger start = index;
+	const BOOL isNegative = ( bytes[index] == '-' );
+	if ( bytes[index] == '+' || bytes[index] == '-' ) { ++index; }
+
+	uint64_t mantissa = 0;
+	NSInteger digits = 0;
+	NSInteger exponent = 0;
+	BOOL isExact = YES;
+
+	for (; _CBHScanner_isDigit(bytes, length, index); ++index)
+	{
+		const unsigned digit = (unsigned)(bytes[index] - '0');
+		if ( digits < kCBHScannerDigitLimit )
+		{
+			mantissa = mantissa * 10 + digit;
+			digits += ( mantissa != 0 );
+		}
+		else
+		{
+			exponent += 1;
+			isExact = NO;
+		}
+	}
+
+	if ( index < length && bytes[index] == '.' )
+	{
+		for (++index; _CBHScanner_isDigit(bytes, length, index); ++index)
+		{
+			if ( digits >= kCBHScannerDigitLimit )
+			{
+				isExact = NO;
+				continue;
+			}
+
+			mantissa = mantissa * 10 + (unsigned)(bytes[index] - '0');
+			digits += ( mantissa != 0 );
+			exponent -= 1;
+		}
+	}
+
+	if ( index < length && ( bytes[index] == 'e' || bytes[index] == 'E' ) )
+	{
+		NSUInteger cursor = index + 1;
+		const BOOL isExponentNegative = ( cursor < length && bytes[cursor] == '-' );
+		if ( cursor < length && ( bytes[cursor] == '+' || bytes[cursor] == '-' ) ) { ++cursor; }
+
+		if ( _CBHScanner_isDigit(bytes, length, cursor) )
+		{
+			NSInteger written = 0;
+			for (; _CBHScanner_isDigit(bytes, length, cursor); ++cursor)
+			{
+				if ( written < 100000 ) { written = written * 10 + (bytes[cursor] - '0'); }
+			}
+
+			exponent += ( isExponentNegative ) ? -written : written;
+			index = cursor;
+		}
+	}
+
+	*offset = index;
+
+	double result;
+	if ( mantissa == 0 && isExact )
+	{
+		result = 0.0;
+	}
+	else if ( isExact && mantissa <= (1ULL << 53) && exponent >= -kCBHScannerExponentLimit && exponent <= kCBHScannerExponentLimit )
+	{
+		result = ( exponent < 0 ) ? (double)mantissa / kCBHScannerPowers[-exponent] : (double)mantissa * kCBHScannerPowers[exponent];
+	}
+	else
+	{
+		*value = _CBHScanner_convertReal(bytes + start, index - start);
+		if ( isinf(*value) ) { *isOutOfRange = YES; }
+		return YES;
+	}
+
+	*value = ( isNegative ) ? -result : result;
+	return YES;
+}
+
+/// Scans the next unsigned integer at or after `*offset`, leaving `*offset` after it. Returns `NO` when no number remains.
+NS_INLINE BOOL CBHScanner_scanInteger(const char * const bytes, const NSUInteger length, NSUInteger * const offset, NSUInteger * const value, BOOL * const isOutOfRange)
+{
+	NSUInteger index = *offset;
+	while ( index < length && !_CBHScanner_isDigit(bytes, length, index) ) { ++index; }
+
+	if ( index >= length )
+	{
+		*offset = length;
+		return NO;
+	}
+
+	NSUInteger result = 0;
+	for (; _CBHScanner_isDigit(bytes, length, index); ++index)
+	{
+		const NSUInteger digit = (NSUInteger)(bytes[index] - '0');
+		if ( result > ((NSUInteger)NSIntegerMax - digit) / 10 )
+		{
+			result = (NSUInteger)NSIntegerMax;
+			*isOutOfRange = YES;
+			continue;
+		}
+
+		result = result * 10 + digit;
+	}
+
+	*offset = index;
+	*value = result;
+	return YES;
+}
+
+
+#pragma mark - Scanning Values
+
+/// Scans `count` reals into `components`, setting any which are missing to 0.
+NS_INLINE CBHParseStatus CBHScanner_scanReals(const char * const bytes, const NSUInteger length, CGFloat * const components, const NSUInteger count, NSUInteger * const _Nullable consumed)
+{
+	NSUInteger offset = 0;
+	NSUInteger found = 0;
+	BOOL isOutOfRange = NO;
+
+	for (double value; found < count && CBHScanner_scanReal(bytes, length, &offset, &value, &isOutOfRange); ++found)
+	{
+		components[found] = (CGFloat)value;
+	}
+
+	for (NSUInteger i = found; i < count; ++i) { components[i] = 0.0; }
+
+	if ( consumed != NULL ) { *consumed = offset; }
+
+	if ( isOutOfRange ) { return CBHParseStatusOutOfRange; }
+	return ( found < count ) ? CBHParseStatusMissingComponents : CBHParseStatusSuccess;
+}
+
+/// Scans `count` unsigned integers into `components`, setting any which are missing to 0.
+NS_INLINE CBHParseStatus CBHScanner_scanIntegers(const char * const bytes, const NSUInteger length, NSUInteger * const components, const NSUInteger count, NSUInteger * const _Nullable consumed)
+{
+	NSUInteger offset = 0;
+	NSUInteger found = 0;
+	BOOL isOutOfRange = NO;
+
+	for (NSUInteger value; found < count && CBHScanner_scanInteger(bytes, length, &offset, &value, &isOutOfRange); ++found)
+	{
+		components[found] = value;
+	}
+
+	for (NSUInteger i = found; i < count; ++i) { components[i] = 0; }
+
+	if ( consumed != NULL ) { *consumed = offset; }
+
+	if ( isOutOfRange ) { return CBHParseStatusOutOfRange; }
+	return ( found < count ) ? CBHParseStatusMissingComponents : CBHParseStatusSuccess;
+}
+
+
+#pragma mark - Scanning Lines
+
+/// Finds the line starting at `*offset`, without its newline, and moves `*offset` to the next line. A newline ending the
+/// buffer does not start another line.
+NS_INLINE BOOL CBHScanner_nextLine(const char * const bytes, const NSUInteger length, NSUInteger * const offset, NSUInteger * const lineLength)
+{
+	if ( *offset >= length ) { return NO; }
+
+	const char *newline = memchr(bytes + *offset, '\n', length - *offset);
+	const NSUInteger end = ( newline != NULL ) ? (NSUInteger)(newline - bytes) : length;
+
+	*lineLength = end - *offset;
+	*offset = ( newline != NULL ) ? end + 1 : length;
+	return YES;
+}
@@ -28,3 +28,19 @@
 #ifndef CBH_PURE
 #define CBH_PURE __attribute__((pure))
 #endif
+
+
+#pragma mark - Vectorization
+
+#if defined(CGFLOAT_IS_DOUBLE) && CGFLOAT_IS_DOUBLE
+#	if defined(__AVX2__)
+#		define CBH_VECTOR_AVX2 1
+#		import <immintrin.h>
+#	elif defined(__SSE2__)
+#		define CBH_VECTOR_SSE2 1
+#		import <emmintrin.h>
+#	elif defined(__ARM_NEON) && defined(__aarch64__)
+#		define CBH_VECTOR_NEON 1
+#		import <arm_neon.h>
+#	endif
+#endif
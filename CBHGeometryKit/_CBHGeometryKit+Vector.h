@@ -0,0 +1,314 @@
+//  _CBHGeometryKit+Vector.h
+//  CBHGeometryKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#pragma once
+
+#import "_CBHGeometryKit+Utilities.h"
+
+#import <string.h>
+
+
+// A minimal lane-wise abstraction over the instruction set selected in _CBHGeometryKit+Utilities.h. Kernels written
+// against it process `CBH_VECTOR_WIDTH` doubles per step and finish any remainder with the scalar functions.
+//
+// Comparisons produce all-ones or all-zeros lanes which can be combined with the logical operations and reduced to
+// a bit per lane with `CBHVector_mask()`.
+//
+// Rounding matches `trunc()`, `floor()`, `ceil()`, and `round()` exactly, including the sign of zero. Pairs are two
+// adjacent doubles, such as the origin and size of a rect. `CBHVector_loadPairs()` splits `CBH_VECTOR_WIDTH` pairs into
+// their first and second halves and `CBHVector_storePairs()` interleaves them again.
+//
+// Narrow loads widen `CBH_VECTOR_WIDTH` floats or unsigned integers to doubles. Narrow stores expect values the type
+// can hold, which for the integer stores means whole numbers in range; floats are rounded to nearest.
+
+#if CBH_VECTOR_AVX2 || CBH_VECTOR_SSE2 || CBH_VECTOR_NEON
+#define CBH_VECTOR 1
+#endif
+
+
+#if CBH_VECTOR_AVX2
+
+#define CBH_VECTOR_WIDTH 4
+
+typedef __m256d CBHVector;
+
+NS_INLINE CBHVector CBHVector_load(const double *values) { return _mm256_loadu_pd(values); }
+NS_INLINE void CBHVector_store(double *values, CBHVector vector) { _mm256_storeu_pd(values, vector); }
+NS_INLINE CBHVector CBHVector_set(double value) { return _mm256_set1_pd(value); }
+
+NS_INLINE CBHVector CBHVector_add(CBHVector a, CBHVector b) { return _mm256_add_pd(a, b); }
+NS_INLINE CBHVector CBHVector_sub(CBHVector a, CBHVector b) { return _mm256_sub_pd(a, b); }
+NS_INLINE CBHVector CBHVector_mul(CBHVector a, CBHVector b) { return _mm256_mul_pd(a, b); }
+NS_INLINE CBHVector CBHVector_div(CBHVector a, CBHVector b) { return _mm256_div_pd(a, b); }
+NS_INLINE CBHVector CBHVector_min(CBHVector a, CBHVector b) { return _mm256_min_pd(a, b); }
+NS_INLINE CBHVector CBHVector_max(CBHVector a, CBHVector b) { return _mm256_max_pd(a, b); }
+NS_INLINE CBHVector CBHVector_sqrt(CBHVector vector) { return _mm256_sqrt_pd(vector); }
+
+NS_INLINE CBHVector CBHVector_isLess(CBHVector a, CBHVector b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+NS_INLINE CBHVector CBHVector_isLessOrEqual(CBHVector a, CBHVector b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+
+NS_INLINE CBHVector CBHVector_and(CBHVector a, CBHVector b) { return _mm256_and_pd(a, b); }
+NS_INLINE CBHVector CBHVector_or(CBHVector a, CBHVector b) { return _mm256_or_pd(a, b); }
+NS_INLINE CBHVector CBHVector_andNot(CBHVector a, CBHVector b) { return _mm256_andnot_pd(b, a); }
+NS_INLINE CBHVector CBHVector_xor(CBHVector a, CBHVector b) { return _mm256_xor_pd(a, b); }
+
+NS_INLINE unsigned int CBHVector_mask(CBHVector vector) { return (unsigned int)_mm256_movemask_pd(vector); }
+NS_INLINE CBHVector CBHVector_select(CBHVector mask, CBHVector a, CBHVector b) { return _mm256_blendv_pd(b, a, mask); }
+
+NS_INLINE CBHVector CBHVector_truncate(CBHVector vector) { return _mm256_round_pd(vector, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+NS_INLINE CBHVector CBHVector_floor(CBHVector vector) { return _mm256_round_pd(vector, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+NS_INLINE CBHVector CBHVector_ceil(CBHVector vector) { return _mm256_round_pd(vector, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC); }
+
+NS_INLINE CBHVector CBHVector_swapPairs(CBHVector vector) { return _mm256_permute_pd(vector, 0x5); }
+
+NS_INLINE void CBHVector_loadPairs(const double *values, CBHVector *first, CBHVector *second)
+{
+	const __m256d low = _mm256_loadu_pd(values);
+	const __m256d high = _mm256_loadu_pd(values + 4);
+
+	*first = _mm256_permute2f128_pd(low, high, 0x20);
+	*second = _mm256_permute2f128_pd(low, high, 0x31);
+}
+
+NS_INLINE void CBHVector_storePairs(double *values, CBHVector first, CBHVector second)
+{
+	_mm256_storeu_pd(values, _mm256_permute2f128_pd(first, second, 0x20));
+	_mm256_storeu_pd(values + 4, _mm256_permute2f128_pd(first, second, 0x31));
+}
+
+NS_INLINE CBHVector CBHVector_loadFloats(const float *values) { return _mm256_cvtps_pd(_mm_loadu_ps(values)); }
+NS_INLINE void CBHVector_storeFloats(float *values, CBHVector vector) { _mm_storeu_ps(values, _mm256_cvtpd_ps(vector)); }
+
+NS_INLINE CBHVector CBHVector_loadUInt16s(const uint16_t *values)
+{
+	return _mm256_cvtepi32_pd(_mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)values)));
+}
+
+NS_INLINE void CBHVector_storeUInt16s(uint16_t *values, CBHVector vector)
+{
+	const __m128i words = _mm256_cvtpd_epi32(vector);
+	_mm_storel_epi64((__m128i *)values, _mm_packus_epi32(words, words));
+}
+
+// Unsigned words are offset by 2^31 to pass through the signed conversions.
+NS_INLINE CBHVector CBHVector_loadUInt32s(const uint32_t *values)
+{
+	const __m128i words = _mm_xor_si128(_mm_loadu_si128((const __m128i *)values), _mm_set1_epi32(INT32_MIN));
+	return _mm256_add_pd(_mm256_cvtepi32_pd(words), _mm256_set1_pd(2147483648.0));
+}
+
+NS_INLINE void CBHVector_storeUInt32s(uint32_t *values, CBHVector vector)
+{
+	const __m128i words = _mm256_cvtpd_epi32(_mm256_sub_pd(vector, _mm256_set1_pd(2147483648.0)));
+	_mm_storeu_si128((__m128i *)values, _mm_xor_si128(words, _mm_set1_epi32(INT32_MIN)));
+}
+
+#elif CBH_VECTOR_SSE2
+
+#define CBH_VECTOR_WIDTH 2
+
+typedef __m128d CBHVector;
+
+NS_INLINE CBHVector CBHVector_load(const double *values) { return _mm_loadu_pd(values); }
+NS_INLINE void CBHVector_store(double *values, CBHVector vector) { _mm_storeu_pd(values, vector); }
+NS_INLINE CBHVector CBHVector_set(double value) { return _mm_set1_pd(value); }
+
+NS_INLINE CBHVector CBHVector_add(CBHVector a, CBHVector b) { return _mm_add_pd(a, b); }
+NS_INLINE CBHVector CBHVector_sub(CBHVector a, CBHVector b) { return _mm_sub_pd(a, b); }
+NS_INLINE CBHVector CBHVector_mul(CBHVector a, CBHVector b) { return _mm_mul_pd(a, b); }
+NS_INLINE CBHVector CBHVector_div(CBHVector a, CBHVector b) { return _mm_div_pd(a, b); }
+NS_INLINE CBHVector CBHVector_min(CBHVector a, CBHVector b) { return _mm_min_pd(a, b); }
+NS_INLINE CBHVector CBHVector_max(CBHVector a, CBHVector b) { return _mm_max_pd(a, b); }
+NS_INLINE CBHVector CBHVector_sqrt(CBHVector vector) { return _mm_sqrt_pd(vector); }
+
+NS_INLINE CBHVector CBHVector_isLess(CBHVector a, CBHVector b) { return _mm_cmplt_pd(a, b); }
+NS_INLINE CBHVector CBHVector_isLessOrEqual(CBHVector a, CBHVector b) { return _mm_cmple_pd(a, b); }
+
+NS_INLINE CBHVector CBHVector_and(CBHVector a, CBHVector b) { return _mm_and_pd(a, b); }
+NS_INLINE CBHVector CBHVector_or(CBHVector a, CBHVector b) { return _mm_or_pd(a, b); }
+NS_INLINE CBHVector CBHVector_andNot(CBHVector a, CBHVector b) { return _mm_andnot_pd(b, a); }
+NS_INLINE CBHVector CBHVector_xor(CBHVector a, CBHVector b) { return _mm_xor_pd(a, b); }
+
+NS_INLINE unsigned int CBHVector_mask(CBHVector vector) { return (unsigned int)_mm_movemask_pd(vector); }
+NS_INLINE CBHVector CBHVector_select(CBHVector mask, CBHVector a, CBHVector b) { return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b)); }
+
+// SSE2 has no rounding instructions. Adding and subtracting 2^52 rounds a smaller magnitude to an integer, which is
+// stepped down when it rounded up. Larger magnitudes, infinities, and NaNs are already integral and pass through.
+NS_INLINE CBHVector CBHVector_truncate(CBHVector vector)
+{
+	const __m128d sign = _mm_set1_pd(-0.0);
+	const __m128d limit = _mm_set1_pd(4503599627370496.0);
+	const __m128d magnitude = _mm_andnot_pd(sign, vector);
+
+	__m128d rounded = _mm_add_pd(magnitude, limit);
+	rounded = _mm_sub_pd(rounded, limit);
+	rounded = _mm_sub_pd(rounded, _mm_and_pd(_mm_cmpgt_pd(rounded, magnitude), _mm_set1_pd(1.0)));
+	rounded = _mm_or_pd(rounded, _mm_and_pd(vector, sign));
+
+	return CBHVector_select(_mm_cmplt_pd(magnitude, limit), rounded, vector);
+}
+
+NS_INLINE CBHVector CBHVector_floor(CBHVector vector)
+{
+	const __m128d truncated = CBHVector_truncate(vector);
+	return CBHVector_select(_mm_cmplt_pd(vector, truncated), _mm_sub_pd(truncated, _mm_set1_pd(1.0)), truncated);
+}
+
+NS_INLINE CBHVector CBHVector_ceil(CBHVector vector)
+{
+	const __m128d truncated = CBHVector_truncate(vector);
+	return CBHVector_select(_mm_cmplt_pd(truncated, vector), _mm_add_pd(truncated, _mm_set1_pd(1.0)), truncated);
+}
+
+NS_INLINE CBHVector CBHVector_swapPairs(CBHVector vector) { return _mm_shuffle_pd(vector, vector, 1); }
+
+NS_INLINE void CBHVector_loadPairs(const double *values, CBHVector *first, CBHVector *second)
+{
+	*first = _mm_loadu_pd(values);
+	*second = _mm_loadu_pd(values + 2);
+}
+
+NS_INLINE void CBHVector_storePairs(double *values, CBHVector first, CBHVector second)
+{
+	_mm_storeu_pd(values, first);
+	_mm_storeu_pd(values + 2, second);
+}
+
+NS_INLINE CBHVector CBHVector_loadFloats(const float *values) { return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64((const __m128i *)values))); }
+NS_INLINE void CBHVector_storeFloats(float *values, CBHVector vector) { _mm_storel_epi64((__m128i *)values, _mm_castps_si128(_mm_cvtpd_ps(vector))); }
+
+NS_INLINE CBHVector CBHVector_loadUInt16s(const uint16_t *values)
+{
+	int32_t bits;
+	memcpy(&bits, values, sizeof(bits));
+	return _mm_cvtepi32_pd(_mm_unpacklo_epi16(_mm_cvtsi32_si128(bits), _mm_setzero_si128()));
+}
+
+// SSE2 only packs with signed saturation, so the words are offset by 2^15 on either side of the pack.
+NS_INLINE void CBHVector_storeUInt16s(uint16_t *values, CBHVector vector)
+{
+	__m128i words = _mm_sub_epi32(_mm_cvtpd_epi32(vector), _mm_set1_epi32(32768));
+	words = _mm_xor_si128(_mm_packs_epi32(words, words), _mm_set1_epi16(INT16_MIN));
+
+	const int32_t bits = _mm_cvtsi128_si32(words);
+	memcpy(values, &bits, sizeof(bits));
+}
+
+// Unsigned words are offset by 2^31 to pass through the signed conversions.
+NS_INLINE CBHVector CBHVector_loadUInt32s(const uint32_t *values)
+{
+	const __m128i words = _mm_xor_si128(_mm_loadl_epi64((const __m128i *)values), _mm_set1_epi32(INT32_MIN));
+	return _mm_add_pd(_mm_cvtepi32_pd(words), _mm_set1_pd(2147483648.0));
+}
+
+NS_INLINE void CBHVector_storeUInt32s(uint32_t *values, CBHVector vector)
+{
+	const __m128i words = _mm_cvtpd_epi32(_mm_sub_pd(vector, _mm_set1_pd(2147483648.0)));
+	_mm_storel_epi64((__m128i *)values, _mm_xor_si128(words, _mm_set1_epi32(INT32_MIN)));
+}
+
+#elif CBH_VECTOR_NEON
+
+#define CBH_VECTOR_WIDTH 2
+
+typedef float64x2_t CBHVector;
+
+NS_INLINE CBHVector CBHVector_load(const double *values) { return vld1q_f64(values); }
+NS_INLINE void CBHVector_store(double *values, CBHVector vector) { vst1q_f64(values, vector); }
+NS_INLINE CBHVector CBHVector_set(double value) { return vdupq_n_f64(value); }
+
+NS_INLINE CBHVector CBHVector_add(CBHVector a, CBHVector b) { return vaddq_f64(a, b); }
+NS_INLINE CBHVector CBHVector_sub(CBHVector a, CBHVector b) { return vsubq_f64(a, b); }
+NS_INLINE CBHVector CBHVector_mul(CBHVector a, CBHVector b) { return vmulq_f64(a, b); }
+NS_INLINE CBHVector CBHVector_div(CBHVector a, CBHVector b) { return vdivq_f64(a, b); }
+NS_INLINE CBHVector CBHVector_min(CBHVector a, CBHVector b) { return vminq_f64(a, b); }
+NS_INLINE CBHVector CBHVector_max(CBHVector a, CBHVector b) { return vmaxq_f64(a, b); }
+NS_INLINE CBHVector CBHVector_sqrt(CBHVector vector) { return vsqrtq_f64(vector); }
+
+NS_INLINE CBHVector CBHVector_isLess(CBHVector a, CBHVector b) { return vreinterpretq_f64_u64(vcltq_f64(a, b)); }
+NS_INLINE CBHVector CBHVector_isLessOrEqual(CBHVector a, CBHVector b) { return vreinterpretq_f64_u64(vcleq_f64(a, b)); }
+
+NS_INLINE CBHVector CBHVector_and(CBHVector a, CBHVector b) { return vreinterpretq_f64_u64(vandq_u64(vreinterpretq_u64_f64(a), vreinterpretq_u64_f64(b))); }
+NS_INLINE CBHVector CBHVector_or(CBHVector a, CBHVector b) { return vreinterpretq_f64_u64(vorrq_u64(vreinterpretq_u64_f64(a), vreinterpretq_u64_f64(b))); }
+NS_INLINE CBHVector CBHVector_andNot(CBHVector a, CBHVector b) { return vreinterpretq_f64_u64(vbicq_u64(vreinterpretq_u64_f64(a), vreinterpretq_u64_f64(b))); }
+NS_INLINE CBHVector CBHVector_xor(CBHVector a, CBHVector b) { return vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(a), vreinterpretq_u64_f64(b))); }
+
+NS_INLINE unsigned int CBHVector_mask(CBHVector vector)
+{
+	const uint64x2_t bits = vshrq_n_u64(vreinterpretq_u64_f64(vector), 63);
+	return (unsigned int)(vgetq_lane_u64(bits, 0) | (vgetq_lane_u64(bits, 1) << 1));
+}
+
+NS_INLINE CBHVector CBHVector_select(CBHVector mask, CBHVector a, CBHVector b) { return vbslq_f64(vreinterpretq_u64_f64(mask), a, b); }
+
+NS_INLINE CBHVector CBHVector_truncate(CBHVector vector) { return vrndq_f64(vector); }
+NS_INLINE CBHVector CBHVector_floor(CBHVector vector) { return vrndmq_f64(vector); }
+NS_INLINE CBHVector CBHVector_ceil(CBHVector vector) { return vrndpq_f64(vector); }
+NS_INLINE CBHVector CBHVector_round(CBHVector vector) { return vrndaq_f64(vector); }
+
+NS_INLINE CBHVector CBHVector_swapPairs(CBHVector vector) { return vextq_f64(vector, vector, 1); }
+
+NS_INLINE void CBHVector_loadPairs(const double *values, CBHVector *first, CBHVector *second)
+{
+	*first = vld1q_f64(values);
+	*second = vld1q_f64(values + 2);
+}
+
+NS_INLINE void CBHVector_storePairs(double *values, CBHVector first, CBHVector second)
+{
+	vst1q_f64(values, first);
+	vst1q_f64(values + 2, second);
+}
+
+NS_INLINE CBHVector CBHVector_loadFloats(const float *values) { return vcvt_f64_f32(vld1_f32(values)); }
+NS_INLINE void CBHVector_storeFloats(float *values, CBHVector vector) { vst1_f32(values, vcvt_f32_f64(vector)); }
+
+NS_INLINE CBHVector CBHVector_loadUInt16s(const uint16_t *values)
+{
+	uint32_t bits;
+	memcpy(&bits, values, sizeof(bits));
+	return vcvtq_f64_u64(vmovl_u32(vget_low_u32(vmovl_u16(vreinterpret_u16_u32(vdup_n_u32(bits))))));
+}
+
+NS_INLINE void CBHVector_storeUInt16s(uint16_t *values, CBHVector vector)
+{
+	const uint32x2_t words = vmovn_u64(vcvtq_u64_f64(vector));
+	const uint32_t bits = vget_lane_u32(vreinterpret_u32_u16(vmovn_u32(vcombine_u32(words, words))), 0);
+	memcpy(values, &bits, sizeof(bits));
+}
+
+NS_INLINE CBHVector CBHVector_loadUInt32s(const uint32_t *values) { return vcvtq_f64_u64(vmovl_u32(vld1_u32(values))); }
+NS_INLINE void CBHVector_storeUInt32s(uint32_t *values, CBHVector vector) { vst1_u32(values, vmovn_u64(vcvtq_u64_f64(vector))); }
+
+#endif
+
+
+#if CBH_VECTOR_AVX2 || CBH_VECTOR_SSE2
+
+// Rounds halfway cases away from zero. The fraction `vector - trunc(vector)` is exact, so only halves step outward.
+NS_INLINE CBHVector CBHVector_round(CBHVector vector)
+{
+	const CBHVector sign = CBHVector_set(-0.0);
+	const CBHVector truncated = CBHVector_truncate(vector);
+	const CBHVector fraction = CBHVector_andNot(CBHVector_sub(vector, truncated), sign);
+	const CBHVector step = CBHVector_or(CBHVector_and(vector, sign), CBHVector_set(1.0));
+
+	return CBHVector_select(CBHVector_isLessOrEqual(CBHVector_set(0.5), fraction), CBHVector_add(truncated, step), truncated);
+}
+
+#endif
@@ -0,0 +1,346 @@
+//  CBHGeometryKitTests+CBHAffineTransform.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+
+
+#define CBHAssertEqualPoints(result, expected) XCTAssertTrue(NSPoint_isEqual(result, expected), @"The points should be the same - result:%@ expected:%@", NSPoint_description(result), NSPoint_description(expected))
+#define CBHAssertEqualRects(result, expected) XCTAssertTrue(NSRect_isEqual(result, expected), @"The rects should be the same - result:%@ expected:%@", NSRect_description(result), NSRect_description(expected))
+#define CBHAssertEqualTransforms(result, expected) XCTAssertTrue(CBHAffineTransform_isEqual(result, expected), @"The transforms should be the same.")
+
+
+enum { kBatchCount = 37 };
+static const NSUInteger kPerformanceCount = 1 << 18;
+
+static CGFloat CBHRandomValue(void)
+{
+	return (CGFloat)rand() / (CGFloat)RAND_MAX * 200.0 - 100.0;
+}
+
+static void CBHFillPoints(NSPoint *points, NSUInteger count, unsigned int seed)
+{
+	srand(seed);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		points[i] = NSPoint_init(CBHRandomValue(), CBHRandomValue());
+	}
+}
+
+static void CBHFillRects(NSRect *rects, NSUInteger count, unsigned int seed)
+{
+	// Some sizes are negative so every corner gets a turn at being the minimum.
+	srand(seed);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		rects[i] = NSRect_init(CBHRandomValue(), CBHRandomValue(), CBHRandomValue(), CBHRandomValue());
+	}
+}
+
+static CBHAffineTransform CBHGeneralTransform(void)
+{
+	CBHAffineTransform transform = CBHAffineTransform_initScale(2.5, -0.75);
+	transform = CBHAffineTransform_rotate(transform, 0.3);
+	return CBHAffineTransform_translate(transform, -12.0, 40.5);
+}
+
+
+@interface CBHGeometryKitTests_CBHAffineTransform : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHAffineTransform
+
+#pragma mark - Creating
+
+- (void)testInit_identity
+{
+	CBHAffineTransform transform = CBHAffineTransform_initIdentity();
+
+	XCTAssertTrue(CBHAffineTransform_isIdentity(transform));
+	XCTAssertTrue(CBHAffineTransform_isScaleTranslate(transform));
+	CBHAssertEqualPoints(CBHAffineTransform_applyToPoint(transform, NSPoint_init(3.0, -4.0)), NSPoint_init(3.0, -4.0));
+}
+
+- (void)testInit_transformStruct
+{
+	NSAffineTransformStruct components = { .m11 = 1.0, .m12 = 2.0, .m21 = 3.0, .m22 = 4.0, .tX = 5.0, .tY = 6.0 };
+	CBHAffineTransform transform = CBHAffineTransform_initWithTransformStruct(components);
+
+	CBHAssertEqualTransforms(transform, CBHAffineTransform_init(1.0, 2.0, 3.0, 4.0, 5.0, 6.0));
+
+	NSAffineTransformStruct result = CBHAffineTransform_transformStruct(transform);
+	XCTAssertEqual(result.m11, components.m11);
+	XCTAssertEqual(result.m12, components.m12);
+	XCTAssertEqual(result.m21, components.m21);
+	XCTAssertEqual(result.m22, components.m22);
+	XCTAssertEqual(result.tX, components.tX);
+	XCTAssertEqual(result.tY, components.tY);
+}
+
+- (void)testInit_mappingRect
+{
+	NSRect rect = NSRect_init(1.0, 1.0, 2.0, 4.0);
+	NSRect other = NSRect_init(0.0, 0.0, 10.0, 10.0);
+	CBHAffineTransform transform = CBHAffineTransform_initMappingRect(rect, other);
+
+	XCTAssertTrue(CBHAffineTransform_isScaleTranslate(transform));
+	CBHAssertEqualRects(CBHAffineTransform_applyToRect(transform, rect), other);
+}
+
+- (void)testInit_matchesNSAffineTransform
+{
+	NSAffineTransform *reference = [NSAffineTransform transform];
+	[reference translateXBy:3.0 yBy:-2.0];
+	[reference scaleXBy:2.0 yBy:0.5];
+
+	CBHAffineTransform transform = CBHAffineTransform_initWithTransformStruct([reference transformStruct]);
+	NSPoint point = NSPoint_init(7.0, 11.0);
+
+	CBHAssertEqualPoints(CBHAffineTransform_applyToPoint(transform, point), [reference transformPoint:point]);
+}
+
+
+#pragma mark - Combining
+
+- (void)testCompose_order
+{
+	// Translating then scaling moves the origin by the scaled translation.
+	CBHAffineTransform transform = CBHAffineTransform_scale(CBHAffineTransform_initTranslation(1.0, 2.0), 10.0, 10.0);
+	CBHAssertEqualPoints(CBHAffineTransform_applyToPoint(transform, NSPoint_init(0.0, 0.0)), NSPoint_init(10.0, 20.0));
+
+	// Scaling then translating does not.
+	transform = CBHAffineTransform_translate(CBHAffineTransform_initScale(10.0, 10.0), 1.0, 2.0);
+	CBHAssertEqualPoints(CBHAffineTransform_applyToPoint(transform, NSPoint_init(0.0, 0.0)), NSPoint_init(1.0, 2.0));
+}
+
+- (void)testCompose_identity
+{
+	CBHAffineTransform transform = CBHGeneralTransform();
+
+	CBHAssertEqualTransforms(CBHAffineTransform_compose(transform, CBHAffineTransform_initIdentity()), transform);
+	CBHAssertEqualTransforms(CBHAffineTransform_compose(CBHAffineTransform_initIdentity(), transform), transform);
+}
+
+- (void)testInvert_roundTrip
+{
+	CBHAffineTransform transforms[] = {
+		CBHGeneralTransform(),
+		CBHAffineTransform_init(-4.0, 0.0, 0.0, 0.25, 9.0, -3.0),
+	};
+
+	for (NSUInteger i = 0; i < sizeof(transforms) / sizeof(*transforms); ++i)
+	{
+		CBHAffineTransform inverse;
+		XCTAssertTrue(CBHAffineTransform_invert(transforms[i], &inverse));
+
+		NSPoint point = NSPoint_init(12.5, -7.0);
+		NSPoint result = CBHAffineTransform_applyToPoint(inverse, CBHAffineTransform_applyToPoint(transforms[i], point));
+		XCTAssertEqualWithAccuracy(result.x, point.x, 1e-9);
+		XCTAssertEqualWithAccuracy(result.y, point.y, 1e-9);
+	}
+}
+
+- (void)testInvert_singular
+{
+	CBHAffineTransform inverse = CBHAffineTransform_initIdentity();
+
+	XCTAssertFalse(CBHAffineTransform_isInvertible(CBHAffineTransform_initScale(0.0, 1.0)));
+	XCTAssertFalse(CBHAffineTransform_invert(CBHAffineTransform_init(1.0, 2.0, 2.0, 4.0, 0.0, 0.0), &inverse));
+	XCTAssertTrue(CBHAffineTransform_isIdentity(inverse), @"A failed inversion should not modify the result.");
+}
+
+
+#pragma mark - Applying
+
+- (void)testApply_size
+{
+	CBHAffineTransform transform = CBHAffineTransform_translate(CBHAffineTransform_initScale(2.0, -3.0), 100.0, 100.0);
+	NSSize size = CBHAffineTransform_applyToSize(transform, NSSize_init(4.0, 5.0));
+
+	XCTAssertEqual(size.width, 8.0);
+	XCTAssertEqual(size.height, -15.0);
+}
+
+- (void)testApply_rectBounds
+{
+	// A quarter turn about the origin maps {1, 2, 3, 4} onto x in [-6, -2] and y in [1, 4].
+	CBHAffineTransform transform = CBHAffineTransform_init(0.0, 1.0, -1.0, 0.0, 0.0, 0.0);
+	CBHAssertEqualRects(CBHAffineTransform_applyToRect(transform, NSRect_init(1.0, 2.0, 3.0, 4.0)), NSRect_init(-6.0, 1.0, 4.0, 3.0));
+
+	// A mirrored scale yields a standardized rect.
+	transform = CBHAffineTransform_initScale(-2.0, 1.0);
+	CBHAssertEqualRects(CBHAffineTransform_applyToRect(transform, NSRect_init(1.0, 2.0, 3.0, 4.0)), NSRect_init(-8.0, 2.0, 6.0, 4.0));
+}
+
+- (void)testApply_rectContainsCorners
+{
+	CBHAffineTransform transform = CBHGeneralTransform();
+	NSRect rects[kBatchCount];
+	CBHFillRects(rects, kBatchCount, 1);
+
+	for (NSUInteger i = 0; i < kBatchCount; ++i)
+	{
+		NSRect bounds = CBHAffineTransform_applyToRect(transform, rects[i]);
+		bounds = NSRect_inset(bounds, -1e-9, -1e-9);
+
+		NSPoint corners[] = {
+			rects[i].origin,
+			NSPoint_init(rects[i].origin.x + rects[i].size.width, rects[i].origin.y),
+			NSPoint_init(rects[i].origin.x, rects[i].origin.y + rects[i].size.height),
+			NSPoint_init(rects[i].origin.x + rects[i].size.width, rects[i].origin.y + rects[i].size.height),
+		};
+
+		for (NSUInteger j = 0; j < 4; ++j)
+		{
+			NSPoint corner = CBHAffineTransform_applyToPoint(transform, corners[j]);
+			XCTAssertTrue(NSRect_isPointInRect(bounds, corner), @"Corner %lu of rect %lu is outside the bounds.", (unsigned long)j, (unsigned long)i);
+		}
+	}
+}
+
+
+#pragma mark - Batched
+
+- (void)testBatched_points
+{
+	CBHAffineTransform transforms[] = { CBHGeneralTransform(), CBHAffineTransform_init(2.0, 0.0, 0.0, -0.5, 3.0, 4.0) };
+	NSPoint points[kBatchCount];
+	NSPoint results[kBatchCount];
+	CBHFillPoints(points, kBatchCount, 2);
+
+	for (NSUInteger t = 0; t < sizeof(transforms) / sizeof(*transforms); ++t)
+	{
+		CBHAffineTransform_applyToPoints(transforms[t], points, results, kBatchCount);
+
+		for (NSUInteger i = 0; i < kBatchCount; ++i)
+		{
+			CBHAssertEqualPoints(results[i], CBHAffineTransform_applyToPoint(transforms[t], points[i]));
+		}
+	}
+}
+
+- (void)testBatched_rects
+{
+	CBHAffineTransform transforms[] = { CBHGeneralTransform(), CBHAffineTransform_init(2.0, 0.0, 0.0, -0.5, 3.0, 4.0) };
+	NSRect rects[kBatchCount];
+	NSRect results[kBatchCount];
+	CBHFillRects(rects, kBatchCount, 3);
+
+	for (NSUInteger t = 0; t < sizeof(transforms) / sizeof(*transforms); ++t)
+	{
+		CBHAffineTransform_applyToRects(transforms[t], rects, results, kBatchCount);
+
+		for (NSUInteger i = 0; i < kBatchCount; ++i)
+		{
+			CBHAssertEqualRects(results[i], CBHAffineTransform_applyToRect(transforms[t], rects[i]));
+		}
+	}
+}
+
+- (void)testBatched_inPlace
+{
+	CBHAffineTransform transform = CBHGeneralTransform();
+	NSPoint points[kBatchCount];
+	NSPoint expectedPoints[kBatchCount];
+	NSRect rects[kBatchCount];
+	NSRect expectedRects[kBatchCount];
+	CBHFillPoints(points, kBatchCount, 4);
+	CBHFillRects(rects, kBatchCount, 5);
+
+	CBHAffineTransform_applyToPoints(transform, points, expectedPoints, kBatchCount);
+	CBHAffineTransform_applyToRects(transform, rects, expectedRects, kBatchCount);
+	CBHAffineTransform_applyToPoints(transform, points, points, kBatchCount);
+	CBHAffineTransform_applyToRects(transform, rects, rects, kBatchCount);
+
+	XCTAssertEqual(memcmp(points, expectedPoints, sizeof(points)), 0);
+	XCTAssertEqual(memcmp(rects, expectedRects, sizeof(rects)), 0);
+}
+
+
+#pragma mark - Performance
+
+- (void)testPerformance_applyToPoint
+{
+	CBHAffineTransform transform = CBHGeneralTransform();
+	NSPoint *points = malloc(sizeof(NSPoint) * kPerformanceCount);
+	NSPoint *results = malloc(sizeof(NSPoint) * kPerformanceCount);
+	CBHFillPoints(points, kPerformanceCount, 7);
+
+	[self measureBlock:^{
+		for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+		{
+			results[i] = CBHAffineTransform_applyToPoint(transform, points[i]);
+		}
+	}];
+
+	free(points);
+	free(results);
+}
+
+- (void)testPerformance_applyToPoints
+{
+	CBHAffineTransform transform = CBHGeneralTransform();
+	NSPoint *points = malloc(sizeof(NSPoint) * kPerformanceCount);
+	NSPoint *results = malloc(sizeof(NSPoint) * kPerformanceCount);
+	CBHFillPoints(points, kPerformanceCount, 7);
+
+	[self measureBlock:^{
+		CBHAffineTransform_applyToPoints(transform, points, results, kPerformanceCount);
+	}];
+
+	free(points);
+	free(results);
+}
+
+- (void)testPerformance_applyToPointsNSAffineTransform
+{
+	NSAffineTransform *reference = [NSAffineTransform transform];
+	[reference setTransformStruct:CBHAffineTransform_transformStruct(CBHGeneralTransform())];
+	NSPoint *points = malloc(sizeof(NSPoint) * kPerformanceCount);
+	NSPoint *results = malloc(sizeof(NSPoint) * kPerformanceCount);
+	CBHFillPoints(points, kPerformanceCount, 7);
+
+	[self measureBlock:^{
+		for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+		{
+			results[i] = [reference transformPoint:points[i]];
+		}
+	}];
+
+	free(points);
+	free(results);
+}
+
+- (void)testPerformance_applyToRects
+{
+	CBHAffineTransform transform = CBHGeneralTransform();
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	NSRect *results = malloc(sizeof(NSRect) * kPerformanceCount);
+	CBHFillRects(rects, kPerformanceCount, 8);
+
+	[self measureBlock:^{
+		CBHAffineTransform_applyToRects(transform, rects, results, kPerformanceCount);
+	}];
+
+	free(rects);
+	free(results);
+}
+
+@end
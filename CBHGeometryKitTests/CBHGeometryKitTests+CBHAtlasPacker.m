@@ -0,0 +1,247 @@
+//  CBHGeometryKitTests+CBHAtlasPacker.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+
+
+// Slightly more than fits, so the packers run out of room.
+enum { kCorpusCount = 3000 };
+static const NSSize kAtlasSize = { 1024.0, 1024.0 };
+
+static const CBHAtlasHeuristic kHeuristics[] = {
+	CBHAtlasHeuristicMaxRectsBestShortSideFit,
+	CBHAtlasHeuristicMaxRectsBestAreaFit,
+	CBHAtlasHeuristicMaxRectsBottomLeft,
+	CBHAtlasHeuristicSkylineBottomLeft,
+	CBHAtlasHeuristicSkylineMinWaste,
+};
+
+// Glyph-like sizes: mostly small and narrow, with the occasional large sprite.
+static void CBHFillCorpus(NSSize *sizes, NSUInteger count)
+{
+	srand(42);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		if ( rand() % 50 == 0 ) { sizes[i] = NSSize_init(32 + rand() % 96, 32 + rand() % 96); }
+		else { sizes[i] = NSSize_init(4 + rand() % 20, 8 + rand() % 24); }
+	}
+}
+
+
+@interface CBHGeometryKitTests_CBHAtlasPacker : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHAtlasPacker
+{
+	NSSize _sizes[kCorpusCount];
+	NSRect _rects[kCorpusCount];
+	BOOL _rotated[kCorpusCount];
+}
+
+- (void)setUp
+{
+	[super setUp];
+	CBHFillCorpus(_sizes, kCorpusCount);
+}
+
+- (void)assertValidPacking:(CGFloat)padding
+{
+	NSRect bounds = NSRect_init(0.0, 0.0, kAtlasSize.width, kAtlasSize.height);
+
+	for (NSUInteger i = 0; i < kCorpusCount; ++i)
+	{
+		if ( NSRect_isEmpty(_rects[i]) ) { continue; }
+
+		NSSize expected = ( _rotated[i] ) ? NSSize_init(_sizes[i].height, _sizes[i].width) : _sizes[i];
+		XCTAssertTrue(NSSize_isEqual(_rects[i].size, expected), @"Rect %lu has the wrong size.", (unsigned long)i);
+		XCTAssertTrue(NSRect_isCovering(bounds, _rects[i]), @"Rect %lu is outside the atlas.", (unsigned long)i);
+
+		NSRect padded = NSRect_inset(_rects[i], -padding / 2.0, -padding / 2.0);
+		for (NSUInteger j = i + 1; j < kCorpusCount; ++j)
+		{
+			if ( NSRect_isEmpty(_rects[j]) ) { continue; }
+
+			NSRect other = NSRect_inset(_rects[j], -padding / 2.0, -padding / 2.0);
+			if ( NSRect_isIntersecting(padded, other) ) { XCTFail(@"Rects %lu and %lu are too close.", (unsigned long)i, (unsigned long)j); return; }
+		}
+	}
+}
+
+
+#pragma mark - Creating
+
+- (void)testCreate_invalid
+{
+	XCTAssertTrue(CBHAtlasPacker_create(NSSize_init(0.0, 10.0), CBHAtlasHeuristicSkylineBottomLeft, 0.0, NO) == NULL);
+	XCTAssertTrue(CBHAtlasPacker_create(NSSize_init(10.0, INFINITY), CBHAtlasHeuristicSkylineBottomLeft, 0.0, NO) == NULL);
+	XCTAssertTrue(CBHAtlasPacker_create(NSSize_init(10.0, 10.0), CBHAtlasHeuristicSkylineBottomLeft, -1.0, NO) == NULL);
+	XCTAssertTrue(CBHAtlasPacker_create(NSSize_init(10.0, 10.0), (CBHAtlasHeuristic)99, 0.0, NO) == NULL);
+}
+
+- (void)testReset
+{
+	CBHAtlasPacker *packer = CBHAtlasPacker_create(NSSize_init(10.0, 10.0), CBHAtlasHeuristicMaxRectsBestShortSideFit, 0.0, NO);
+
+	XCTAssertTrue(CBHAtlasPacker_insert(packer, NSSize_init(10.0, 10.0), NULL, NULL));
+	XCTAssertEqual(CBHAtlasPacker_occupancy(packer), 1.0);
+	XCTAssertFalse(CBHAtlasPacker_insert(packer, NSSize_init(1.0, 1.0), NULL, NULL));
+
+	CBHAtlasPacker_reset(packer);
+	XCTAssertEqual(CBHAtlasPacker_count(packer), 0);
+	XCTAssertEqual(CBHAtlasPacker_occupancy(packer), 0.0);
+	XCTAssertTrue(CBHAtlasPacker_insert(packer, NSSize_init(1.0, 1.0), NULL, NULL));
+
+	CBHAtlasPacker_destroy(packer);
+}
+
+
+#pragma mark - Placing
+
+- (void)testInsert_unplaceable
+{
+	for (NSUInteger h = 0; h < sizeof(kHeuristics) / sizeof(*kHeuristics); ++h)
+	{
+		CBHAtlasPacker *packer = CBHAtlasPacker_create(NSSize_init(10.0, 20.0), kHeuristics[h], 0.0, NO);
+
+		XCTAssertFalse(CBHAtlasPacker_insert(packer, NSSize_init(0.0, 5.0), NULL, NULL));
+		XCTAssertFalse(CBHAtlasPacker_insert(packer, NSSize_init(NAN, 5.0), NULL, NULL));
+		XCTAssertFalse(CBHAtlasPacker_insert(packer, NSSize_init(20.0, 5.0), NULL, NULL));
+		XCTAssertEqual(CBHAtlasPacker_count(packer), 0);
+
+		CBHAtlasPacker_destroy(packer);
+	}
+}
+
+- (void)testInsert_rotation
+{
+	for (NSUInteger h = 0; h < sizeof(kHeuristics) / sizeof(*kHeuristics); ++h)
+	{
+		CBHAtlasPacker *packer = CBHAtlasPacker_create(NSSize_init(10.0, 20.0), kHeuristics[h], 0.0, YES);
+
+		NSRect rect;
+		BOOL rotated = NO;
+		XCTAssertTrue(CBHAtlasPacker_insert(packer, NSSize_init(20.0, 5.0), &rect, &rotated));
+		XCTAssertTrue(rotated);
+		XCTAssertTrue(NSRect_isEqual(rect, NSRect_init(0.0, 0.0, 5.0, 20.0)));
+
+		CBHAtlasPacker_destroy(packer);
+	}
+}
+
+- (void)testInsert_padding
+{
+	for (NSUInteger h = 0; h < sizeof(kHeuristics) / sizeof(*kHeuristics); ++h)
+	{
+		// Two 4 wide rects fit side by side in 10 with a padding of 2, but not 3.
+		CBHAtlasPacker *packer = CBHAtlasPacker_create(NSSize_init(10.0, 4.0), kHeuristics[h], 2.0, NO);
+		XCTAssertTrue(CBHAtlasPacker_insert(packer, NSSize_init(4.0, 4.0), NULL, NULL));
+		XCTAssertTrue(CBHAtlasPacker_insert(packer, NSSize_init(4.0, 4.0), NULL, NULL));
+		CBHAtlasPacker_destroy(packer);
+
+		packer = CBHAtlasPacker_create(NSSize_init(10.0, 4.0), kHeuristics[h], 3.0, NO);
+		XCTAssertTrue(CBHAtlasPacker_insert(packer, NSSize_init(4.0, 4.0), NULL, NULL));
+		XCTAssertFalse(CBHAtlasPacker_insert(packer, NSSize_init(4.0, 4.0), NULL, NULL));
+		CBHAtlasPacker_destroy(packer);
+	}
+}
+
+- (void)testInsert_valid
+{
+	for (NSUInteger h = 0; h < sizeof(kHeuristics) / sizeof(*kHeuristics); ++h)
+	{
+		CBHAtlasPacker *packer = CBHAtlasPacker_create(kAtlasSize, kHeuristics[h], 1.0, YES);
+
+		for (NSUInteger i = 0; i < kCorpusCount; ++i)
+		{
+			if ( !CBHAtlasPacker_insert(packer, _sizes[i], _rects + i, _rotated + i) ) { _rects[i] = NSRect_initEmpty(); }
+		}
+
+		[self assertValidPacking:1.0];
+		CBHAtlasPacker_destroy(packer);
+	}
+}
+
+- (void)testInsertSizes_valid
+{
+	for (NSUInteger h = 0; h < sizeof(kHeuristics) / sizeof(*kHeuristics); ++h)
+	{
+		CBHAtlasPacker *packer = CBHAtlasPacker_create(kAtlasSize, kHeuristics[h], 1.0, YES);
+
+		NSUInteger placed = CBHAtlasPacker_insertSizes(packer, _sizes, _rects, _rotated, kCorpusCount);
+		XCTAssertEqual(placed, CBHAtlasPacker_count(packer));
+
+		[self assertValidPacking:1.0];
+		CBHAtlasPacker_destroy(packer);
+	}
+}
+
+- (void)testInsertSizes_occupancy
+{
+	// Floors for the fixed corpus, so a change which packs worse is noticed.
+	const CGFloat minimums[] = { 0.97, 0.97, 0.97, 0.90, 0.88 };
+
+	for (NSUInteger h = 0; h < sizeof(kHeuristics) / sizeof(*kHeuristics); ++h)
+	{
+		CBHAtlasPacker *packer = CBHAtlasPacker_create(kAtlasSize, kHeuristics[h], 0.0, YES);
+
+		CBHAtlasPacker_insertSizes(packer, _sizes, _rects, _rotated, kCorpusCount);
+		XCTAssertGreaterThanOrEqual(CBHAtlasPacker_occupancy(packer), minimums[h], @"Heuristic %ld packs too loosely.", (long)kHeuristics[h]);
+
+		CBHAtlasPacker_destroy(packer);
+	}
+}
+
+
+#pragma mark - Performance
+
+- (void)measureHeuristic:(CBHAtlasHeuristic)heuristic
+{
+	CBHAtlasPacker *packer = CBHAtlasPacker_create(kAtlasSize, heuristic, 1.0, YES);
+
+	[self measureBlock:^{
+		CBHAtlasPacker_reset(packer);
+		CBHAtlasPacker_insertSizes(packer, self->_sizes, self->_rects, self->_rotated, kCorpusCount);
+	}];
+
+	CBHAtlasPacker_destroy(packer);
+}
+
+- (void)testPerformance_maxRectsBestShortSideFit
+{
+	[self measureHeuristic:CBHAtlasHeuristicMaxRectsBestShortSideFit];
+}
+
+- (void)testPerformance_maxRectsBottomLeft
+{
+	[self measureHeuristic:CBHAtlasHeuristicMaxRectsBottomLeft];
+}
+
+- (void)testPerformance_skylineBottomLeft
+{
+	[self measureHeuristic:CBHAtlasHeuristicSkylineBottomLeft];
+}
+
+- (void)testPerformance_skylineMinWaste
+{
+	[self measureHeuristic:CBHAtlasHeuristicSkylineMinWaste];
+}
+
+@end
@@ -0,0 +1,279 @@
+//  CBHGeometryKitTests+CBHGeometryArchive.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+
+#define CBHAssertEqualRects(result, expected) XCTAssertTrue(NSRect_isEqual(result, expected), @"The rects should be the same - result:%@ expected:%@", NSRect_description(result), NSRect_description(expected))
+
+
+enum { kRectCount = 5000 };
+
+static void CBHFillRects(NSRect *rects, NSUInteger count, unsigned int seed)
+{
+	srand(seed);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		rects[i] = NSRect_init((CGFloat)rand() / 3.0, (CGFloat)(rand() % 100), (CGFloat)(rand() % 7), -(CGFloat)rand() / 11.0);
+	}
+}
+
+
+@interface CBHGeometryKitTests_CBHGeometryArchive : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHGeometryArchive
+{
+	NSRect _rects[kRectCount];
+	CBHGeometryArchiveWriter *_writer;
+}
+
+- (void)setUp
+{
+	NSPoint points[3] = { NSPoint_init(1.0, 2.0), NSPoint_init(3.25, -4.0), NSPoint_init(0.1, 5.0) };
+	NSRange ranges[2] = { NSRange_init(1, 2), NSRange_init(NSNotFound, 7) };
+	CBHFillRects(_rects, kRectCount, 5);
+
+	_writer = CBHGeometryArchiveWriter_create();
+	CBHGeometryArchiveWriter_beginSection(_writer, CBHGeometryArchiveKindPoints, CBHGeometryArchiveStorageFloat64);
+	CBHGeometryArchiveWriter_appendPoints(_writer, points, 3);
+	CBHGeometryArchiveWriter_beginSection(_writer, CBHGeometryArchiveKindRects, CBHGeometryArchiveStorageFloat64);
+	CBHGeometryArchiveWriter_appendRects(_writer, _rects, kRectCount / 2);
+	CBHGeometryArchiveWriter_appendRects(_writer, _rects + kRectCount / 2, kRectCount - kRectCount / 2);
+	CBHGeometryArchiveWriter_beginSection(_writer, CBHGeometryArchiveKindRects, CBHGeometryArchiveStorageFloat32);
+	CBHGeometryArchiveWriter_appendRects(_writer, _rects, kRectCount);
+	CBHGeometryArchiveWriter_beginSection(_writer, CBHGeometryArchiveKindRanges, CBHGeometryArchiveStorageUInt64);
+	CBHGeometryArchiveWriter_appendRanges(_writer, ranges, 2);
+	CBHGeometryArchiveWriter_finish(_writer);
+}
+
+- (void)tearDown
+{
+	CBHGeometryArchiveWriter_destroy(_writer);
+}
+
+- (NSMutableData *)archiveData
+{
+	return [NSMutableData dataWithBytes:CBHGeometryArchiveWriter_bytes(_writer) length:CBHGeometryArchiveWriter_length(_writer)];
+}
+
+
+#pragma mark - Writing Archives
+
+- (void)testWriting_sectionRules
+{
+	NSPoint point = NSPoint_init(1.0, 2.0);
+	CBHGeometryArchiveWriter *writer = CBHGeometryArchiveWriter_create();
+
+	XCTAssertFalse(CBHGeometryArchiveWriter_appendPoints(writer, &point, 1), @"Values need a section.");
+	XCTAssertFalse(CBHGeometryArchiveWriter_beginSection(writer, CBHGeometryArchiveKindRanges, CBHGeometryArchiveStorageFloat32), @"Ranges are stored as integers.");
+	XCTAssertFalse(CBHGeometryArchiveWriter_beginSection(writer, CBHGeometryArchiveKindPoints, CBHGeometryArchiveStorageUInt64), @"Points are stored as floats.");
+	XCTAssertTrue(CBHGeometryArchiveWriter_beginSection(writer, CBHGeometryArchiveKindSizes, CBHGeometryArchiveStorageFloat32), @"Beginning failed.");
+	XCTAssertFalse(CBHGeometryArchiveWriter_appendPoints(writer, &point, 1), @"Values must match the section.");
+	XCTAssertTrue(CBHGeometryArchiveWriter_finish(writer), @"Finishing failed.");
+	XCTAssertFalse(CBHGeometryArchiveWriter_finish(writer), @"An archive can only be finished once.");
+	XCTAssertFalse(CBHGeometryArchiveWriter_beginSection(writer, CBHGeometryArchiveKindSizes, CBHGeometryArchiveStorageFloat32), @"Finished archives cannot grow.");
+
+	CBHGeometryArchiveWriter_destroy(writer);
+}
+
+- (void)testWriting_fileDescriptor
+{
+	char path[] = "/tmp/CBHGeometryArchive.XXXXXX";
+	int fileDescriptor = mkstemp(path);
+	XCTAssertGreaterThanOrEqual(fileDescriptor, 0, @"Could not create a temporary file.");
+
+	CBHGeometryArchiveWriter *writer = CBHGeometryArchiveWriter_createWithFileDescriptor(fileDescriptor);
+	XCTAssertTrue(CBHGeometryArchiveWriter_beginSection(writer, CBHGeometryArchiveKindRects, CBHGeometryArchiveStorageFloat64), @"Beginning failed.");
+	for (NSUInteger i = 0; i < 20; ++i)
+	{
+		XCTAssertTrue(CBHGeometryArchiveWriter_appendRects(writer, _rects, kRectCount), @"Appending failed.");
+	}
+	XCTAssertTrue(CBHGeometryArchiveWriter_finish(writer), @"Finishing failed.");
+	XCTAssertTrue(CBHGeometryArchiveWriter_bytes(writer) == NULL, @"File descriptor writers do not keep their output.");
+	CBHGeometryArchiveWriter_destroy(writer);
+	close(fileDescriptor);
+
+	CBHGeometryArchiveStatus status;
+	CBHGeometryArchive *archive = CBHGeometryArchive_createWithContentsOfFile(path, &status);
+	XCTAssertEqual(status, CBHGeometryArchiveStatusSuccess, @"Opening failed.");
+
+	NSUInteger count = 0;
+	const NSRect *rects = CBHGeometryArchive_rects(archive, 0, &count);
+	XCTAssertEqual(count, (NSUInteger)kRectCount * 20, @"Wrong count.");
+	XCTAssertEqual(memcmp(rects + kRectCount * 19, _rects, sizeof(NSRect) * kRectCount), 0, @"Wrong rects.");
+
+	CBHGeometryArchive_destroy(archive);
+	unlink(path);
+}
+
+
+#pragma mark - Reading Archives
+
+- (void)testReading_inPlace
+{
+	NSMutableData *data = [self archiveData];
+	CBHGeometryArchive *archive = CBHGeometryArchive_createWithBytes([data bytes], [data length], NULL);
+	NSUInteger count = 0;
+
+	XCTAssertEqual(CBHGeometryArchive_sectionCount(archive), 4UL, @"Wrong section count.");
+
+	const NSPoint *points = CBHGeometryArchive_points(archive, 0, &count);
+	XCTAssertEqual(count, 3UL, @"Wrong count.");
+	XCTAssertEqual(points[1].x, 3.25, @"Wrong point.");
+
+	const NSRect *rects = CBHGeometryArchive_rects(archive, 1, &count);
+	XCTAssertEqual(count, (NSUInteger)kRectCount, @"Wrong count.");
+	XCTAssertEqual(memcmp(rects, _rects, sizeof(NSRect) * kRectCount), 0, @"Wrong rects.");
+
+	XCTAssertTrue(CBHGeometryArchive_rects(archive, 0, NULL) == NULL, @"Points are not rects.");
+	XCTAssertTrue(CBHGeometryArchive_rects(archive, 2, NULL) == NULL, @"Float32 rects cannot be read in place.");
+
+	const NSRange *ranges = CBHGeometryArchive_ranges(archive, 3, &count);
+	XCTAssertEqual(count, 2UL, @"Wrong count.");
+	XCTAssertEqual(ranges[1].location, (NSUInteger)NSNotFound, @"Wrong range.");
+
+	CBHGeometryArchive_destroy(archive);
+}
+
+- (void)testReading_copying
+{
+	NSMutableData *data = [self archiveData];
+	CBHGeometryArchive *archive = CBHGeometryArchive_createWithBytes([data bytes], [data length], NULL);
+	NSRect rects[kRectCount];
+
+	CBHGeometryArchiveSection section = CBHGeometryArchive_sectionAtIndex(archive, 2);
+	XCTAssertEqual(section.kind, CBHGeometryArchiveKindRects, @"Wrong kind.");
+	XCTAssertEqual(section.storage, CBHGeometryArchiveStorageFloat32, @"Wrong storage.");
+
+	XCTAssertEqual(CBHGeometryArchive_getRects(archive, 2, NSRange_init(0, kRectCount), rects), (NSUInteger)kRectCount, @"Wrong count.");
+	for (NSUInteger i = 0; i < kRectCount; ++i)
+	{
+		NSRect expected = NSRect_init((float)_rects[i].origin.x, (float)_rects[i].origin.y, (float)_rects[i].size.width, (float)_rects[i].size.height);
+		CBHAssertEqualRects(rects[i], expected);
+	}
+
+	XCTAssertEqual(CBHGeometryArchive_getRects(archive, 1, NSRange_init(kRectCount - 2, 10), rects), 2UL, @"Copies should be clamped.");
+	CBHAssertEqualRects(rects[1], _rects[kRectCount - 1]);
+	XCTAssertEqual(CBHGeometryArchive_getRects(archive, 0, NSRange_init(0, 1), rects), 0UL, @"Points are not rects.");
+
+	CBHGeometryArchive_destroy(archive);
+}
+
+- (void)testReading_validation
+{
+	NSMutableData *data = [self archiveData];
+	uint8_t *bytes = [data mutableBytes];
+	CBHGeometryArchiveStatus status;
+
+	XCTAssertTrue(CBHGeometryArchive_createWithBytes(bytes, [data length] - 1, &status) == NULL, @"Truncated archives are invalid.");
+	XCTAssertEqual(status, CBHGeometryArchiveStatusInvalid, @"Wrong status.");
+
+	bytes[8] = 2;
+	XCTAssertTrue(CBHGeometryArchive_createWithBytes(bytes, [data length], &status) == NULL, @"Newer versions are unsupported.");
+	XCTAssertEqual(status, CBHGeometryArchiveStatusUnsupportedVersion, @"Wrong status.");
+	bytes[8] = 1;
+
+	uint32_t swapped = 0x04030201;
+	memcpy(bytes + 12, &swapped, sizeof(uint32_t));
+	XCTAssertTrue(CBHGeometryArchive_createWithBytes(bytes, [data length], &status) == NULL, @"Swapped archives cannot be read in place.");
+	XCTAssertEqual(status, CBHGeometryArchiveStatusWrongByteOrder, @"Wrong status.");
+
+	XCTAssertTrue(CBHGeometryArchive_createWithContentsOfFile("/nonexistent/archive", &status) == NULL, @"Missing files cannot be opened.");
+	XCTAssertEqual(status, CBHGeometryArchiveStatusUnreadable, @"Wrong status.");
+}
+
+- (void)testReading_corruption
+{
+	NSMutableData *pristine = [self archiveData];
+	NSMutableData *data = [NSMutableData dataWithLength:[pristine length]];
+	uint8_t *bytes = [data mutableBytes];
+	srand(6);
+
+	// Damage the header, table and trailer; anything still accepted must describe values inside the archive.
+	for (NSUInteger i = 0; i < 5000; ++i)
+	{
+		memcpy(bytes, [pristine bytes], [pristine length]);
+		NSUInteger offset = ( i % 2 == 0 ) ? (NSUInteger)rand() % 32 : [data length] - 1 - (NSUInteger)rand() % 160;
+		bytes[offset] ^= (uint8_t)(1 + rand() % 255);
+
+		CBHGeometryArchive *archive = CBHGeometryArchive_createWithBytes(bytes, [data length], NULL);
+		for (NSUInteger j = 0; j < ( archive != NULL ? CBHGeometryArchive_sectionCount(archive) : 0 ); ++j)
+		{
+			CBHGeometryArchiveSection section = CBHGeometryArchive_sectionAtIndex(archive, j);
+			NSUInteger stride = ( section.kind == CBHGeometryArchiveKindRects ? 4 : 2 ) * ( section.storage == CBHGeometryArchiveStorageFloat32 ? 4 : 8 );
+			const uint8_t *end = (const uint8_t *)section.values + section.count * stride;
+			XCTAssertTrue(end <= bytes + [data length], @"Sections must lie inside the archive.");
+		}
+		CBHGeometryArchive_destroy(archive);
+	}
+}
+
+
+#pragma mark - Performance
+
+static const NSUInteger kPerformanceCount = 1 << 20;
+
+- (void)testPerformance_parseLines
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	CBHFillRects(rects, kPerformanceCount, 7);
+
+	CBHGeometryWriter *writer = CBHGeometryWriter_create();
+	CBHGeometryWriter_writeRects(writer, rects, kPerformanceCount);
+
+	[self measureBlock:^{
+		NSRect_parseLines(CBHGeometryWriter_bytes(writer), CBHGeometryWriter_length(writer), rects, NULL, kPerformanceCount);
+	}];
+
+	CBHGeometryWriter_destroy(writer);
+	free(rects);
+}
+
+- (void)testPerformance_archive
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	CBHFillRects(rects, kPerformanceCount, 7);
+
+	char path[] = "/tmp/CBHGeometryArchive.XXXXXX";
+	int fileDescriptor = mkstemp(path);
+	CBHGeometryArchiveWriter *writer = CBHGeometryArchiveWriter_createWithFileDescriptor(fileDescriptor);
+	CBHGeometryArchiveWriter_beginSection(writer, CBHGeometryArchiveKindRects, CBHGeometryArchiveStorageFloat64);
+	CBHGeometryArchiveWriter_appendRects(writer, rects, kPerformanceCount);
+	CBHGeometryArchiveWriter_finish(writer);
+	CBHGeometryArchiveWriter_destroy(writer);
+	close(fileDescriptor);
+
+	[self measureBlock:^{
+		CBHGeometryArchive *archive = CBHGeometryArchive_createWithContentsOfFile(path, NULL);
+		const NSRect *mapped = CBHGeometryArchive_rects(archive, 0, NULL);
+
+		CGFloat sum = 0.0;
+		for (NSUInteger i = 0; i < kPerformanceCount; i += 512) { sum += mapped[i].origin.x; }
+		XCTAssertGreaterThan(sum, 0.0);
+
+		CBHGeometryArchive_destroy(archive);
+	}];
+
+	unlink(path);
+	free(rects);
+}
+
+@end
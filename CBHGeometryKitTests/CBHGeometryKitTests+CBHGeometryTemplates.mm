@@ -0,0 +1,224 @@
+//  CBHGeometryKitTests+CBHGeometryTemplates.mm
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+#include <cstring>
+
+
+using namespace CBH;
+
+
+#pragma mark - Compile-Time Evaluation
+
+// Each of these only compiles if the expression is evaluated at compile time.
+
+constexpr RectF kBounds(0.0, 0.0, 320.0, 240.0);
+constexpr RectF kCard = RectF(0.0, 0.0, 100.0, 50.0).centeredInRect(kBounds);
+
+static_assert(kCard == RectF(110.0, 95.0, 100.0, 50.0), "Wrong centred rect.");
+static_assert(kBounds.midPoint() == PointF(160.0, 120.0), "Wrong mid point.");
+static_assert(kBounds.inset(10.0, 20.0) == RectF(10.0, 20.0, 300.0, 200.0), "Wrong inset rect.");
+static_assert(kBounds.isCovering(kCard) && !kCard.isCovering(kBounds), "Wrong covering.");
+static_assert(kCard.unionWith(RectF(0.0, 0.0, 10.0, 10.0)) == RectF(0.0, 0.0, 210.0, 145.0), "Wrong union.");
+static_assert(kCard.intersection(RectF(0.0, 0.0, 120.0, 100.0)) == RectF(110.0, 95.0, 10.0, 5.0), "Wrong intersection.");
+static_assert(RectF(-0.5, 0.25, 1.0, 1.0).integral() == RectF(-1.0, 0.0, 2.0, 2.0), "Wrong integral rect.");
+static_assert(RectF(4.0, 4.0, -2.0, -3.0).absolute() == RectF(2.0, 1.0, 2.0, 3.0), "Wrong absolute rect.");
+static_assert(RectF(0.0, 0.0, 0.0, 5.0).isEmpty() && !RectF().isPointInRect(PointF()), "Wrong emptiness.");
+
+static_assert(SizeF(3.0, 4.0).scaleParametric(1.0, -1.0) == SizeF(4.0, 3.0), "Wrong scaled size.");
+static_assert(SizeF(-2.5, 2.5).round() == SizeF(-3.0, 3.0), "Wrong rounded size.");
+
+static_assert(PointF().distance(PointF(3.0, 4.0)) == 5.0, "Wrong distance.");
+static_assert(PointF().distance(PointF(1.0, 1.0)) == 1.4142135623730951, "Wrong distance.");
+static_assert(Point<float>().distance(Point<float>(1.0f, 1.0f)) == 1.41421354f, "Wrong float distance.");
+static_assert(PointF(1.7, -1.7).nearestPixel() == PointF(1.5, -0.5), "Wrong pixel center.");
+
+static_assert(Rect<int32_t>(0, 0, 10, 10).intersection(Rect<int32_t>(5, 5, 10, 10)) == Rect<int32_t>(5, 5, 5, 5), "Wrong integer intersection.");
+static_assert(Rect<int32_t>(0, 0, 5, 5).midPoint() == Point<int32_t>(2, 2), "Wrong integer mid point.");
+
+static_assert(RangeU(5, 10).intersection(RangeU(12, 10)) == RangeU(12, 3), "Wrong range intersection.");
+static_assert(RangeU(5, 10).unionWith(RangeU(20, 5)) == RangeU(5, 20), "Wrong range union.");
+static_assert(RangeU(5, 10).locationAtOffset(10) == NSNotFound, "Wrong missing location.");
+static_assert(RangeU::fromTo(2, 6).max() == 6, "Wrong maximum.");
+
+
+// Values the C functions handle specially, folded at compile time so they can be compared with the C functions.
+static constexpr CGFloat kValues[] = {
+	0.0, -0.0, 0.3, -0.3, 0.5, -0.5, 0.7, -0.7, 1.5, -1.5, 2.5, -2.5, 0.49999999999999994, -0.49999999999999994,
+	4503599627370495.5, -4503599627370495.5, 4503599627370496.0, 1e150, -1e150, 1e-310, -1e-310, 3.0, 12345.678,
+};
+static constexpr NSUInteger kValueCount = sizeof(kValues) / sizeof(*kValues);
+
+struct CBHFoldedValues
+{
+	PointF truncated[kValueCount];
+	PointF rounded[kValueCount];
+	SizeF absolute[kValueCount];
+	RectF integral[kValueCount];
+	CGFloat distances[kValueCount];
+};
+
+static constexpr CBHFoldedValues CBHFoldValues()
+{
+	CBHFoldedValues folded = {};
+
+	for (NSUInteger i = 0; i < kValueCount; ++i)
+	{
+		const CGFloat value = kValues[i];
+		const CGFloat other = kValues[(i + 5) % kValueCount];
+
+		folded.truncated[i] = PointF(value, other).truncate();
+		folded.rounded[i] = PointF(value, other).round();
+		folded.absolute[i] = SizeF(value, other).absolute();
+		folded.integral[i] = RectF(value, other, 2.25, 1.5).integral();
+		folded.distances[i] = PointF(value, other).distance(PointF(1.0, -2.0));
+	}
+
+	return folded;
+}
+
+static constexpr CBHFoldedValues kFolded = CBHFoldValues();
+
+
+#pragma mark - Test Support
+
+static CGFloat CBHRandomValue(void)
+{
+	switch ( rand() % 3 )
+	{
+		case 0: return kValues[(NSUInteger)rand() % kValueCount];
+		case 1: return (CGFloat)(rand() % 41 - 20) / 2.0;
+		default: return (CGFloat)rand() / (CGFloat)RAND_MAX * 200.0 - 100.0;
+	}
+}
+
+static NSUInteger CBHRandomLocation(void)
+{
+	return ( rand() % 4 ) ? (NSUInteger)(rand() % 40) : NSNotFound - (NSUInteger)(rand() % 20);
+}
+
+static BOOL CBHIsIdentical(const void *value, const void *other, size_t size)
+{
+	return ( memcmp(value, other, size) == 0 );
+}
+
+
+@interface CBHGeometryKitTests_CBHGeometryTemplates : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHGeometryTemplates
+
+#pragma mark - Conversion
+
+- (void)testConversion_roundTrips
+{
+	const NSRect rect = NSRect_init(1.5, -2.0, 3.0, 4.25);
+	const NSRange range = NSRange_init(3, 9);
+
+	XCTAssertTrue(NSRect_isEqual(RectF(rect), rect), @"The rect should survive conversion.");
+	XCTAssertTrue(NSRange_isEqual(RangeU(range), range), @"The range should survive conversion.");
+	XCTAssertTrue(NSRect_isEqual(Rect<float>(rect), rect), @"The rect should survive conversion to float.");
+	XCTAssertTrue(NSRect_isEqual(Rect<int32_t>(rect), NSRect_init(1.0, -2.0, 3.0, 4.0)), @"The rect should truncate to integers.");
+
+	static_assert(sizeof(RectF) == sizeof(NSRect), "Rects should be the size of NSRect.");
+	static_assert(sizeof(RangeU) == sizeof(NSRange), "Ranges should be the size of NSRange.");
+}
+
+
+#pragma mark - Agreement
+
+- (void)testFolded_matchesC
+{
+	for (NSUInteger i = 0; i < kValueCount; ++i)
+	{
+		const CGFloat value = kValues[i];
+		const CGFloat other = kValues[(i + 5) % kValueCount];
+
+		const NSPoint truncated = NSPoint_truncate(NSPoint_init(value, other));
+		const NSPoint rounded = NSPoint_round(NSPoint_init(value, other));
+		const NSSize absolute = NSSize_absolute(NSSize_init(value, other));
+		const NSRect integral = NSRect_integral(NSRect_init(value, other, 2.25, 1.5));
+		const CGFloat distance = NSPoint_distance(NSPoint_init(value, other), NSPoint_init(1.0, -2.0));
+
+		XCTAssertTrue(CBHIsIdentical(&kFolded.truncated[i], &truncated, sizeof(NSPoint)), @"Wrong truncated point for %g.", value);
+		XCTAssertTrue(CBHIsIdentical(&kFolded.rounded[i], &rounded, sizeof(NSPoint)), @"Wrong rounded point for %g.", value);
+		XCTAssertTrue(CBHIsIdentical(&kFolded.absolute[i], &absolute, sizeof(NSSize)), @"Wrong absolute size for %g.", value);
+		XCTAssertTrue(CBHIsIdentical(&kFolded.integral[i], &integral, sizeof(NSRect)), @"Wrong integral rect for %g.", value);
+		XCTAssertTrue(CBHIsIdentical(&kFolded.distances[i], &distance, sizeof(CGFloat)), @"Wrong distance for %g.", value);
+	}
+}
+
+- (void)testPoints_matchC
+{
+	srand(1);
+	for (NSUInteger i = 0; i < 1 << 16; ++i)
+	{
+		const NSPoint point = NSPoint_init(CBHRandomValue(), CBHRandomValue());
+		const NSPoint other = NSPoint_init(CBHRandomValue(), CBHRandomValue());
+
+		XCTAssertTrue(NSPoint_isEqual(PointF(point).round(), NSPoint_round(point)), @"Wrong rounded point at %lu.", i);
+		XCTAssertTrue(NSPoint_isEqual(PointF(point).nearestPixel(), NSPoint_nearestPixel(point)), @"Wrong pixel center at %lu.", i);
+		XCTAssertTrue(NSPoint_isEqual(PointF(point).shift(PointF(other)), NSPoint_shift(point, other)), @"Wrong shifted point at %lu.", i);
+		XCTAssertEqual(PointF(point).distance(PointF(other)), NSPoint_distance(point, other), @"Wrong distance at %lu.", i);
+		XCTAssertEqual(PointF(point).distanceSquared(PointF(other)), NSPoint_distanceSquared(point, other), @"Wrong squared distance at %lu.", i);
+		XCTAssertEqual(PointF(point).approximateDistance(PointF(other)), NSPoint_approximateDistance(point, other), @"Wrong approximate distance at %lu.", i);
+	}
+}
+
+- (void)testRects_matchC
+{
+	srand(2);
+	for (NSUInteger i = 0; i < 1 << 16; ++i)
+	{
+		const NSRect rect = NSRect_init(CBHRandomValue(), CBHRandomValue(), CBHRandomValue(), CBHRandomValue());
+		const NSRect other = NSRect_init(CBHRandomValue(), CBHRandomValue(), CBHRandomValue(), CBHRandomValue());
+		const NSPoint point = NSPoint_init(CBHRandomValue(), CBHRandomValue());
+
+		XCTAssertEqual(RectF(rect).isCovering(RectF(other)), (bool)NSRect_isCovering(rect, other), @"Wrong covering at %lu.", i);
+		XCTAssertEqual(RectF(rect).isIntersecting(RectF(other)), (bool)NSRect_isIntersecting(rect, other), @"Wrong intersecting at %lu.", i);
+		XCTAssertEqual(RectF(rect).isMouseInRect(PointF(point), false), (bool)NSRect_isMouseInRect(rect, point, NO), @"Wrong containment at %lu.", i);
+		XCTAssertTrue(NSRect_isEqual(RectF(rect).integral(), NSRect_integral(rect)), @"Wrong integral rect at %lu.", i);
+		XCTAssertTrue(NSRect_isEqual(RectF(rect).absolute(), NSRect_absolute(rect)), @"Wrong absolute rect at %lu.", i);
+		XCTAssertTrue(NSRect_isEqual(RectF(rect).intersection(RectF(other)), NSRect_intersection(rect, other)), @"Wrong intersection at %lu.", i);
+		XCTAssertTrue(NSRect_isEqual(RectF(rect).unionWith(RectF(other)), NSRect_union(rect, other)), @"Wrong union at %lu.", i);
+		XCTAssertTrue(NSRect_isEqual(RectF(rect).centeredInRect(RectF(other)), NSRect_centeredInRect(rect, other)), @"Wrong centred rect at %lu.", i);
+		XCTAssertTrue(NSPoint_isEqual(RectF(rect).minPoint(), NSRect_minPoint(rect)), @"Wrong minimum point at %lu.", i);
+		XCTAssertTrue(NSPoint_isEqual(RectF(rect).maxPoint(), NSRect_maxPoint(rect)), @"Wrong maximum point at %lu.", i);
+	}
+}
+
+- (void)testRanges_matchC
+{
+	srand(3);
+	for (NSUInteger i = 0; i < 1 << 16; ++i)
+	{
+		const NSRange range = NSRange_init(CBHRandomLocation(), CBHRandomLocation());
+		const NSRange other = NSRange_init(CBHRandomLocation(), CBHRandomLocation());
+		const NSUInteger location = CBHRandomLocation();
+
+		XCTAssertEqual(RangeU(range).isLocationInRange(location), (bool)NSRange_isLocationInRange(range, location), @"Wrong containment at %lu.", i);
+		XCTAssertTrue(NSRange_isEqual(RangeU(range).intersection(RangeU(other)), NSRange_intersection(range, other)), @"Wrong intersection at %lu.", i);
+		XCTAssertTrue(NSRange_isEqual(RangeU(range).unionWith(RangeU(other)), NSRange_union(range, other)), @"Wrong union at %lu.", i);
+		XCTAssertEqual(RangeU(range).locationAtOffset(location % 50), NSRange_locationAtOffset(range, location % 50), @"Wrong location at %lu.", i);
+	}
+}
+
+@end
@@ -0,0 +1,182 @@
+//  CBHGeometryKitTests+CBHGeometryWriter.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+
+enum { kRectCount = 5000 };
+
+static void CBHFillRects(NSRect *rects, NSUInteger count, unsigned int seed)
+{
+	srand(seed);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		switch ( i % 3 )
+		{
+			case 0: rects[i] = NSRect_init((CGFloat)(rand() % 4000), (CGFloat)(rand() % 4000), (CGFloat)(rand() % 200) + 0.5, (CGFloat)(rand() % 200) + 0.25); break;
+			case 1: rects[i] = NSRect_init((CGFloat)rand() / 7.0, -(CGFloat)rand() / 1e9, 0.1 * (CGFloat)(rand() % 100), 1e-7 * (CGFloat)rand()); break;
+			default: rects[i] = NSRect_init(-0.0, 1.0 / 3.0, 123456789.123, 1e300); break;
+		}
+	}
+}
+
+
+@interface CBHGeometryKitTests_CBHGeometryWriter : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHGeometryWriter
+
+#pragma mark - Creating Writers
+
+- (void)testCreation_empty
+{
+	CBHGeometryWriter *writer = CBHGeometryWriter_create();
+
+	XCTAssertEqual(CBHGeometryWriter_length(writer), 0UL, @"Wrong length.");
+	XCTAssertTrue(CBHGeometryWriter_flush(writer), @"Flushing memory should succeed.");
+
+	CBHGeometryWriter_destroy(writer);
+}
+
+
+#pragma mark - Writing Values
+
+- (void)testWriting_lines
+{
+	NSPoint points[2] = { NSPoint_init(1.0, 2.5), NSPoint_init(-3.0, 0.1) };
+	NSSize sizes[1] = { NSSize_init(4.0, 5.0) };
+	NSRect rects[1] = { NSRect_init(1.0, 2.0, 3.0, 4.0) };
+	NSRange ranges[1] = { NSRange_init(6, 7) };
+	const char *expected = "{1, 2.5}\n{-3, 0.1}\n{4, 5}\n{{1, 2}, {3, 4}}\n{6, 7}\n";
+
+	CBHGeometryWriter *writer = CBHGeometryWriter_create();
+	XCTAssertTrue(CBHGeometryWriter_writePoints(writer, points, 2), @"Writing failed.");
+	XCTAssertTrue(CBHGeometryWriter_writeSizes(writer, sizes, 1), @"Writing failed.");
+	XCTAssertTrue(CBHGeometryWriter_writeRects(writer, rects, 1), @"Writing failed.");
+	XCTAssertTrue(CBHGeometryWriter_writeRanges(writer, ranges, 1), @"Writing failed.");
+
+	XCTAssertEqual(CBHGeometryWriter_length(writer), strlen(expected), @"Wrong length.");
+	XCTAssertEqual(memcmp(CBHGeometryWriter_bytes(writer), expected, strlen(expected)), 0, @"Wrong output.");
+
+	CBHGeometryWriter_destroy(writer);
+}
+
+- (void)testWriting_roundTrip
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kRectCount);
+	NSRect *parsed = malloc(sizeof(NSRect) * kRectCount);
+	CBHFillRects(rects, kRectCount, 3);
+
+	CBHGeometryWriter *writer = CBHGeometryWriter_create();
+	XCTAssertTrue(CBHGeometryWriter_writeRects(writer, rects, kRectCount), @"Writing failed.");
+
+	NSUInteger count = NSRect_parseLines(CBHGeometryWriter_bytes(writer), CBHGeometryWriter_length(writer), parsed, NULL, kRectCount);
+
+	XCTAssertEqual(count, (NSUInteger)kRectCount, @"Wrong line count.");
+	XCTAssertEqual(memcmp(rects, parsed, sizeof(NSRect) * kRectCount), 0, @"Every rect should survive the round trip.");
+
+	CBHGeometryWriter_destroy(writer);
+	free(rects);
+	free(parsed);
+}
+
+- (void)testWriting_fileDescriptor
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kRectCount);
+	CBHFillRects(rects, kRectCount, 4);
+
+	CBHGeometryWriter *expected = CBHGeometryWriter_create();
+	CBHGeometryWriter_writeRects(expected, rects, kRectCount);
+
+	char path[] = "/tmp/CBHGeometryWriter.XXXXXX";
+	int fileDescriptor = mkstemp(path);
+	XCTAssertGreaterThanOrEqual(fileDescriptor, 0, @"Could not create a temporary file.");
+
+	CBHGeometryWriter *writer = CBHGeometryWriter_createWithFileDescriptor(fileDescriptor);
+	XCTAssertTrue(CBHGeometryWriter_writeRects(writer, rects, kRectCount), @"Writing failed.");
+	XCTAssertTrue(CBHGeometryWriter_flush(writer), @"Flushing failed.");
+	XCTAssertTrue(CBHGeometryWriter_bytes(writer) == NULL, @"File descriptor writers do not keep their output.");
+	XCTAssertEqual(CBHGeometryWriter_length(writer), CBHGeometryWriter_length(expected), @"Wrong length.");
+	CBHGeometryWriter_destroy(writer);
+	close(fileDescriptor);
+
+	NSData *data = [NSData dataWithContentsOfFile:@(path)];
+	XCTAssertEqual([data length], CBHGeometryWriter_length(expected), @"Wrong file length.");
+	XCTAssertEqual(memcmp([data bytes], CBHGeometryWriter_bytes(expected), [data length]), 0, @"Wrong file contents.");
+
+	unlink(path);
+	CBHGeometryWriter_destroy(expected);
+	free(rects);
+}
+
+- (void)testWriting_failure
+{
+	NSRange ranges[1] = { NSRange_init(1, 2) };
+
+	int fileDescriptors[2];
+	XCTAssertEqual(pipe(fileDescriptors), 0, @"Could not create a pipe.");
+	close(fileDescriptors[1]);
+
+	CBHGeometryWriter *writer = CBHGeometryWriter_createWithFileDescriptor(fileDescriptors[1]);
+	XCTAssertTrue(CBHGeometryWriter_writeRanges(writer, ranges, 1), @"Writing is buffered.");
+	XCTAssertFalse(CBHGeometryWriter_flush(writer), @"Flushing to a closed descriptor should fail.");
+	XCTAssertFalse(CBHGeometryWriter_writeRanges(writer, ranges, 1), @"Failures should be sticky.");
+	CBHGeometryWriter_destroy(writer);
+
+	close(fileDescriptors[0]);
+}
+
+
+#pragma mark - Performance
+
+static const NSUInteger kPerformanceCount = 1 << 18;
+
+- (void)testPerformance_description
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	CBHFillRects(rects, kPerformanceCount, 7);
+
+	[self measureBlock:^{
+		NSMutableString *output = [NSMutableString string];
+		for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+		{
+			[output appendString:NSRect_description(rects[i])];
+			[output appendString:@"\n"];
+		}
+	}];
+
+	free(rects);
+}
+
+- (void)testPerformance_writer
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	CBHFillRects(rects, kPerformanceCount, 7);
+
+	[self measureBlock:^{
+		CBHGeometryWriter *writer = CBHGeometryWriter_create();
+		CBHGeometryWriter_writeRects(writer, rects, kPerformanceCount);
+		CBHGeometryWriter_destroy(writer);
+	}];
+
+	free(rects);
+}
+
+@end
@@ -0,0 +1,451 @@
+//  CBHGeometryKitTests+CBHHitGrid.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+
+#define CBHAssertEqualRects(result, expected) XCTAssertTrue(NSRect_isEqual(result, expected), @"The rects should be the same - result:%@ expected:%@", NSRect_description(result), NSRect_description(expected))
+
+
+enum { kRectCount = 1499 };
+
+static NSRect CBHRandomRect(void)
+{
+	// Quarter unit steps so edges coincide with points and cell boundaries. Some rects are empty, never hit, or too
+	// large for any cell.
+	switch ( rand() % 50 )
+	{
+		case 0: return NSRect_init(10.0, 10.0, 0.0, 5.0);
+		case 1: return NSRect_init(-INFINITY, 0.0, INFINITY, 10.0);
+		case 2: return NSRect_init(-100.0, -100.0, INFINITY, 1.0e40);
+		case 3: return NSRect_init(1.0e-300, -1.0e-300, 1.0e-310, 2.0);
+		default: return NSRect_init((CGFloat)(rand() % 800) / 4.0 - 100.0, (CGFloat)(rand() % 800) / 4.0 - 100.0, (CGFloat)(rand() % 120) / 4.0, (CGFloat)(rand() % 120) / 4.0);
+	}
+}
+
+static NSPoint CBHRandomPoint(const NSRect *rects)
+{
+	// Half the points lie on a corner or edge of a rect.
+	const NSRect rect = rects[(NSUInteger)rand() % kRectCount];
+	switch ( rand() % 6 )
+	{
+		case 0: return NSRect_minPoint(rect);
+		case 1: return NSPoint_init(NSRect_maxX(rect), NSRect_maxY(rect));
+		case 2: return NSPoint_init(NSRect_minX(rect), NSRect_maxY(rect));
+		default: return NSPoint_init((CGFloat)(rand() % 880) / 4.0 - 110.0, (CGFloat)(rand() % 880) / 4.0 - 110.0);
+	}
+}
+
+typedef struct CBHCollector
+{
+	NSUInteger indexes[kRectCount];
+	NSUInteger count;
+	NSUInteger limit;
+} CBHCollector;
+
+static void CBHCollect(NSUInteger index, void *context, BOOL *stop)
+{
+	CBHCollector *collector = context;
+	collector->indexes[collector->count++] = index;
+
+	if ( collector->count == collector->limit ) { *stop = YES; }
+}
+
+
+@interface CBHGeometryKitTests_CBHHitGrid : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHHitGrid
+{
+	NSRect _rects[kRectCount];
+	NSInteger _zIndexes[kRectCount];
+	BOOL _isLive[kRectCount];
+	CBHHitGrid *_grid;
+}
+
+- (void)setUp
+{
+	srand(91);
+	for (NSUInteger i = 0; i < kRectCount; ++i)
+	{
+		_rects[i] = CBHRandomRect();
+		_zIndexes[i] = 0;
+		_isLive[i] = YES;
+	}
+
+	_grid = CBHHitGrid_createWithRects(_rects, kRectCount);
+	XCTAssertTrue(_grid != NULL, @"Creation should succeed.");
+}
+
+- (void)tearDown
+{
+	CBHHitGrid_destroy(_grid);
+}
+
+- (BOOL)isIndex:(NSUInteger)index aboveIndex:(NSUInteger)other
+{
+	return ( _zIndexes[index] > _zIndexes[other] ) || ( _zIndexes[index] == _zIndexes[other] && index > other );
+}
+
+// Loops over every rect, keeping the hits sorted topmost first.
+- (NSUInteger)expectedHits:(NSUInteger *)hits atPoint:(NSPoint)point flipped:(BOOL)flipped
+{
+	NSUInteger count = 0;
+	for (NSUInteger i = 0; i < kRectCount; ++i)
+	{
+		if ( !_isLive[i] || !NSRect_isMouseInRect(_rects[i], point, flipped) ) { continue; }
+
+		NSUInteger position = count++;
+		for (; position > 0 && [self isIndex:i aboveIndex:hits[position - 1]]; --position) { hits[position] = hits[position - 1]; }
+		hits[position] = i;
+	}
+
+	return count;
+}
+
+- (void)assertHitsMatchRects
+{
+	NSUInteger expected[kRectCount];
+	NSUInteger indexes[kRectCount];
+
+	for (NSUInteger q = 0; q < 400; ++q)
+	{
+		const NSPoint point = CBHRandomPoint(_rects);
+		const BOOL flipped = ( q % 2 == 0 );
+		const NSUInteger expectedCount = [self expectedHits:expected atPoint:point flipped:flipped];
+
+		const NSUInteger topmost = CBHHitGrid_topmostIndexAtPoint(_grid, point, flipped);
+		XCTAssertEqual(topmost, ( expectedCount > 0 ) ? expected[0] : NSNotFound, @"Wrong topmost hit.");
+
+		const NSUInteger count = CBHHitGrid_hitIndexes(_grid, point, flipped, indexes, kRectCount);
+		XCTAssertEqual(count, expectedCount, @"Wrong hit count.");
+		for (NSUInteger i = 0; i < MIN(count, expectedCount); ++i)
+		{
+			XCTAssertEqual(indexes[i], expected[i], @"Hits should be topmost first.");
+		}
+	}
+}
+
+
+#pragma mark - Creating Hit Grids
+
+- (void)testCreation_empty
+{
+	CBHHitGrid *grid = CBHHitGrid_create();
+
+	XCTAssertEqual(CBHHitGrid_count(grid), 0UL, @"Wrong count.");
+	XCTAssertEqual(CBHHitGrid_topmostIndexAtPoint(grid, NSPoint_init(0.0, 0.0), NO), (NSUInteger)NSNotFound, @"An empty grid holds nothing.");
+	XCTAssertEqual(CBHHitGrid_hitIndexes(grid, NSPoint_init(0.0, 0.0), YES, NULL, 0), 0UL, @"An empty grid holds nothing.");
+	CBHAssertEqualRects(CBHHitGrid_rectAtIndex(grid, 0), NSZeroRect);
+
+	CBHHitGrid_destroy(grid);
+}
+
+- (void)testCreation_stacking
+{
+	XCTAssertEqual(CBHHitGrid_count(_grid), (NSUInteger)kRectCount, @"Wrong count.");
+	CBHAssertEqualRects(CBHHitGrid_rectAtIndex(_grid, 7), _rects[7]);
+	XCTAssertEqual(CBHHitGrid_zIndexAtIndex(_grid, 7), 0L, @"Rects from an array have a z-index of 0.");
+
+	[self assertHitsMatchRects];
+}
+
+- (void)testCreation_unhittableRects
+{
+	NSRect rects[3] = { NSRect_init(0.0, 0.0, 0.0, 4.0), NSRect_init(0.0, 0.0, 4.0, NAN), NSRect_init(INFINITY, 0.0, 4.0, 4.0) };
+	CBHHitGrid *grid = CBHHitGrid_createWithRects(rects, 3);
+
+	XCTAssertEqual(CBHHitGrid_count(grid), 3UL, @"Wrong count.");
+	CBHAssertEqualRects(CBHHitGrid_rectAtIndex(grid, 0), rects[0]);
+	XCTAssertEqual(CBHHitGrid_hitIndexes(grid, NSPoint_init(0.0, 1.0), YES, NULL, 0), 0UL, @"These rects are never hit.");
+	XCTAssertEqual(CBHHitGrid_hitIndexes(grid, NSPoint_init(INFINITY, 1.0), YES, NULL, 0), 0UL, @"These rects are never hit.");
+
+	CBHHitGrid_destroy(grid);
+}
+
+
+#pragma mark - Modifying Hit Grids
+
+- (void)testModifying_churn
+{
+	srand(92);
+	for (NSUInteger round = 0; round < 8; ++round)
+	{
+		for (NSUInteger i = 0; i < 1000; ++i)
+		{
+			NSUInteger index = (NSUInteger)rand() % kRectCount;
+
+			if ( !_isLive[index] )
+			{
+				NSRect rect = CBHRandomRect();
+				NSInteger zIndex = rand() % 5 - 2;
+				NSUInteger inserted = CBHHitGrid_insertRect(_grid, rect, zIndex);
+
+				XCTAssertLessThan(inserted, (NSUInteger)kRectCount, @"Removed indexes should be reused.");
+				XCTAssertFalse(_isLive[inserted], @"Live indexes should not be reused.");
+				_rects[inserted] = rect;
+				_zIndexes[inserted] = zIndex;
+				_isLive[inserted] = YES;
+				continue;
+			}
+
+			switch ( rand() % 4 )
+			{
+				case 0:
+					XCTAssertTrue(CBHHitGrid_removeIndex(_grid, index), @"Removing failed.");
+					XCTAssertFalse(CBHHitGrid_removeIndex(_grid, index), @"An index can only be removed once.");
+					_isLive[index] = NO;
+					break;
+
+				case 1:
+					_zIndexes[index] = rand() % 5 - 2;
+					XCTAssertTrue(CBHHitGrid_setZIndex(_grid, index, _zIndexes[index]), @"Restacking failed.");
+					break;
+
+				case 2:
+					_rects[index] = CBHRandomRect();
+					XCTAssertTrue(CBHHitGrid_setRect(_grid, index, _rects[index]), @"Moving failed.");
+					break;
+
+				default:
+					_rects[index] = NSRect_offset(_rects[index], (CGFloat)(rand() % 9 - 4) / 4.0, (CGFloat)(rand() % 9 - 4) / 4.0);
+					XCTAssertTrue(CBHHitGrid_setRect(_grid, index, _rects[index]), @"Moving failed.");
+					break;
+			}
+		}
+
+		[self assertHitsMatchRects];
+	}
+
+	NSUInteger liveCount = 0;
+	for (NSUInteger i = 0; i < kRectCount; ++i)
+	{
+		if ( _isLive[i] ) { liveCount += 1; }
+	}
+	XCTAssertEqual(CBHHitGrid_count(_grid), liveCount, @"Wrong count.");
+}
+
+- (void)testModifying_unusedIndexes
+{
+	CBHHitGrid_removeIndex(_grid, 5);
+
+	XCTAssertFalse(CBHHitGrid_setRect(_grid, 5, NSRect_init(0.0, 0.0, 1.0, 1.0)), @"Unused indexes cannot be moved.");
+	XCTAssertFalse(CBHHitGrid_setZIndex(_grid, 5, 1), @"Unused indexes cannot be restacked.");
+	XCTAssertFalse(CBHHitGrid_setRect(_grid, kRectCount, NSRect_init(0.0, 0.0, 1.0, 1.0)), @"Unused indexes cannot be moved.");
+	CBHAssertEqualRects(CBHHitGrid_rectAtIndex(_grid, 5), NSZeroRect);
+	XCTAssertEqual(CBHHitGrid_zIndexAtIndex(_grid, kRectCount), 0L, @"Unused indexes have a z-index of 0.");
+}
+
+
+#pragma mark - Finding Hits
+
+- (void)testHits_flipped
+{
+	CBHHitGrid *grid = CBHHitGrid_create();
+	CBHHitGrid_insertRect(grid, NSRect_init(0.0, 0.0, 8.0, 8.0), 0);
+	CBHHitGrid_insertRect(grid, NSRect_init(0.0, 8.0, 8.0, 8.0), 0);
+
+	XCTAssertEqual(CBHHitGrid_topmostIndexAtPoint(grid, NSPoint_init(4.0, 8.0), YES), 1UL, @"Flipped rects hold their lower edge.");
+	XCTAssertEqual(CBHHitGrid_topmostIndexAtPoint(grid, NSPoint_init(4.0, 8.0), NO), 0UL, @"Unflipped rects hold their upper edge.");
+	XCTAssertEqual(CBHHitGrid_topmostIndexAtPoint(grid, NSPoint_init(4.0, 0.0), NO), (NSUInteger)NSNotFound, @"Unflipped rects exclude their lower edge.");
+	XCTAssertEqual(CBHHitGrid_topmostIndexAtPoint(grid, NSPoint_init(8.0, 4.0), YES), (NSUInteger)NSNotFound, @"Rects exclude their right edge.");
+	XCTAssertEqual(CBHHitGrid_topmostIndexAtPoint(grid, NSPoint_init(4.0, NAN), YES), (NSUInteger)NSNotFound, @"Nothing holds a NaN point.");
+
+	CBHHitGrid_destroy(grid);
+}
+
+- (void)testHits_zIndexes
+{
+	CBHHitGrid *grid = CBHHitGrid_create();
+	CBHHitGrid_insertRect(grid, NSRect_init(0.0, 0.0, 100.0, 100.0), 2);
+	CBHHitGrid_insertRect(grid, NSRect_init(10.0, 10.0, 1.0, 1.0), 1);
+	CBHHitGrid_insertRect(grid, NSRect_init(-1.0e9, -1.0e9, 2.0e9, 2.0e9), 1);
+
+	NSUInteger indexes[3];
+	XCTAssertEqual(CBHHitGrid_hitIndexes(grid, NSPoint_init(10.5, 10.5), NO, indexes, 3), 3UL, @"Wrong hit count.");
+	XCTAssertTrue(indexes[0] == 0 && indexes[1] == 2 && indexes[2] == 1, @"Hits should be sorted by z-index and then by index.");
+
+	CBHHitGrid_setZIndex(grid, 1, 3);
+	XCTAssertEqual(CBHHitGrid_topmostIndexAtPoint(grid, NSPoint_init(10.5, 10.5), NO), 1UL, @"Restacking should raise the rect.");
+
+	CBHHitGrid_setRect(grid, 1, NSRect_init(50.0, 50.0, 1.0, 1.0));
+	XCTAssertEqual(CBHHitGrid_topmostIndexAtPoint(grid, NSPoint_init(10.5, 10.5), NO), 0UL, @"Moving should uncover the rect below.");
+
+	CBHHitGrid_destroy(grid);
+}
+
+- (void)testHits_capacity
+{
+	CBHHitGrid *grid = CBHHitGrid_create();
+	for (NSUInteger i = 0; i < 100; ++i)
+	{
+		CBHHitGrid_insertRect(grid, NSRect_init(-(CGFloat)i, -(CGFloat)i, 2.0 * i + 1.0, 2.0 * i + 1.0), (NSInteger)(i % 7));
+	}
+
+	NSUInteger all[100];
+	NSUInteger some[10];
+	XCTAssertEqual(CBHHitGrid_hitIndexes(grid, NSPoint_init(0.5, 0.5), NO, all, 100), 100UL, @"Every rect holds the point.");
+	XCTAssertEqual(CBHHitGrid_hitIndexes(grid, NSPoint_init(0.5, 0.5), NO, some, 10), 100UL, @"The total should not depend on capacity.");
+	XCTAssertEqual(memcmp(all, some, sizeof(some)), 0, @"A short buffer should hold the topmost hits.");
+
+	CBHHitGrid_destroy(grid);
+}
+
+
+#pragma mark - Enumerating Hits
+
+- (void)testEnumeration_order
+{
+	CBHHitGrid *grid = CBHHitGrid_create();
+	for (NSUInteger i = 0; i < 300; ++i)
+	{
+		CBHHitGrid_insertRect(grid, NSRect_init(-(CGFloat)i, -(CGFloat)i, 2.0 * i + 1.0, 2.0 * i + 1.0), (NSInteger)(i * 7 % 13));
+	}
+
+	NSUInteger expected[300];
+	CBHCollector collector = { .count = 0, .limit = kRectCount };
+	XCTAssertEqual(CBHHitGrid_hitIndexes(grid, NSPoint_init(0.5, 0.5), YES, expected, 300), 300UL, @"Every rect holds the point.");
+	CBHHitGrid_enumerateHits(grid, NSPoint_init(0.5, 0.5), YES, CBHCollect, &collector);
+
+	XCTAssertEqual(collector.count, 300UL, @"Every hit should be enumerated.");
+	XCTAssertEqual(memcmp(collector.indexes, expected, sizeof(expected)), 0, @"Hits should be enumerated topmost first.");
+
+	CBHHitGrid_destroy(grid);
+}
+
+- (void)testEnumeration_stop
+{
+	CBHCollector collector = { .count = 0, .limit = 2 };
+	for (NSUInteger i = 0; i < 3; ++i)
+	{
+		CBHHitGrid_insertRect(_grid, NSRect_init(999.0, 999.0, 2.0, 2.0), 0);
+	}
+
+	CBHHitGrid_enumerateHits(_grid, NSPoint_init(1000.0, 1000.0), NO, CBHCollect, &collector);
+
+	XCTAssertEqual(collector.count, 2UL, @"Enumeration should stop when asked.");
+}
+
+
+#pragma mark - Performance
+
+static const NSUInteger kPerformanceCount = 200000;
+static const NSUInteger kPerformanceLoopQueries = 100;
+static const NSUInteger kPerformanceGridQueries = 100000;
+
+static void CBHFillViews(NSRect *rects, NSUInteger count)
+{
+	// Views scattered over a large canvas, each overlapping a few others.
+	srand(93);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		rects[i] = NSRect_init((CGFloat)(rand() % 100000) / 10.0, (CGFloat)(rand() % 100000) / 10.0, 5.0 + rand() % 10, 5.0 + rand() % 10);
+	}
+}
+
+static NSPoint CBHQueryPoint(NSUInteger q)
+{
+	return NSPoint_init((CGFloat)((q * 7919) % 100000) / 10.0, (CGFloat)((q * 104729) % 100000) / 10.0);
+}
+
+- (void)testPerformance_topmostLoop
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	CBHFillViews(rects, kPerformanceCount);
+
+	[self measureBlock:^{
+		for (NSUInteger q = 0; q < kPerformanceLoopQueries; ++q)
+		{
+			const NSPoint point = CBHQueryPoint(q);
+			for (NSUInteger i = kPerformanceCount; i-- > 0;)
+			{
+				if ( NSRect_isMouseInRect(rects[i], point, NO) ) { break; }
+			}
+		}
+	}];
+
+	free(rects);
+}
+
+- (void)testPerformance_topmostGrid
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	CBHFillViews(rects, kPerformanceCount);
+
+	CBHHitGrid *grid = CBHHitGrid_createWithRects(rects, kPerformanceCount);
+
+	[self measureBlock:^{
+		for (NSUInteger q = 0; q < kPerformanceGridQueries; ++q)
+		{
+			CBHHitGrid_topmostIndexAtPoint(grid, CBHQueryPoint(q), NO);
+		}
+	}];
+
+	CBHHitGrid_destroy(grid);
+	free(rects);
+}
+
+- (void)testPerformance_churn
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	NSUInteger *indexes = malloc(sizeof(NSUInteger) * kPerformanceCount);
+	CBHFillViews(rects, kPerformanceCount);
+
+	CBHHitGrid *grid = CBHHitGrid_createWithRects(rects, kPerformanceCount);
+
+	// Each frame moves every view, replaces a tenth of them, and hit-tests a few thousand points.
+	[self measureBlock:^{
+		for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+		{
+			rects[i] = NSRect_offset(rects[i], (CGFloat)(rand() % 9 - 4), (CGFloat)(rand() % 9 - 4));
+			CBHHitGrid_setRect(grid, i, rects[i]);
+		}
+
+		for (NSUInteger i = 0; i < kPerformanceCount / 10; ++i)
+		{
+			const NSUInteger index = (NSUInteger)rand() % kPerformanceCount;
+			CBHHitGrid_removeIndex(grid, index);
+			CBHHitGrid_insertRect(grid, rects[index], rand() % 4);
+		}
+
+		for (NSUInteger q = 0; q < 4096; ++q)
+		{
+			CBHHitGrid_hitIndexes(grid, CBHQueryPoint(q + (NSUInteger)rand()), NO, indexes, kPerformanceCount);
+		}
+	}];
+
+	CBHHitGrid_destroy(grid);
+	free(rects);
+	free(indexes);
+}
+
+- (void)testPerformance_creation
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	CBHFillViews(rects, kPerformanceCount);
+
+	[self measureBlock:^{
+		CBHHitGrid_destroy(CBHHitGrid_createWithRects(rects, kPerformanceCount));
+	}];
+
+	free(rects);
+}
+
+@end
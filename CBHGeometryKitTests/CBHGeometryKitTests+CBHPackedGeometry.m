@@ -0,0 +1,328 @@
+//  CBHGeometryKitTests+CBHPackedGeometry.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+
+static const NSUInteger kElementCount = 5000;
+static const NSUInteger kPerformanceCount = 1 << 20;
+
+static CGFloat CBHRandomValue(CGFloat scale)
+{
+	return ((CGFloat)rand() / (CGFloat)RAND_MAX * 2.0 - 1.0) * scale;
+}
+
+static void CBHFillPoints(NSPoint *points, NSUInteger count, CGFloat offset, unsigned int seed)
+{
+	srand(seed);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		points[i] = NSPoint_init(offset + CBHRandomValue(500.0), -offset + CBHRandomValue(500.0));
+	}
+}
+
+static void CBHFillRects(NSRect *rects, NSUInteger count, unsigned int seed)
+{
+	srand(seed);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		rects[i] = NSRect_init(CBHRandomValue(500.0), CBHRandomValue(500.0), CBHRandomValue(40.0), CBHRandomValue(40.0));
+	}
+}
+
+
+@interface CBHGeometryKitTests_CBHPackedGeometry : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHPackedGeometry
+
+#pragma mark - Creating
+
+- (void)testCreate_invalidFormat
+{
+	const NSPoint point = NSPoint_init(1.0, 2.0);
+	const NSRect rect = NSRect_init(1.0, 2.0, 3.0, 4.0);
+
+	XCTAssertTrue(CBHPackedPoints_create(&point, 1, (CBHPackedFormat)7) == NULL);
+	XCTAssertTrue(CBHPackedRects_create(&rect, 1, (CBHPackedFormat)-1) == NULL);
+}
+
+- (void)testCreate_empty
+{
+	CBHPackedPoints *points = CBHPackedPoints_create(NULL, 0, CBHPackedFormatUInt16);
+	CBHPackedRects *rects = CBHPackedRects_create(NULL, 0, CBHPackedFormatUInt16);
+
+	XCTAssertEqual(CBHPackedPoints_count(points), 0UL);
+	XCTAssertTrue(NSRect_isEqual(CBHPackedPoints_bounds(points), NSRect_initEmpty()));
+	XCTAssertEqual(CBHPackedPoints_inRectIndexes(points, NSRect_init(-1.0, -1.0, 2.0, 2.0), NULL, 0), 0UL);
+
+	XCTAssertEqual(CBHPackedRects_count(rects), 0UL);
+	XCTAssertTrue(NSRect_isEqual(CBHPackedRects_bounds(rects), NSRect_initEmpty()));
+	XCTAssertEqual(CBHPackedRects_containingPointIndexes(rects, NSPoint_init(0.0, 0.0), NULL, 0), 0UL);
+
+	CBHPackedPoints_destroy(points);
+	CBHPackedRects_destroy(rects);
+	CBHPackedPoints_destroy(NULL);
+	CBHPackedRects_destroy(NULL);
+}
+
+
+#pragma mark - Quantization
+
+- (void)assertErrorOfFormat:(CBHPackedFormat)format divisor:(CGFloat)divisor
+{
+	NSPoint *points = malloc(sizeof(NSPoint) * kElementCount);
+	NSPoint *decoded = malloc(sizeof(NSPoint) * kElementCount);
+	CBHFillPoints(points, kElementCount, 1e6, 1);
+
+	CBHPackedPoints *packed = CBHPackedPoints_create(points, kElementCount, format);
+	XCTAssertEqual(CBHPackedPoints_format(packed), format);
+	CBHPackedPoints_unpack(packed, NSMakeRange(0, kElementCount), decoded);
+
+	NSPoint measured = NSPoint_init(0.0, 0.0);
+	for (NSUInteger i = 0; i < kElementCount; ++i)
+	{
+		measured.x = MAX(measured.x, fabs(decoded[i].x - points[i].x));
+		measured.y = MAX(measured.y, fabs(decoded[i].y - points[i].y));
+	}
+
+	const NSPoint error = CBHPackedPoints_maximumError(packed);
+	XCTAssertEqual(error.x, measured.x);
+	XCTAssertEqual(error.y, measured.y);
+
+	// The spread of every block is at most 1000, and decoding 1e6 rounds by up to half a double step.
+	const CGFloat bound = 1000.0 / divisor + 1.2e-10;
+	XCTAssertLessThanOrEqual(error.x, bound);
+	XCTAssertLessThanOrEqual(error.y, bound);
+
+	CBHPackedPoints_destroy(packed);
+	free(points);
+	free(decoded);
+}
+
+- (void)testQuantization_float32
+{
+	[self assertErrorOfFormat:CBHPackedFormatFloat32 divisor:33554432.0];
+}
+
+- (void)testQuantization_uint16
+{
+	[self assertErrorOfFormat:CBHPackedFormatUInt16 divisor:131070.0];
+}
+
+- (void)testQuantization_uint32
+{
+	[self assertErrorOfFormat:CBHPackedFormatUInt32 divisor:8589934590.0];
+}
+
+- (void)testQuantization_constant
+{
+	NSPoint points[2000];
+	for (NSUInteger i = 0; i < 2000; ++i) { points[i] = NSPoint_init(12.345, -6.7); }
+
+	CBHPackedPoints *packed = CBHPackedPoints_create(points, 2000, CBHPackedFormatUInt16);
+
+	XCTAssertTrue(NSPoint_isEqual(CBHPackedPoints_maximumError(packed), NSPoint_init(0.0, 0.0)));
+	XCTAssertTrue(NSPoint_isEqual(CBHPackedPoints_pointAtIndex(packed, 1999), points[1999]));
+
+	CBHPackedPoints_destroy(packed);
+}
+
+- (void)testByteCount
+{
+	NSPoint *points = malloc(sizeof(NSPoint) * kElementCount);
+	CBHFillPoints(points, kElementCount, 0.0, 2);
+
+	CBHPackedPoints *floats = CBHPackedPoints_create(points, kElementCount, CBHPackedFormatFloat32);
+	CBHPackedPoints *shorts = CBHPackedPoints_create(points, kElementCount, CBHPackedFormatUInt16);
+
+	XCTAssertLessThan(CBHPackedPoints_byteCount(floats), sizeof(NSPoint) * kElementCount * 55 / 100);
+	XCTAssertLessThan(CBHPackedPoints_byteCount(shorts), sizeof(NSPoint) * kElementCount * 30 / 100);
+
+	CBHPackedPoints_destroy(floats);
+	CBHPackedPoints_destroy(shorts);
+	free(points);
+}
+
+
+#pragma mark - Packed Points
+
+- (void)testPoints_decoding
+{
+	NSPoint *points = malloc(sizeof(NSPoint) * kElementCount);
+	NSPoint *decoded = malloc(sizeof(NSPoint) * kElementCount);
+	CBHFillPoints(points, kElementCount, 0.0, 3);
+
+	CBHPackedPoints *packed = CBHPackedPoints_create(points, kElementCount, CBHPackedFormatUInt16);
+	CBHPackedPoints_unpack(packed, NSMakeRange(0, kElementCount), decoded);
+
+	for (NSUInteger i = 0; i < kElementCount; ++i)
+	{
+		XCTAssertTrue(NSPoint_isEqual(CBHPackedPoints_pointAtIndex(packed, i), decoded[i]), @"Point %lu should decode the same way.", (unsigned long)i);
+	}
+
+	NSPoint range[5];
+	CBHPackedPoints_unpack(packed, NSMakeRange(1021, 5), range);
+	XCTAssertEqual(memcmp(range, decoded + 1021, sizeof(range)), 0, @"A range across blocks should decode the same way.");
+
+	CBHPackedPoints_destroy(packed);
+	free(points);
+	free(decoded);
+}
+
+- (void)testPoints_queriesMatchDecoded
+{
+	NSPoint *points = malloc(sizeof(NSPoint) * kElementCount);
+	NSPoint *decoded = malloc(sizeof(NSPoint) * kElementCount);
+	CGFloat *distances = malloc(sizeof(CGFloat) * kElementCount);
+	CGFloat *expected = malloc(sizeof(CGFloat) * kElementCount);
+	NSUInteger *indexes = malloc(sizeof(NSUInteger) * kElementCount);
+	CBHFillPoints(points, kElementCount, 0.0, 4);
+
+	CBHPackedPoints *packed = CBHPackedPoints_create(points, kElementCount, CBHPackedFormatUInt16);
+	CBHPackedPoints_unpack(packed, NSMakeRange(0, kElementCount), decoded);
+
+	XCTAssertTrue(NSRect_isEqual(CBHPackedPoints_bounds(packed), NSRect_boundingRectOfPoints(decoded, kElementCount)));
+
+	const NSPoint point = NSPoint_init(12.0, -40.0);
+	CBHPackedPoints_distancesSquaredToPoint(packed, point, distances);
+	NSPoint_distancesSquaredToPoints(point, decoded, expected, kElementCount);
+	XCTAssertEqual(memcmp(distances, expected, sizeof(CGFloat) * kElementCount), 0, @"The distances should match the decoded points.");
+
+	const NSRect queries[] = { NSRect_init(-100.0, -50.0, 150.0, 80.0), NSRect_init(-1000.0, -1000.0, 2000.0, 2000.0), NSRect_init(0.0, 0.0, 0.0, 0.0) };
+
+	for (NSUInteger q = 0; q < sizeof(queries) / sizeof(*queries); ++q)
+	{
+		const NSUInteger count = CBHPackedPoints_inRectIndexes(packed, queries[q], indexes, kElementCount);
+		NSUInteger next = 0;
+
+		for (NSUInteger i = 0; i < kElementCount; ++i)
+		{
+			if ( !NSRect_isPointInRect(queries[q], decoded[i]) ) { continue; }
+			XCTAssertEqual(indexes[next], i);
+			next += 1;
+		}
+
+		XCTAssertEqual(count, next);
+	}
+
+	XCTAssertEqual(CBHPackedPoints_inRectIndexes(packed, queries[1], NULL, 0), kElementCount);
+
+	CBHPackedPoints_destroy(packed);
+	free(points);
+	free(decoded);
+	free(distances);
+	free(expected);
+	free(indexes);
+}
+
+
+#pragma mark - Packed Rects
+
+- (void)testRects_queriesMatchDecoded
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kElementCount);
+	NSRect *decoded = malloc(sizeof(NSRect) * kElementCount);
+	NSUInteger *indexes = malloc(sizeof(NSUInteger) * kElementCount);
+	CBHFillRects(rects, kElementCount, 5);
+
+	CBHPackedRects *packed = CBHPackedRects_create(rects, kElementCount, CBHPackedFormatFloat32);
+	CBHPackedRects_unpack(packed, NSMakeRange(0, kElementCount), decoded);
+
+	NSRect error = NSRect_init(0.0, 0.0, 0.0, 0.0);
+	for (NSUInteger i = 0; i < kElementCount; ++i)
+	{
+		XCTAssertTrue(NSRect_isEqual(CBHPackedRects_rectAtIndex(packed, i), decoded[i]));
+		error.origin.x = MAX(error.origin.x, fabs(decoded[i].origin.x - rects[i].origin.x));
+		error.origin.y = MAX(error.origin.y, fabs(decoded[i].origin.y - rects[i].origin.y));
+		error.size.width = MAX(error.size.width, fabs(decoded[i].size.width - rects[i].size.width));
+		error.size.height = MAX(error.size.height, fabs(decoded[i].size.height - rects[i].size.height));
+	}
+
+	XCTAssertTrue(NSRect_isEqual(CBHPackedRects_maximumError(packed), error));
+	XCTAssertTrue(NSRect_isEqual(CBHPackedRects_bounds(packed), NSRect_unionOfRects(decoded, kElementCount)));
+
+	const NSRect query = NSRect_init(-60.0, 10.0, 90.0, 45.0);
+	NSUInteger count = CBHPackedRects_intersectingIndexes(packed, query, indexes, kElementCount);
+	NSUInteger next = 0;
+
+	for (NSUInteger i = 0; i < kElementCount; ++i)
+	{
+		if ( !NSRect_isIntersecting(decoded[i], query) ) { continue; }
+		XCTAssertEqual(indexes[next], i);
+		next += 1;
+	}
+
+	XCTAssertGreaterThan(count, 0UL);
+	XCTAssertEqual(count, next);
+
+	const NSPoint point = NSPoint_init(3.0, -7.0);
+	count = CBHPackedRects_containingPointIndexes(packed, point, indexes, kElementCount);
+	next = 0;
+
+	for (NSUInteger i = 0; i < kElementCount; ++i)
+	{
+		if ( !NSRect_isPointInRect(decoded[i], point) ) { continue; }
+		XCTAssertEqual(indexes[next], i);
+		next += 1;
+	}
+
+	XCTAssertEqual(count, next);
+
+	CBHPackedRects_destroy(packed);
+	free(rects);
+	free(decoded);
+	free(indexes);
+}
+
+
+#pragma mark - Performance
+
+- (void)testPerformance_createUInt16
+{
+	NSPoint *points = malloc(sizeof(NSPoint) * kPerformanceCount);
+	CBHFillPoints(points, kPerformanceCount, 0.0, 6);
+
+	[self measureBlock:^{
+		CBHPackedPoints_destroy(CBHPackedPoints_create(points, kPerformanceCount, CBHPackedFormatUInt16));
+	}];
+
+	free(points);
+}
+
+- (void)testPerformance_inRectIndexesUInt16
+{
+	NSPoint *points = malloc(sizeof(NSPoint) * kPerformanceCount);
+	NSUInteger *indexes = malloc(sizeof(NSUInteger) * kPerformanceCount);
+	CBHFillPoints(points, kPerformanceCount, 0.0, 7);
+
+	CBHPackedPoints *packed = CBHPackedPoints_create(points, kPerformanceCount, CBHPackedFormatUInt16);
+	const NSRect query = NSRect_init(-100.0, -100.0, 200.0, 200.0);
+
+	[self measureBlock:^{
+		CBHPackedPoints_inRectIndexes(packed, query, indexes, kPerformanceCount);
+	}];
+
+	CBHPackedPoints_destroy(packed);
+	free(points);
+	free(indexes);
+}
+
+@end
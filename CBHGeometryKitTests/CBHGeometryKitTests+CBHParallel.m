@@ -0,0 +1,276 @@
+//  CBHGeometryKitTests+CBHParallel.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+#import <stdatomic.h>
+
+
+static const NSUInteger kBatchCount = 300001;
+static const NSUInteger kPerformanceCount = 1 << 22;
+
+static CGFloat CBHRandomValue(void)
+{
+	return (CGFloat)rand() / (CGFloat)RAND_MAX * 200.0 - 100.0;
+}
+
+static void CBHFillPoints(NSPoint *points, NSUInteger count, unsigned int seed)
+{
+	srand(seed);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		points[i] = NSPoint_init(CBHRandomValue(), CBHRandomValue());
+	}
+}
+
+typedef struct CBHCoverage
+{
+	_Atomic(NSUInteger) *visits;
+	_Atomic(NSUInteger) calls;
+	NSUInteger offset;
+} CBHCoverage;
+
+static void CBHCover(void *context, NSRange range)
+{
+	CBHCoverage *coverage = context;
+	atomic_fetch_add(&coverage->calls, 1);
+
+	for (NSUInteger i = range.location; i < NSMaxRange(range); ++i)
+	{
+		atomic_fetch_add(&coverage->visits[coverage->offset + i], 1);
+	}
+}
+
+static void CBHCoverNested(void *context, NSRange range)
+{
+	CBHCoverage *outer = context;
+	CBHCoverage inner = { .visits = outer->visits, .offset = range.location };
+	atomic_init(&inner.calls, 0);
+
+	CBHParallel_apply(range.length, &inner, CBHCover);
+	atomic_fetch_add(&outer->calls, atomic_load(&inner.calls));
+}
+
+
+@interface CBHGeometryKitTests_CBHParallel : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHParallel
+
+- (void)tearDown
+{
+	CBHParallel_setThreadCount(0);
+	CBHParallel_setGrainSize(0);
+}
+
+- (void)assertCoverageOfCount:(NSUInteger)count function:(CBHParallelFunction)function expectedCalls:(NSUInteger)expectedCalls
+{
+	_Atomic(NSUInteger) *visits = calloc(MAX(count, 1UL), sizeof(_Atomic(NSUInteger)));
+	CBHCoverage coverage = { .visits = visits, .offset = 0 };
+	atomic_init(&coverage.calls, 0);
+
+	CBHParallel_apply(count, &coverage, function);
+
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		XCTAssertEqual(atomic_load(&visits[i]), 1UL, @"Index %lu should be visited once.", (unsigned long)i);
+		if ( atomic_load(&visits[i]) != 1 ) { break; }
+	}
+
+	XCTAssertEqual(atomic_load(&coverage.calls), expectedCalls, @"The function should be called once per range.");
+
+	free(visits);
+}
+
+
+#pragma mark - Configuration
+
+- (void)testConfiguration_defaults
+{
+	XCTAssertGreaterThanOrEqual(CBHParallel_threadCount(), 1UL);
+	XCTAssertEqual(CBHParallel_grainSize(), 32768UL);
+}
+
+- (void)testConfiguration_settings
+{
+	CBHParallel_setThreadCount(3);
+	CBHParallel_setGrainSize(100);
+
+	XCTAssertEqual(CBHParallel_threadCount(), 3UL);
+	XCTAssertEqual(CBHParallel_grainSize(), 100UL);
+
+	CBHParallel_setGrainSize(0);
+	XCTAssertEqual(CBHParallel_grainSize(), 32768UL);
+}
+
+
+#pragma mark - Running Operations
+
+- (void)testApply_coversEveryIndexOnce
+{
+	const NSUInteger threadCounts[] = { 1, 2, 3, 8 };
+	const NSUInteger grainSizes[] = { 1, 7, 1000 };
+	const NSUInteger counts[] = { 1, 2, 999, 1000, 1001, 1999, 2000, 123457 };
+
+	for (NSUInteger t = 0; t < sizeof(threadCounts) / sizeof(*threadCounts); ++t)
+	{
+		for (NSUInteger g = 0; g < sizeof(grainSizes) / sizeof(*grainSizes); ++g)
+		{
+			CBHParallel_setThreadCount(threadCounts[t]);
+			CBHParallel_setGrainSize(grainSizes[g]);
+
+			for (NSUInteger c = 0; c < sizeof(counts) / sizeof(*counts); ++c)
+			{
+				const NSUInteger count = counts[c];
+				const BOOL isSplit = ( threadCounts[t] > 1 && count >= 2 * grainSizes[g] );
+				const NSUInteger calls = ( isSplit ) ? (count + grainSizes[g] - 1) / grainSizes[g] : 1;
+
+				[self assertCoverageOfCount:count function:CBHCover expectedCalls:calls];
+			}
+		}
+	}
+}
+
+- (void)testApply_empty
+{
+	CBHParallel_setGrainSize(1);
+	[self assertCoverageOfCount:0 function:CBHCover expectedCalls:0];
+}
+
+- (void)testApply_nested
+{
+	CBHParallel_setThreadCount(4);
+	CBHParallel_setGrainSize(100);
+
+	// Inner operations run on their calling thread, so each outer range is one inner call.
+	[self assertCoverageOfCount:100000 function:CBHCoverNested expectedCalls:1000];
+}
+
+
+#pragma mark - Batched Functions
+
+- (void)testBatches_matchSerial
+{
+	NSPoint *starts = malloc(sizeof(NSPoint) * kBatchCount);
+	NSPoint *ends = malloc(sizeof(NSPoint) * kBatchCount);
+	NSPoint *serialPoints = malloc(sizeof(NSPoint) * kBatchCount);
+	NSPoint *parallelPoints = malloc(sizeof(NSPoint) * kBatchCount);
+	CGFloat *serialDistances = malloc(sizeof(CGFloat) * kBatchCount);
+	CGFloat *parallelDistances = malloc(sizeof(CGFloat) * kBatchCount);
+	CBHFillPoints(starts, kBatchCount, 1);
+	CBHFillPoints(ends, kBatchCount, 2);
+
+	const CBHAffineTransform transform = CBHAffineTransform_translate(CBHAffineTransform_initRotation(0.3), 4.0, -2.5);
+
+	CBHParallel_setThreadCount(1);
+	NSPoint_distancesBetweenPoints(starts, ends, serialDistances, kBatchCount);
+	CBHAffineTransform_applyToPoints(transform, starts, serialPoints, kBatchCount);
+	const NSPoint serialCentroid = NSPoint_centroidOfPoints(starts, kBatchCount);
+	CBHPointAccumulator serialAccumulator = CBHPointAccumulator_init();
+	CBHPointAccumulator_pushPoints(&serialAccumulator, starts, kBatchCount);
+
+	CBHParallel_setThreadCount(8);
+	CBHParallel_setGrainSize(1000);
+	NSPoint_distancesBetweenPoints(starts, ends, parallelDistances, kBatchCount);
+	CBHAffineTransform_applyToPoints(transform, starts, parallelPoints, kBatchCount);
+	const NSPoint parallelCentroid = NSPoint_centroidOfPoints(starts, kBatchCount);
+	CBHPointAccumulator parallelAccumulator = CBHPointAccumulator_init();
+	CBHPointAccumulator_pushPoints(&parallelAccumulator, starts, kBatchCount);
+
+	XCTAssertEqual(memcmp(serialDistances, parallelDistances, sizeof(CGFloat) * kBatchCount), 0, @"The distances should be identical.");
+	XCTAssertEqual(memcmp(serialPoints, parallelPoints, sizeof(NSPoint) * kBatchCount), 0, @"The points should be identical.");
+	XCTAssertEqual(memcmp(&serialCentroid, &parallelCentroid, sizeof(NSPoint)), 0, @"The centroids should be identical.");
+	XCTAssertEqual(memcmp(&serialAccumulator, &parallelAccumulator, sizeof(CBHPointAccumulator)), 0, @"The accumulators should be identical.");
+
+	free(starts);
+	free(ends);
+	free(serialPoints);
+	free(parallelPoints);
+	free(serialDistances);
+	free(parallelDistances);
+}
+
+- (void)testBatches_maskMatchesSerial
+{
+	NSPoint *origins = malloc(sizeof(NSPoint) * kBatchCount);
+	CBHFillPoints(origins, kBatchCount, 3);
+
+	CBHRectArray array;
+	XCTAssertTrue(CBHRectArray_init(&array, kBatchCount));
+	for (NSUInteger i = 0; i < kBatchCount; ++i)
+	{
+		CBHRectArray_append(&array, NSRect_init(origins[i].x, origins[i].y, 5.0, 5.0));
+	}
+
+	const NSUInteger words = (kBatchCount + 63) / 64;
+	uint64_t *serialMask = calloc(words, sizeof(uint64_t));
+	uint64_t *parallelMask = calloc(words, sizeof(uint64_t));
+	const NSRect query = NSRect_init(-20.0, -20.0, 40.0, 40.0);
+
+	CBHParallel_setThreadCount(1);
+	const NSUInteger serialMatches = CBHRectArray_isIntersectingMask(&array, query, serialMask);
+
+	CBHParallel_setThreadCount(8);
+	CBHParallel_setGrainSize(1000);
+	const NSUInteger parallelMatches = CBHRectArray_isIntersectingMask(&array, query, parallelMask);
+
+	XCTAssertGreaterThan(serialMatches, 0UL);
+	XCTAssertEqual(serialMatches, parallelMatches);
+	XCTAssertEqual(memcmp(serialMask, parallelMask, sizeof(uint64_t) * words), 0, @"The masks should be identical.");
+
+	CBHRectArray_destroy(&array);
+	free(origins);
+	free(serialMask);
+	free(parallelMask);
+}
+
+
+#pragma mark - Performance
+
+- (void)measureDistancesWithThreadCount:(NSUInteger)threadCount
+{
+	NSPoint *starts = malloc(sizeof(NSPoint) * kPerformanceCount);
+	NSPoint *ends = malloc(sizeof(NSPoint) * kPerformanceCount);
+	CGFloat *distances = malloc(sizeof(CGFloat) * kPerformanceCount);
+	CBHFillPoints(starts, kPerformanceCount, 4);
+	CBHFillPoints(ends, kPerformanceCount, 5);
+
+	CBHParallel_setThreadCount(threadCount);
+
+	[self measureBlock:^{
+		NSPoint_distancesBetweenPoints(starts, ends, distances, kPerformanceCount);
+	}];
+
+	free(starts);
+	free(ends);
+	free(distances);
+}
+
+- (void)testPerformance_distancesSerial
+{
+	[self measureDistancesWithThreadCount:1];
+}
+
+- (void)testPerformance_distancesParallel
+{
+	[self measureDistancesWithThreadCount:0];
+}
+
+@end
@@ -0,0 +1,258 @@
+//  CBHGeometryKitTests+CBHPixelRect.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+
+#define CBHAssertEqualPixelRects(result, expected) XCTAssertTrue(CBHPixelRect_isEqual(result, expected), @"The rects should be the same - result:{{%d, %d}, {%d, %d}} expected:{{%d, %d}, {%d, %d}}", result.origin.x, result.origin.y, result.size.width, result.size.height, expected.origin.x, expected.origin.y, expected.size.width, expected.size.height)
+
+static const NSUInteger kRandomCount = 1 << 16;
+static const NSUInteger kPerformanceCount = 1 << 22;
+
+static int32_t CBHRandomInteger(void)
+{
+	return (int32_t)(rand() % 201) - 100;
+}
+
+static CBHPixelRect CBHRandomPixelRect(void)
+{
+	return CBHPixelRect_init(CBHRandomInteger(), CBHRandomInteger(), CBHRandomInteger() / 2, CBHRandomInteger() / 2);
+}
+
+static CGFloat CBHRandomValue(void)
+{
+	return (CGFloat)rand() / (CGFloat)RAND_MAX * 200.0 - 100.0;
+}
+
+static NSRect CBHRandomRect(void)
+{
+	return NSRect_init(CBHRandomValue(), CBHRandomValue(), CBHRandomValue() / 2.0, CBHRandomValue() / 2.0);
+}
+
+
+@interface CBHGeometryKitTests_CBHPixelRect : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHPixelRect
+
+#pragma mark - Creating Pixel Geometry
+
+- (void)testInitialization_parametric
+{
+	CBHPixelRect rect = CBHPixelRect_init(1, 2, 3, 4);
+
+	XCTAssertEqual(rect.origin.x, 1, @"Wrong x component.");
+	XCTAssertEqual(rect.origin.y, 2, @"Wrong y component.");
+	XCTAssertEqual(rect.size.width, 3, @"Wrong width component.");
+	XCTAssertEqual(rect.size.height, 4, @"Wrong height component.");
+}
+
+- (void)testInitialization_struct
+{
+	CBHPixelRect rect = CBHPixelRect_initWithStructs(CBHPixelPoint_init(1, 2), CBHPixelSize_init(3, 4));
+
+	CBHAssertEqualPixelRects(rect, CBHPixelRect_init(1, 2, 3, 4));
+}
+
+- (void)testInitialization_zero
+{
+	CBHPixelRect rect = CBHPixelRect_initEmpty();
+
+	CBHAssertEqualPixelRects(rect, CBHPixelRect_init(0, 0, 0, 0));
+	XCTAssertTrue(CBHPixelRect_isEmpty(rect), @"The zero rect should be empty.");
+}
+
+
+#pragma mark - Converting Pixel Geometry
+
+- (void)testConversion_matchesIntegral
+{
+	srand(1);
+	for (NSUInteger i = 0; i < kRandomCount; ++i)
+	{
+		const NSRect rect = CBHRandomRect();
+		const NSRect expected = NSRect_integral(rect);
+		const NSRect result = CBHPixelRect_rect(CBHPixelRect_initWithRect(rect));
+
+		XCTAssertTrue(NSRect_isEqual(result, expected), @"Wrong conversion of %@.", NSRect_description(rect));
+		if ( !NSRect_isEqual(result, expected) ) { break; }
+	}
+}
+
+- (void)testConversion_empty
+{
+	CBHAssertEqualPixelRects(CBHPixelRect_initWithRect(NSRect_init(5.5, 6.5, 0.0, 3.0)), CBHPixelRect_initEmpty());
+	CBHAssertEqualPixelRects(CBHPixelRect_initWithRect(NSRect_init(5.5, 6.5, 3.0, -1.0)), CBHPixelRect_initEmpty());
+	CBHAssertEqualPixelRects(CBHPixelRect_initWithRect(NSRect_init(-1.5, -0.5, 1.0, 1.0)), CBHPixelRect_init(-2, -1, 2, 2));
+}
+
+- (void)testConversion_saturates
+{
+	const CBHPixelRect rect = CBHPixelRect_initWithRect(NSRect_init(-1e12, NAN, 1e13, 1.0));
+
+	XCTAssertEqual(rect.origin.x, INT32_MIN, @"Wrong x component.");
+	XCTAssertEqual(rect.origin.y, INT32_MIN, @"Wrong y component.");
+	XCTAssertEqual(rect.size.width, INT32_MAX, @"Wrong width component.");
+}
+
+- (void)testConversion_components
+{
+	XCTAssertTrue(NSPoint_isEqual(CBHPixelPoint_point(CBHPixelPoint_init(-3, 4)), NSPoint_init(-3.0, 4.0)));
+	XCTAssertTrue(NSSize_isEqual(CBHPixelSize_size(CBHPixelSize_init(5, -6)), NSSize_init(5.0, -6.0)));
+	XCTAssertTrue(NSRect_isEqual(CBHPixelRect_rect(CBHPixelRect_init(1, 2, 3, 4)), NSRect_init(1.0, 2.0, 3.0, 4.0)));
+}
+
+
+#pragma mark - Checking Pixel Geometry
+
+- (void)testChecking_matchesNSRect
+{
+	srand(2);
+	for (NSUInteger i = 0; i < kRandomCount; ++i)
+	{
+		const CBHPixelRect rect = CBHRandomPixelRect();
+		const CBHPixelRect other = CBHRandomPixelRect();
+		const CBHPixelPoint point = CBHPixelPoint_init(CBHRandomInteger(), CBHRandomInteger());
+
+		const NSRect floatRect = CBHPixelRect_rect(rect);
+		const NSRect floatOther = CBHPixelRect_rect(other);
+
+		XCTAssertEqual(CBHPixelRect_isEmpty(rect), NSRect_isEmpty(floatRect), @"Wrong emptiness at %lu.", i);
+		XCTAssertEqual(CBHPixelRect_isCovering(rect, other), NSRect_isCovering(floatRect, floatOther), @"Wrong covering at %lu.", i);
+		XCTAssertEqual(CBHPixelRect_isIntersecting(rect, other), NSRect_isIntersecting(floatRect, floatOther), @"Wrong intersecting at %lu.", i);
+		XCTAssertEqual(CBHPixelRect_isPointInRect(rect, point), NSRect_isPointInRect(floatRect, CBHPixelPoint_point(point)), @"Wrong containment at %lu.", i);
+	}
+}
+
+- (void)testChecking_equality
+{
+	XCTAssertTrue(CBHPixelPoint_isEqual(CBHPixelPoint_init(1, 2), CBHPixelPoint_init(1, 2)));
+	XCTAssertFalse(CBHPixelPoint_isEqual(CBHPixelPoint_init(1, 2), CBHPixelPoint_init(2, 1)));
+	XCTAssertTrue(CBHPixelSize_isEqual(CBHPixelSize_init(3, 4), CBHPixelSize_init(3, 4)));
+	XCTAssertFalse(CBHPixelSize_isEqual(CBHPixelSize_init(3, 4), CBHPixelSize_init(3, 5)));
+	XCTAssertTrue(CBHPixelRect_isEqual(CBHPixelRect_init(1, 2, 3, 4), CBHPixelRect_init(1, 2, 3, 4)));
+	XCTAssertFalse(CBHPixelRect_isEqual(CBHPixelRect_init(1, 2, 3, 4), CBHPixelRect_init(1, 2, 4, 3)));
+}
+
+
+#pragma mark - Derived Pixel Rects
+
+- (void)testDerived_matchesNSRect
+{
+	srand(3);
+	for (NSUInteger i = 0; i < kRandomCount; ++i)
+	{
+		const CBHPixelRect rect = CBHRandomPixelRect();
+		const CBHPixelRect other = CBHRandomPixelRect();
+		const int32_t dX = CBHRandomInteger() / 4;
+		const int32_t dY = CBHRandomInteger() / 4;
+
+		const NSRect floatRect = CBHPixelRect_rect(rect);
+		const NSRect floatOther = CBHPixelRect_rect(other);
+
+		XCTAssertTrue(NSRect_isEqual(CBHPixelRect_rect(CBHPixelRect_inset(rect, dX, dY)), NSRect_inset(floatRect, dX, dY)), @"Wrong inset rect at %lu.", i);
+		XCTAssertTrue(NSRect_isEqual(CBHPixelRect_rect(CBHPixelRect_offset(rect, dX, dY)), NSRect_offset(floatRect, dX, dY)), @"Wrong offset rect at %lu.", i);
+		XCTAssertTrue(NSRect_isEqual(CBHPixelRect_rect(CBHPixelRect_union(rect, other)), NSRect_union(floatRect, floatOther)), @"Wrong union at %lu.", i);
+
+		const NSRect intersection = NSRect_intersection(floatRect, floatOther);
+		const NSRect expected = ( NSRect_isEmpty(intersection) ) ? NSRect_initEmpty() : intersection;
+		XCTAssertTrue(NSRect_isEqual(CBHPixelRect_rect(CBHPixelRect_intersection(rect, other)), expected), @"Wrong intersection at %lu.", i);
+	}
+}
+
+- (void)testDerived_centered
+{
+	CBHAssertEqualPixelRects(CBHPixelRect_centeredInRect(CBHPixelRect_init(0, 0, 2, 2), CBHPixelRect_init(10, 10, 6, 6)), CBHPixelRect_init(12, 12, 2, 2));
+	CBHAssertEqualPixelRects(CBHPixelRect_centeredInRect(CBHPixelRect_init(0, 0, 2, 2), CBHPixelRect_init(10, 10, 5, 5)), CBHPixelRect_init(11, 11, 2, 2));
+	CBHAssertEqualPixelRects(CBHPixelRect_centeredInRect(CBHPixelRect_init(0, 0, 4, 4), CBHPixelRect_init(-1, -1, 1, 1)), CBHPixelRect_init(-3, -3, 4, 4));
+}
+
+
+#pragma mark - Calculated Properties
+
+- (void)testProperties_matchNSRect
+{
+	srand(4);
+	for (NSUInteger i = 0; i < kRandomCount; ++i)
+	{
+		const CBHPixelRect rect = CBHRandomPixelRect();
+		const NSRect floatRect = CBHPixelRect_rect(rect);
+
+		XCTAssertEqual((CGFloat)CBHPixelRect_minX(rect), NSRect_minX(floatRect), @"Wrong minimum x at %lu.", i);
+		XCTAssertEqual((CGFloat)CBHPixelRect_minY(rect), NSRect_minY(floatRect), @"Wrong minimum y at %lu.", i);
+		XCTAssertEqual((CGFloat)CBHPixelRect_maxX(rect), NSRect_maxX(floatRect), @"Wrong maximum x at %lu.", i);
+		XCTAssertEqual((CGFloat)CBHPixelRect_maxY(rect), NSRect_maxY(floatRect), @"Wrong maximum y at %lu.", i);
+		XCTAssertTrue(NSPoint_isEqual(CBHPixelPoint_point(CBHPixelRect_minPoint(rect)), NSRect_minPoint(floatRect)), @"Wrong minimum point at %lu.", i);
+		XCTAssertTrue(NSPoint_isEqual(CBHPixelPoint_point(CBHPixelRect_maxPoint(rect)), NSRect_maxPoint(floatRect)), @"Wrong maximum point at %lu.", i);
+	}
+}
+
+
+#pragma mark - Batched Conversions
+
+- (void)testBatches_matchScalar
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kRandomCount);
+	NSRect *results = malloc(sizeof(NSRect) * kRandomCount);
+	CBHPixelRect *pixelRects = malloc(sizeof(CBHPixelRect) * kRandomCount);
+
+	srand(5);
+	for (NSUInteger i = 0; i < kRandomCount; ++i)
+	{
+		rects[i] = CBHRandomRect();
+	}
+
+	CBHPixelRect_initWithRects(rects, pixelRects, kRandomCount);
+	CBHPixelRect_getRects(pixelRects, results, kRandomCount);
+
+	for (NSUInteger i = 0; i < kRandomCount; ++i)
+	{
+		CBHAssertEqualPixelRects(pixelRects[i], CBHPixelRect_initWithRect(rects[i]));
+		XCTAssertTrue(NSRect_isEqual(results[i], NSRect_integral(rects[i])), @"Wrong rect at %lu.", i);
+	}
+
+	free(rects);
+	free(results);
+	free(pixelRects);
+}
+
+
+#pragma mark - Performance
+
+- (void)testPerformance_initWithRects
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	CBHPixelRect *pixelRects = malloc(sizeof(CBHPixelRect) * kPerformanceCount);
+
+	srand(6);
+	for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+	{
+		rects[i] = CBHRandomRect();
+	}
+
+	[self measureBlock:^{
+		CBHPixelRect_initWithRects(rects, pixelRects, kPerformanceCount);
+	}];
+
+	free(rects);
+	free(pixelRects);
+}
+
+@end
@@ -0,0 +1,231 @@
+//  CBHGeometryKitTests+CBHPointAccumulator.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+
+
+#define CBHAssertEqualPoints(result, expected) XCTAssertTrue(NSPoint_isEqual(result, expected), @"The points should be the same - result:%@ expected:%@", NSPoint_description(result), NSPoint_description(expected))
+#define CBHAssertClose(result, expected, tolerance) XCTAssertEqualWithAccuracy(result, expected, (tolerance) * MAX(1.0, fabs(expected)))
+
+
+enum { kStreamCount = 200003 };
+static const NSUInteger kPerformanceCount = 1 << 22;
+
+static void CBHFillStream(NSPoint *points, NSUInteger count, CGFloat offset, unsigned int seed)
+{
+	// A jittery track far from the origin, where naive sums of squares lose most of their precision.
+	srand(seed);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		CGFloat t = (CGFloat)i * 1e-3;
+		points[i] = NSPoint_init(offset + 40.0 * cos(t) + (CGFloat)(rand() % 1000) / 1000.0, offset + 25.0 * sin(t * 1.5));
+	}
+}
+
+
+@interface CBHGeometryKitTests_CBHPointAccumulator : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHPointAccumulator
+{
+	NSPoint *_points;
+	NSPoint _centroid;
+	NSPoint _variance;
+	CGFloat _length;
+}
+
+- (void)setUp
+{
+	[super setUp];
+
+	_points = malloc(sizeof(NSPoint) * kStreamCount);
+	CBHFillStream(_points, kStreamCount, 1e8, 13);
+
+	// Two-pass references with extended precision sums.
+	long double x = 0.0;
+	long double y = 0.0;
+	long double length = 0.0;
+	for (NSUInteger i = 0; i < kStreamCount; ++i)
+	{
+		x += _points[i].x;
+		y += _points[i].y;
+		if ( i > 0 ) { length += NSPoint_distance(_points[i - 1], _points[i]); }
+	}
+
+	_centroid = NSPoint_init((CGFloat)(x / kStreamCount), (CGFloat)(y / kStreamCount));
+	_length = (CGFloat)length;
+
+	long double varianceX = 0.0;
+	long double varianceY = 0.0;
+	for (NSUInteger i = 0; i < kStreamCount; ++i)
+	{
+		varianceX += ((long double)_points[i].x - _centroid.x) * ((long double)_points[i].x - _centroid.x);
+		varianceY += ((long double)_points[i].y - _centroid.y) * ((long double)_points[i].y - _centroid.y);
+	}
+
+	_variance = NSPoint_init((CGFloat)(varianceX / kStreamCount), (CGFloat)(varianceY / kStreamCount));
+}
+
+- (void)tearDown
+{
+	free(_points);
+	[super tearDown];
+}
+
+- (void)assertMatchesStream:(const CBHPointAccumulator *)accumulator
+{
+	XCTAssertEqual(accumulator->count, (NSUInteger)kStreamCount);
+	CBHAssertEqualPoints(CBHPointAccumulator_bounds(accumulator).origin, NSRect_boundingRectOfPoints(_points, kStreamCount).origin);
+	CBHAssertEqualPoints(NSRect_maxPoint(CBHPointAccumulator_bounds(accumulator)), NSRect_maxPoint(NSRect_boundingRectOfPoints(_points, kStreamCount)));
+
+	NSPoint centroid = CBHPointAccumulator_centroid(accumulator);
+	CBHAssertClose(centroid.x, _centroid.x, 1e-13);
+	CBHAssertClose(centroid.y, _centroid.y, 1e-13);
+
+	NSPoint variance = CBHPointAccumulator_variance(accumulator);
+	CBHAssertClose(variance.x, _variance.x, 1e-8);
+	CBHAssertClose(variance.y, _variance.y, 1e-8);
+
+	CBHAssertClose(CBHPointAccumulator_length(accumulator), _length, 1e-13);
+}
+
+
+#pragma mark - Creating Accumulators
+
+- (void)testInit_empty
+{
+	CBHPointAccumulator accumulator = CBHPointAccumulator_init();
+
+	XCTAssertEqual(accumulator.count, 0UL);
+	XCTAssertTrue(NSRect_isEqual(CBHPointAccumulator_bounds(&accumulator), NSRect_initEmpty()));
+	CBHAssertEqualPoints(CBHPointAccumulator_centroid(&accumulator), NSPoint_initZero());
+	CBHAssertEqualPoints(CBHPointAccumulator_variance(&accumulator), NSPoint_initZero());
+	XCTAssertEqual(CBHPointAccumulator_length(&accumulator), 0.0);
+}
+
+
+#pragma mark - Adding Points
+
+- (void)testPush_small
+{
+	const NSPoint points[4] = { {0.0, 0.0}, {3.0, 4.0}, {3.0, 0.0}, {2.0, 0.0} };
+	CBHPointAccumulator accumulator = CBHPointAccumulator_init();
+
+	for (NSUInteger i = 0; i < 4; ++i)
+	{
+		CBHPointAccumulator_push(&accumulator, points[i]);
+	}
+
+	XCTAssertTrue(NSRect_isEqual(CBHPointAccumulator_bounds(&accumulator), NSRect_init(0.0, 0.0, 3.0, 4.0)));
+	CBHAssertEqualPoints(CBHPointAccumulator_centroid(&accumulator), NSPoint_init(2.0, 1.0));
+	CBHAssertClose(CBHPointAccumulator_variance(&accumulator).x, 1.5, 1e-15);
+	CBHAssertClose(CBHPointAccumulator_variance(&accumulator).y, 3.0, 1e-15);
+	CBHAssertClose(CBHPointAccumulator_standardDeviation(&accumulator).y, sqrt(3.0), 1e-15);
+	XCTAssertEqual(CBHPointAccumulator_length(&accumulator), 10.0);
+}
+
+- (void)testPush_stream
+{
+	CBHPointAccumulator accumulator = CBHPointAccumulator_init();
+
+	for (NSUInteger i = 0; i < kStreamCount; ++i)
+	{
+		CBHPointAccumulator_push(&accumulator, _points[i]);
+	}
+
+	[self assertMatchesStream:&accumulator];
+}
+
+- (void)testPushPoints_stream
+{
+	CBHPointAccumulator accumulator = CBHPointAccumulator_init();
+	CBHPointAccumulator_pushPoints(&accumulator, _points, kStreamCount);
+
+	[self assertMatchesStream:&accumulator];
+}
+
+- (void)testPushPoints_inPieces
+{
+	// Uneven pieces which split the vector steps and the internal chunks.
+	CBHPointAccumulator accumulator = CBHPointAccumulator_init();
+	NSUInteger location = 0;
+
+	for (NSUInteger length = 1; location < kStreamCount; length = length * 3 + 1)
+	{
+		NSUInteger piece = MIN(length, kStreamCount - location);
+		CBHPointAccumulator_pushPoints(&accumulator, _points + location, piece);
+		location += piece;
+	}
+
+	[self assertMatchesStream:&accumulator];
+}
+
+- (void)testMerge_partials
+{
+	const NSUInteger split = kStreamCount / 3;
+	CBHPointAccumulator head = CBHPointAccumulator_init();
+	CBHPointAccumulator tail = CBHPointAccumulator_init();
+	CBHPointAccumulator empty = CBHPointAccumulator_init();
+
+	CBHPointAccumulator_pushPoints(&head, _points, split);
+	CBHPointAccumulator_pushPoints(&tail, _points + split, kStreamCount - split);
+	CBHPointAccumulator_merge(&head, &empty);
+	CBHPointAccumulator_merge(&head, &tail);
+
+	[self assertMatchesStream:&head];
+
+	CBHPointAccumulator_merge(&empty, &head);
+	XCTAssertEqual(memcmp(&empty, &head, sizeof(CBHPointAccumulator)), 0, @"Merging into an empty accumulator should copy.");
+}
+
+
+#pragma mark - Performance
+
+- (void)testPerformance_push
+{
+	NSPoint *points = malloc(sizeof(NSPoint) * kPerformanceCount);
+	CBHFillStream(points, kPerformanceCount, 0.0, 7);
+
+	[self measureBlock:^{
+		CBHPointAccumulator accumulator = CBHPointAccumulator_init();
+		for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+		{
+			CBHPointAccumulator_push(&accumulator, points[i]);
+		}
+	}];
+
+	free(points);
+}
+
+- (void)testPerformance_pushPoints
+{
+	NSPoint *points = malloc(sizeof(NSPoint) * kPerformanceCount);
+	CBHFillStream(points, kPerformanceCount, 0.0, 7);
+
+	[self measureBlock:^{
+		CBHPointAccumulator accumulator = CBHPointAccumulator_init();
+		CBHPointAccumulator_pushPoints(&accumulator, points, kPerformanceCount);
+	}];
+
+	free(points);
+}
+
+@end
@@ -0,0 +1,375 @@
+//  CBHGeometryKitTests+CBHPointTree.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+
+enum { kPointCount = 1523 };
+
+static void CBHFillPoints(NSPoint *points, NSUInteger count, unsigned int seed)
+{
+	srand(seed);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		// A coarse grid so many points coincide and many distances tie.
+		points[i] = NSPoint_init((CGFloat)(rand() % 120) / 2.0 - 30.0, (CGFloat)(rand() % 120) / 2.0 - 30.0);
+	}
+}
+
+static int CBHCompareIndexes(const void *a, const void *b)
+{
+	NSUInteger lhs = *(const NSUInteger *)a;
+	NSUInteger rhs = *(const NSUInteger *)b;
+
+	return (lhs > rhs) - (lhs < rhs);
+}
+
+typedef struct CBHCollector
+{
+	NSUInteger indexes[kPointCount];
+	NSUInteger count;
+	NSUInteger limit;
+} CBHCollector;
+
+static void CBHCollect(NSUInteger index, void *context, BOOL *stop)
+{
+	CBHCollector *collector = context;
+	collector->indexes[collector->count++] = index;
+
+	if ( collector->count == collector->limit ) { *stop = YES; }
+}
+
+
+@interface CBHGeometryKitTests_CBHPointTree : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHPointTree
+{
+	NSPoint _points[kPointCount];
+	CBHPointTree *_tree;
+}
+
+- (void)setUp
+{
+	CBHFillPoints(_points, kPointCount, 31);
+	_tree = CBHPointTree_createWithPoints(_points, kPointCount);
+	XCTAssertTrue(_tree != NULL, @"Creation should succeed.");
+}
+
+- (void)tearDown
+{
+	CBHPointTree_destroy(_tree);
+}
+
+- (void)assertIndexes:(NSUInteger *)indexes count:(NSUInteger)count matchPredicate:(BOOL (^)(NSPoint point))predicate
+{
+	qsort(indexes, count, sizeof(NSUInteger), CBHCompareIndexes);
+
+	NSUInteger expected = 0;
+	for (NSUInteger i = 0; i < kPointCount; ++i)
+	{
+		if ( !predicate(_points[i]) ) { continue; }
+
+		XCTAssertLessThan(expected, count, @"Too few indexes.");
+		if ( expected < count ) { XCTAssertEqual(indexes[expected], i, @"Wrong index."); }
+		expected += 1;
+	}
+
+	XCTAssertEqual(count, expected, @"Wrong index count.");
+}
+
+// The index of the nearest point after `after` in (distance, index) order, as a brute force scan finds it.
+- (NSUInteger)nearestIndexToPoint:(NSPoint)point after:(NSUInteger)after distance:(CGFloat)afterDistance
+{
+	NSUInteger best = NSNotFound;
+	CGFloat bestDistance = 0.0;
+
+	for (NSUInteger i = 0; i < kPointCount; ++i)
+	{
+		CGFloat distance = NSPoint_distanceSquared(point, _points[i]);
+
+		if ( after != NSNotFound && (distance < afterDistance || (distance == afterDistance && i <= after)) ) { continue; }
+		if ( best != NSNotFound && (distance > bestDistance || (distance == bestDistance && i > best)) ) { continue; }
+
+		best = i;
+		bestDistance = distance;
+	}
+
+	return best;
+}
+
+
+#pragma mark - Creating Point Trees
+
+- (void)testCreation_empty
+{
+	NSPoint points[1] = { NSZeroPoint };
+	CBHPointTree *tree = CBHPointTree_createWithPoints(points, 0);
+	NSUInteger indexes[1];
+	CGFloat distances[1];
+
+	XCTAssertEqual(CBHPointTree_count(tree), 0UL, @"Wrong count.");
+	XCTAssertEqual(CBHPointTree_nearestIndex(tree, NSZeroPoint), (NSUInteger)NSNotFound, @"An empty tree has no nearest point.");
+	XCTAssertEqual(CBHPointTree_nearestIndexes(tree, NSZeroPoint, 1, indexes, distances), 0UL, @"An empty tree has no nearest points.");
+	XCTAssertEqual(CBHPointTree_withinDistanceIndexes(tree, NSZeroPoint, 10.0, indexes, 1), 0UL, @"An empty tree holds nothing.");
+
+	CBHPointTree_destroy(tree);
+}
+
+- (void)testProperties_count
+{
+	XCTAssertEqual(CBHPointTree_count(_tree), (NSUInteger)kPointCount, @"Wrong count.");
+}
+
+
+#pragma mark - Finding Nearest Points
+
+- (void)testNearest_index
+{
+	NSPoint queries[4] = { NSPoint_init(0.0, 0.0), NSPoint_init(0.25, -0.25), NSPoint_init(-100.0, 40.0), NSPoint_init(29.75, 29.5) };
+
+	for (NSUInteger q = 0; q < 4; ++q)
+	{
+		NSUInteger expected = [self nearestIndexToPoint:queries[q] after:NSNotFound distance:0.0];
+		XCTAssertEqual(CBHPointTree_nearestIndex(_tree, queries[q]), expected, @"Wrong nearest point.");
+	}
+}
+
+- (void)testNearest_indexes
+{
+	enum { kNearestCount = 25 };
+
+	NSPoint point = NSPoint_init(3.25, -7.75);
+	NSUInteger indexes[kNearestCount];
+	CGFloat distances[kNearestCount];
+
+	XCTAssertEqual(CBHPointTree_nearestIndexes(_tree, point, kNearestCount, indexes, distances), (NSUInteger)kNearestCount, @"Wrong count.");
+
+	NSUInteger previous = NSNotFound;
+	CGFloat previousDistance = 0.0;
+
+	for (NSUInteger i = 0; i < kNearestCount; ++i)
+	{
+		NSUInteger expected = [self nearestIndexToPoint:point after:previous distance:previousDistance];
+
+		XCTAssertEqual(indexes[i], expected, @"Wrong index at %lu.", (unsigned long)i);
+		XCTAssertEqual(distances[i], NSPoint_distanceSquared(point, _points[expected]), @"Wrong distance at %lu.", (unsigned long)i);
+
+		previous = expected;
+		previousDistance = distances[i];
+	}
+}
+
+- (void)testNearest_moreThanCount
+{
+	NSPoint points[3] = { NSPoint_init(0.0, 0.0), NSPoint_init(2.0, 0.0), NSPoint_init(1.0, 0.0) };
+	CBHPointTree *tree = CBHPointTree_createWithPoints(points, 3);
+	NSUInteger indexes[5];
+	CGFloat distances[5];
+
+	XCTAssertEqual(CBHPointTree_nearestIndexes(tree, NSPoint_init(0.5, 0.0), 5, indexes, distances), 3UL, @"Only the points held can be found.");
+	XCTAssertEqual(indexes[0], 0UL, @"Ties are broken by index.");
+	XCTAssertEqual(indexes[1], 2UL, @"Ties are broken by index.");
+	XCTAssertEqual(indexes[2], 1UL, @"Wrong index.");
+
+	CBHPointTree_destroy(tree);
+}
+
+
+#pragma mark - Querying Indexes
+
+- (void)testIndexes_withinDistance
+{
+	CGFloat distances[4] = { 0.0, 0.5, 3.0, 12.25 };
+	NSPoint point = NSPoint_init(1.5, 2.0);
+	NSUInteger indexes[kPointCount];
+
+	for (NSUInteger q = 0; q < 4; ++q)
+	{
+		CGFloat distance = distances[q];
+		NSUInteger count = CBHPointTree_withinDistanceIndexes(_tree, point, distance, indexes, kPointCount);
+
+		[self assertIndexes:indexes count:count matchPredicate:^BOOL (NSPoint element) {
+			return NSPoint_distance(point, element) <= distance;
+		}];
+	}
+}
+
+- (void)testIndexes_inRect
+{
+	NSRect rects[4] = { NSRect_init(-2.0, -3.0, 12.5, 9.5), NSRect_init(0.0, 0.0, 0.5, 0.5), NSRect_init(0.0, 0.0, 0.0, 5.0), NSRect_init(-100.0, -100.0, 200.0, 200.0) };
+	NSUInteger indexes[kPointCount];
+
+	for (NSUInteger q = 0; q < 4; ++q)
+	{
+		NSRect rect = rects[q];
+		NSUInteger count = CBHPointTree_inRectIndexes(_tree, rect, indexes, kPointCount);
+
+		[self assertIndexes:indexes count:count matchPredicate:^BOOL (NSPoint element) {
+			return NSRect_isPointInRect(rect, element);
+		}];
+	}
+}
+
+- (void)testIndexes_capacity
+{
+	NSPoint point = NSPoint_init(1.5, 2.0);
+	NSUInteger partial[4] = { 0 };
+
+	NSUInteger count = CBHPointTree_withinDistanceIndexes(_tree, point, 8.0, NULL, 0);
+	XCTAssertGreaterThan(count, 4UL, @"The query should match more points than the buffer holds.");
+	XCTAssertEqual(CBHPointTree_withinDistanceIndexes(_tree, point, 8.0, partial, 4), count, @"The full count should be returned.");
+
+	for (NSUInteger i = 0; i < 4; ++i)
+	{
+		XCTAssertLessThanOrEqual(NSPoint_distance(point, _points[partial[i]]), 8.0, @"Wrong index.");
+	}
+}
+
+
+#pragma mark - Enumerating Matches
+
+- (void)testEnumeration_withinDistance
+{
+	NSPoint point = NSPoint_init(-4.0, 6.5);
+	CBHCollector collector = { .count = 0, .limit = 0 };
+
+	CBHPointTree_enumerateWithinDistance(_tree, point, 5.0, CBHCollect, &collector);
+
+	[self assertIndexes:collector.indexes count:collector.count matchPredicate:^BOOL (NSPoint element) {
+		return NSPoint_distance(point, element) <= 5.0;
+	}];
+}
+
+- (void)testEnumeration_inRect
+{
+	NSRect rect = NSRect_init(-10.0, -10.0, 15.0, 7.5);
+	CBHCollector collector = { .count = 0, .limit = 0 };
+
+	CBHPointTree_enumerateInRect(_tree, rect, CBHCollect, &collector);
+
+	[self assertIndexes:collector.indexes count:collector.count matchPredicate:^BOOL (NSPoint element) {
+		return NSRect_isPointInRect(rect, element);
+	}];
+}
+
+- (void)testEnumeration_stop
+{
+	CBHCollector collector = { .count = 0, .limit = 3 };
+
+	CBHPointTree_enumerateInRect(_tree, NSRect_init(-100.0, -100.0, 200.0, 200.0), CBHCollect, &collector);
+
+	XCTAssertEqual(collector.count, 3UL, @"Enumeration should stop when asked.");
+}
+
+
+#pragma mark - Performance
+
+static const NSUInteger kPerformanceQueries = 100;
+
+static NSPoint *CBHCreateUniformPoints(NSUInteger count)
+{
+	NSPoint *points = malloc(sizeof(NSPoint) * count);
+
+	srand(32);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		points[i] = NSPoint_init((CGFloat)rand() / (CGFloat)RAND_MAX * 1000.0, (CGFloat)rand() / (CGFloat)RAND_MAX * 1000.0);
+	}
+
+	return points;
+}
+
+static NSPoint CBHQueryPoint(NSUInteger query)
+{
+	return NSPoint_init((CGFloat)((query * 97) % 1000), (CGFloat)((query * 31) % 1000));
+}
+
+- (void)measureNearestLoopWithCount:(NSUInteger)count
+{
+	NSPoint *points = CBHCreateUniformPoints(count);
+	NSUInteger *nearest = malloc(sizeof(NSUInteger) * kPerformanceQueries);
+
+	[self measureBlock:^{
+		for (NSUInteger q = 0; q < kPerformanceQueries; ++q)
+		{
+			NSPoint point = CBHQueryPoint(q);
+			CGFloat best = NSPoint_distanceSquared(point, points[0]);
+			nearest[q] = 0;
+
+			for (NSUInteger i = 1; i < count; ++i)
+			{
+				CGFloat distance = NSPoint_distanceSquared(point, points[i]);
+				if ( distance < best ) { best = distance; nearest[q] = i; }
+			}
+		}
+	}];
+
+	free(nearest);
+	free(points);
+}
+
+- (void)measureNearestTreeWithCount:(NSUInteger)count
+{
+	NSPoint *points = CBHCreateUniformPoints(count);
+	CBHPointTree *tree = CBHPointTree_createWithPoints(points, count);
+
+	[self measureBlock:^{
+		for (NSUInteger q = 0; q < kPerformanceQueries; ++q)
+		{
+			CBHPointTree_nearestIndex(tree, CBHQueryPoint(q));
+		}
+	}];
+
+	CBHPointTree_destroy(tree);
+	free(points);
+}
+
+- (void)testPerformance_nearestLoop_1K
+{
+	[self measureNearestLoopWithCount:1000];
+}
+
+- (void)testPerformance_nearestTree_1K
+{
+	[self measureNearestTreeWithCount:1000];
+}
+
+- (void)testPerformance_nearestLoop_100K
+{
+	[self measureNearestLoopWithCount:100000];
+}
+
+- (void)testPerformance_nearestTree_100K
+{
+	[self measureNearestTreeWithCount:100000];
+}
+
+- (void)testPerformance_nearestLoop_10M
+{
+	[self measureNearestLoopWithCount:10000000];
+}
+
+- (void)testPerformance_nearestTree_10M
+{
+	[self measureNearestTreeWithCount:10000000];
+}
+
+@end
@@ -0,0 +1,226 @@
+//  CBHGeometryKitTests+CBHPolygon.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+
+
+enum { kBatchCount = 1037 };
+static const NSUInteger kPerformanceCount = 1 << 16;
+static const NSUInteger kPerformanceVertexCount = 64;
+
+static const NSPoint kSquare[] = { {0.0, 0.0}, {2.0, 0.0}, {2.0, 2.0}, {0.0, 2.0} };
+static const NSPoint kClockwiseSquare[] = { {0.0, 0.0}, {0.0, 2.0}, {2.0, 2.0}, {2.0, 0.0} };
+
+static void CBHFillStar(NSPoint *points)
+{
+	// A pentagram, which winds twice around its centre.
+	for (NSUInteger i = 0; i < 5; ++i)
+	{
+		CGFloat angle = M_PI_2 + (CGFloat)i * 4.0 * M_PI / 5.0;
+		points[i] = NSPoint_init(cos(angle), sin(angle));
+	}
+}
+
+static void CBHFillGridPoints(NSPoint *points, NSUInteger count, unsigned int seed)
+{
+	// Half-unit coordinates so many points land exactly on vertices and edges.
+	srand(seed);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		points[i] = NSPoint_init((rand() % 25) / 2.0 - 0.5, (rand() % 25) / 2.0 - 0.5);
+	}
+}
+
+static void CBHFillCircle(NSPoint *points, NSUInteger count)
+{
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		CGFloat angle = 2.0 * M_PI * (CGFloat)i / (CGFloat)count;
+		points[i] = NSPoint_init(100.0 * cos(angle), 100.0 * sin(angle));
+	}
+}
+
+
+@interface CBHGeometryKitTests_CBHPolygon : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHPolygon
+
+#pragma mark - Measuring
+
+- (void)testArea_orientation
+{
+	XCTAssertEqual(CBHPolygon_signedArea(kSquare, 4), 4.0);
+	XCTAssertEqual(CBHPolygon_signedArea(kClockwiseSquare, 4), -4.0);
+	XCTAssertEqual(CBHPolygon_area(kClockwiseSquare, 4), 4.0);
+}
+
+- (void)testArea_degenerate
+{
+	XCTAssertEqual(CBHPolygon_signedArea(kSquare, 0), 0.0);
+	XCTAssertEqual(CBHPolygon_signedArea(kSquare, 2), 0.0);
+}
+
+- (void)testArea_farFromOrigin
+{
+	NSPoint points[4];
+	for (NSUInteger i = 0; i < 4; ++i)
+	{
+		points[i] = NSPoint_init(kSquare[i].x + 1e9, kSquare[i].y - 1e9);
+	}
+
+	XCTAssertEqual(CBHPolygon_signedArea(points, 4), 4.0);
+}
+
+- (void)testPerimeter
+{
+	XCTAssertEqual(CBHPolygon_perimeter(kSquare, 4), 8.0);
+	XCTAssertEqual(CBHPolygon_perimeter(kSquare, 2), 4.0);
+	XCTAssertEqual(CBHPolygon_perimeter(kSquare, 1), 0.0);
+}
+
+- (void)testBoundingRect
+{
+	NSRect bounds = CBHPolygon_boundingRect(kClockwiseSquare, 4);
+	XCTAssertTrue(NSRect_isEqual(bounds, NSRect_init(0.0, 0.0, 2.0, 2.0)));
+}
+
+
+#pragma mark - Testing Points
+
+- (void)testContains_interiorAndExterior
+{
+	XCTAssertTrue(CBHPolygon_containsPoint(kSquare, 4, NSPoint_init(1.0, 1.0), CBHPolygonFillRuleNonZero));
+	XCTAssertTrue(CBHPolygon_containsPoint(kClockwiseSquare, 4, NSPoint_init(1.0, 1.0), CBHPolygonFillRuleNonZero));
+	XCTAssertFalse(CBHPolygon_containsPoint(kSquare, 4, NSPoint_init(3.0, 1.0), CBHPolygonFillRuleNonZero));
+	XCTAssertFalse(CBHPolygon_containsPoint(kSquare, 4, NSPoint_init(-1.0, 1.0), CBHPolygonFillRuleEvenOdd));
+	XCTAssertFalse(CBHPolygon_containsPoint(kSquare, 2, NSPoint_init(1.0, 0.0), CBHPolygonFillRuleNonZero));
+}
+
+- (void)testContains_edges
+{
+	// The lower and left edges are inside and the upper and right edges are outside.
+	XCTAssertTrue(CBHPolygon_containsPoint(kSquare, 4, NSPoint_init(0.0, 0.0), CBHPolygonFillRuleNonZero));
+	XCTAssertTrue(CBHPolygon_containsPoint(kSquare, 4, NSPoint_init(0.0, 1.0), CBHPolygonFillRuleNonZero));
+	XCTAssertFalse(CBHPolygon_containsPoint(kSquare, 4, NSPoint_init(2.0, 1.0), CBHPolygonFillRuleNonZero));
+	XCTAssertFalse(CBHPolygon_containsPoint(kSquare, 4, NSPoint_init(1.0, 2.0), CBHPolygonFillRuleNonZero));
+}
+
+- (void)testContains_sharedEdge
+{
+	const NSPoint right[] = { {2.0, 0.0}, {4.0, 0.0}, {4.0, 2.0}, {2.0, 2.0} };
+
+	for (NSUInteger i = 0; i < 20; ++i)
+	{
+		NSPoint point = NSPoint_init(2.0, (CGFloat)i / 10.0);
+		BOOL isInLeft = CBHPolygon_containsPoint(kSquare, 4, point, CBHPolygonFillRuleEvenOdd);
+		BOOL isInRight = CBHPolygon_containsPoint(right, 4, point, CBHPolygonFillRuleEvenOdd);
+
+		XCTAssertNotEqual(isInLeft, isInRight, @"Point %@ should be in exactly one polygon.", NSPoint_description(point));
+	}
+}
+
+- (void)testContains_fillRules
+{
+	NSPoint star[5];
+	CBHFillStar(star);
+
+	XCTAssertTrue(CBHPolygon_containsPoint(star, 5, NSPoint_initZero(), CBHPolygonFillRuleNonZero));
+	XCTAssertFalse(CBHPolygon_containsPoint(star, 5, NSPoint_initZero(), CBHPolygonFillRuleEvenOdd));
+	XCTAssertTrue(CBHPolygon_containsPoint(star, 5, NSPoint_init(0.0, 0.6), CBHPolygonFillRuleEvenOdd));
+}
+
+- (void)testBatched_matchesScalar
+{
+	const CBHPolygonFillRule rules[] = { CBHPolygonFillRuleNonZero, CBHPolygonFillRuleEvenOdd };
+	NSPoint polygon[24];
+	NSPoint queries[kBatchCount];
+	BOOL results[kBatchCount];
+
+	// Random vertices on a small grid give self-intersecting polygons with horizontal and repeated edges.
+	CBHFillGridPoints(polygon, 24, 3);
+	CBHFillGridPoints(queries, kBatchCount, 5);
+	queries[0] = NSPoint_init(NAN, 1.0);
+
+	for (NSUInteger r = 0; r < 2; ++r)
+	{
+		NSUInteger inside = CBHPolygon_containsPoints(polygon, 24, queries, results, kBatchCount, rules[r]);
+		NSUInteger expected = 0;
+
+		for (NSUInteger i = 0; i < kBatchCount; ++i)
+		{
+			BOOL isInside = CBHPolygon_containsPoint(polygon, 24, queries[i], rules[r]);
+			XCTAssertEqual(results[i], isInside, @"Point %lu should match the scalar test.", (unsigned long)i);
+			expected += ( isInside ) ? 1 : 0;
+		}
+
+		XCTAssertEqual(inside, expected);
+	}
+}
+
+- (void)testBatched_degenerate
+{
+	NSPoint queries[3] = { {0.5, 0.5}, {1.0, 1.0}, {0.0, 0.0} };
+	BOOL results[3] = { YES, YES, YES };
+
+	XCTAssertEqual(CBHPolygon_containsPoints(kSquare, 2, queries, results, 3, CBHPolygonFillRuleNonZero), 0UL);
+	XCTAssertFalse(results[0] || results[1] || results[2]);
+}
+
+
+#pragma mark - Performance
+
+- (void)testPerformance_containsPoint
+{
+	NSPoint polygon[kPerformanceVertexCount];
+	NSPoint *queries = malloc(sizeof(NSPoint) * kPerformanceCount);
+	BOOL *results = malloc(sizeof(BOOL) * kPerformanceCount);
+	CBHFillCircle(polygon, kPerformanceVertexCount);
+	CBHFillGridPoints(queries, kPerformanceCount, 7);
+
+	[self measureBlock:^{
+		for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+		{
+			results[i] = CBHPolygon_containsPoint(polygon, kPerformanceVertexCount, queries[i], CBHPolygonFillRuleNonZero);
+		}
+	}];
+
+	free(queries);
+	free(results);
+}
+
+- (void)testPerformance_containsPoints
+{
+	NSPoint polygon[kPerformanceVertexCount];
+	NSPoint *queries = malloc(sizeof(NSPoint) * kPerformanceCount);
+	BOOL *results = malloc(sizeof(BOOL) * kPerformanceCount);
+	CBHFillCircle(polygon, kPerformanceVertexCount);
+	CBHFillGridPoints(queries, kPerformanceCount, 7);
+
+	[self measureBlock:^{
+		CBHPolygon_containsPoints(polygon, kPerformanceVertexCount, queries, results, kPerformanceCount, CBHPolygonFillRuleNonZero);
+	}];
+
+	free(queries);
+	free(results);
+}
+
+@end
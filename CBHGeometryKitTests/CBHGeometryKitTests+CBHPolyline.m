@@ -0,0 +1,230 @@
+//  CBHGeometryKitTests+CBHPolyline.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+
+
+enum { kTrackCount = 4000 };
+static const NSUInteger kPerformanceCount = 1 << 20;
+
+static void CBHFillTrack(NSPoint *points, NSUInteger count, unsigned int seed)
+{
+	// A random walk on whole units which always climbs, so vertices are distinct but collinear runs are common.
+	srand(seed);
+	CGFloat x = 0.0;
+	CGFloat y = 0.0;
+
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		x += rand() % 7 - 3;
+		y += 1 + rand() % 3;
+		points[i] = NSPoint_init(x, y);
+	}
+}
+
+static void CBHFillCurve(NSPoint *points, NSUInteger count)
+{
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		CGFloat t = (CGFloat)i * 1e-4;
+		points[i] = NSPoint_init(t * 100.0 + sin(t * 7.0), cos(t * 3.0) * 50.0);
+	}
+}
+
+static CGFloat CBHSegmentDistance(NSPoint point, NSPoint start, NSPoint end)
+{
+	CGFloat dx = end.x - start.x;
+	CGFloat dy = end.y - start.y;
+	CGFloat lengthSquared = dx * dx + dy * dy;
+	if ( lengthSquared == 0.0 ) { return NSPoint_distance(point, start); }
+
+	CGFloat t = MIN(MAX(((point.x - start.x) * dx + (point.y - start.y) * dy) / lengthSquared, 0.0), 1.0);
+	return NSPoint_distance(point, NSPoint_init(start.x + t * dx, start.y + t * dy));
+}
+
+
+@interface CBHGeometryKitTests_CBHPolyline : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHPolyline
+{
+	NSPoint _original[kTrackCount];
+	NSPoint _points[kTrackCount];
+}
+
+- (void)setUp
+{
+	[super setUp];
+	CBHFillTrack(_original, kTrackCount, 11);
+	memcpy(_points, _original, sizeof(_points));
+}
+
+// The kept vertices must be a subsequence of the original which starts and ends with it.
+- (NSUInteger *)assertSubsequence:(NSUInteger)count
+{
+	NSUInteger *indexes = malloc(sizeof(NSUInteger) * count);
+	NSUInteger next = 0;
+
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		while ( next < kTrackCount && !NSPoint_isEqual(_original[next], _points[i]) ) { ++next; }
+		XCTAssertLessThan(next, (NSUInteger)kTrackCount, @"Vertex %lu is not from the original.", (unsigned long)i);
+		indexes[i] = next++;
+	}
+
+	XCTAssertEqual(indexes[0], 0UL);
+	XCTAssertEqual(indexes[count - 1], (NSUInteger)kTrackCount - 1);
+
+	return indexes;
+}
+
+
+#pragma mark - Measuring
+
+- (void)testLength
+{
+	const NSPoint points[] = { {0.0, 0.0}, {3.0, 4.0}, {3.0, 8.0} };
+
+	XCTAssertEqual(CBHPolyline_length(points, 3), 9.0);
+	XCTAssertEqual(CBHPolyline_length(points, 1), 0.0);
+	XCTAssertEqual(CBHPolyline_length(points, 0), 0.0);
+}
+
+
+#pragma mark - Douglas–Peucker
+
+- (void)testDouglasPeucker_short
+{
+	NSPoint points[2] = { {0.0, 0.0}, {1.0, 1.0} };
+
+	XCTAssertEqual(CBHPolyline_simplifyDouglasPeucker(points, 0, 1.0), 0UL);
+	XCTAssertEqual(CBHPolyline_simplifyDouglasPeucker(points, 2, 1.0), 2UL);
+}
+
+- (void)testDouglasPeucker_collinear
+{
+	NSPoint points[5] = { {0.0, 0.0}, {1.0, 1.0}, {2.0, 2.0}, {3.0, 3.0}, {4.0, 4.0} };
+
+	XCTAssertEqual(CBHPolyline_simplifyDouglasPeucker(points, 5, 0.0), 2UL);
+	XCTAssertTrue(NSPoint_isEqual(points[1], NSPoint_init(4.0, 4.0)));
+}
+
+- (void)testDouglasPeucker_tolerance
+{
+	const CGFloat tolerance = 2.5;
+	NSUInteger count = CBHPolyline_simplifyDouglasPeucker(_points, kTrackCount, tolerance);
+
+	XCTAssertGreaterThan(count, 2UL);
+	XCTAssertLessThan(count, (NSUInteger)kTrackCount);
+
+	NSUInteger *indexes = [self assertSubsequence:count];
+
+	for (NSUInteger k = 1; k < count; ++k)
+	{
+		for (NSUInteger i = indexes[k - 1] + 1; i < indexes[k]; ++i)
+		{
+			XCTAssertLessThanOrEqual(CBHSegmentDistance(_original[i], _points[k - 1], _points[k]), tolerance);
+		}
+	}
+
+	free(indexes);
+}
+
+
+#pragma mark - Visvalingam–Whyatt
+
+- (void)testVisvalingam_short
+{
+	NSPoint points[2] = { {0.0, 0.0}, {1.0, 1.0} };
+
+	XCTAssertEqual(CBHPolyline_simplifyVisvalingam(points, 1, 1.0), 1UL);
+	XCTAssertEqual(CBHPolyline_simplifyVisvalingam(points, 2, 1.0), 2UL);
+}
+
+- (void)testVisvalingam_removesSmallestFirst
+{
+	// The bump at index 4 goes first, which leaves the corner at index 1 the smallest.
+	NSPoint points[6] = { {0.0, 0.0}, {1.0, 0.0}, {2.0, 4.0}, {3.0, 0.0}, {4.0, 1.0}, {5.0, 0.0} };
+
+	XCTAssertEqual(CBHPolyline_simplifyVisvalingam(points, 6, 2.5), 4UL);
+	XCTAssertTrue(NSPoint_isEqual(points[1], NSPoint_init(2.0, 4.0)));
+	XCTAssertTrue(NSPoint_isEqual(points[2], NSPoint_init(3.0, 0.0)));
+}
+
+- (void)testVisvalingam_monotonic
+{
+	NSUInteger previous = kTrackCount;
+
+	for (CGFloat area = 0.5; area < 64.0; area *= 2.0)
+	{
+		memcpy(_points, _original, sizeof(_points));
+		NSUInteger count = CBHPolyline_simplifyVisvalingam(_points, kTrackCount, area);
+
+		XCTAssertLessThanOrEqual(count, previous);
+		free([self assertSubsequence:count]);
+		previous = count;
+	}
+
+	XCTAssertLessThan(previous, (NSUInteger)kTrackCount / 4);
+}
+
+- (void)testVisvalingam_zeroArea
+{
+	NSUInteger count = CBHPolyline_simplifyVisvalingam(_points, kTrackCount, 0.0);
+
+	XCTAssertEqual(count, (NSUInteger)kTrackCount);
+	XCTAssertEqual(memcmp(_points, _original, sizeof(_points)), 0);
+}
+
+
+#pragma mark - Performance
+
+- (void)testPerformance_simplifyDouglasPeucker
+{
+	NSPoint *curve = malloc(sizeof(NSPoint) * kPerformanceCount);
+	NSPoint *points = malloc(sizeof(NSPoint) * kPerformanceCount);
+	CBHFillCurve(curve, kPerformanceCount);
+
+	[self measureBlock:^{
+		memcpy(points, curve, sizeof(NSPoint) * kPerformanceCount);
+		CBHPolyline_simplifyDouglasPeucker(points, kPerformanceCount, 0.05);
+	}];
+
+	free(curve);
+	free(points);
+}
+
+- (void)testPerformance_simplifyVisvalingam
+{
+	NSPoint *curve = malloc(sizeof(NSPoint) * kPerformanceCount);
+	NSPoint *points = malloc(sizeof(NSPoint) * kPerformanceCount);
+	CBHFillCurve(curve, kPerformanceCount);
+
+	[self measureBlock:^{
+		memcpy(points, curve, sizeof(NSPoint) * kPerformanceCount);
+		CBHPolyline_simplifyVisvalingam(points, kPerformanceCount, 0.01);
+	}];
+
+	free(curve);
+	free(points);
+}
+
+@end
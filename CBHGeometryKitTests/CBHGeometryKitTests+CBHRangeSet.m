@@ -0,0 +1,321 @@
+//  CBHGeometryKitTests+CBHRangeSet.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+
+#define CBHAssertEqualRanges(result, expected) XCTAssertTrue(NSRange_isEqual(result, expected), @"The ranges should be the same - result:%@ expected:%@", NSRange_description(result), NSRange_description(expected))
+
+
+// Sets are checked against a bitmap of locations. Enough ranges are added to spread the set over several blocks.
+enum { kLocationCount = 4096 };
+
+typedef struct CBHBitmap
+{
+	BOOL locations[kLocationCount];
+} CBHBitmap;
+
+static NSRange CBHRandomRange(void)
+{
+	NSUInteger location = (NSUInteger)(rand() % (kLocationCount - 64));
+	NSUInteger length = (NSUInteger)(rand() % ((rand() % 4 == 0) ? 48 : 6));
+
+	return NSRange_init(location, length);
+}
+
+static void CBHBitmap_setRange(CBHBitmap *bitmap, NSRange range, BOOL value)
+{
+	for (NSUInteger i = range.location; i < NSRange_max(range); ++i)
+	{
+		bitmap->locations[i] = value;
+	}
+}
+
+
+@interface CBHGeometryKitTests_CBHRangeSet : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHRangeSet
+
+- (void)assertSet:(const CBHRangeSet *)set ranges:(const NSRange *)expected count:(NSUInteger)count
+{
+	NSRange ranges[8];
+	XCTAssertEqual(CBHRangeSet_getRanges(set, ranges, 8), count, @"Wrong range count.");
+
+	for (NSUInteger i = 0; i < MIN(count, 8UL); ++i)
+	{
+		CBHAssertEqualRanges(ranges[i], expected[i]);
+	}
+}
+
+- (void)assertSet:(const CBHRangeSet *)set matchesBitmap:(const CBHBitmap *)bitmap
+{
+	NSUInteger count = 0;
+	NSUInteger rangeCount = 0;
+
+	for (NSUInteger i = 0; i < kLocationCount; ++i)
+	{
+		BOOL isSet = bitmap->locations[i];
+		if ( isSet ) { count += 1; }
+		if ( isSet && (i == 0 || !bitmap->locations[i - 1]) ) { rangeCount += 1; }
+
+		XCTAssertEqual(CBHRangeSet_isLocationInSet(set, i), isSet, @"Wrong membership at %lu.", (unsigned long)i);
+	}
+
+	XCTAssertEqual(CBHRangeSet_count(set), count, @"Wrong count.");
+	XCTAssertEqual(CBHRangeSet_rangeCount(set), rangeCount, @"Wrong range count.");
+}
+
+
+#pragma mark - Creating Range Sets
+
+- (void)testCreation_empty
+{
+	CBHRangeSet *set = CBHRangeSet_create();
+
+	XCTAssertTrue(CBHRangeSet_isEmpty(set), @"A new set is empty.");
+	XCTAssertEqual(CBHRangeSet_count(set), 0UL, @"Wrong count.");
+	CBHAssertEqualRanges(CBHRangeSet_bounds(set), NSRange_initEmpty());
+	XCTAssertFalse(CBHRangeSet_isLocationInSet(set, 0), @"An empty set holds nothing.");
+
+	CBHRangeSet_destroy(set);
+}
+
+- (void)testCreation_copy
+{
+	CBHRangeSet *set = CBHRangeSet_createWithRange(NSRange_init(4, 4));
+	CBHRangeSet *copy = CBHRangeSet_copy(set);
+
+	XCTAssertTrue(CBHRangeSet_isEqual(set, copy), @"A copy is equal to its original.");
+
+	CBHRangeSet_removeAll(set);
+	XCTAssertFalse(CBHRangeSet_isEqual(set, copy), @"A copy is independent of its original.");
+
+	CBHRangeSet_destroy(set);
+	CBHRangeSet_destroy(copy);
+}
+
+
+#pragma mark - Modifying Range Sets
+
+- (void)testModifying_coalescing
+{
+	CBHRangeSet *set = CBHRangeSet_create();
+
+	XCTAssertTrue(CBHRangeSet_addRange(set, NSRange_init(10, 5)), @"Adding failed.");
+	XCTAssertTrue(CBHRangeSet_addRange(set, NSRange_init(0, 5)), @"Adding failed.");
+	XCTAssertTrue(CBHRangeSet_addRange(set, NSRange_init(20, 0)), @"Adding failed.");
+
+	NSRange disjoint[2] = { NSRange_init(0, 5), NSRange_init(10, 5) };
+	[self assertSet:set ranges:disjoint count:2];
+
+	XCTAssertTrue(CBHRangeSet_addRange(set, NSRange_init(5, 5)), @"Adding failed.");
+
+	NSRange touching[1] = { NSRange_init(0, 15) };
+	[self assertSet:set ranges:touching count:1];
+	CBHAssertEqualRanges(CBHRangeSet_bounds(set), NSRange_init(0, 15));
+
+	CBHRangeSet_destroy(set);
+}
+
+- (void)testModifying_removing
+{
+	CBHRangeSet *set = CBHRangeSet_createWithRange(NSRange_init(0, 20));
+
+	XCTAssertTrue(CBHRangeSet_removeRange(set, NSRange_init(5, 5)), @"Removing failed.");
+
+	NSRange split[2] = { NSRange_init(0, 5), NSRange_init(10, 10) };
+	[self assertSet:set ranges:split count:2];
+	XCTAssertEqual(CBHRangeSet_count(set), 15UL, @"Wrong count.");
+
+	XCTAssertTrue(CBHRangeSet_removeRange(set, NSRange_init(3, 10)), @"Removing failed.");
+
+	NSRange trimmed[2] = { NSRange_init(0, 3), NSRange_init(13, 7) };
+	[self assertSet:set ranges:trimmed count:2];
+
+	XCTAssertTrue(CBHRangeSet_removeRange(set, NSRange_init(0, 100)), @"Removing failed.");
+	XCTAssertTrue(CBHRangeSet_isEmpty(set), @"Everything was removed.");
+
+	CBHRangeSet_destroy(set);
+}
+
+- (void)testModifying_againstBitmap
+{
+	srand(71);
+	CBHRangeSet *set = CBHRangeSet_create();
+	CBHBitmap bitmap = {0};
+
+	for (NSUInteger i = 0; i < 20000; ++i)
+	{
+		NSRange range = CBHRandomRange();
+		BOOL isAdding = ( rand() % 3 != 0 );
+
+		if ( isAdding ) { XCTAssertTrue(CBHRangeSet_addRange(set, range), @"Adding failed."); }
+		else { XCTAssertTrue(CBHRangeSet_removeRange(set, range), @"Removing failed."); }
+
+		CBHBitmap_setRange(&bitmap, range, isAdding);
+	}
+
+	[self assertSet:set matchesBitmap:&bitmap];
+
+	CBHRangeSet_destroy(set);
+}
+
+
+#pragma mark - Combining Range Sets
+
+- (void)testCombining_againstBitmap
+{
+	srand(72);
+	CBHRangeSet *set = CBHRangeSet_create();
+	CBHRangeSet *other = CBHRangeSet_create();
+	CBHBitmap bitmap = {0};
+	CBHBitmap otherBitmap = {0};
+
+	for (NSUInteger i = 0; i < 2000; ++i)
+	{
+		NSRange range = CBHRandomRange();
+		NSRange otherRange = CBHRandomRange();
+
+		CBHRangeSet_addRange(set, range);
+		CBHRangeSet_addRange(other, otherRange);
+		CBHBitmap_setRange(&bitmap, range, YES);
+		CBHBitmap_setRange(&otherBitmap, otherRange, YES);
+	}
+
+	CBHRangeSet *result = CBHRangeSet_create();
+	CBHBitmap expected;
+
+	XCTAssertTrue(CBHRangeSet_union(result, set, other), @"Union failed.");
+	for (NSUInteger i = 0; i < kLocationCount; ++i) { expected.locations[i] = bitmap.locations[i] || otherBitmap.locations[i]; }
+	[self assertSet:result matchesBitmap:&expected];
+
+	XCTAssertTrue(CBHRangeSet_intersection(result, set, other), @"Intersection failed.");
+	for (NSUInteger i = 0; i < kLocationCount; ++i) { expected.locations[i] = bitmap.locations[i] && otherBitmap.locations[i]; }
+	[self assertSet:result matchesBitmap:&expected];
+
+	XCTAssertTrue(CBHRangeSet_subtract(set, set, other), @"Subtraction failed.");
+	for (NSUInteger i = 0; i < kLocationCount; ++i) { expected.locations[i] = bitmap.locations[i] && !otherBitmap.locations[i]; }
+	[self assertSet:set matchesBitmap:&expected];
+
+	CBHRangeSet_destroy(set);
+	CBHRangeSet_destroy(other);
+	CBHRangeSet_destroy(result);
+}
+
+
+#pragma mark - Checking Range Sets
+
+- (void)testChecking_ranges
+{
+	CBHRangeSet *set = CBHRangeSet_createWithRange(NSRange_init(10, 10));
+	CBHRangeSet_addRange(set, NSRange_init(30, 10));
+
+	XCTAssertTrue(CBHRangeSet_isLocationInSet(set, 10), @"The first location is in the set.");
+	XCTAssertFalse(CBHRangeSet_isLocationInSet(set, 20), @"The end location is not in the set.");
+	XCTAssertFalse(CBHRangeSet_isLocationInSet(set, NSUIntegerMax), @"The end location is not in the set.");
+
+	XCTAssertTrue(CBHRangeSet_isIntersectingRange(set, NSRange_init(15, 20)), @"Overlapping ranges intersect.");
+	XCTAssertFalse(CBHRangeSet_isIntersectingRange(set, NSRange_init(20, 10)), @"Ranges in a gap do not intersect.");
+	XCTAssertFalse(CBHRangeSet_isIntersectingRange(set, NSRange_init(12, 0)), @"Empty ranges never intersect.");
+
+	XCTAssertTrue(CBHRangeSet_isCoveringRange(set, NSRange_init(30, 10)), @"A held range is covered.");
+	XCTAssertFalse(CBHRangeSet_isCoveringRange(set, NSRange_init(15, 20)), @"A range over a gap is not covered.");
+	XCTAssertFalse(CBHRangeSet_isCoveringRange(set, NSRange_init(12, 0)), @"Empty ranges are never covered.");
+
+	CBHRangeSet_destroy(set);
+}
+
+
+#pragma mark - Iterating Ranges
+
+- (void)testIterating_location
+{
+	CBHRangeSet *set = CBHRangeSet_create();
+	for (NSUInteger i = 0; i < 1000; ++i)
+	{
+		CBHRangeSet_addRange(set, NSRange_init(i * 10, 5));
+	}
+
+	CBHRangeSetIterator iterator = CBHRangeSetIterator_initWithLocation(set, 4502);
+	NSRange range;
+
+	XCTAssertTrue(CBHRangeSetIterator_next(&iterator, &range), @"Missing range.");
+	CBHAssertEqualRanges(range, NSRange_init(4500, 5));
+	XCTAssertTrue(CBHRangeSetIterator_next(&iterator, &range), @"Missing range.");
+	CBHAssertEqualRanges(range, NSRange_init(4510, 5));
+
+	iterator = CBHRangeSetIterator_initWithLocation(set, 4505);
+	XCTAssertTrue(CBHRangeSetIterator_next(&iterator, &range), @"Missing range.");
+	CBHAssertEqualRanges(range, NSRange_init(4510, 5));
+
+	iterator = CBHRangeSetIterator_initWithLocation(set, 9995);
+	XCTAssertFalse(CBHRangeSetIterator_next(&iterator, &range), @"The iterator should be exhausted.");
+
+	CBHRangeSet_destroy(set);
+}
+
+- (void)testIterating_capacity
+{
+	CBHRangeSet *set = CBHRangeSet_createWithRange(NSRange_init(0, 1));
+	CBHRangeSet_addRange(set, NSRange_init(2, 1));
+	NSRange buffer[2] = { NSRange_initEmpty(), NSRange_initEmpty() };
+
+	XCTAssertEqual(CBHRangeSet_getRanges(set, NULL, 0), 2UL, @"Wrong range count.");
+	XCTAssertEqual(CBHRangeSet_getRanges(set, buffer, 1), 2UL, @"Wrong range count.");
+	CBHAssertEqualRanges(buffer[0], NSRange_init(0, 1));
+	CBHAssertEqualRanges(buffer[1], NSRange_initEmpty());
+
+	CBHRangeSet_destroy(set);
+}
+
+
+#pragma mark - Performance
+
+static const NSUInteger kPerformanceCount = 200000;
+
+- (void)testPerformance_indexSet
+{
+	srand(73);
+
+	[self measureBlock:^{
+		NSMutableIndexSet *set = [NSMutableIndexSet indexSet];
+		for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+		{
+			[set addIndexesInRange:NSRange_init((NSUInteger)rand() % 100000000, (NSUInteger)(rand() % 100 + 1))];
+		}
+	}];
+}
+
+- (void)testPerformance_rangeSet
+{
+	srand(73);
+
+	[self measureBlock:^{
+		CBHRangeSet *set = CBHRangeSet_create();
+		for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+		{
+			CBHRangeSet_addRange(set, NSRange_init((NSUInteger)rand() % 100000000, (NSUInteger)(rand() % 100 + 1)));
+		}
+		CBHRangeSet_destroy(set);
+	}];
+}
+
+@end
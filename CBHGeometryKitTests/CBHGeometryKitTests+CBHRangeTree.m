@@ -0,0 +1,338 @@
+//  CBHGeometryKitTests+CBHRangeTree.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+
+#define CBHAssertEqualRanges(result, expected) XCTAssertTrue(NSRange_isEqual(result, expected), @"The ranges should be the same - result:%@ expected:%@", NSRange_description(result), NSRange_description(expected))
+
+
+enum { kRangeCount = 1733 };
+
+static NSRange CBHRandomRange(void)
+{
+	// Some ranges are empty, not found, or run past the last location.
+	switch ( rand() % 40 )
+	{
+		case 0: return NSRange_init(NSNotFound, (NSUInteger)(rand() % 4));
+		case 1: return NSRange_init(NSUIntegerMax - 2, 8);
+		default: return NSRange_init((NSUInteger)(rand() % 2000), (NSUInteger)(rand() % ((rand() % 5 == 0) ? 200 : 20)));
+	}
+}
+
+static BOOL CBHIsReportable(NSRange range)
+{
+	return ( range.length > 0 ) && ( range.location != NSNotFound ) && ( range.location <= NSUIntegerMax - range.length );
+}
+
+static int CBHCompareIndexes(const void *a, const void *b)
+{
+	NSUInteger lhs = *(const NSUInteger *)a;
+	NSUInteger rhs = *(const NSUInteger *)b;
+
+	return (lhs > rhs) - (lhs < rhs);
+}
+
+typedef struct CBHCollector
+{
+	NSUInteger indexes[kRangeCount];
+	NSUInteger count;
+	NSUInteger limit;
+} CBHCollector;
+
+static void CBHCollect(NSUInteger index, void *context, BOOL *stop)
+{
+	CBHCollector *collector = context;
+	collector->indexes[collector->count++] = index;
+
+	if ( collector->count == collector->limit ) { *stop = YES; }
+}
+
+
+@interface CBHGeometryKitTests_CBHRangeTree : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHRangeTree
+{
+	NSRange _ranges[kRangeCount];
+	BOOL _isLive[kRangeCount];
+	CBHRangeTree *_tree;
+}
+
+- (void)setUp
+{
+	srand(81);
+	for (NSUInteger i = 0; i < kRangeCount; ++i)
+	{
+		_ranges[i] = CBHRandomRange();
+		_isLive[i] = YES;
+	}
+
+	_tree = CBHRangeTree_createWithRanges(_ranges, kRangeCount);
+}
+
+- (void)tearDown
+{
+	CBHRangeTree_destroy(_tree);
+}
+
+- (void)assertIndexes:(NSUInteger *)indexes count:(NSUInteger)count matchPredicate:(BOOL (^)(NSRange range))predicate
+{
+	for (NSUInteger i = 1; i < count; ++i)
+	{
+		XCTAssertLessThanOrEqual(_ranges[indexes[i - 1]].location, _ranges[indexes[i]].location, @"Matches should be in order of location.");
+	}
+
+	NSUInteger expected[kRangeCount];
+	NSUInteger expectedCount = 0;
+	for (NSUInteger i = 0; i < kRangeCount; ++i)
+	{
+		if ( _isLive[i] && CBHIsReportable(_ranges[i]) && predicate(_ranges[i]) ) { expected[expectedCount++] = i; }
+	}
+
+	qsort(indexes, count, sizeof(NSUInteger), CBHCompareIndexes);
+
+	XCTAssertEqual(count, expectedCount, @"Wrong match count.");
+	for (NSUInteger i = 0; i < MIN(count, expectedCount); ++i)
+	{
+		XCTAssertEqual(indexes[i], expected[i], @"Wrong match.");
+	}
+}
+
+
+#pragma mark - Creating Range Trees
+
+- (void)testCreation_empty
+{
+	CBHRangeTree *tree = CBHRangeTree_create();
+	NSUInteger indexes[1];
+
+	XCTAssertEqual(CBHRangeTree_count(tree), 0UL, @"Wrong count.");
+	XCTAssertEqual(CBHRangeTree_overlappingIndexes(tree, NSRange_init(0, 100), indexes, 1), 0UL, @"An empty tree holds nothing.");
+	CBHAssertEqualRanges(CBHRangeTree_rangeAtIndex(tree, 0), NSRange_init(NSNotFound, 0));
+
+	CBHRangeTree_destroy(tree);
+}
+
+- (void)testCreation_unreportableRanges
+{
+	NSRange ranges[3] = { NSRange_init(5, 0), NSRange_init(NSNotFound, 2), NSRange_init(NSUIntegerMax - 1, 4) };
+	CBHRangeTree *tree = CBHRangeTree_createWithRanges(ranges, 3);
+
+	XCTAssertEqual(CBHRangeTree_count(tree), 3UL, @"Wrong count.");
+	CBHAssertEqualRanges(CBHRangeTree_rangeAtIndex(tree, 1), ranges[1]);
+	XCTAssertEqual(CBHRangeTree_overlappingIndexes(tree, NSRange_init(0, NSUIntegerMax), NULL, 0), 0UL, @"These ranges are never reported.");
+	XCTAssertEqual(CBHRangeTree_containingLocationIndexes(tree, 5, NULL, 0), 0UL, @"Empty ranges contain no locations.");
+
+	CBHRangeTree_destroy(tree);
+}
+
+
+#pragma mark - Modifying Range Trees
+
+- (void)testModifying_insertAndRemove
+{
+	srand(82);
+	for (NSUInteger i = 0; i < 4000; ++i)
+	{
+		NSUInteger index = (NSUInteger)rand() % kRangeCount;
+
+		if ( _isLive[index] )
+		{
+			XCTAssertTrue(CBHRangeTree_removeIndex(_tree, index), @"Removing failed.");
+			XCTAssertFalse(CBHRangeTree_removeIndex(_tree, index), @"An index can only be removed once.");
+			_isLive[index] = NO;
+		}
+		else
+		{
+			NSRange range = CBHRandomRange();
+			NSUInteger inserted = CBHRangeTree_insertRange(_tree, range);
+
+			XCTAssertLessThan(inserted, (NSUInteger)kRangeCount, @"Removed indexes should be reused.");
+			XCTAssertFalse(_isLive[inserted], @"Live indexes should not be reused.");
+			_ranges[inserted] = range;
+			_isLive[inserted] = YES;
+		}
+	}
+
+	NSUInteger liveCount = 0;
+	for (NSUInteger i = 0; i < kRangeCount; ++i)
+	{
+		if ( _isLive[i] ) { liveCount += 1; }
+	}
+	XCTAssertEqual(CBHRangeTree_count(_tree), liveCount, @"Wrong count.");
+
+	NSUInteger indexes[kRangeCount];
+	NSRange query = NSRange_init(400, 300);
+	NSUInteger count = CBHRangeTree_overlappingIndexes(_tree, query, indexes, kRangeCount);
+	[self assertIndexes:indexes count:count matchPredicate:^BOOL(NSRange range) {
+		return NSRange_intersection(range, query).length > 0;
+	}];
+}
+
+- (void)testModifying_growing
+{
+	CBHRangeTree *tree = CBHRangeTree_create();
+	for (NSUInteger i = 0; i < 1000; ++i)
+	{
+		XCTAssertEqual(CBHRangeTree_insertRange(tree, NSRange_init(i, 10)), i, @"Indexes are assigned in order.");
+	}
+
+	XCTAssertEqual(CBHRangeTree_containingLocationIndexes(tree, 500, NULL, 0), 10UL, @"Wrong match count.");
+	XCTAssertFalse(CBHRangeTree_removeIndex(tree, 1000), @"Unused indexes cannot be removed.");
+
+	CBHRangeTree_destroy(tree);
+}
+
+
+#pragma mark - Querying Indexes
+
+- (void)testIndexes_overlapping
+{
+	NSRange queries[4] = { NSRange_init(0, 1), NSRange_init(100, 50), NSRange_init(1500, 1000), NSRange_init(0, NSUIntegerMax) };
+	NSUInteger indexes[kRangeCount];
+
+	for (NSUInteger q = 0; q < 4; ++q)
+	{
+		NSRange query = queries[q];
+		NSUInteger count = CBHRangeTree_overlappingIndexes(_tree, query, indexes, kRangeCount);
+
+		[self assertIndexes:indexes count:count matchPredicate:^BOOL(NSRange range) {
+			return NSRange_intersection(range, query).length > 0;
+		}];
+	}
+}
+
+- (void)testIndexes_containingLocation
+{
+	NSUInteger locations[4] = { 0, 17, 999, 2100 };
+	NSUInteger indexes[kRangeCount];
+
+	for (NSUInteger q = 0; q < 4; ++q)
+	{
+		NSUInteger location = locations[q];
+		NSUInteger count = CBHRangeTree_containingLocationIndexes(_tree, location, indexes, kRangeCount);
+
+		[self assertIndexes:indexes count:count matchPredicate:^BOOL(NSRange range) {
+			return NSRange_isLocationInRange(range, location);
+		}];
+	}
+}
+
+- (void)testIndexes_conventions
+{
+	XCTAssertEqual(CBHRangeTree_overlappingIndexes(_tree, NSRange_init(100, 0), NULL, 0), 0UL, @"Empty queries match nothing.");
+	XCTAssertEqual(CBHRangeTree_overlappingIndexes(_tree, NSRange_init(NSNotFound, 10), NULL, 0), 0UL, @"Not found queries match nothing.");
+	XCTAssertEqual(CBHRangeTree_containingLocationIndexes(_tree, NSNotFound, NULL, 0), 0UL, @"Not found queries match nothing.");
+	XCTAssertEqual(CBHRangeTree_containingLocationIndexes(_tree, NSUIntegerMax, NULL, 0), 0UL, @"No range holds the last location.");
+}
+
+- (void)testIndexes_capacity
+{
+	NSRange query = NSRange_init(0, 2000);
+	NSUInteger total = CBHRangeTree_overlappingIndexes(_tree, query, NULL, 0);
+	NSUInteger indexes[kRangeCount];
+
+	XCTAssertGreaterThan(total, 10UL, @"The query should match several ranges.");
+	XCTAssertEqual(CBHRangeTree_overlappingIndexes(_tree, query, indexes, 10), total, @"The total should not depend on capacity.");
+}
+
+
+#pragma mark - Enumerating Matches
+
+- (void)testEnumeration_overlapping
+{
+	CBHCollector collector = { .count = 0, .limit = kRangeCount };
+	NSRange query = NSRange_init(250, 75);
+	CBHRangeTree_enumerateOverlapping(_tree, query, CBHCollect, &collector);
+
+	[self assertIndexes:collector.indexes count:collector.count matchPredicate:^BOOL(NSRange range) {
+		return NSRange_intersection(range, query).length > 0;
+	}];
+}
+
+- (void)testEnumeration_stop
+{
+	CBHCollector collector = { .count = 0, .limit = 3 };
+	CBHRangeTree_enumerateContainingLocation(_tree, 1000, CBHCollect, &collector);
+
+	XCTAssertEqual(collector.count, 3UL, @"Enumeration should stop when asked.");
+}
+
+
+#pragma mark - Performance
+
+static const NSUInteger kPerformanceCount = 1 << 18;
+static const NSUInteger kPerformanceLoopQueries = 100;
+static const NSUInteger kPerformanceTreeQueries = 10000;
+
+static void CBHFillSpans(NSRange *ranges, NSUInteger count)
+{
+	srand(83);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		ranges[i] = NSRange_init((NSUInteger)rand() % 10000000, (NSUInteger)(rand() % 200 + 1));
+	}
+}
+
+- (void)testPerformance_overlappingLoop
+{
+	NSRange *ranges = malloc(sizeof(NSRange) * kPerformanceCount);
+	NSUInteger *indexes = malloc(sizeof(NSUInteger) * kPerformanceCount);
+	CBHFillSpans(ranges, kPerformanceCount);
+
+	[self measureBlock:^{
+		for (NSUInteger q = 0; q < kPerformanceLoopQueries; ++q)
+		{
+			NSRange query = NSRange_init((q * 7919) % 10000000, 1000);
+			NSUInteger count = 0;
+
+			for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+			{
+				if ( NSRange_intersection(ranges[i], query).length > 0 ) { indexes[count++] = i; }
+			}
+		}
+	}];
+
+	free(ranges);
+	free(indexes);
+}
+
+- (void)testPerformance_overlappingTree
+{
+	NSRange *ranges = malloc(sizeof(NSRange) * kPerformanceCount);
+	NSUInteger *indexes = malloc(sizeof(NSUInteger) * kPerformanceCount);
+	CBHFillSpans(ranges, kPerformanceCount);
+
+	CBHRangeTree *tree = CBHRangeTree_createWithRanges(ranges, kPerformanceCount);
+
+	[self measureBlock:^{
+		for (NSUInteger q = 0; q < kPerformanceTreeQueries; ++q)
+		{
+			CBHRangeTree_overlappingIndexes(tree, NSRange_init((q * 7919) % 10000000, 1000), indexes, kPerformanceCount);
+		}
+	}];
+
+	CBHRangeTree_destroy(tree);
+	free(ranges);
+	free(indexes);
+}
+
+@end
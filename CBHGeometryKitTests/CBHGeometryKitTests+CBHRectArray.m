@@ -0,0 +1,376 @@
+//  CBHGeometryKitTests+CBHRectArray.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+
+#define CBHAssertEqualRects(result, expected) XCTAssertTrue(NSRect_isEqual(result, expected), @"The rects should be the same - result:%@ expected:%@", NSRect_description(result), NSRect_description(expected))
+
+
+enum { kRectCount = 131 };
+
+static void CBHFillRects(NSRect *rects, NSUInteger count, unsigned int seed)
+{
+	srand(seed);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		// Quarter unit steps over a small span so edges coincide and some sizes are 0 or negative.
+		CGFloat x = (CGFloat)(rand() % 160) / 4.0 - 20.0;
+		CGFloat y = (CGFloat)(rand() % 160) / 4.0 - 20.0;
+		CGFloat width = (CGFloat)(rand() % 120) / 4.0 - 5.0;
+		CGFloat height = (CGFloat)(rand() % 120) / 4.0 - 5.0;
+
+		rects[i] = NSRect_init(x, y, width, height);
+	}
+}
+
+static BOOL CBHMaskBit(const uint64_t *mask, NSUInteger index)
+{
+	return ( (mask[index / 64] >> (index % 64)) & 1 ) != 0;
+}
+
+
+@interface CBHGeometryKitTests_CBHRectArray : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHRectArray
+{
+	NSRect _rects[kRectCount];
+	CBHRectArray _array;
+}
+
+- (void)setUp
+{
+	CBHFillRects(_rects, kRectCount, 11);
+	XCTAssertTrue(CBHRectArray_initWithRects(&_array, _rects, kRectCount), @"Initialization should succeed.");
+}
+
+- (void)tearDown
+{
+	CBHRectArray_destroy(&_array);
+}
+
+
+#pragma mark - Creating Rect Arrays
+
+- (void)testInitialization_empty
+{
+	CBHRectArray array;
+
+	XCTAssertTrue(CBHRectArray_init(&array, 0), @"Initialization should succeed.");
+	XCTAssertEqual(array.count, 0UL, @"Wrong count.");
+
+	CBHRectArray_destroy(&array);
+}
+
+- (void)testInitialization_rects
+{
+	XCTAssertEqual(_array.count, (NSUInteger)kRectCount, @"Wrong count.");
+
+	for (NSUInteger i = 0; i < kRectCount; ++i)
+	{
+		CBHAssertEqualRects(CBHRectArray_rectAtIndex(&_array, i), _rects[i]);
+	}
+}
+
+- (void)testInitialization_alignment
+{
+	XCTAssertEqual((uintptr_t)_array.x % 64, 0UL, @"The x column should be aligned.");
+	XCTAssertEqual((uintptr_t)_array.y % 64, 0UL, @"The y column should be aligned.");
+	XCTAssertEqual((uintptr_t)_array.width % 64, 0UL, @"The width column should be aligned.");
+	XCTAssertEqual((uintptr_t)_array.height % 64, 0UL, @"The height column should be aligned.");
+}
+
+
+#pragma mark - Managing Storage
+
+- (void)testStorage_growth
+{
+	CBHRectArray array;
+	CBHRectArray_init(&array, 1);
+
+	for (NSUInteger i = 0; i < kRectCount; ++i)
+	{
+		XCTAssertTrue(CBHRectArray_append(&array, _rects[i]), @"Append should succeed.");
+	}
+
+	XCTAssertEqual(array.count, (NSUInteger)kRectCount, @"Wrong count.");
+	XCTAssertGreaterThanOrEqual(array.capacity, array.count, @"Capacity should cover the count.");
+
+	for (NSUInteger i = 0; i < kRectCount; ++i)
+	{
+		CBHAssertEqualRects(CBHRectArray_rectAtIndex(&array, i), _rects[i]);
+	}
+
+	CBHRectArray_destroy(&array);
+}
+
+- (void)testStorage_removeAll
+{
+	NSUInteger capacity = _array.capacity;
+
+	CBHRectArray_removeAll(&_array);
+
+	XCTAssertEqual(_array.count, 0UL, @"Wrong count.");
+	XCTAssertEqual(_array.capacity, capacity, @"Capacity should be kept.");
+}
+
+
+#pragma mark - Adding and Accessing Rects
+
+- (void)testAccess_setRect
+{
+	NSRect rect = NSRect_init(1.0, 2.0, 3.0, 4.0);
+
+	CBHRectArray_setRectAtIndex(&_array, rect, 7);
+
+	CBHAssertEqualRects(CBHRectArray_rectAtIndex(&_array, 7), rect);
+}
+
+- (void)testAccess_getRects
+{
+	NSRect rects[10];
+
+	CBHRectArray_getRects(&_array, rects, NSRange_init(20, 10));
+
+	for (NSUInteger i = 0; i < 10; ++i)
+	{
+		CBHAssertEqualRects(rects[i], _rects[20 + i]);
+	}
+}
+
+
+#pragma mark - Checking Rects
+
+- (void)testMask_isEmpty
+{
+	uint64_t mask[(kRectCount + 63) / 64];
+	NSUInteger expected = 0;
+
+	NSUInteger matches = CBHRectArray_isEmptyMask(&_array, mask);
+
+	for (NSUInteger i = 0; i < kRectCount; ++i)
+	{
+		BOOL isEmpty = NSRect_isEmpty(_rects[i]);
+		XCTAssertEqual(CBHMaskBit(mask, i), isEmpty, @"Wrong result at %lu.", (unsigned long)i);
+		expected += ( isEmpty ) ? 1 : 0;
+	}
+
+	XCTAssertEqual(matches, expected, @"Wrong match count.");
+}
+
+- (void)testMask_isIntersecting
+{
+	NSRect rect = NSRect_init(-2.0, -3.0, 12.5, 9.25);
+	uint64_t mask[(kRectCount + 63) / 64];
+
+	CBHRectArray_isIntersectingMask(&_array, rect, mask);
+
+	for (NSUInteger i = 0; i < kRectCount; ++i)
+	{
+		XCTAssertEqual(CBHMaskBit(mask, i), NSRect_isIntersecting(_rects[i], rect), @"Wrong result at %lu.", (unsigned long)i);
+	}
+}
+
+- (void)testMask_isCovering
+{
+	NSRect rect = NSRect_init(1.0, 1.0, 2.0, 2.0);
+	uint64_t mask[(kRectCount + 63) / 64];
+
+	CBHRectArray_isCoveringMask(&_array, rect, mask);
+
+	for (NSUInteger i = 0; i < kRectCount; ++i)
+	{
+		XCTAssertEqual(CBHMaskBit(mask, i), NSRect_isCovering(_rects[i], rect), @"Wrong result at %lu.", (unsigned long)i);
+	}
+}
+
+- (void)testMask_isCoveredBy
+{
+	NSRect rect = NSRect_init(-10.0, -10.0, 30.0, 30.0);
+	uint64_t mask[(kRectCount + 63) / 64];
+
+	CBHRectArray_isCoveredByMask(&_array, rect, mask);
+
+	for (NSUInteger i = 0; i < kRectCount; ++i)
+	{
+		XCTAssertEqual(CBHMaskBit(mask, i), NSRect_isCovering(rect, _rects[i]), @"Wrong result at %lu.", (unsigned long)i);
+	}
+}
+
+- (void)testMask_isPointInRect
+{
+	NSPoint point = NSPoint_init(2.0, 3.0);
+	uint64_t mask[(kRectCount + 63) / 64];
+
+	CBHRectArray_isPointInRectMask(&_array, point, mask);
+
+	for (NSUInteger i = 0; i < kRectCount; ++i)
+	{
+		XCTAssertEqual(CBHMaskBit(mask, i), NSRect_isPointInRect(_rects[i], point), @"Wrong result at %lu.", (unsigned long)i);
+	}
+}
+
+- (void)testMask_unusedBitsCleared
+{
+	uint64_t mask[(kRectCount + 63) / 64];
+	memset(mask, 0xFF, sizeof(mask));
+
+	CBHRectArray_isIntersectingMask(&_array, NSRect_init(-100.0, -100.0, 200.0, 200.0), mask);
+
+	XCTAssertEqual(mask[kRectCount / 64] >> (kRectCount % 64), 0ULL, @"Bits past the count should be clear.");
+}
+
+- (void)testIndexes_isIntersecting
+{
+	NSRect rect = NSRect_init(-2.0, -3.0, 12.5, 9.25);
+	NSUInteger indexes[kRectCount];
+	NSUInteger expected = 0;
+
+	NSUInteger count = CBHRectArray_isIntersectingIndexes(&_array, rect, indexes);
+
+	for (NSUInteger i = 0; i < kRectCount; ++i)
+	{
+		if ( !NSRect_isIntersecting(_rects[i], rect) ) { continue; }
+
+		XCTAssertLessThan(expected, count, @"Too few indexes.");
+		XCTAssertEqual(indexes[expected], i, @"Wrong index.");
+		expected += 1;
+	}
+
+	XCTAssertEqual(count, expected, @"Wrong index count.");
+}
+
+- (void)testIndexes_emptyQuery
+{
+	NSUInteger indexes[kRectCount];
+
+	XCTAssertEqual(CBHRectArray_isIntersectingIndexes(&_array, NSRect_initEmpty(), indexes), 0UL, @"An empty rect intersects nothing.");
+	XCTAssertEqual(CBHRectArray_isCoveringIndexes(&_array, NSRect_initEmpty(), indexes), 0UL, @"An empty rect is never covered.");
+}
+
+
+#pragma mark - Snapping Rects to Pixels
+
+- (void)assertSnapping:(void (*)(CBHRectArray *, CGFloat))snap matchesBatch:(void (*)(const NSRect *, NSRect *, NSUInteger, CGFloat))batch
+{
+	const CGFloat scales[] = { 1.0, 1.5, 2.0, 3.0 };
+
+	for (NSUInteger s = 0; s < sizeof(scales) / sizeof(*scales); ++s)
+	{
+		CBHRectArray array;
+		XCTAssertTrue(CBHRectArray_initWithRects(&array, _rects, kRectCount));
+
+		NSRect expected[kRectCount];
+		batch(_rects, expected, kRectCount, scales[s]);
+		snap(&array, scales[s]);
+
+		for (NSUInteger i = 0; i < kRectCount; ++i)
+		{
+			const NSRect rect = CBHRectArray_rectAtIndex(&array, i);
+			XCTAssertEqual(memcmp(&rect, &expected[i], sizeof(NSRect)), 0, @"The rects should be identical - result:%@ expected:%@", NSRect_description(rect), NSRect_description(expected[i]));
+		}
+
+		CBHRectArray_destroy(&array);
+	}
+}
+
+- (void)testSnapping_matchesBatch
+{
+	[self assertSnapping:CBHRectArray_integral matchesBatch:NSRect_integralRects];
+	[self assertSnapping:CBHRectArray_truncate matchesBatch:NSRect_truncateRects];
+	[self assertSnapping:CBHRectArray_round matchesBatch:NSRect_roundRects];
+	[self assertSnapping:CBHRectArray_alignWithPixels matchesBatch:NSRect_alignRectsWithPixels];
+}
+
+- (void)testSnapping_integral
+{
+	CBHRectArray_integral(&_array, 1.0);
+
+	for (NSUInteger i = 0; i < kRectCount; ++i)
+	{
+		CBHAssertEqualRects(CBHRectArray_rectAtIndex(&_array, i), NSRect_integral(_rects[i]));
+	}
+}
+
+- (void)testSnapping_integralNaN
+{
+	NSRect rects[9];
+	for (NSUInteger i = 0; i < 9; ++i)
+	{
+		rects[i] = NSRect_init(1.5 * i, -0.5 * i, ( i % 3 == 0 ) ? NAN : 2.25, ( i % 3 == 1 ) ? NAN : 3.75);
+	}
+
+	CBHRectArray array;
+	XCTAssertTrue(CBHRectArray_initWithRects(&array, rects, 9));
+	CBHRectArray_integral(&array, 1.0);
+
+	for (NSUInteger i = 0; i < 9; ++i)
+	{
+		CBHAssertEqualRects(CBHRectArray_rectAtIndex(&array, i), NSRect_integral(rects[i]));
+	}
+
+	CBHRectArray_destroy(&array);
+}
+
+
+#pragma mark - Performance
+
+static const NSUInteger kPerformanceCount = 1 << 20;
+
+- (void)testPerformance_intersectingLoop
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	NSUInteger *indexes = malloc(sizeof(NSUInteger) * kPerformanceCount);
+	CBHFillRects(rects, kPerformanceCount, 12);
+	NSRect viewport = NSRect_init(0.0, 0.0, 10.0, 10.0);
+
+	[self measureBlock:^{
+		NSUInteger count = 0;
+		for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+		{
+			if ( NSRect_isIntersecting(rects[i], viewport) ) { indexes[count++] = i; }
+		}
+	}];
+
+	free(rects);
+	free(indexes);
+}
+
+- (void)testPerformance_intersectingIndexes
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	NSUInteger *indexes = malloc(sizeof(NSUInteger) * kPerformanceCount);
+	CBHFillRects(rects, kPerformanceCount, 12);
+	NSRect viewport = NSRect_init(0.0, 0.0, 10.0, 10.0);
+
+	CBHRectArray array;
+	CBHRectArray_initWithRects(&array, rects, kPerformanceCount);
+
+	[self measureBlock:^{
+		CBHRectArray_isIntersectingIndexes(&array, viewport, indexes);
+	}];
+
+	CBHRectArray_destroy(&array);
+	free(rects);
+	free(indexes);
+}
+
+@end
@@ -0,0 +1,369 @@
+//  CBHGeometryKitTests+CBHRectTree.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+
+#define CBHAssertEqualRects(result, expected) XCTAssertTrue(NSRect_isEqual(result, expected), @"The rects should be the same - result:%@ expected:%@", NSRect_description(result), NSRect_description(expected))
+
+
+enum { kRectCount = 2311 };
+
+static void CBHFillRects(NSRect *rects, NSUInteger count, unsigned int seed)
+{
+	srand(seed);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		// Quarter unit steps so edges coincide and some sizes are 0 or negative.
+		CGFloat x = (CGFloat)(rand() % 800) / 4.0 - 100.0;
+		CGFloat y = (CGFloat)(rand() % 800) / 4.0 - 100.0;
+		CGFloat width = (CGFloat)(rand() % 60) / 4.0 - 2.0;
+		CGFloat height = (CGFloat)(rand() % 60) / 4.0 - 2.0;
+
+		rects[i] = NSRect_init(x, y, width, height);
+	}
+}
+
+static int CBHCompareIndexes(const void *a, const void *b)
+{
+	NSUInteger lhs = *(const NSUInteger *)a;
+	NSUInteger rhs = *(const NSUInteger *)b;
+
+	return (lhs > rhs) - (lhs < rhs);
+}
+
+typedef struct CBHCollector
+{
+	NSUInteger indexes[kRectCount];
+	NSUInteger count;
+	NSUInteger limit;
+} CBHCollector;
+
+static void CBHCollect(NSUInteger index, void *context, BOOL *stop)
+{
+	CBHCollector *collector = context;
+	collector->indexes[collector->count++] = index;
+
+	if ( collector->count == collector->limit ) { *stop = YES; }
+}
+
+
+@interface CBHGeometryKitTests_CBHRectTree : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHRectTree
+{
+	NSRect _rects[kRectCount];
+	CBHRectTree *_tree;
+}
+
+- (void)setUp
+{
+	CBHFillRects(_rects, kRectCount, 21);
+	_tree = CBHRectTree_createWithRects(_rects, kRectCount);
+	XCTAssertTrue(_tree != NULL, @"Creation should succeed.");
+}
+
+- (void)tearDown
+{
+	CBHRectTree_destroy(_tree);
+}
+
+- (void)assertIndexes:(NSUInteger *)indexes count:(NSUInteger)count matchPredicate:(BOOL (^)(NSRect rect))predicate
+{
+	qsort(indexes, count, sizeof(NSUInteger), CBHCompareIndexes);
+
+	NSUInteger expected = 0;
+	for (NSUInteger i = 0; i < kRectCount; ++i)
+	{
+		if ( !predicate(_rects[i]) ) { continue; }
+
+		XCTAssertLessThan(expected, count, @"Too few indexes.");
+		if ( expected < count ) { XCTAssertEqual(indexes[expected], i, @"Wrong index."); }
+		expected += 1;
+	}
+
+	XCTAssertEqual(count, expected, @"Wrong index count.");
+}
+
+
+#pragma mark - Creating Rect Trees
+
+- (void)testCreation_empty
+{
+	NSRect rects[1] = { NSZeroRect };
+	CBHRectTree *tree = CBHRectTree_createWithRects(rects, 0);
+	NSUInteger indexes[1];
+
+	XCTAssertEqual(CBHRectTree_count(tree), 0UL, @"Wrong count.");
+	CBHAssertEqualRects(CBHRectTree_bounds(tree), NSZeroRect);
+	XCTAssertEqual(CBHRectTree_intersectingIndexes(tree, NSRect_init(-1.0, -1.0, 2.0, 2.0), indexes, 1), 0UL, @"An empty tree holds nothing.");
+
+	CBHRectTree_destroy(tree);
+}
+
+- (void)testCreation_onlyEmptyRects
+{
+	NSRect rects[3] = { NSRect_init(0.0, 0.0, 0.0, 1.0), NSRect_init(0.0, 0.0, 1.0, -1.0), NSRect_init(0.0, 0.0, -1.0, -1.0) };
+	CBHRectTree *tree = CBHRectTree_createWithRects(rects, 3);
+	NSUInteger indexes[3];
+
+	XCTAssertEqual(CBHRectTree_count(tree), 3UL, @"Wrong count.");
+	XCTAssertEqual(CBHRectTree_coveredByIndexes(tree, NSRect_init(-5.0, -5.0, 10.0, 10.0), indexes, 3), 0UL, @"Empty rects are never covered.");
+	XCTAssertEqual(CBHRectTree_containingPointIndexes(tree, NSZeroPoint, indexes, 3), 0UL, @"Empty rects contain no points.");
+
+	CBHRectTree_destroy(tree);
+}
+
+
+#pragma mark - Properties
+
+- (void)testProperties_count
+{
+	XCTAssertEqual(CBHRectTree_count(_tree), (NSUInteger)kRectCount, @"Wrong count.");
+}
+
+- (void)testProperties_bounds
+{
+	NSRect expected = NSZeroRect;
+	for (NSUInteger i = 0; i < kRectCount; ++i)
+	{
+		expected = NSRect_union(expected, _rects[i]);
+	}
+
+	CBHAssertEqualRects(CBHRectTree_bounds(_tree), expected);
+}
+
+
+#pragma mark - Querying Indexes
+
+- (void)testIndexes_intersecting
+{
+	NSRect queries[4] = { NSRect_init(-2.0, -3.0, 12.5, 9.25), NSRect_init(0.0, 0.0, 0.25, 0.25), NSRect_init(-50.0, -20.0, 80.0, 45.75), NSRect_init(-1000.0, -1000.0, 2000.0, 2000.0) };
+	NSUInteger indexes[kRectCount];
+
+	for (NSUInteger q = 0; q < 4; ++q)
+	{
+		NSRect rect = queries[q];
+		NSUInteger count = CBHRectTree_intersectingIndexes(_tree, rect, indexes, kRectCount);
+
+		[self assertIndexes:indexes count:count matchPredicate:^BOOL (NSRect element) {
+			return NSRect_isIntersecting(element, rect);
+		}];
+	}
+}
+
+- (void)testIndexes_coveredBy
+{
+	NSRect queries[3] = { NSRect_init(-10.0, -10.0, 30.0, 30.0), NSRect_init(0.0, 0.0, 5.0, 5.0), NSRect_init(-1000.0, -1000.0, 2000.0, 2000.0) };
+	NSUInteger indexes[kRectCount];
+
+	for (NSUInteger q = 0; q < 3; ++q)
+	{
+		NSRect rect = queries[q];
+		NSUInteger count = CBHRectTree_coveredByIndexes(_tree, rect, indexes, kRectCount);
+
+		[self assertIndexes:indexes count:count matchPredicate:^BOOL (NSRect element) {
+			return NSRect_isCovering(rect, element);
+		}];
+	}
+}
+
+- (void)testIndexes_containingPoint
+{
+	NSPoint points[3] = { NSPoint_init(2.0, 3.0), NSPoint_init(-20.25, 7.5), NSPoint_init(0.0, 0.0) };
+	NSUInteger indexes[kRectCount];
+
+	for (NSUInteger q = 0; q < 3; ++q)
+	{
+		NSPoint point = points[q];
+		NSUInteger count = CBHRectTree_containingPointIndexes(_tree, point, indexes, kRectCount);
+
+		[self assertIndexes:indexes count:count matchPredicate:^BOOL (NSRect element) {
+			return NSRect_isPointInRect(element, point);
+		}];
+	}
+}
+
+- (void)testIndexes_edges
+{
+	NSRect rects[2] = { NSRect_init(0.0, 0.0, 1.0, 1.0), NSRect_init(1.0, 0.0, 1.0, 1.0) };
+	CBHRectTree *tree = CBHRectTree_createWithRects(rects, 2);
+	NSUInteger indexes[2];
+
+	XCTAssertEqual(CBHRectTree_intersectingIndexes(tree, NSRect_init(1.0, 1.0, 1.0, 1.0), indexes, 2), 0UL, @"Touching edges do not intersect.");
+	XCTAssertEqual(CBHRectTree_coveredByIndexes(tree, NSRect_init(0.0, 0.0, 1.0, 1.0), indexes, 2), 1UL, @"A rect covers itself.");
+	XCTAssertEqual(CBHRectTree_containingPointIndexes(tree, NSPoint_init(1.0, 0.0), indexes, 2), 1UL, @"Only the minimum edge is inside.");
+	XCTAssertEqual(indexes[0], 1UL, @"Wrong index.");
+
+	CBHRectTree_destroy(tree);
+}
+
+- (void)testIndexes_emptyQuery
+{
+	NSUInteger indexes[kRectCount];
+
+	XCTAssertEqual(CBHRectTree_intersectingIndexes(_tree, NSRect_init(0.0, 0.0, 0.0, 10.0), indexes, kRectCount), 0UL, @"An empty rect intersects nothing.");
+	XCTAssertEqual(CBHRectTree_coveredByIndexes(_tree, NSRect_init(0.0, 0.0, 10.0, -10.0), indexes, kRectCount), 0UL, @"An empty rect covers nothing.");
+}
+
+- (void)testIndexes_capacity
+{
+	NSRect rect = NSRect_init(-50.0, -20.0, 80.0, 45.75);
+	NSUInteger indexes[kRectCount];
+	NSUInteger partial[8] = { 0 };
+
+	NSUInteger count = CBHRectTree_intersectingIndexes(_tree, rect, indexes, kRectCount);
+	XCTAssertGreaterThan(count, 8UL, @"The query should match more rects than the buffer holds.");
+
+	XCTAssertEqual(CBHRectTree_intersectingIndexes(_tree, rect, partial, 8), count, @"The full count should be returned.");
+	XCTAssertEqual(CBHRectTree_intersectingIndexes(_tree, rect, NULL, 0), count, @"Counting should not need a buffer.");
+
+	for (NSUInteger i = 0; i < 8; ++i)
+	{
+		XCTAssertTrue(NSRect_isIntersecting(_rects[partial[i]], rect), @"Wrong index.");
+	}
+}
+
+
+#pragma mark - Enumerating Matches
+
+- (void)testEnumeration_intersecting
+{
+	NSRect rect = NSRect_init(-2.0, -3.0, 12.5, 9.25);
+	CBHCollector collector = { .count = 0, .limit = 0 };
+
+	CBHRectTree_enumerateIntersecting(_tree, rect, CBHCollect, &collector);
+
+	[self assertIndexes:collector.indexes count:collector.count matchPredicate:^BOOL (NSRect element) {
+		return NSRect_isIntersecting(element, rect);
+	}];
+}
+
+- (void)testEnumeration_coveredBy
+{
+	NSRect rect = NSRect_init(-10.0, -10.0, 30.0, 30.0);
+	CBHCollector collector = { .count = 0, .limit = 0 };
+
+	CBHRectTree_enumerateCoveredBy(_tree, rect, CBHCollect, &collector);
+
+	[self assertIndexes:collector.indexes count:collector.count matchPredicate:^BOOL (NSRect element) {
+		return NSRect_isCovering(rect, element);
+	}];
+}
+
+- (void)testEnumeration_containingPoint
+{
+	NSPoint point = NSPoint_init(2.0, 3.0);
+	CBHCollector collector = { .count = 0, .limit = 0 };
+
+	CBHRectTree_enumerateContainingPoint(_tree, point, CBHCollect, &collector);
+
+	[self assertIndexes:collector.indexes count:collector.count matchPredicate:^BOOL (NSRect element) {
+		return NSRect_isPointInRect(element, point);
+	}];
+}
+
+- (void)testEnumeration_stop
+{
+	CBHCollector collector = { .count = 0, .limit = 3 };
+
+	CBHRectTree_enumerateIntersecting(_tree, NSRect_init(-1000.0, -1000.0, 2000.0, 2000.0), CBHCollect, &collector);
+
+	XCTAssertEqual(collector.count, 3UL, @"Enumeration should stop when asked.");
+}
+
+
+#pragma mark - Performance
+
+static const NSUInteger kPerformanceCount = 1 << 20;
+static const NSUInteger kPerformanceLoopQueries = 10;
+static const NSUInteger kPerformanceTreeQueries = 1000;
+
+static void CBHFillTiles(NSRect *rects, NSUInteger count)
+{
+	srand(22);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		rects[i] = NSRect_init((CGFloat)(rand() % 100000) / 10.0, (CGFloat)(rand() % 100000) / 10.0, (CGFloat)(rand() % 100 + 1) / 10.0, (CGFloat)(rand() % 100 + 1) / 10.0);
+	}
+}
+
+static NSRect CBHViewport(NSUInteger query)
+{
+	return NSRect_init((CGFloat)((query * 97) % 9000), (CGFloat)((query * 31) % 9000), 100.0, 100.0);
+}
+
+- (void)testPerformance_intersectingLoop
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	NSUInteger *indexes = malloc(sizeof(NSUInteger) * kPerformanceCount);
+	CBHFillTiles(rects, kPerformanceCount);
+
+	[self measureBlock:^{
+		for (NSUInteger q = 0; q < kPerformanceLoopQueries; ++q)
+		{
+			NSRect viewport = CBHViewport(q);
+			NSUInteger count = 0;
+
+			for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+			{
+				if ( NSRect_isIntersecting(rects[i], viewport) ) { indexes[count++] = i; }
+			}
+		}
+	}];
+
+	free(rects);
+	free(indexes);
+}
+
+- (void)testPerformance_intersectingTree
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	NSUInteger *indexes = malloc(sizeof(NSUInteger) * kPerformanceCount);
+	CBHFillTiles(rects, kPerformanceCount);
+
+	CBHRectTree *tree = CBHRectTree_createWithRects(rects, kPerformanceCount);
+
+	[self measureBlock:^{
+		for (NSUInteger q = 0; q < kPerformanceTreeQueries; ++q)
+		{
+			CBHRectTree_intersectingIndexes(tree, CBHViewport(q), indexes, kPerformanceCount);
+		}
+	}];
+
+	CBHRectTree_destroy(tree);
+	free(rects);
+	free(indexes);
+}
+
+- (void)testPerformance_creation
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	CBHFillTiles(rects, kPerformanceCount);
+
+	[self measureBlock:^{
+		CBHRectTree_destroy(CBHRectTree_createWithRects(rects, kPerformanceCount));
+	}];
+
+	free(rects);
+}
+
+@end
@@ -0,0 +1,425 @@
+//  CBHGeometryKitTests+CBHRegion.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+
+#define CBHAssertEqualRects(result, expected) XCTAssertTrue(NSRect_isEqual(result, expected), @"The rects should be the same - result:%@ expected:%@", NSRect_description(result), NSRect_description(expected))
+
+
+// Regions are checked against a raster of unit cells. Test rects have whole number edges inside the grid.
+enum { kGridSize = 32 };
+
+typedef struct CBHGrid
+{
+	BOOL cells[kGridSize][kGridSize];
+} CBHGrid;
+
+static NSRect CBHRandomRect(void)
+{
+	// Some sizes are 0 or negative.
+	return NSRect_init((CGFloat)(rand() % (kGridSize - 12)), (CGFloat)(rand() % (kGridSize - 12)), (CGFloat)(rand() % 12 - 1), (CGFloat)(rand() % 12 - 1));
+}
+
+static void CBHGrid_fillRect(CBHGrid *grid, NSRect rect)
+{
+	for (NSInteger y = 0; y < kGridSize; ++y)
+	{
+		for (NSInteger x = 0; x < kGridSize; ++x)
+		{
+			if ( NSRect_isPointInRect(rect, NSPoint_init((CGFloat)x + 0.5, (CGFloat)y + 0.5)) ) { grid->cells[y][x] = YES; }
+		}
+	}
+}
+
+static CBHGrid CBHGrid_initWithRegion(const CBHRegion *region)
+{
+	CBHGrid grid = {0};
+
+	CBHRegionIterator iterator = CBHRegionIterator_init(region);
+	NSRect rect;
+	while ( CBHRegionIterator_next(&iterator, &rect) )
+	{
+		CBHGrid_fillRect(&grid, rect);
+	}
+
+	return grid;
+}
+
+
+@interface CBHGeometryKitTests_CBHRegion : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHRegion
+
+- (void)assertRegion:(const CBHRegion *)region rects:(const NSRect *)expected count:(NSUInteger)count
+{
+	NSRect rects[16];
+	XCTAssertEqual(CBHRegion_getRects(region, rects, 16), count, @"Wrong rect count.");
+
+	for (NSUInteger i = 0; i < MIN(count, 16UL); ++i)
+	{
+		CBHAssertEqualRects(rects[i], expected[i]);
+	}
+}
+
+
+#pragma mark - Creating Regions
+
+- (void)testCreation_empty
+{
+	CBHRegion *region = CBHRegion_create();
+
+	XCTAssertTrue(CBHRegion_isEmpty(region), @"A new region is empty.");
+	XCTAssertEqual(CBHRegion_rectCount(region), 0UL, @"Wrong rect count.");
+	CBHAssertEqualRects(CBHRegion_bounds(region), NSZeroRect);
+
+	CBHRegion_destroy(region);
+}
+
+- (void)testCreation_emptyRects
+{
+	NSRect rects[3] = { NSRect_init(0.0, 0.0, 0.0, 1.0), NSRect_init(0.0, 0.0, 1.0, -1.0), NSRect_init(4.0, 4.0, -2.0, -2.0) };
+	CBHRegion *region = CBHRegion_createWithRects(rects, 3);
+
+	XCTAssertTrue(CBHRegion_isEmpty(region), @"Empty rects cover nothing.");
+
+	CBHRegion *absolute = CBHRegion_createWithRect(NSRect_absolute(rects[2]));
+	NSRect expected[1] = { NSRect_init(2.0, 2.0, 2.0, 2.0) };
+	[self assertRegion:absolute rects:expected count:1];
+
+	CBHRegion_destroy(region);
+	CBHRegion_destroy(absolute);
+}
+
+- (void)testCreation_rects
+{
+	NSRect rects[2] = { NSRect_init(0.0, 0.0, 4.0, 4.0), NSRect_init(2.0, 2.0, 4.0, 4.0) };
+	CBHRegion *region = CBHRegion_createWithRects(rects, 2);
+
+	NSRect expected[3] = { NSRect_init(0.0, 0.0, 4.0, 2.0), NSRect_init(0.0, 2.0, 6.0, 2.0), NSRect_init(2.0, 4.0, 4.0, 2.0) };
+	[self assertRegion:region rects:expected count:3];
+	CBHAssertEqualRects(CBHRegion_bounds(region), NSRect_init(0.0, 0.0, 6.0, 6.0));
+
+	CBHRegion_destroy(region);
+}
+
+- (void)testCreation_copy
+{
+	NSRect rects[2] = { NSRect_init(0.0, 0.0, 4.0, 4.0), NSRect_init(8.0, 1.0, 1.0, 1.0) };
+	CBHRegion *region = CBHRegion_createWithRects(rects, 2);
+	CBHRegion *copy = CBHRegion_copy(region);
+
+	XCTAssertTrue(CBHRegion_isEqual(region, copy), @"A copy is equal to its original.");
+
+	CBHRegion_removeAll(region);
+	XCTAssertFalse(CBHRegion_isEqual(region, copy), @"A copy is independent of its original.");
+
+	CBHRegion_destroy(region);
+	CBHRegion_destroy(copy);
+}
+
+
+#pragma mark - Normalization
+
+- (void)testNormalization_adjacentSpans
+{
+	NSRect rects[2] = { NSRect_init(0.0, 0.0, 2.0, 2.0), NSRect_init(2.0, 0.0, 2.0, 2.0) };
+	CBHRegion *region = CBHRegion_createWithRects(rects, 2);
+
+	NSRect expected[1] = { NSRect_init(0.0, 0.0, 4.0, 2.0) };
+	[self assertRegion:region rects:expected count:1];
+
+	CBHRegion_destroy(region);
+}
+
+- (void)testNormalization_adjacentBands
+{
+	NSRect rects[3] = { NSRect_init(0.0, 0.0, 2.0, 2.0), NSRect_init(0.0, 2.0, 2.0, 2.0), NSRect_init(0.0, 4.0, 2.0, 2.0) };
+	CBHRegion *region = CBHRegion_createWithRects(rects, 3);
+
+	NSRect expected[1] = { NSRect_init(0.0, 0.0, 2.0, 6.0) };
+	[self assertRegion:region rects:expected count:1];
+
+	CBHRegion_destroy(region);
+}
+
+- (void)testNormalization_unique
+{
+	NSRect rects[2] = { NSRect_init(0.0, 0.0, 4.0, 2.0), NSRect_init(0.0, 2.0, 2.0, 2.0) };
+	NSRect others[2] = { NSRect_init(0.0, 0.0, 2.0, 4.0), NSRect_init(2.0, 0.0, 2.0, 2.0) };
+	CBHRegion *region = CBHRegion_createWithRects(rects, 2);
+	CBHRegion *other = CBHRegion_createWithRects(others, 2);
+
+	XCTAssertTrue(CBHRegion_isEqual(region, other), @"Regions covering the same area are equal.");
+
+	CBHRegion_destroy(region);
+	CBHRegion_destroy(other);
+}
+
+
+#pragma mark - Combining Regions
+
+- (void)testCombining_againstGrid
+{
+	srand(61);
+	for (NSUInteger trial = 0; trial < 500; ++trial)
+	{
+		NSRect rects[6];
+		NSRect others[6];
+		CBHGrid grid = {0};
+		CBHGrid otherGrid = {0};
+
+		for (NSUInteger i = 0; i < 6; ++i)
+		{
+			rects[i] = CBHRandomRect();
+			others[i] = CBHRandomRect();
+			CBHGrid_fillRect(&grid, rects[i]);
+			CBHGrid_fillRect(&otherGrid, others[i]);
+		}
+
+		CBHRegion *region = CBHRegion_createWithRects(rects, 6);
+		CBHRegion *other = CBHRegion_createWithRects(others, 6);
+		CBHRegion *unionRegion = CBHRegion_create();
+		CBHRegion *intersectionRegion = CBHRegion_create();
+		CBHRegion *subtractRegion = CBHRegion_create();
+
+		XCTAssertTrue(CBHRegion_union(unionRegion, region, other), @"Union failed.");
+		XCTAssertTrue(CBHRegion_intersection(intersectionRegion, region, other), @"Intersection failed.");
+		XCTAssertTrue(CBHRegion_subtract(subtractRegion, region, other), @"Subtraction failed.");
+
+		CBHGrid unionGrid = CBHGrid_initWithRegion(unionRegion);
+		CBHGrid intersectionGrid = CBHGrid_initWithRegion(intersectionRegion);
+		CBHGrid subtractGrid = CBHGrid_initWithRegion(subtractRegion);
+
+		for (NSInteger y = 0; y < kGridSize; ++y)
+		{
+			for (NSInteger x = 0; x < kGridSize; ++x)
+			{
+				BOOL a = grid.cells[y][x];
+				BOOL b = otherGrid.cells[y][x];
+				NSPoint point = NSPoint_init((CGFloat)x + 0.5, (CGFloat)y + 0.5);
+
+				XCTAssertEqual(CBHRegion_isPointInRegion(region, point), a, @"Wrong containment at %ld, %ld.", (long)x, (long)y);
+				XCTAssertEqual(unionGrid.cells[y][x], (BOOL)(a || b), @"Wrong union at %ld, %ld.", (long)x, (long)y);
+				XCTAssertEqual(intersectionGrid.cells[y][x], (BOOL)(a && b), @"Wrong intersection at %ld, %ld.", (long)x, (long)y);
+				XCTAssertEqual(subtractGrid.cells[y][x], (BOOL)(a && !b), @"Wrong subtraction at %ld, %ld.", (long)x, (long)y);
+			}
+		}
+
+		CBHRegion_destroy(region);
+		CBHRegion_destroy(other);
+		CBHRegion_destroy(unionRegion);
+		CBHRegion_destroy(intersectionRegion);
+		CBHRegion_destroy(subtractRegion);
+	}
+}
+
+- (void)testCombining_aliasing
+{
+	CBHRegion *region = CBHRegion_createWithRect(NSRect_init(0.0, 0.0, 4.0, 4.0));
+	CBHRegion *other = CBHRegion_createWithRect(NSRect_init(2.0, 2.0, 4.0, 4.0));
+
+	XCTAssertTrue(CBHRegion_subtract(region, region, other), @"Subtraction failed.");
+	NSRect expected[2] = { NSRect_init(0.0, 0.0, 4.0, 2.0), NSRect_init(0.0, 2.0, 2.0, 2.0) };
+	[self assertRegion:region rects:expected count:2];
+
+	XCTAssertTrue(CBHRegion_union(other, region, other), @"Union failed.");
+	CBHRegion *expectedRegion = CBHRegion_createWithRects((NSRect[2]){ NSRect_init(0.0, 0.0, 4.0, 4.0), NSRect_init(2.0, 2.0, 4.0, 4.0) }, 2);
+	XCTAssertTrue(CBHRegion_isEqual(other, expectedRegion), @"Wrong union.");
+
+	CBHRegion_destroy(region);
+	CBHRegion_destroy(other);
+	CBHRegion_destroy(expectedRegion);
+}
+
+- (void)testCombining_rects
+{
+	CBHRegion *region = CBHRegion_createWithRect(NSRect_init(0.0, 0.0, 6.0, 6.0));
+
+	XCTAssertTrue(CBHRegion_subtractRect(region, region, NSRect_init(2.0, 2.0, 2.0, 2.0)), @"Subtraction failed.");
+	NSRect expected[4] = { NSRect_init(0.0, 0.0, 6.0, 2.0), NSRect_init(0.0, 2.0, 2.0, 2.0), NSRect_init(4.0, 2.0, 2.0, 2.0), NSRect_init(0.0, 4.0, 6.0, 2.0) };
+	[self assertRegion:region rects:expected count:4];
+
+	XCTAssertTrue(CBHRegion_intersectionRect(region, region, NSRect_init(1.0, 1.0, 2.0, 2.0)), @"Intersection failed.");
+	NSRect intersected[2] = { NSRect_init(1.0, 1.0, 2.0, 1.0), NSRect_init(1.0, 2.0, 1.0, 1.0) };
+	[self assertRegion:region rects:intersected count:2];
+
+	XCTAssertTrue(CBHRegion_unionRect(region, region, NSRect_init(2.0, 2.0, 1.0, 1.0)), @"Union failed.");
+	NSRect united[1] = { NSRect_init(1.0, 1.0, 2.0, 2.0) };
+	[self assertRegion:region rects:united count:1];
+
+	XCTAssertTrue(CBHRegion_intersectionRect(region, region, NSRect_init(5.0, 5.0, 1.0, 1.0)), @"Intersection failed.");
+	XCTAssertTrue(CBHRegion_isEmpty(region), @"Disjoint areas have an empty intersection.");
+	CBHAssertEqualRects(CBHRegion_bounds(region), NSZeroRect);
+
+	CBHRegion_destroy(region);
+}
+
+- (void)testCombining_emptyRect
+{
+	CBHRegion *region = CBHRegion_createWithRect(NSRect_init(0.0, 0.0, 4.0, 4.0));
+	CBHRegion *copy = CBHRegion_copy(region);
+
+	XCTAssertTrue(CBHRegion_unionRect(region, region, NSRect_init(8.0, 8.0, -2.0, 2.0)), @"Union failed.");
+	XCTAssertTrue(CBHRegion_subtractRect(region, region, NSRect_init(1.0, 1.0, 2.0, 0.0)), @"Subtraction failed.");
+	XCTAssertTrue(CBHRegion_isEqual(region, copy), @"Empty rects change nothing.");
+
+	XCTAssertTrue(CBHRegion_intersectionRect(region, region, NSRect_init(1.0, 1.0, 2.0, -2.0)), @"Intersection failed.");
+	XCTAssertTrue(CBHRegion_isEmpty(region), @"Empty rects cover nothing.");
+
+	CBHRegion_destroy(region);
+	CBHRegion_destroy(copy);
+}
+
+
+#pragma mark - Checking Regions
+
+- (void)testChecking_point
+{
+	CBHRegion *region = CBHRegion_createWithRect(NSRect_init(0.0, 0.0, 2.0, 2.0));
+
+	XCTAssertTrue(CBHRegion_isPointInRegion(region, NSPoint_init(0.0, 0.0)), @"Minimum edges are inside.");
+	XCTAssertTrue(CBHRegion_isPointInRegion(region, NSPoint_init(1.5, 1.5)), @"Interior points are inside.");
+	XCTAssertFalse(CBHRegion_isPointInRegion(region, NSPoint_init(2.0, 1.0)), @"Maximum edges are outside.");
+	XCTAssertFalse(CBHRegion_isPointInRegion(region, NSPoint_init(1.0, 2.0)), @"Maximum edges are outside.");
+
+	CBHRegion_destroy(region);
+}
+
+- (void)testChecking_rects
+{
+	NSRect rects[2] = { NSRect_init(0.0, 0.0, 4.0, 2.0), NSRect_init(6.0, 0.0, 2.0, 4.0) };
+	CBHRegion *region = CBHRegion_createWithRects(rects, 2);
+
+	XCTAssertTrue(CBHRegion_isCoveringRect(region, NSRect_init(6.0, 0.0, 2.0, 4.0)), @"Covered across merged bands.");
+	XCTAssertTrue(CBHRegion_isCoveringRect(region, NSRect_init(1.0, 0.5, 2.0, 1.0)), @"Covered within a rect.");
+	XCTAssertFalse(CBHRegion_isCoveringRect(region, NSRect_init(3.0, 0.0, 4.0, 1.0)), @"A gap is not covered.");
+	XCTAssertFalse(CBHRegion_isCoveringRect(region, NSRect_init(0.0, 0.0, 1.0, 3.0)), @"A rect reaching past the region is not covered.");
+	XCTAssertFalse(CBHRegion_isCoveringRect(region, NSRect_init(1.0, 1.0, 0.0, 0.0)), @"Empty rects are never covered.");
+
+	XCTAssertTrue(CBHRegion_isIntersectingRect(region, NSRect_init(3.0, 1.0, 4.0, 4.0)), @"Overlapping rects intersect.");
+	XCTAssertFalse(CBHRegion_isIntersectingRect(region, NSRect_init(4.0, 0.0, 2.0, 4.0)), @"Rects in a gap do not intersect.");
+	XCTAssertFalse(CBHRegion_isIntersectingRect(region, NSRect_init(0.0, 2.0, 4.0, 2.0)), @"Touching rects do not intersect.");
+	XCTAssertFalse(CBHRegion_isIntersectingRect(region, NSRect_init(1.0, 1.0, -1.0, 1.0)), @"Empty rects never intersect.");
+
+	CBHRegion_destroy(region);
+}
+
+- (void)testChecking_againstGrid
+{
+	srand(62);
+	for (NSUInteger trial = 0; trial < 200; ++trial)
+	{
+		NSRect rects[8];
+		CBHGrid grid = {0};
+
+		for (NSUInteger i = 0; i < 8; ++i)
+		{
+			rects[i] = CBHRandomRect();
+			CBHGrid_fillRect(&grid, rects[i]);
+		}
+
+		CBHRegion *region = CBHRegion_createWithRects(rects, 8);
+
+		for (NSUInteger q = 0; q < 20; ++q)
+		{
+			NSRect query = CBHRandomRect();
+			BOOL isIntersecting = NO;
+			BOOL isCovering = !NSRect_isEmpty(query);
+
+			for (NSInteger y = 0; y < kGridSize; ++y)
+			{
+				for (NSInteger x = 0; x < kGridSize; ++x)
+				{
+					if ( !NSRect_isPointInRect(query, NSPoint_init((CGFloat)x + 0.5, (CGFloat)y + 0.5)) ) { continue; }
+
+					if ( grid.cells[y][x] ) { isIntersecting = YES; }
+					else { isCovering = NO; }
+				}
+			}
+
+			XCTAssertEqual(CBHRegion_isIntersectingRect(region, query), isIntersecting, @"Wrong intersection for %@.", NSRect_description(query));
+			XCTAssertEqual(CBHRegion_isCoveringRect(region, query), isCovering, @"Wrong covering for %@.", NSRect_description(query));
+		}
+
+		CBHRegion_destroy(region);
+	}
+}
+
+
+#pragma mark - Iterating Rects
+
+- (void)testIterating_order
+{
+	NSRect rects[3] = { NSRect_init(4.0, 4.0, 1.0, 1.0), NSRect_init(2.0, 0.0, 1.0, 1.0), NSRect_init(0.0, 0.0, 1.0, 1.0) };
+	CBHRegion *region = CBHRegion_createWithRects(rects, 3);
+
+	CBHRegionIterator iterator = CBHRegionIterator_init(region);
+	NSRect rect;
+
+	XCTAssertTrue(CBHRegionIterator_next(&iterator, &rect), @"Missing rect.");
+	CBHAssertEqualRects(rect, rects[2]);
+	XCTAssertTrue(CBHRegionIterator_next(&iterator, &rect), @"Missing rect.");
+	CBHAssertEqualRects(rect, rects[1]);
+	XCTAssertTrue(CBHRegionIterator_next(&iterator, &rect), @"Missing rect.");
+	CBHAssertEqualRects(rect, rects[0]);
+	XCTAssertFalse(CBHRegionIterator_next(&iterator, &rect), @"The iterator should be exhausted.");
+
+	CBHRegion_destroy(region);
+}
+
+- (void)testIterating_capacity
+{
+	NSRect rects[3] = { NSRect_init(4.0, 4.0, 1.0, 1.0), NSRect_init(2.0, 0.0, 1.0, 1.0), NSRect_init(0.0, 0.0, 1.0, 1.0) };
+	CBHRegion *region = CBHRegion_createWithRects(rects, 3);
+	NSRect buffer[2] = { NSZeroRect, NSZeroRect };
+
+	XCTAssertEqual(CBHRegion_getRects(region, NULL, 0), 3UL, @"Wrong rect count.");
+	XCTAssertEqual(CBHRegion_getRects(region, buffer, 1), 3UL, @"Wrong rect count.");
+	CBHAssertEqualRects(buffer[0], rects[2]);
+	CBHAssertEqualRects(buffer[1], NSZeroRect);
+
+	CBHRegion_destroy(region);
+}
+
+
+#pragma mark - Performance
+
+static const NSUInteger kPerformanceCount = 10000;
+
+- (void)testPerformance_union
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+
+	srand(63);
+	for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+	{
+		rects[i] = NSRect_init((CGFloat)(rand() % 2000), (CGFloat)(rand() % 2000), (CGFloat)(rand() % 64 + 1), (CGFloat)(rand() % 64 + 1));
+	}
+
+	[self measureBlock:^{
+		CBHRegion_destroy(CBHRegion_createWithRects(rects, kPerformanceCount));
+	}];
+
+	free(rects);
+}
+
+@end
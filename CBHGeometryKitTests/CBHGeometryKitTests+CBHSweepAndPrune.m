@@ -0,0 +1,307 @@
+//  CBHGeometryKitTests+CBHSweepAndPrune.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+
+
+enum { kRectCount = 1201 };
+enum { kFrameCount = 12 };
+static const NSUInteger kPerformanceCount = 100000;
+static const NSUInteger kPerformanceLoopCount = 4000;
+
+static void CBHFillRects(NSRect *rects, NSUInteger count, unsigned int seed)
+{
+	srand(seed);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		// Quarter unit steps so edges coincide and some sizes are 0 or negative.
+		CGFloat x = (CGFloat)(rand() % 800) / 4.0 - 100.0;
+		CGFloat y = (CGFloat)(rand() % 800) / 4.0 - 100.0;
+		CGFloat width = (CGFloat)(rand() % 60) / 4.0 - 2.0;
+		CGFloat height = (CGFloat)(rand() % 60) / 4.0 - 2.0;
+
+		rects[i] = NSRect_init(x, y, width, height);
+	}
+}
+
+static void CBHMoveRects(NSRect *rects, NSUInteger count, CGFloat distance)
+{
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		rects[i].origin.x += (CGFloat)(rand() % 9 - 4) / 4.0 * distance;
+		rects[i].origin.y += (CGFloat)(rand() % 9 - 4) / 4.0 * distance;
+	}
+}
+
+static void CBHFillItems(NSRect *rects, NSUInteger count)
+{
+	// Labels scattered over a large canvas, each overlapping a few others.
+	srand(5);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		rects[i] = NSRect_init((CGFloat)(rand() % 100000) / 10.0, (CGFloat)(rand() % 100000) / 10.0, 5.0 + rand() % 10, 5.0 + rand() % 10);
+	}
+}
+
+static int CBHComparePairs(const void *a, const void *b)
+{
+	const CBHSweepAndPrunePair *lhs = a;
+	const CBHSweepAndPrunePair *rhs = b;
+
+	if ( lhs->first != rhs->first ) { return (lhs->first > rhs->first) - (lhs->first < rhs->first); }
+	return (lhs->second > rhs->second) - (lhs->second < rhs->second);
+}
+
+typedef struct CBHPairCollector
+{
+	NSUInteger count;
+	NSUInteger limit;
+	BOOL isOrdered;
+} CBHPairCollector;
+
+static void CBHCollectPair(NSUInteger first, NSUInteger second, void *context, BOOL *stop)
+{
+	CBHPairCollector *collector = context;
+	collector->count += 1;
+	collector->isOrdered = collector->isOrdered && ( first < second );
+
+	if ( collector->count == collector->limit ) { *stop = YES; }
+}
+
+
+@interface CBHGeometryKitTests_CBHSweepAndPrune : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_CBHSweepAndPrune
+{
+	NSRect _rects[kRectCount];
+	CBHSweepAndPrune *_broadphase;
+}
+
+- (void)setUp
+{
+	CBHFillRects(_rects, kRectCount, 17);
+	_broadphase = CBHSweepAndPrune_createWithRects(_rects, kRectCount);
+	XCTAssertTrue(_broadphase != NULL, @"Creation should succeed.");
+}
+
+- (void)tearDown
+{
+	CBHSweepAndPrune_destroy(_broadphase);
+}
+
+- (void)assertPairsMatchRects
+{
+	NSUInteger capacity = kRectCount * 16;
+	CBHSweepAndPrunePair *pairs = malloc(sizeof(CBHSweepAndPrunePair) * capacity);
+	NSUInteger count = CBHSweepAndPrune_overlappingPairs(_broadphase, pairs, capacity);
+	XCTAssertLessThanOrEqual(count, capacity, @"The buffer should hold every pair.");
+
+	qsort(pairs, MIN(count, capacity), sizeof(CBHSweepAndPrunePair), CBHComparePairs);
+
+	NSUInteger expected = 0;
+	for (NSUInteger i = 0; i < kRectCount; ++i)
+	{
+		for (NSUInteger j = i + 1; j < kRectCount; ++j)
+		{
+			if ( !NSRect_isIntersecting(_rects[i], _rects[j]) ) { continue; }
+
+			XCTAssertLessThan(expected, count, @"Too few pairs.");
+			if ( expected < count ) { XCTAssertTrue(pairs[expected].first == i && pairs[expected].second == j, @"Wrong pair."); }
+			expected += 1;
+		}
+	}
+
+	XCTAssertEqual(count, expected, @"Wrong pair count.");
+	free(pairs);
+}
+
+
+#pragma mark - Creating Broadphases
+
+- (void)testCreation_empty
+{
+	NSRect rects[1] = { NSZeroRect };
+	CBHSweepAndPrune *broadphase = CBHSweepAndPrune_createWithRects(rects, 0);
+	CBHSweepAndPrunePair pairs[1];
+
+	XCTAssertEqual(CBHSweepAndPrune_count(broadphase), 0UL, @"Wrong count.");
+	XCTAssertEqual(CBHSweepAndPrune_overlappingPairs(broadphase, pairs, 1), 0UL, @"An empty broadphase holds nothing.");
+
+	CBHSweepAndPrune_destroy(broadphase);
+}
+
+- (void)testCreation_edges
+{
+	// Touching edges and empty rects never overlap, matching `NSRect_isIntersecting()`.
+	NSRect rects[5] = {
+		NSRect_init(0.0, 0.0, 1.0, 1.0),
+		NSRect_init(1.0, 0.0, 1.0, 1.0),
+		NSRect_init(0.0, 1.0, 1.0, 1.0),
+		NSRect_init(0.5, 0.5, 0.0, 1.0),
+		NSRect_init(0.5, 0.5, 1.0, 1.0),
+	};
+	CBHSweepAndPrune *broadphase = CBHSweepAndPrune_createWithRects(rects, 5);
+	CBHSweepAndPrunePair pairs[8];
+
+	XCTAssertEqual(CBHSweepAndPrune_overlappingPairs(broadphase, pairs, 8), 3UL, @"Only the offset rect overlaps the others.");
+	qsort(pairs, 3, sizeof(CBHSweepAndPrunePair), CBHComparePairs);
+	XCTAssertTrue(pairs[0].first == 0 && pairs[0].second == 4);
+	XCTAssertTrue(pairs[1].first == 1 && pairs[1].second == 4);
+	XCTAssertTrue(pairs[2].first == 2 && pairs[2].second == 4);
+
+	CBHSweepAndPrune_destroy(broadphase);
+}
+
+
+#pragma mark - Properties
+
+- (void)testProperties
+{
+	XCTAssertEqual(CBHSweepAndPrune_count(_broadphase), (NSUInteger)kRectCount, @"Wrong count.");
+	XCTAssertTrue(NSRect_isEqual(CBHSweepAndPrune_rectAtIndex(_broadphase, 7), _rects[7]), @"Wrong rect.");
+}
+
+
+#pragma mark - Finding Pairs
+
+- (void)testPairs_matchBruteForce
+{
+	[self assertPairsMatchRects];
+}
+
+- (void)testPairs_capacity
+{
+	CBHSweepAndPrunePair pairs[4];
+	NSUInteger total = CBHSweepAndPrune_overlappingPairs(_broadphase, NULL, 0);
+
+	XCTAssertGreaterThan(total, 4UL, @"The fixture should have many pairs.");
+	XCTAssertEqual(CBHSweepAndPrune_overlappingPairs(_broadphase, pairs, 4), total, @"The count should not depend on the capacity.");
+}
+
+- (void)testPairs_enumeration
+{
+	CBHPairCollector collector = { .count = 0, .limit = NSNotFound, .isOrdered = YES };
+	CBHSweepAndPrune_enumerateOverlappingPairs(_broadphase, CBHCollectPair, &collector);
+
+	XCTAssertEqual(collector.count, CBHSweepAndPrune_overlappingPairs(_broadphase, NULL, 0), @"Enumeration should find every pair.");
+	XCTAssertTrue(collector.isOrdered, @"The lesser index should come first.");
+}
+
+- (void)testPairs_stop
+{
+	CBHPairCollector collector = { .count = 0, .limit = 3, .isOrdered = YES };
+	CBHSweepAndPrune_enumerateOverlappingPairs(_broadphase, CBHCollectPair, &collector);
+
+	XCTAssertEqual(collector.count, 3UL, @"Enumeration should stop when asked.");
+}
+
+
+#pragma mark - Moving Rects
+
+- (void)testUpdate_smallMoves
+{
+	srand(3);
+	for (NSUInteger frame = 0; frame < kFrameCount; ++frame)
+	{
+		CBHMoveRects(_rects, kRectCount, 1.0);
+		CBHSweepAndPrune_updateRects(_broadphase, _rects);
+		[self assertPairsMatchRects];
+	}
+}
+
+- (void)testUpdate_largeMoves
+{
+	// Moves this far reorder most of the rects, so the re-sort starts over.
+	srand(4);
+	for (NSUInteger frame = 0; frame < 3; ++frame)
+	{
+		CBHMoveRects(_rects, kRectCount, 80.0);
+		CBHSweepAndPrune_updateRects(_broadphase, _rects);
+		[self assertPairsMatchRects];
+	}
+}
+
+- (void)testUpdate_setRect
+{
+	_rects[3] = NSRect_init(-1000.0, -1000.0, 2000.0, 2000.0);
+	CBHSweepAndPrune_setRect(_broadphase, 3, _rects[3]);
+	[self assertPairsMatchRects];
+
+	_rects[3] = NSRect_init(-1000.0, -1000.0, -1.0, 2000.0);
+	CBHSweepAndPrune_setRect(_broadphase, 3, _rects[3]);
+	[self assertPairsMatchRects];
+}
+
+
+#pragma mark - Performance
+
+- (void)testPerformance_pairsLoop
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceLoopCount);
+	CBHFillItems(rects, kPerformanceLoopCount);
+
+	[self measureBlock:^{
+		NSUInteger count = 0;
+		for (NSUInteger i = 0; i < kPerformanceLoopCount; ++i)
+		{
+			for (NSUInteger j = i + 1; j < kPerformanceLoopCount; ++j)
+			{
+				count += ( NSRect_isIntersecting(rects[i], rects[j]) ) ? 1 : 0;
+			}
+		}
+	}];
+
+	free(rects);
+}
+
+- (void)testPerformance_pairsSweep
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	CBHSweepAndPrunePair *pairs = malloc(sizeof(CBHSweepAndPrunePair) * kPerformanceCount);
+	CBHFillItems(rects, kPerformanceCount);
+
+	CBHSweepAndPrune *broadphase = CBHSweepAndPrune_createWithRects(rects, kPerformanceCount);
+
+	[self measureBlock:^{
+		CBHMoveRects(rects, kPerformanceCount, 1.0);
+		CBHSweepAndPrune_updateRects(broadphase, rects);
+		CBHSweepAndPrune_overlappingPairs(broadphase, pairs, kPerformanceCount);
+	}];
+
+	CBHSweepAndPrune_destroy(broadphase);
+	free(rects);
+	free(pairs);
+}
+
+- (void)testPerformance_creation
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	CBHFillItems(rects, kPerformanceCount);
+
+	[self measureBlock:^{
+		CBHSweepAndPrune_destroy(CBHSweepAndPrune_createWithRects(rects, kPerformanceCount));
+	}];
+
+	free(rects);
+}
+
+@end
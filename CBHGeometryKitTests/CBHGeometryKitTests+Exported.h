@@ -0,0 +1,36 @@
+//  CBHGeometryKitTests+Exported.h
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+// Wrappers around the exported functions, compiled in `CBHGeometryKitTests+Exported.m` without `CBH_GEOMETRY_INLINE`
+// so files compiled with it can call the library's symbols rather than their own inline copies.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+NSRect CBHExported_NSRect_init(CGFloat x, CGFloat y, CGFloat width, CGFloat height);
+BOOL CBHExported_NSRect_isEmpty(NSRect rect);
+NSRect CBHExported_NSRect_absolute(NSRect rect);
+NSRect CBHExported_NSRect_inset(NSRect rect, CGFloat dX, CGFloat dY);
+NSRect CBHExported_NSRect_centeredInRect(NSRect rect, NSRect inRect);
+NSPoint CBHExported_NSRect_midPoint(NSRect rect);
+CGFloat CBHExported_NSPoint_distanceSquared(NSPoint start, NSPoint end);
+NSUInteger CBHExported_NSRange_max(NSRange range);
+
+NS_ASSUME_NONNULL_END
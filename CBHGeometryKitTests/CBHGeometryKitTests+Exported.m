@@ -0,0 +1,69 @@
+//  CBHGeometryKitTests+Exported.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+// This file must not be compiled with `-DCBH_GEOMETRY_INLINE=1`, so each call below reaches the exported symbol.
+
+@import CBHGeometryKit;
+
+#import "CBHGeometryKitTests+Exported.h"
+
+
+#if CBH_GEOMETRY_INLINE
+#error "CBHGeometryKitTests+Exported.m must be compiled without CBH_GEOMETRY_INLINE set."
+#endif
+
+
+NSRect CBHExported_NSRect_init(CGFloat x, CGFloat y, CGFloat width, CGFloat height)
+{
+	return NSRect_init(x, y, width, height);
+}
+
+BOOL CBHExported_NSRect_isEmpty(NSRect rect)
+{
+	return NSRect_isEmpty(rect);
+}
+
+NSRect CBHExported_NSRect_absolute(NSRect rect)
+{
+	return NSRect_absolute(rect);
+}
+
+NSRect CBHExported_NSRect_inset(NSRect rect, CGFloat dX, CGFloat dY)
+{
+	return NSRect_inset(rect, dX, dY);
+}
+
+NSRect CBHExported_NSRect_centeredInRect(NSRect rect, NSRect inRect)
+{
+	return NSRect_centeredInRect(rect, inRect);
+}
+
+NSPoint CBHExported_NSRect_midPoint(NSRect rect)
+{
+	return NSRect_midPoint(rect);
+}
+
+CGFloat CBHExported_NSPoint_distanceSquared(NSPoint start, NSPoint end)
+{
+	return NSPoint_distanceSquared(start, end);
+}
+
+NSUInteger CBHExported_NSRange_max(NSRange range)
+{
+	return NSRange_max(range);
+}
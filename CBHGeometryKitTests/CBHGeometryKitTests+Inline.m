@@ -0,0 +1,190 @@
+//  CBHGeometryKitTests+Inline.m
+//  CBHGeometryKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+// This file is compiled with `-DCBH_GEOMETRY_INLINE=1`, so the functions below are the `static inline` definitions from
+// the headers. The exported functions are reached through wrappers in `CBHGeometryKitTests+Exported.m`, which is
+// compiled without the flag, so both can be measured side by side.
+
+@import XCTest;
+@import CBHGeometryKit;
+
+#import "CBHGeometryKitTests+Exported.h"
+
+
+#if !CBH_GEOMETRY_INLINE
+#error "CBHGeometryKitTests+Inline.m must be compiled with CBH_GEOMETRY_INLINE set."
+#endif
+
+
+enum { kRectCount = 1 << 10 };
+
+static void CBHFillRects(NSRect *rects, NSUInteger count)
+{
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		rects[i] = NSRect_init((CGFloat)(i % 97) - 40.0, (CGFloat)(i % 13), (CGFloat)(i % 7) - 3.0, (CGFloat)(i % 5) - 2.0);
+	}
+}
+
+
+@interface CBHGeometryKitTests_Inline : XCTestCase
+@end
+
+
+@implementation CBHGeometryKitTests_Inline
+
+#pragma mark - Agreement
+
+- (void)testInline_matchesExported
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kRectCount);
+	CBHFillRects(rects, kRectCount);
+
+	const NSRect container = NSRect_init(0.0, 0.0, 100.0, 100.0);
+
+	for (NSUInteger i = 0; i < kRectCount; ++i)
+	{
+		const NSRect rect = rects[i];
+
+		XCTAssertTrue(NSRect_isEqual(NSRect_init(1.0, 2.0, 3.0, (CGFloat)i), CBHExported_NSRect_init(1.0, 2.0, 3.0, (CGFloat)i)), @"Wrong rect at %lu.", i);
+		XCTAssertEqual(NSRect_isEmpty(rect), CBHExported_NSRect_isEmpty(rect), @"Wrong emptiness at %lu.", i);
+		XCTAssertTrue(NSRect_isEqual(NSRect_absolute(rect), CBHExported_NSRect_absolute(rect)), @"Wrong absolute rect at %lu.", i);
+		XCTAssertTrue(NSRect_isEqual(NSRect_inset(rect, 1.5, -2.0), CBHExported_NSRect_inset(rect, 1.5, -2.0)), @"Wrong inset rect at %lu.", i);
+		XCTAssertTrue(NSRect_isEqual(NSRect_centeredInRect(rect, container), CBHExported_NSRect_centeredInRect(rect, container)), @"Wrong centred rect at %lu.", i);
+		XCTAssertTrue(NSPoint_isEqual(NSRect_midPoint(rect), CBHExported_NSRect_midPoint(rect)), @"Wrong mid point at %lu.", i);
+		XCTAssertEqual(NSPoint_distanceSquared(rect.origin, container.origin), CBHExported_NSPoint_distanceSquared(rect.origin, container.origin), @"Wrong distance at %lu.", i);
+		XCTAssertEqual(NSRange_max(NSRange_init(i, 7)), CBHExported_NSRange_max(NSRange_init(i, 7)), @"Wrong maximum at %lu.", i);
+	}
+
+	free(rects);
+}
+
+
+#pragma mark - Performance
+
+static const NSUInteger kPerformanceCount = 1 << 20;
+
+- (void)testPerformance_inlineMidPoint
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	NSPoint *points = malloc(sizeof(NSPoint) * kPerformanceCount);
+	CBHFillRects(rects, kPerformanceCount);
+
+	[self measureBlock:^{
+		for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+		{
+			points[i] = NSRect_midPoint(rects[i]);
+		}
+	}];
+
+	free(points);
+	free(rects);
+}
+
+- (void)testPerformance_exportedMidPoint
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	NSPoint *points = malloc(sizeof(NSPoint) * kPerformanceCount);
+	CBHFillRects(rects, kPerformanceCount);
+
+	[self measureBlock:^{
+		for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+		{
+			points[i] = CBHExported_NSRect_midPoint(rects[i]);
+		}
+	}];
+
+	free(points);
+	free(rects);
+}
+
+
+- (void)testPerformance_inlineDistanceSquared
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	CGFloat *distances = malloc(sizeof(CGFloat) * kPerformanceCount);
+	CBHFillRects(rects, kPerformanceCount);
+
+	const NSPoint origin = NSPoint_init(50.0, 50.0);
+
+	[self measureBlock:^{
+		for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+		{
+			distances[i] = NSPoint_distanceSquared(rects[i].origin, origin);
+		}
+	}];
+
+	free(distances);
+	free(rects);
+}
+
+- (void)testPerformance_exportedDistanceSquared
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	CGFloat *distances = malloc(sizeof(CGFloat) * kPerformanceCount);
+	CBHFillRects(rects, kPerformanceCount);
+
+	const NSPoint origin = NSPoint_init(50.0, 50.0);
+
+	[self measureBlock:^{
+		for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+		{
+			distances[i] = CBHExported_NSPoint_distanceSquared(rects[i].origin, origin);
+		}
+	}];
+
+	free(distances);
+	free(rects);
+}
+
+
+- (void)testPerformance_inlineCountEmpty
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	CBHFillRects(rects, kPerformanceCount);
+
+	[self measureBlock:^{
+		NSUInteger count = 0;
+		for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+		{
+			count += NSRect_isEmpty(rects[i]);
+		}
+		XCTAssertGreaterThan(count, 0UL);
+	}];
+
+	free(rects);
+}
+
+- (void)testPerformance_exportedCountEmpty
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceCount);
+	CBHFillRects(rects, kPerformanceCount);
+
+	[self measureBlock:^{
+		NSUInteger count = 0;
+		for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+		{
+			count += CBHExported_NSRect_isEmpty(rects[i]);
+		}
+		XCTAssertGreaterThan(count, 0UL);
+	}];
+
+	free(rects);
+}
+
+@end
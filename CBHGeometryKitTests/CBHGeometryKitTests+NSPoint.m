@@ -56,6 +56,54 @@
 }
 
 
+#pragma mark - Parsing Points
+
+- (void)testParsing_matchesString
+{
+	NSArray<NSString *> *strings = @[@"{2, 4.0}", @"{-1.5, +2.25}", @"{.5, -.75}", @"{1e3, 2.5E-2}", @"3", @"", @"{}", @"no numbers", @"{0.1, 0.7}", @"{1234567.891011, 0.000001}", @"{12345678901234567890123, 1e-320}", @"{-0, 4}"];
+
+	for (NSString *string in strings)
+	{
+		const char *bytes = [string UTF8String];
+		NSPoint point = NSPoint_initWithBytes(bytes, strlen(bytes), NULL, NULL);
+
+		CBHAssertEqualPoints(point, NSPoint_initWithString(string));
+	}
+}
+
+- (void)testParsing_status
+{
+	NSUInteger consumed = 0;
+	CBHParseStatus status = CBHParseStatusSuccess;
+
+	NSPoint_initWithBytes("{1, 2} {3, 4}", 12, &consumed, &status);
+	XCTAssertEqual(status, CBHParseStatusSuccess, @"Wrong status.");
+	XCTAssertEqual(consumed, 5UL, @"Parsing should stop after the last component.");
+
+	NSPoint_initWithBytes("{}", 2, &consumed, &status);
+	XCTAssertEqual(status, CBHParseStatusMissingComponents, @"Wrong status.");
+	XCTAssertEqual(consumed, 2UL, @"Parsing should read everything when components are missing.");
+}
+
+- (void)testParsing_lines
+{
+	const char *bytes = "{1, 2}\n\n{-3.5, 4e1}\n{5}\n";
+	NSPoint points[4];
+	CBHParseStatus statuses[4];
+
+	XCTAssertEqual(NSPoint_parseLines(bytes, strlen(bytes), points, statuses, 4), 4UL, @"Wrong line count.");
+	XCTAssertEqual(NSPoint_parseLines(bytes, strlen(bytes), points, NULL, 1), 4UL, @"Lines past the capacity should still be counted.");
+	CBHAssertEqualPoints(points[0], NSPoint_init(1.0, 2.0));
+	XCTAssertEqual(statuses[0], CBHParseStatusSuccess, @"Wrong status.");
+	CBHAssertEqualPoints(points[1], NSPoint_init(0.0, 0.0));
+	XCTAssertEqual(statuses[1], CBHParseStatusMissingComponents, @"Wrong status.");
+	CBHAssertEqualPoints(points[2], NSPoint_init(-3.5, 40.0));
+	XCTAssertEqual(statuses[2], CBHParseStatusSuccess, @"Wrong status.");
+	CBHAssertEqualPoints(points[3], NSPoint_init(5.0, 0.0));
+	XCTAssertEqual(statuses[3], CBHParseStatusMissingComponents, @"Wrong status.");
+}
+
+
 #pragma mark - Checking Points
 
 - (void)testEquality_same
@@ -180,6 +228,412 @@
 	XCTAssertEqual(distanceSquared, 25.0, @"Wrong distance squared.");
 }
 
+- (void)testDistance_approximate
+{
+	NSPoint a = NSPoint_initZero();
+	NSPoint b = NSPoint_init(3.0, 4.0);
+
+	CGFloat distance = NSPoint_approximateDistance(a, b);
+
+	XCTAssertEqualWithAccuracy(distance, 5.0, 5.0 * 0.0213, @"Wrong approximate distance.");
+}
+
+- (void)testDistance_approximateErrorBound
+{
+	NSPoint origin = NSPoint_init(-3.0, 7.0);
+
+	for (NSUInteger i = 0; i <= 3600; ++i)
+	{
+		CGFloat angle = (M_PI * 2.0 * (CGFloat)i) / 3600.0;
+		NSPoint point = NSPoint_shiftParametric(origin, cos(angle) * 250.0, sin(angle) * 250.0);
+
+		CGFloat exact = NSPoint_distance(origin, point);
+		CGFloat approximate = NSPoint_approximateDistance(origin, point);
+
+		XCTAssertLessThanOrEqual(fabs(approximate - exact), exact * 0.0213, @"Error exceeds bound at angle %f.", angle);
+	}
+}
+
+- (void)testDistance_approximateZero
+{
+	NSPoint a = NSPoint_init(3.0, 4.0);
+
+	XCTAssertEqual(NSPoint_approximateDistance(a, a), 0.0, @"Wrong approximate distance.");
+}
+
+
+#pragma mark - Batched Distance
+
+enum { kBatchCount = 37 };
+
+static void CBHFillPoints(NSPoint *points, NSUInteger count, unsigned int seed)
+{
+	srand(seed);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		points[i] = NSPoint_init((CGFloat)rand() / 3.0 - 1000.0, (CGFloat)rand() / 7.0 - 2000.0);
+	}
+}
+
+- (void)testBatchedDistance_toPoints
+{
+	NSPoint point = NSPoint_init(1.0 / 3.0, -7.25);
+	NSPoint points[kBatchCount];
+	CGFloat distances[kBatchCount];
+	CBHFillPoints(points, kBatchCount, 1);
+
+	NSPoint_distancesToPoints(point, points, distances, kBatchCount);
+
+	for (NSUInteger i = 0; i < kBatchCount; ++i)
+	{
+		XCTAssertEqual(distances[i], NSPoint_distance(point, points[i]), @"Wrong distance at %lu.", (unsigned long)i);
+	}
+}
+
+- (void)testBatchedDistance_squaredToPoints
+{
+	NSPoint point = NSPoint_init(1.0 / 3.0, -7.25);
+	NSPoint points[kBatchCount];
+	CGFloat distances[kBatchCount];
+	CBHFillPoints(points, kBatchCount, 2);
+
+	NSPoint_distancesSquaredToPoints(point, points, distances, kBatchCount);
+
+	for (NSUInteger i = 0; i < kBatchCount; ++i)
+	{
+		XCTAssertEqual(distances[i], NSPoint_distanceSquared(point, points[i]), @"Wrong distance squared at %lu.", (unsigned long)i);
+	}
+}
+
+- (void)testBatchedDistance_betweenPoints
+{
+	NSPoint starts[kBatchCount];
+	NSPoint ends[kBatchCount];
+	CGFloat distances[kBatchCount];
+	CBHFillPoints(starts, kBatchCount, 3);
+	CBHFillPoints(ends, kBatchCount, 4);
+
+	NSPoint_distancesBetweenPoints(starts, ends, distances, kBatchCount);
+
+	for (NSUInteger i = 0; i < kBatchCount; ++i)
+	{
+		XCTAssertEqual(distances[i], NSPoint_distance(starts[i], ends[i]), @"Wrong distance at %lu.", (unsigned long)i);
+	}
+}
+
+- (void)testBatchedDistance_squaredBetweenPoints
+{
+	NSPoint starts[kBatchCount];
+	NSPoint ends[kBatchCount];
+	CGFloat distances[kBatchCount];
+	CBHFillPoints(starts, kBatchCount, 5);
+	CBHFillPoints(ends, kBatchCount, 6);
+
+	NSPoint_distancesSquaredBetweenPoints(starts, ends, distances, kBatchCount);
+
+	for (NSUInteger i = 0; i < kBatchCount; ++i)
+	{
+		XCTAssertEqual(distances[i], NSPoint_distanceSquared(starts[i], ends[i]), @"Wrong distance squared at %lu.", (unsigned long)i);
+	}
+}
+
+- (void)testBatchedDistance_empty
+{
+	NSPoint point = NSPoint_initZero();
+	CGFloat distance = -1.0;
+
+	NSPoint_distancesToPoints(point, &point, &distance, 0);
+
+	XCTAssertEqual(distance, -1.0, @"Nothing should be written.");
+}
+
+- (void)testBatchedDistance_approximateToPoints
+{
+	NSPoint point = NSPoint_init(1.0 / 3.0, -7.25);
+	NSPoint points[kBatchCount];
+	CGFloat distances[kBatchCount];
+	CBHFillPoints(points, kBatchCount, 8);
+
+	NSPoint_approximateDistancesToPoints(point, points, distances, kBatchCount);
+
+	for (NSUInteger i = 0; i < kBatchCount; ++i)
+	{
+		XCTAssertEqual(distances[i], NSPoint_approximateDistance(point, points[i]), @"Wrong approximate distance at %lu.", (unsigned long)i);
+	}
+}
+
+- (void)testBatchedDistance_approximateBetweenPoints
+{
+	NSPoint starts[kBatchCount];
+	NSPoint ends[kBatchCount];
+	CGFloat distances[kBatchCount];
+	CBHFillPoints(starts, kBatchCount, 9);
+	CBHFillPoints(ends, kBatchCount, 10);
+
+	NSPoint_approximateDistancesBetweenPoints(starts, ends, distances, kBatchCount);
+
+	for (NSUInteger i = 0; i < kBatchCount; ++i)
+	{
+		XCTAssertEqual(distances[i], NSPoint_approximateDistance(starts[i], ends[i]), @"Wrong approximate distance at %lu.", (unsigned long)i);
+	}
+}
+
+
+#pragma mark - Batched Reductions
+
+// Spans several parallel chunks and ends part way through one.
+static const NSUInteger kReductionCount = 300001;
+
+- (void)testBatchedReduction_extents
+{
+	NSUInteger counts[] = { 1, 2, 3, kBatchCount, kReductionCount };
+	NSPoint *points = malloc(sizeof(NSPoint) * kReductionCount);
+	CBHFillPoints(points, kReductionCount, 11);
+
+	for (NSUInteger c = 0; c < sizeof(counts) / sizeof(*counts); ++c)
+	{
+		NSPoint expectedMinimum = points[0];
+		NSPoint expectedMaximum = points[0];
+		for (NSUInteger i = 1; i < counts[c]; ++i)
+		{
+			expectedMinimum = NSPoint_init(MIN(expectedMinimum.x, points[i].x), MIN(expectedMinimum.y, points[i].y));
+			expectedMaximum = NSPoint_init(MAX(expectedMaximum.x, points[i].x), MAX(expectedMaximum.y, points[i].y));
+		}
+
+		NSPoint minimum;
+		NSPoint maximum;
+		XCTAssertTrue(NSPoint_extentsOfPoints(points, counts[c], &minimum, &maximum));
+		CBHAssertEqualPoints(minimum, expectedMinimum);
+		CBHAssertEqualPoints(maximum, expectedMaximum);
+	}
+
+	free(points);
+}
+
+- (void)testBatchedReduction_extentsEmpty
+{
+	NSPoint point = NSPoint_init(1.0, 2.0);
+	NSPoint minimum = NSPoint_initZero();
+	NSPoint maximum = NSPoint_initZero();
+
+	XCTAssertFalse(NSPoint_extentsOfPoints(&point, 0, &minimum, &maximum));
+	CBHAssertEqualPoints(minimum, NSPoint_initZero());
+	CBHAssertEqualPoints(maximum, NSPoint_initZero());
+}
+
+- (void)testBatchedReduction_centroid
+{
+	NSPoint points[] = { NSPoint_init(0.0, 0.0), NSPoint_init(4.0, 0.0), NSPoint_init(4.0, 8.0), NSPoint_init(0.0, 8.0), NSPoint_init(2.0, 4.0) };
+
+	CBHAssertEqualPoints(NSPoint_centroidOfPoints(points, 5), NSPoint_init(2.0, 4.0));
+	CBHAssertEqualPoints(NSPoint_centroidOfPoints(points, 0), NSPoint_initZero());
+}
+
+- (void)testBatchedReduction_centroidLarge
+{
+	NSPoint *points = malloc(sizeof(NSPoint) * kReductionCount);
+	CBHFillPoints(points, kReductionCount, 12);
+
+	long double x = 0.0;
+	long double y = 0.0;
+	for (NSUInteger i = 0; i < kReductionCount; ++i)
+	{
+		x += points[i].x;
+		y += points[i].y;
+	}
+
+	NSPoint centroid = NSPoint_centroidOfPoints(points, kReductionCount);
+	XCTAssertEqualWithAccuracy(centroid.x, (CGFloat)(x / kReductionCount), 1e-9);
+	XCTAssertEqualWithAccuracy(centroid.y, (CGFloat)(y / kReductionCount), 1e-9);
+
+	// The summation order is fixed, so repeating it gives the same bits.
+	CBHAssertEqualPoints(NSPoint_centroidOfPoints(points, kReductionCount), centroid);
+
+	free(points);
+}
+
+
+#pragma mark - Batched Pixel Alignment
+
+- (void)assertBatch:(void (*)(const NSPoint *, NSPoint *, NSUInteger, CGFloat))batch matchesScalar:(NSPoint (*)(NSPoint))scalar
+{
+	NSPoint *points = malloc(sizeof(NSPoint) * kReductionCount);
+	NSPoint *results = malloc(sizeof(NSPoint) * kReductionCount);
+	CBHFillPoints(points, kReductionCount, 13);
+
+	// Halfway cases and zeros of both signs.
+	for (NSUInteger i = 0; i < kReductionCount; i += 7)
+	{
+		points[i] = NSPoint_init(trunc(points[i].x) + 0.5, -0.0);
+	}
+
+	batch(points, results, kReductionCount, 1.0);
+
+	for (NSUInteger i = 0; i < kReductionCount; ++i)
+	{
+		const NSPoint expected = scalar(points[i]);
+		XCTAssertEqual(memcmp(&results[i], &expected, sizeof(NSPoint)), 0, @"The points should be identical - result:%@ expected:%@", NSPoint_description(results[i]), NSPoint_description(expected));
+		if ( memcmp(&results[i], &expected, sizeof(NSPoint)) != 0 ) { break; }
+	}
+
+	free(points);
+	free(results);
+}
+
+- (void)testBatchedPixelAlignment_matchesScalar
+{
+	[self assertBatch:NSPoint_truncatePoints matchesScalar:NSPoint_truncate];
+	[self assertBatch:NSPoint_roundPoints matchesScalar:NSPoint_round];
+	[self assertBatch:NSPoint_nearestPixels matchesScalar:NSPoint_nearestPixel];
+}
+
+- (void)testBatchedPixelAlignment_scaled
+{
+	NSPoint points[] = { NSPoint_init(1.2, -1.2), NSPoint_init(0.25, -0.75), NSPoint_init(2.4, 0.1) };
+	NSPoint results[3];
+
+	NSPoint_truncatePoints(points, results, 3, 2.0);
+	CBHAssertEqualPoints(results[0], NSPoint_init(1.0, -1.0));
+	CBHAssertEqualPoints(results[1], NSPoint_init(0.0, -0.5));
+
+	NSPoint_roundPoints(points, results, 3, 2.0);
+	CBHAssertEqualPoints(results[0], NSPoint_init(1.0, -1.0));
+	CBHAssertEqualPoints(results[1], NSPoint_init(0.5, -1.0));
+
+	NSPoint_nearestPixels(points, results, 3, 3.0);
+	CBHAssertEqualPoints(results[0], NSPoint_init(3.5 / 3.0, -2.5 / 3.0));
+	CBHAssertEqualPoints(results[2], NSPoint_init(7.5 / 3.0, 0.5 / 3.0));
+}
+
+
+#pragma mark - Performance
+
+static const NSUInteger kPerformanceCount = 1 << 22;
+
+- (void)testPerformance_distance
+{
+	NSPoint point = NSPoint_init(0.5, 0.5);
+	NSPoint *points = malloc(sizeof(NSPoint) * kPerformanceCount);
+	CGFloat *distances = malloc(sizeof(CGFloat) * kPerformanceCount);
+	CBHFillPoints(points, kPerformanceCount, 7);
+
+	[self measureBlock:^{
+		for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+		{
+			distances[i] = NSPoint_distance(point, points[i]);
+		}
+	}];
+
+	free(points);
+	free(distances);
+}
+
+- (void)testPerformance_approximateDistance
+{
+	NSPoint point = NSPoint_init(0.5, 0.5);
+	NSPoint *points = malloc(sizeof(NSPoint) * kPerformanceCount);
+	CGFloat *distances = malloc(sizeof(CGFloat) * kPerformanceCount);
+	CBHFillPoints(points, kPerformanceCount, 7);
+
+	[self measureBlock:^{
+		for (NSUInteger i = 0; i < kPerformanceCount; ++i)
+		{
+			distances[i] = NSPoint_approximateDistance(point, points[i]);
+		}
+	}];
+
+	free(points);
+	free(distances);
+}
+
+- (void)testPerformance_approximateDistanceBatched
+{
+	NSPoint point = NSPoint_init(0.5, 0.5);
+	NSPoint *points = malloc(sizeof(NSPoint) * kPerformanceCount);
+	CGFloat *distances = malloc(sizeof(CGFloat) * kPerformanceCount);
+	CBHFillPoints(points, kPerformanceCount, 7);
+
+	[self measureBlock:^{
+		NSPoint_approximateDistancesToPoints(point, points, distances, kPerformanceCount);
+	}];
+
+	free(points);
+	free(distances);
+}
+
+- (void)testPerformance_distanceBatched
+{
+	NSPoint point = NSPoint_init(0.5, 0.5);
+	NSPoint *points = malloc(sizeof(NSPoint) * kPerformanceCount);
+	CGFloat *distances = malloc(sizeof(CGFloat) * kPerformanceCount);
+	CBHFillPoints(points, kPerformanceCount, 7);
+
+	[self measureBlock:^{
+		NSPoint_distancesToPoints(point, points, distances, kPerformanceCount);
+	}];
+
+	free(points);
+	free(distances);
+}
+
+- (void)testPerformance_extentsOfPoints
+{
+	NSPoint *points = malloc(sizeof(NSPoint) * kPerformanceCount);
+	CBHFillPoints(points, kPerformanceCount, 7);
+
+	[self measureBlock:^{
+		NSPoint minimum;
+		NSPoint maximum;
+		NSPoint_extentsOfPoints(points, kPerformanceCount, &minimum, &maximum);
+	}];
+
+	free(points);
+}
+
+- (void)testPerformance_centroidOfPoints
+{
+	NSPoint *points = malloc(sizeof(NSPoint) * kPerformanceCount);
+	CBHFillPoints(points, kPerformanceCount, 7);
+
+	[self measureBlock:^{
+		NSPoint_centroidOfPoints(points, kPerformanceCount);
+	}];
+
+	free(points);
+}
+
+
+- (void)testPerformance_nearestPixel
+{
+	NSPoint *points = malloc(sizeof(NSPoint) * kReductionCount);
+	NSPoint *results = malloc(sizeof(NSPoint) * kReductionCount);
+	CBHFillPoints(points, kReductionCount, 14);
+
+	[self measureBlock:^{
+		for (NSUInteger i = 0; i < kReductionCount; ++i)
+		{
+			results[i] = NSPoint_nearestPixel(points[i]);
+		}
+	}];
+
+	free(points);
+	free(results);
+}
+
+- (void)testPerformance_nearestPixels
+{
+	NSPoint *points = malloc(sizeof(NSPoint) * kReductionCount);
+	NSPoint *results = malloc(sizeof(NSPoint) * kReductionCount);
+	CBHFillPoints(points, kReductionCount, 14);
+
+	[self measureBlock:^{
+		NSPoint_nearestPixels(points, results, kReductionCount, 2.0);
+	}];
+
+	free(points);
+	free(results);
+}
+
 
 #pragma mark - Description
 
@@ -203,4 +657,38 @@
 	XCTAssertEqualObjects(result, expected, @"Wrong description");
 }
 
+- (void)testDescription_buffer
+{
+	NSPoint initial = NSPoint_init(3.5, -4.0);
+	char buffer[128];
+
+	NSUInteger length = NSPoint_getDescription(initial, buffer, sizeof(buffer));
+
+	XCTAssertEqual(length, strlen("{3.5, -4}"), @"Wrong length.");
+	XCTAssertEqual(strcmp(buffer, "{3.5, -4}"), 0, @"Wrong description.");
+	XCTAssertEqualObjects(@(buffer), NSPoint_description(initial), @"The description should match the string description.");
+}
+
+- (void)testDescription_bufferTruncation
+{
+	NSPoint initial = NSPoint_init(3.5, -4.0);
+	char buffer[4] = { 'x', 'x', 'x', 'x' };
+
+	XCTAssertEqual(NSPoint_getDescription(initial, NULL, 0), strlen("{3.5, -4}"), @"Wrong length.");
+	XCTAssertEqual(NSPoint_getDescription(initial, buffer, sizeof(buffer)), strlen("{3.5, -4}"), @"Wrong length.");
+	XCTAssertEqual(strncmp(buffer, "{3.5, -4}", 3), 0, @"Wrong truncated description.");
+	XCTAssertEqual(buffer[3], '\0', @"The truncated description should be terminated.");
+}
+
+- (void)testDescription_bufferRoundTrip
+{
+	NSPoint initial = NSPoint_init(0.1, 1.0 / 3.0);
+	char buffer[128];
+
+	NSUInteger length = NSPoint_getDescription(initial, buffer, sizeof(buffer));
+
+	CBHAssertEqualPoints(NSPoint_initWithBytes(buffer, length, NULL, NULL), initial);
+	CBHAssertEqualPoints(NSPoint_initWithString(@(buffer)), initial);
+}
+
 @end
@@ -68,6 +68,50 @@
 }
 
 
+#pragma mark - Parsing Ranges
+
+- (void)testParsing_matchesString
+{
+	NSArray<NSString *> *strings = @[@"{2, 4}", @"{-2, 4}", @"{2.5, 4}", @"7", @"", @"{}", @"no numbers", @"{ 12 , 34 }"];
+
+	for (NSString *string in strings)
+	{
+		const char *bytes = [string UTF8String];
+		NSRange range = NSRange_initWithBytes(bytes, strlen(bytes), NULL, NULL);
+
+		CBHAssertEqualRanges(range, NSRange_initWithString(string));
+	}
+}
+
+- (void)testParsing_status
+{
+	NSUInteger consumed = 0;
+	CBHParseStatus status = CBHParseStatusSuccess;
+
+	NSRange_initWithBytes("{1, 2} {3, 4}", 12, &consumed, &status);
+	XCTAssertEqual(status, CBHParseStatusSuccess, @"Wrong status.");
+	XCTAssertEqual(consumed, 5UL, @"Parsing should stop after the last component.");
+
+	NSRange_initWithBytes("{}", 2, &consumed, &status);
+	XCTAssertEqual(status, CBHParseStatusMissingComponents, @"Wrong status.");
+	XCTAssertEqual(consumed, 2UL, @"Parsing should read everything when components are missing.");
+}
+
+- (void)testParsing_lines
+{
+	const char *bytes = "{1, 2}\n{3}\n";
+	NSRange ranges[2];
+	CBHParseStatus statuses[2];
+
+	XCTAssertEqual(NSRange_parseLines(bytes, strlen(bytes), ranges, statuses, 2), 2UL, @"Wrong line count.");
+	XCTAssertEqual(NSRange_parseLines(bytes, strlen(bytes), ranges, NULL, 1), 2UL, @"Lines past the capacity should still be counted.");
+	CBHAssertEqualRanges(ranges[0], NSRange_init(1, 2));
+	XCTAssertEqual(statuses[0], CBHParseStatusSuccess, @"Wrong status.");
+	CBHAssertEqualRanges(ranges[1], NSRange_init(3, 0));
+	XCTAssertEqual(statuses[1], CBHParseStatusMissingComponents, @"Wrong status.");
+}
+
+
 #pragma mark - Calculated Properties
 
 - (void)testLocationIn_true
@@ -135,4 +179,38 @@
 	XCTAssertEqualObjects(result, expected, @"Wrong description");
 }
 
+- (void)testDescription_buffer
+{
+	NSRange initial = NSRange_init(2, 4);
+	char buffer[128];
+
+	NSUInteger length = NSRange_getDescription(initial, buffer, sizeof(buffer));
+
+	XCTAssertEqual(length, strlen("{2, 4}"), @"Wrong length.");
+	XCTAssertEqual(strcmp(buffer, "{2, 4}"), 0, @"Wrong description.");
+	XCTAssertEqualObjects(@(buffer), NSRange_description(initial), @"The description should match the string description.");
+}
+
+- (void)testDescription_bufferTruncation
+{
+	NSRange initial = NSRange_init(2, 4);
+	char buffer[4] = { 'x', 'x', 'x', 'x' };
+
+	XCTAssertEqual(NSRange_getDescription(initial, NULL, 0), strlen("{2, 4}"), @"Wrong length.");
+	XCTAssertEqual(NSRange_getDescription(initial, buffer, sizeof(buffer)), strlen("{2, 4}"), @"Wrong length.");
+	XCTAssertEqual(strncmp(buffer, "{2, 4}", 3), 0, @"Wrong truncated description.");
+	XCTAssertEqual(buffer[3], '\0', @"The truncated description should be terminated.");
+}
+
+- (void)testDescription_bufferRoundTrip
+{
+	NSRange initial = NSRange_init(NSNotFound, 7);
+	char buffer[128];
+
+	NSUInteger length = NSRange_getDescription(initial, buffer, sizeof(buffer));
+
+	CBHAssertEqualRanges(NSRange_initWithBytes(buffer, length, NULL, NULL), initial);
+	CBHAssertEqualRanges(NSRange_initWithString(@(buffer)), initial);
+}
+
 @end
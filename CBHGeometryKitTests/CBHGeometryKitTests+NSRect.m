@@ -84,6 +84,50 @@
 }
 
 
+#pragma mark - Parsing Rects
+
+- (void)testParsing_matchesString
+{
+	NSArray<NSString *> *strings = @[@"{{1, 2}, {3.0, 4.0}}", @"{{-1.5, +2.25}, {.5, -.75}}", @"{{1e3, 2.5E-2}, {0.1, 0.7}}", @"{{1, 2}}", @"", @"{{}, {}}", @"no numbers", @"{{1234567.891011, 0.000001}, {3, 4}}"];
+
+	for (NSString *string in strings)
+	{
+		const char *bytes = [string UTF8String];
+		NSRect rect = NSRect_initWithBytes(bytes, strlen(bytes), NULL, NULL);
+
+		CBHAssertEqualRects(rect, NSRect_initWithString(string));
+	}
+}
+
+- (void)testParsing_status
+{
+	NSUInteger consumed = 0;
+	CBHParseStatus status = CBHParseStatusSuccess;
+
+	NSRect_initWithBytes("{{1, 2}, {3, 4}} {{5, 6}, {7, 8}}", 33, &consumed, &status);
+	XCTAssertEqual(status, CBHParseStatusSuccess, @"Wrong status.");
+	XCTAssertEqual(consumed, 15UL, @"Parsing should stop after the last component.");
+
+	NSRect_initWithBytes("{}", 2, &consumed, &status);
+	XCTAssertEqual(status, CBHParseStatusMissingComponents, @"Wrong status.");
+	XCTAssertEqual(consumed, 2UL, @"Parsing should read everything when components are missing.");
+}
+
+- (void)testParsing_lines
+{
+	const char *bytes = "{{1, 2}, {3, 4}}\r\n{{5, 6}}";
+	NSRect rects[2];
+	CBHParseStatus statuses[2];
+
+	XCTAssertEqual(NSRect_parseLines(bytes, strlen(bytes), rects, statuses, 2), 2UL, @"Wrong line count.");
+	XCTAssertEqual(NSRect_parseLines(bytes, strlen(bytes), rects, NULL, 1), 2UL, @"Lines past the capacity should still be counted.");
+	CBHAssertEqualRects(rects[0], NSRect_init(1.0, 2.0, 3.0, 4.0));
+	XCTAssertEqual(statuses[0], CBHParseStatusSuccess, @"Wrong status.");
+	CBHAssertEqualRects(rects[1], NSRect_init(5.0, 6.0, 0.0, 0.0));
+	XCTAssertEqual(statuses[1], CBHParseStatusMissingComponents, @"Wrong status.");
+}
+
+
 #pragma mark - Checking Rects
 
 - (void)testEquality_same
@@ -529,6 +573,237 @@
 }
 
 
+#pragma mark - Batched Reductions
+
+// Spans several parallel chunks and ends part way through one.
+static const NSUInteger kReductionCount = 300001;
+
+// Integral coordinates, so folding with `NSRect_union()` rounds nothing. Some rects are empty or inverted.
+static void CBHFillRects(NSRect *rects, NSUInteger count, unsigned int seed)
+{
+	srand(seed);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		rects[i] = NSRect_init(rand() % 20000 - 10000, rand() % 20000 - 10000, rand() % 400 - 50, rand() % 400 - 50);
+	}
+}
+
+- (void)testBatchedReduction_union
+{
+	NSUInteger counts[] = { 0, 1, 2, 3, 37, kReductionCount };
+	NSRect *rects = malloc(sizeof(NSRect) * kReductionCount);
+	CBHFillRects(rects, kReductionCount, 1);
+
+	for (NSUInteger c = 0; c < sizeof(counts) / sizeof(*counts); ++c)
+	{
+		NSRect expected = NSRect_initEmpty();
+		for (NSUInteger i = 0; i < counts[c]; ++i)
+		{
+			expected = NSRect_union(expected, rects[i]);
+		}
+
+		CBHAssertEqualRects(NSRect_unionOfRects(rects, counts[c]), expected);
+	}
+
+	free(rects);
+}
+
+- (void)testBatchedReduction_unionOfEmptyRects
+{
+	NSRect rects[] = { NSRect_init(1.0, 2.0, 0.0, 5.0), NSRect_init(3.0, 4.0, 5.0, -1.0), NSRect_init(6.0, 7.0, NAN, 1.0) };
+
+	CBHAssertEqualRects(NSRect_unionOfRects(rects, 3), NSRect_initEmpty());
+}
+
+- (void)testBatchedReduction_boundingRectOfPoints
+{
+	NSPoint points[] = { NSPoint_init(1.0, -2.0), NSPoint_init(-3.0, 4.0), NSPoint_init(5.0, 0.5) };
+
+	CBHAssertEqualRects(NSRect_boundingRectOfPoints(points, 3), NSRect_init(-3.0, -2.0, 8.0, 6.0));
+	CBHAssertEqualRects(NSRect_boundingRectOfPoints(points, 1), NSRect_init(1.0, -2.0, 0.0, 0.0));
+	CBHAssertEqualRects(NSRect_boundingRectOfPoints(points, 0), NSRect_initEmpty());
+}
+
+
+#pragma mark - Batched Pixel Alignment
+
+// Quarters land exactly on halfway cases at every scale tested. Some rects are empty or inverted, and some have a NaN
+// width or height.
+static void CBHFillFractionalRects(NSRect *rects, NSUInteger count, unsigned int seed)
+{
+	srand(seed);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		const CGFloat fraction = (rand() % 2) ? 0.25 * (rand() % 4) : (CGFloat)rand() / (CGFloat)RAND_MAX;
+		rects[i] = NSRect_init(rand() % 2000 - 1000 + fraction, rand() % 2000 - 1000 - fraction, rand() % 400 - 50 + fraction, rand() % 400 - 50 - fraction);
+
+		if ( i % 37 == 0 ) { rects[i].size.width = NAN; }
+		if ( i % 37 == 1 ) { rects[i].size.height = NAN; }
+	}
+}
+
+- (void)assertBatch:(void (*)(const NSRect *, NSRect *, NSUInteger, CGFloat))batch matchesScalar:(NSRect (*)(NSRect))scalar
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kReductionCount);
+	NSRect *results = malloc(sizeof(NSRect) * kReductionCount);
+	CBHFillFractionalRects(rects, kReductionCount, 3);
+
+	batch(rects, results, kReductionCount, 1.0);
+
+	for (NSUInteger i = 0; i < kReductionCount; ++i)
+	{
+		const NSRect expected = scalar(rects[i]);
+		XCTAssertEqual(memcmp(&results[i], &expected, sizeof(NSRect)), 0, @"The rects should be identical - result:%@ expected:%@", NSRect_description(results[i]), NSRect_description(expected));
+		if ( memcmp(&results[i], &expected, sizeof(NSRect)) != 0 ) { break; }
+	}
+
+	free(rects);
+	free(results);
+}
+
+- (void)testBatchedPixelAlignment_matchesScalar
+{
+	[self assertBatch:NSRect_integralRects matchesScalar:NSRect_integral];
+	[self assertBatch:NSRect_truncateRects matchesScalar:NSRect_truncate];
+	[self assertBatch:NSRect_roundRects matchesScalar:NSRect_round];
+	[self assertBatch:NSRect_alignRectsWithPixels matchesScalar:NSRect_alignWithPixels];
+}
+
+- (void)testBatchedPixelAlignment_scaled
+{
+	NSRect rects[] = { NSRect_init(1.2, -1.2, 3.3, 0.74), NSRect_init(0.25, 0.75, -1.0, 2.0) };
+	NSRect results[2];
+
+	NSRect_integralRects(rects, results, 2, 2.0);
+	CBHAssertEqualRects(results[0], NSRect_init(1.0, -1.5, 3.5, 1.5));
+	CBHAssertEqualRects(results[1], NSRect_initEmpty());
+
+	NSRect_truncateRects(rects, results, 2, 2.0);
+	CBHAssertEqualRects(results[0], NSRect_init(1.0, -1.0, 3.0, 0.5));
+
+	NSRect_roundRects(rects, results, 2, 2.0);
+	CBHAssertEqualRects(results[0], NSRect_init(1.0, -1.0, 3.5, 0.5));
+	CBHAssertEqualRects(results[1], NSRect_init(0.5, 1.0, -1.0, 2.0));
+
+	NSRect_alignRectsWithPixels(rects, results, 2, 2.0);
+	CBHAssertEqualRects(results[0], NSRect_init(1.25, -0.75, 3.0, 0.5));
+}
+
+- (void)testBatchedPixelAlignment_inPlace
+{
+	NSRect rects[] = { NSRect_init(1.2, -1.2, 3.3, 0.74), NSRect_init(0.25, 0.75, 1.0, 2.0), NSRect_init(-7.5, 2.5, 4.5, 3.5) };
+	NSRect expected[3];
+
+	NSRect_roundRects(rects, expected, 3, 3.0);
+	NSRect_roundRects(rects, rects, 3, 3.0);
+
+	XCTAssertEqual(memcmp(rects, expected, sizeof(rects)), 0, @"The rects should be the same.");
+}
+
+
+#pragma mark - Performance
+
+static const NSUInteger kPerformanceLineCount = 1 << 18;
+
+static NSString *CBHRectLines(NSUInteger count)
+{
+	NSMutableString *lines = [NSMutableString string];
+	srand(9);
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		[lines appendFormat:@"{{%d.5, %d}, {%.3f, %d.25}}\n", rand() % 4000, rand() % 4000, (double)rand() / 1e6, rand() % 100];
+	}
+
+	return lines;
+}
+
+- (void)testPerformance_initWithString
+{
+	NSArray<NSString *> *lines = [CBHRectLines(kPerformanceLineCount) componentsSeparatedByString:@"\n"];
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceLineCount);
+
+	[self measureBlock:^{
+		for (NSUInteger i = 0; i < kPerformanceLineCount; ++i)
+		{
+			rects[i] = NSRect_initWithString(lines[i]);
+		}
+	}];
+
+	free(rects);
+}
+
+- (void)testPerformance_parseLines
+{
+	NSData *data = [CBHRectLines(kPerformanceLineCount) dataUsingEncoding:NSUTF8StringEncoding];
+	NSRect *rects = malloc(sizeof(NSRect) * kPerformanceLineCount);
+
+	[self measureBlock:^{
+		NSRect_parseLines([data bytes], [data length], rects, NULL, kPerformanceLineCount);
+	}];
+
+	free(rects);
+}
+
+- (void)testPerformance_union
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kReductionCount);
+	CBHFillRects(rects, kReductionCount, 2);
+
+	[self measureBlock:^{
+		NSRect result = NSRect_initEmpty();
+		for (NSUInteger i = 0; i < kReductionCount; ++i)
+		{
+			result = NSRect_union(result, rects[i]);
+		}
+	}];
+
+	free(rects);
+}
+
+- (void)testPerformance_unionOfRects
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kReductionCount);
+	CBHFillRects(rects, kReductionCount, 2);
+
+	[self measureBlock:^{
+		NSRect_unionOfRects(rects, kReductionCount);
+	}];
+
+	free(rects);
+}
+
+
+- (void)testPerformance_alignWithPixels
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kReductionCount);
+	NSRect *results = malloc(sizeof(NSRect) * kReductionCount);
+	CBHFillFractionalRects(rects, kReductionCount, 4);
+
+	[self measureBlock:^{
+		for (NSUInteger i = 0; i < kReductionCount; ++i)
+		{
+			results[i] = NSRect_alignWithPixels(rects[i]);
+		}
+	}];
+
+	free(rects);
+	free(results);
+}
+
+- (void)testPerformance_alignRectsWithPixels
+{
+	NSRect *rects = malloc(sizeof(NSRect) * kReductionCount);
+	NSRect *results = malloc(sizeof(NSRect) * kReductionCount);
+	CBHFillFractionalRects(rects, kReductionCount, 4);
+
+	[self measureBlock:^{
+		NSRect_alignRectsWithPixels(rects, results, kReductionCount, 2.0);
+	}];
+
+	free(rects);
+	free(results);
+}
+
 
 #pragma mark - Description
 
@@ -552,4 +827,38 @@
 	XCTAssertEqualObjects(result, expected, @"Wrong description");
 }
 
+- (void)testDescription_buffer
+{
+	NSRect initial = NSRect_init(1.0, 2.5, 3.0, 4.25);
+	char buffer[128];
+
+	NSUInteger length = NSRect_getDescription(initial, buffer, sizeof(buffer));
+
+	XCTAssertEqual(length, strlen("{{1, 2.5}, {3, 4.25}}"), @"Wrong length.");
+	XCTAssertEqual(strcmp(buffer, "{{1, 2.5}, {3, 4.25}}"), 0, @"Wrong description.");
+	XCTAssertEqualObjects(@(buffer), NSRect_description(initial), @"The description should match the string description.");
+}
+
+- (void)testDescription_bufferTruncation
+{
+	NSRect initial = NSRect_init(1.0, 2.5, 3.0, 4.25);
+	char buffer[4] = { 'x', 'x', 'x', 'x' };
+
+	XCTAssertEqual(NSRect_getDescription(initial, NULL, 0), strlen("{{1, 2.5}, {3, 4.25}}"), @"Wrong length.");
+	XCTAssertEqual(NSRect_getDescription(initial, buffer, sizeof(buffer)), strlen("{{1, 2.5}, {3, 4.25}}"), @"Wrong length.");
+	XCTAssertEqual(strncmp(buffer, "{{1, 2.5}, {3, 4.25}}", 3), 0, @"Wrong truncated description.");
+	XCTAssertEqual(buffer[3], '\0', @"The truncated description should be terminated.");
+}
+
+- (void)testDescription_bufferRoundTrip
+{
+	NSRect initial = NSRect_init(0.1, 1.0 / 3.0, 1e-7, 123456789.123);
+	char buffer[128];
+
+	NSUInteger length = NSRect_getDescription(initial, buffer, sizeof(buffer));
+
+	CBHAssertEqualRects(NSRect_initWithBytes(buffer, length, NULL, NULL), initial);
+	CBHAssertEqualRects(NSRect_initWithString(@(buffer)), initial);
+}
+
 @end
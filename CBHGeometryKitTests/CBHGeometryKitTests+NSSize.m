@@ -58,6 +58,50 @@
 }
 
 
+#pragma mark - Parsing Sizes
+
+- (void)testParsing_matchesString
+{
+	NSArray<NSString *> *strings = @[@"{2, 4.0}", @"{-1.5, +2.25}", @"{.5, -.75}", @"{1e3, 2.5E-2}", @"3", @"", @"{}", @"no numbers", @"{0.1, 0.7}", @"{1234567.891011, 0.000001}"];
+
+	for (NSString *string in strings)
+	{
+		const char *bytes = [string UTF8String];
+		NSSize size = NSSize_initWithBytes(bytes, strlen(bytes), NULL, NULL);
+
+		CBHAssertEqualSizes(size, NSSize_initWithString(string));
+	}
+}
+
+- (void)testParsing_status
+{
+	NSUInteger consumed = 0;
+	CBHParseStatus status = CBHParseStatusSuccess;
+
+	NSSize_initWithBytes("{1, 2} {3, 4}", 12, &consumed, &status);
+	XCTAssertEqual(status, CBHParseStatusSuccess, @"Wrong status.");
+	XCTAssertEqual(consumed, 5UL, @"Parsing should stop after the last component.");
+
+	NSSize_initWithBytes("{}", 2, &consumed, &status);
+	XCTAssertEqual(status, CBHParseStatusMissingComponents, @"Wrong status.");
+	XCTAssertEqual(consumed, 2UL, @"Parsing should read everything when components are missing.");
+}
+
+- (void)testParsing_lines
+{
+	const char *bytes = "{1, 2}\n{3}\n";
+	NSSize sizes[2];
+	CBHParseStatus statuses[2];
+
+	XCTAssertEqual(NSSize_parseLines(bytes, strlen(bytes), sizes, statuses, 2), 2UL, @"Wrong line count.");
+	XCTAssertEqual(NSSize_parseLines(bytes, strlen(bytes), sizes, NULL, 1), 2UL, @"Lines past the capacity should still be counted.");
+	CBHAssertEqualSizes(sizes[0], NSSize_init(1.0, 2.0));
+	XCTAssertEqual(statuses[0], CBHParseStatusSuccess, @"Wrong status.");
+	CBHAssertEqualSizes(sizes[1], NSSize_init(3.0, 0.0));
+	XCTAssertEqual(statuses[1], CBHParseStatusMissingComponents, @"Wrong status.");
+}
+
+
 #pragma mark - Checking Sizes
 
 - (void)testEquality_same
@@ -260,4 +304,38 @@
 	XCTAssertEqualObjects(result, expected, @"Wrong description");
 }
 
+- (void)testDescription_buffer
+{
+	NSSize initial = NSSize_init(3.5, 4.0);
+	char buffer[128];
+
+	NSUInteger length = NSSize_getDescription(initial, buffer, sizeof(buffer));
+
+	XCTAssertEqual(length, strlen("{3.5, 4}"), @"Wrong length.");
+	XCTAssertEqual(strcmp(buffer, "{3.5, 4}"), 0, @"Wrong description.");
+	XCTAssertEqualObjects(@(buffer), NSSize_description(initial), @"The description should match the string description.");
+}
+
+- (void)testDescription_bufferTruncation
+{
+	NSSize initial = NSSize_init(3.5, 4.0);
+	char buffer[4] = { 'x', 'x', 'x', 'x' };
+
+	XCTAssertEqual(NSSize_getDescription(initial, NULL, 0), strlen("{3.5, 4}"), @"Wrong length.");
+	XCTAssertEqual(NSSize_getDescription(initial, buffer, sizeof(buffer)), strlen("{3.5, 4}"), @"Wrong length.");
+	XCTAssertEqual(strncmp(buffer, "{3.5, 4}", 3), 0, @"Wrong truncated description.");
+	XCTAssertEqual(buffer[3], '\0', @"The truncated description should be terminated.");
+}
+
+- (void)testDescription_bufferRoundTrip
+{
+	NSSize initial = NSSize_init(0.1, 1.0 / 3.0);
+	char buffer[128];
+
+	NSUInteger length = NSSize_getDescription(initial, buffer, sizeof(buffer));
+
+	CBHAssertEqualSizes(NSSize_initWithBytes(buffer, length, NULL, NULL), initial);
+	CBHAssertEqualSizes(NSSize_initWithString(@(buffer)), initial);
+}
+
 @end